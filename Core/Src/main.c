@@ -21,6 +21,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "crc_port.h"
 
 /* USER CODE END Includes */
 
@@ -112,6 +113,7 @@ void initThread(void *pvParameter) {
     user_params_t *params = flash_params_get_current();
     dwt_init();
     flash_params_init();
+    crc_port_init();
     event_bus_init();
     gps_app_start();
 
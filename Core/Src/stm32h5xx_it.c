@@ -22,6 +22,7 @@
 #include "stm32h5xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "uart_dma_hw.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -181,7 +182,8 @@ void DebugMon_Handler(void) {
   */
 void GPDMA1_Channel4_IRQHandler(void) {
     /* USER CODE BEGIN GPDMA1_Channel4_IRQn 0 */
-
+    uart_dma_hw_rx_dma_irq(UART_DMA_LTE);
+    return;
     /* USER CODE END GPDMA1_Channel4_IRQn 0 */
     HAL_DMA_IRQHandler(&handle_GPDMA1_Channel4);
     /* USER CODE BEGIN GPDMA1_Channel4_IRQn 1 */
@@ -194,7 +196,8 @@ void GPDMA1_Channel4_IRQHandler(void) {
   */
 void GPDMA1_Channel5_IRQHandler(void) {
     /* USER CODE BEGIN GPDMA1_Channel5_IRQn 0 */
-
+    uart_dma_hw_rx_dma_irq(UART_DMA_BLE);
+    return;
     /* USER CODE END GPDMA1_Channel5_IRQn 0 */
     HAL_DMA_IRQHandler(&handle_GPDMA1_Channel5);
     /* USER CODE BEGIN GPDMA1_Channel5_IRQn 1 */
@@ -207,7 +210,8 @@ void GPDMA1_Channel5_IRQHandler(void) {
   */
 void GPDMA1_Channel6_IRQHandler(void) {
     /* USER CODE BEGIN GPDMA1_Channel6_IRQn 0 */
-
+    uart_dma_hw_rx_dma_irq(UART_DMA_RS485);
+    return;
     /* USER CODE END GPDMA1_Channel6_IRQn 0 */
     HAL_DMA_IRQHandler(&handle_GPDMA1_Channel6);
     /* USER CODE BEGIN GPDMA1_Channel6_IRQn 1 */
@@ -272,7 +276,8 @@ void TIM6_IRQHandler(void) {
   */
 void USART1_IRQHandler(void) {
     /* USER CODE BEGIN USART1_IRQn 0 */
-
+    uart_dma_hw_usart_irq(UART_DMA_LTE);
+    return;
     /* USER CODE END USART1_IRQn 0 */
     HAL_UART_IRQHandler(&huart1);
     /* USER CODE BEGIN USART1_IRQn 1 */
@@ -285,7 +290,8 @@ void USART1_IRQHandler(void) {
   */
 void USART2_IRQHandler(void) {
     /* USER CODE BEGIN USART2_IRQn 0 */
-
+    uart_dma_hw_usart_irq(UART_DMA_GPS);
+    return;
     /* USER CODE END USART2_IRQn 0 */
     HAL_UART_IRQHandler(&huart2);
     /* USER CODE BEGIN USART2_IRQn 1 */
@@ -298,7 +304,8 @@ void USART2_IRQHandler(void) {
   */
 void USART3_IRQHandler(void) {
     /* USER CODE BEGIN USART3_IRQn 0 */
-
+    uart_dma_hw_usart_irq(UART_DMA_LORA);
+    return;
     /* USER CODE END USART3_IRQn 0 */
     HAL_UART_IRQHandler(&huart3);
     /* USER CODE BEGIN USART3_IRQn 1 */
@@ -311,7 +318,8 @@ void USART3_IRQHandler(void) {
   */
 void UART4_IRQHandler(void) {
     /* USER CODE BEGIN UART4_IRQn 0 */
-
+    uart_dma_hw_usart_irq(UART_DMA_BLE);
+    return;
     /* USER CODE END UART4_IRQn 0 */
     HAL_UART_IRQHandler(&huart4);
     /* USER CODE BEGIN UART4_IRQn 1 */
@@ -324,7 +332,8 @@ void UART4_IRQHandler(void) {
   */
 void UART5_IRQHandler(void) {
     /* USER CODE BEGIN UART5_IRQn 0 */
-
+    uart_dma_hw_usart_irq(UART_DMA_RS485);
+    return;
     /* USER CODE END UART5_IRQn 0 */
     HAL_UART_IRQHandler(&huart5);
     /* USER CODE BEGIN UART5_IRQn 1 */
@@ -350,7 +359,8 @@ void USART6_IRQHandler(void) {
   */
 void GPDMA2_Channel4_IRQHandler(void) {
     /* USER CODE BEGIN GPDMA2_Channel4_IRQn 0 */
-
+    uart_dma_hw_rx_dma_irq(UART_DMA_GPS);
+    return;
     /* USER CODE END GPDMA2_Channel4_IRQn 0 */
     HAL_DMA_IRQHandler(&handle_GPDMA2_Channel4);
     /* USER CODE BEGIN GPDMA2_Channel4_IRQn 1 */
@@ -363,7 +373,8 @@ void GPDMA2_Channel4_IRQHandler(void) {
   */
 void GPDMA2_Channel5_IRQHandler(void) {
     /* USER CODE BEGIN GPDMA2_Channel5_IRQn 0 */
-
+    uart_dma_hw_rx_dma_irq(UART_DMA_LORA);
+    return;
     /* USER CODE END GPDMA2_Channel5_IRQn 0 */
     HAL_DMA_IRQHandler(&handle_GPDMA2_Channel5);
     /* USER CODE BEGIN GPDMA2_Channel5_IRQn 1 */
@@ -376,7 +387,8 @@ void GPDMA2_Channel5_IRQHandler(void) {
   */
 void GPDMA2_Channel6_IRQHandler(void) {
     /* USER CODE BEGIN GPDMA2_Channel6_IRQn 0 */
-
+    uart_dma_hw_rx_dma_irq(UART_DMA_RS232);
+    return;
     /* USER CODE END GPDMA2_Channel6_IRQn 0 */
     HAL_DMA_IRQHandler(&handle_GPDMA2_Channel6);
     /* USER CODE BEGIN GPDMA2_Channel6_IRQn 1 */
@@ -389,7 +401,8 @@ void GPDMA2_Channel6_IRQHandler(void) {
   */
 void UART8_IRQHandler(void) {
     /* USER CODE BEGIN UART8_IRQn 0 */
-
+    uart_dma_hw_usart_irq(UART_DMA_RS232);
+    return;
     /* USER CODE END UART8_IRQn 0 */
     HAL_UART_IRQHandler(&huart8);
     /* USER CODE BEGIN UART8_IRQn 1 */
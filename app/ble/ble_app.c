@@ -54,8 +54,8 @@ void ble_app_start(void) {
         return;
     }
 
-    /* 인터럽트에서 사용할 큐 설정 */
-    ble_port_set_queue(ble_get_rx_queue(&ble_instance.ble));
+    /* 인터럽트에서 알림을 보낼 RX 태스크 설정 */
+    ble_port_set_task(&ble_instance.ble.rx_task);
 
     /* BLE 핸들 포인터 전달 (ble_port에서 링버퍼 접근용) */
     ble_port_set_ble_handle(&ble_instance.ble);
@@ -78,12 +78,15 @@ void ble_app_stop(void) {
 
     LOG_INFO("BLE 앱 종료 시작");
 
-    /* 포트 종료 */
-    ble_port_stop(&ble_instance.ble);
+    /* RX 알림 해제 (ISR이 종료 중인 태스크를 깨우지 않게) */
+    ble_port_set_task(NULL);
 
-    /* RX 태스크 종료 (lib/ble에서 관리) */
+    /* RX 태스크 종료 (lib/ble에서 관리, RX 링 소비자를 먼저 멈춤) */
     ble_rx_task_stop(&ble_instance.ble);
 
+    /* 포트 종료 (RX 링 리셋) */
+    ble_port_stop(&ble_instance.ble);
+
     ble_instance.enabled = false;
 
     LOG_INFO("BLE 앱 종료 완료");
@@ -3,16 +3,16 @@
 
 /**
  * @file ble_port.h
- * @brief BLE UART 포트 (STM32 HAL)
+ * @brief BLE UART 포트 (uart_dma_port 인스턴스)
  *
- * UART5 (PC12 TX, PD2 RX) + DMA1_Stream0
+ * UART4 + GPDMA1 Ch5 (RX) / Ch2 (TX), uart_dma_hw 표 참고
  */
 
 #include <stdbool.h>
 #include <stdint.h>
 #include "ble.h"
 #include "FreeRTOS.h"
-#include "queue.h"
+#include "task.h"
 
 /**
  * @brief BLE 포트 초기화
@@ -52,10 +52,10 @@ uint32_t ble_port_get_rx_pos(void);
 char *ble_port_get_recv_buf(void);
 
 /**
- * @brief RX 신호 큐 설정
- * @param queue RX 큐
+ * @brief RX 알림 대상 태스크 설정
+ * @param task 태스크 핸들 변수의 주소 (ble_t.rx_task, NULL: 알림 해제)
  */
-void ble_port_set_queue(QueueHandle_t queue);
+void ble_port_set_task(TaskHandle_t *task);
 
 /**
  * @brief BLE 핸들 설정 (링버퍼 접근용)
@@ -64,12 +64,12 @@ void ble_port_set_queue(QueueHandle_t queue);
 void ble_port_set_ble_handle(ble_t *ble);
 
 /**
- * @brief Polling 방식 라인 수신 (초기화용)
+ * @brief RX 링에서 한 줄 수신 (모듈 설정용, 포트 시작 후 태스크 컨텍스트)
  * @param buf 버퍼
  * @param buf_size 버퍼 크기
  * @param timeout_ms 타임아웃 (ms)
  * @return 수신 바이트 수, -1: 타임아웃
  */
-int ble_uart5_recv_line_poll(char *buf, size_t buf_size, uint32_t timeout_ms);
+int ble_port_recv_line(char *buf, size_t buf_size, uint32_t timeout_ms);
 
 #endif /* BLE_PORT_H */
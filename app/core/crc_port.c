@@ -0,0 +1,110 @@
+/**
+ * @file crc_port.c
+ * @brief STM32H5 CRC 주변장치 → crc32_hal_ops_t
+ *
+ * 주변장치는 MSB 우선 CRC32(0x04C11DB7)만 계산하므로 입력/출력 비트 반전으로
+ * reflected CRC32를 만듦:
+ *  - REV_IN 바이트 단위, REV_OUT 사용
+ *  - 초기값은 이전 CRC를 비트 반전해서 INIT에 기록 (이어서 계산 가능)
+ *  - 32비트 쓰기는 첫 바이트가 최상위 (big-endian으로 묶음, HAL CRC_Handle_8과 동일)
+ *
+ * CRC는 하나뿐이라 사용 중이면 false를 돌려주고 호출자가 소프트웨어로 계산.
+ */
+
+#include "crc_port.h"
+#include "crc.h"
+#include "main.h"
+
+#define CRC_POLY_32 0x04C11DB7u
+
+static volatile bool crc_busy;
+
+static inline uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) |
+           (uint32_t)p[3];
+}
+
+#if CRC_PORT_DMA_MIN_LEN > 0
+/**
+ * @brief 4바이트 정렬된 워드를 GPDMA로 DR에 공급 (완료까지 폴링)
+ *
+ * 메모리의 little-endian 워드를 그대로 보내므로 그동안 REV_IN을 워드 단위로 바꿈
+ */
+static bool crc_dma_feed(const uint8_t *p, size_t words) {
+    DMA_Channel_TypeDef *ch = GPDMA1_Channel0_NS;
+    bool ok;
+
+    CRC->CR = (CRC->CR & ~CRC_CR_REV_IN) | CRC_CR_REV_IN_0 | CRC_CR_REV_IN_1;
+
+    ch->CFCR = DMA_CFCR_TCF | DMA_CFCR_HTF | DMA_CFCR_DTEF | DMA_CFCR_ULEF | DMA_CFCR_USEF;
+    ch->CTR1 = DMA_CTR1_SINC | DMA_CTR1_SDW_LOG2_1 | DMA_CTR1_DDW_LOG2_1;
+    ch->CTR2 = DMA_CTR2_SWREQ;
+    ch->CBR1 = (uint32_t)(words * 4) & DMA_CBR1_BNDT;
+    ch->CSAR = (uint32_t)p;
+    ch->CDAR = (uint32_t)&CRC->DR;
+    ch->CLLR = 0;
+    ch->CCR = DMA_CCR_EN;
+
+    while ((ch->CSR & (DMA_CSR_TCF | DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF)) == 0) {
+    }
+    ok = (ch->CSR & DMA_CSR_TCF) != 0;
+
+    ch->CFCR = DMA_CFCR_TCF | DMA_CFCR_HTF | DMA_CFCR_DTEF | DMA_CFCR_ULEF | DMA_CFCR_USEF;
+    CRC->CR = (CRC->CR & ~CRC_CR_REV_IN) | CRC_CR_REV_IN_0;
+    return ok;
+}
+#endif
+
+static bool crc_hw_calc(uint32_t *crc, const void *data, size_t len) {
+    const uint8_t *p = data;
+
+    if (__atomic_test_and_set(&crc_busy, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+
+    CRC->INIT = __RBIT(*crc);
+    CRC->CR |= CRC_CR_RESET;
+
+#if CRC_PORT_DMA_MIN_LEN > 0
+    if (len >= CRC_PORT_DMA_MIN_LEN && ((uint32_t)p & 3u) == 0) {
+        size_t words = len / 4;
+
+        if (!crc_dma_feed(p, words)) {
+            __atomic_clear(&crc_busy, __ATOMIC_RELEASE);
+            return false;
+        }
+        p += words * 4;
+        len -= words * 4;
+    }
+#endif
+
+    for (; len >= 4; len -= 4, p += 4) {
+        CRC->DR = load_be32(p);
+    }
+    for (; len > 0; len--, p++) {
+        *(volatile uint8_t *)&CRC->DR = *p;
+    }
+
+    *crc = CRC->DR;
+    __atomic_clear(&crc_busy, __ATOMIC_RELEASE);
+    return true;
+}
+
+static const crc32_hal_ops_t crc_hw_ops = {
+    .calc = crc_hw_calc,
+};
+
+void crc_port_init(void) {
+    RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+    (void)RCC->AHB1ENR;
+
+#if CRC_PORT_DMA_MIN_LEN > 0
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPDMA1EN;
+    (void)RCC->AHB1ENR;
+#endif
+
+    CRC->POL = CRC_POLY_32;
+    CRC->CR = CRC_CR_REV_IN_0 | CRC_CR_REV_OUT; /* POLYSIZE 00 = 32비트 */
+
+    crc32_set_hal(&crc_hw_ops);
+}
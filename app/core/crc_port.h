@@ -0,0 +1,20 @@
+#ifndef CRC_PORT_H
+#define CRC_PORT_H
+
+/**
+ * @brief CRC DMA 공급 최소 길이 (0이면 DMA 사용 안 함, CPU가 DR에 직접 씀)
+ *
+ * GPDMA1 Channel 0 사용. 프레임이 짧으면 채널 설정 비용이 더 큼
+ */
+#ifndef CRC_PORT_DMA_MIN_LEN
+#define CRC_PORT_DMA_MIN_LEN 0
+#endif
+
+/**
+ * @brief CRC 주변장치 초기화 및 crc32 하드웨어 등록
+ *
+ * Unicore CRC32(reflected 0xEDB88320)로 설정. 태스크 시작 전 호출
+ */
+void crc_port_init(void);
+
+#endif
@@ -0,0 +1,517 @@
+/**
+ * @file uart_dma_hw.c
+ * @brief STM32H5 USART + GPDMA → uart_dma_hw_ops_t / uart_dma_os_ops_t
+ *
+ * RX: 채널마다 {CBR1, CDAR, CLLR} 노드 하나가 자기 자신을 가리킴 (UB1/UDA/ULL).
+ *     첫 블록은 rx_buf[offset]부터, 블록이 끝나면 노드가 버퍼 전체를 다시 적재.
+ *     쓰기 위치 = rx_size - CBR1.BNDT (블록이 rx_buf 끝에서 끝나므로 항상 성립)
+ * TX: 전송마다 일반(단일 블록) 전송, 목적지 요청(DREQ)으로 TDR에 공급
+ *
+ * 전송 오류(DTE/ULE/USE)가 나면 채널은 하드웨어가 멈추고 uart_dma_port_error_isr가
+ * 마지막 공개 위치에서 다시 시작함.
+ */
+
+#include "uart_dma_hw.h"
+#include "FreeRTOS.h"
+#include "gps.h"
+#include "main.h"
+#include "semphr.h"
+#include "task.h"
+
+#define DMA_CH_ERR_FLAGS (DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF)
+#define DMA_CH_ALL_FLAGS                                                                    \
+    (DMA_CFCR_TCF | DMA_CFCR_HTF | DMA_CFCR_DTEF | DMA_CFCR_ULEF | DMA_CFCR_USEF |           \
+     DMA_CFCR_SUSPF | DMA_CFCR_TOF)
+
+#define USART_ERR_CLEAR (USART_ICR_ORECF | USART_ICR_FECF | USART_ICR_NECF | USART_ICR_PECF)
+
+#define UART_DMA_IRQ_PRIO 5 /* CubeMX RX 채널과 같은 우선순위 (FreeRTOS API 호출 가능) */
+
+/*===========================================================================
+ * 인스턴스 표
+ *===========================================================================*/
+
+#define GPS_RX_SIZE   GPS_RX_BUF_SIZE /* gps->rx_buf 메모리 (gps.h) */
+#define GPS_TX_SIZE   2048
+#define LTE_RX_SIZE   2048
+#define LTE_TX_SIZE   1024
+#define LORA_RX_SIZE  1024
+#define LORA_TX_SIZE  512
+#define BLE_RX_SIZE   1024
+#define BLE_TX_SIZE   512
+#define RS485_RX_SIZE 512
+#define RS485_TX_SIZE 512
+#define RS232_RX_SIZE 512
+#define RS232_TX_SIZE 512
+
+static char gps_rx[GPS_RX_SIZE];
+static uint8_t gps_tx[GPS_TX_SIZE];
+static char lte_rx[LTE_RX_SIZE];
+static uint8_t lte_tx[LTE_TX_SIZE];
+static char lora_rx[LORA_RX_SIZE];
+static uint8_t lora_tx[LORA_TX_SIZE];
+static char ble_rx[BLE_RX_SIZE];
+static uint8_t ble_tx[BLE_TX_SIZE];
+static char rs485_rx[RS485_RX_SIZE];
+static uint8_t rs485_tx[RS485_TX_SIZE];
+static char rs232_rx[RS232_RX_SIZE];
+static uint8_t rs232_tx[RS232_TX_SIZE];
+
+static const uart_dma_hw_ops_t h5_hw_ops;
+static const uart_dma_os_ops_t rtos_ops;
+
+#define UART_DMA_DESC(_name, _uart, _rx_ch, _tx_ch, _rx_req, _tx_req, _baud, _rx, _tx)       \
+    {                                                                                       \
+        .name = _name, .uart = _uart, .rx_dma = _rx_ch, .tx_dma = _tx_ch,                  \
+        .rx_request = _rx_req, .tx_request = _tx_req, .baudrate = _baud, .rx_buf = _rx,    \
+        .rx_size = sizeof(_rx), .tx_buf = _tx, .tx_size = sizeof(_tx), .hw = &h5_hw_ops,   \
+        .os = &rtos_ops,                                                                    \
+    }
+
+static const uart_dma_desc_t uart_dma_descs[UART_DMA_COUNT] = {
+    [UART_DMA_GPS] = UART_DMA_DESC("gps", USART2, GPDMA2_Channel4, GPDMA2_Channel0,
+                                   GPDMA2_REQUEST_USART2_RX, GPDMA2_REQUEST_USART2_TX, 115200,
+                                   gps_rx, gps_tx),
+    [UART_DMA_LTE] = UART_DMA_DESC("lte", USART1, GPDMA1_Channel4, GPDMA1_Channel1,
+                                   GPDMA1_REQUEST_USART1_RX, GPDMA1_REQUEST_USART1_TX, 115200,
+                                   lte_rx, lte_tx),
+    [UART_DMA_LORA] = UART_DMA_DESC("lora", USART3, GPDMA2_Channel5, GPDMA2_Channel1,
+                                    GPDMA2_REQUEST_USART3_RX, GPDMA2_REQUEST_USART3_TX, 115200,
+                                    lora_rx, lora_tx),
+    [UART_DMA_BLE] = UART_DMA_DESC("ble", UART4, GPDMA1_Channel5, GPDMA1_Channel2,
+                                   GPDMA1_REQUEST_UART4_RX, GPDMA1_REQUEST_UART4_TX, 9600,
+                                   ble_rx, ble_tx),
+    [UART_DMA_RS485] = UART_DMA_DESC("rs485", UART5, GPDMA1_Channel6, GPDMA1_Channel3,
+                                     GPDMA1_REQUEST_UART5_RX, GPDMA1_REQUEST_UART5_TX, 115200,
+                                     rs485_rx, rs485_tx),
+    [UART_DMA_RS232] = UART_DMA_DESC("rs232", UART8, GPDMA2_Channel6, GPDMA2_Channel2,
+                                     GPDMA2_REQUEST_UART8_RX, GPDMA2_REQUEST_UART8_TX, 115200,
+                                     rs232_rx, rs232_tx),
+};
+
+/* 표에 없는 보드별 값 (커널 클럭 선택, TX 채널 인터럽트) */
+static const struct {
+    uint64_t kernel_clk;
+    IRQn_Type tx_irq;
+} uart_dma_extra[UART_DMA_COUNT] = {
+    [UART_DMA_GPS] = {RCC_PERIPHCLK_USART2, GPDMA2_Channel0_IRQn},
+    [UART_DMA_LTE] = {RCC_PERIPHCLK_USART1, GPDMA1_Channel1_IRQn},
+    [UART_DMA_LORA] = {RCC_PERIPHCLK_USART3, GPDMA2_Channel1_IRQn},
+    [UART_DMA_BLE] = {RCC_PERIPHCLK_UART4, GPDMA1_Channel2_IRQn},
+    [UART_DMA_RS485] = {RCC_PERIPHCLK_UART5, GPDMA1_Channel3_IRQn},
+    [UART_DMA_RS232] = {RCC_PERIPHCLK_UART8, GPDMA2_Channel2_IRQn},
+};
+
+/* RX 연결 리스트 노드 (UB1 | UDA | ULL 순서대로 CBR1, CDAR, CLLR) */
+typedef struct {
+    uint32_t cbr1;
+    uint32_t cdar;
+    uint32_t cllr;
+} rx_node_t;
+
+static rx_node_t rx_nodes[UART_DMA_COUNT] __attribute__((aligned(4)));
+static uart_dma_port_t ports[UART_DMA_COUNT];
+static bool port_ready[UART_DMA_COUNT];
+
+static inline uart_dma_id_t port_id(uart_dma_port_t *port) {
+    return (uart_dma_id_t)(port - ports);
+}
+
+static inline USART_TypeDef *port_uart(uart_dma_port_t *port) {
+    return (USART_TypeDef *)port->desc->uart;
+}
+
+/*===========================================================================
+ * GPDMA 채널
+ *===========================================================================*/
+
+/* 진행 중 전송을 멈추고 채널 초기화 (일시정지 후 리셋) */
+static void dma_ch_abort(DMA_Channel_TypeDef *ch) {
+    if (ch->CCR & DMA_CCR_EN) {
+        ch->CCR |= DMA_CCR_SUSP;
+        while ((ch->CSR & (DMA_CSR_SUSPF | DMA_CSR_IDLEF)) == 0) {
+        }
+    }
+    ch->CCR = DMA_CCR_RESET;
+    ch->CFCR = DMA_CH_ALL_FLAGS;
+}
+
+static void h5_rx_start(uart_dma_port_t *port, size_t offset) {
+    const uart_dma_desc_t *d = port->desc;
+    DMA_Channel_TypeDef *ch = d->rx_dma;
+    rx_node_t *node = &rx_nodes[port_id(port)];
+    uint32_t node_addr = (uint32_t)node;
+    uint32_t link = DMA_CLLR_UB1 | DMA_CLLR_UDA | DMA_CLLR_ULL | (node_addr & DMA_CLLR_LA);
+
+    dma_ch_abort(ch);
+
+    /* 두 번째 블록부터: 버퍼 전체, 다시 자신을 적재 */
+    node->cbr1 = (uint32_t)d->rx_size & DMA_CBR1_BNDT;
+    node->cdar = (uint32_t)d->rx_buf;
+    node->cllr = link;
+
+    ch->CTR1 = DMA_CTR1_DINC; /* 바이트 단위, 목적지 증가 */
+    ch->CTR2 = d->rx_request & DMA_CTR2_REQSEL;
+    ch->CBR1 = (uint32_t)(d->rx_size - offset) & DMA_CBR1_BNDT;
+    ch->CSAR = (uint32_t)&port_uart(port)->RDR;
+    ch->CDAR = (uint32_t)&d->rx_buf[offset];
+    ch->CLBAR = node_addr & DMA_CLBAR_LBA;
+    ch->CLLR = link;
+    ch->CCR = DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_DTEIE | DMA_CCR_ULEIE | DMA_CCR_USEIE |
+              DMA_CCR_EN;
+}
+
+static size_t h5_rx_remaining(uart_dma_port_t *port) {
+    DMA_Channel_TypeDef *ch = port->desc->rx_dma;
+
+    return ch->CBR1 & DMA_CBR1_BNDT;
+}
+
+static bool h5_tx_start(uart_dma_port_t *port, const uint8_t *data, size_t len) {
+    const uart_dma_desc_t *d = port->desc;
+    DMA_Channel_TypeDef *ch = d->tx_dma;
+    USART_TypeDef *u = port_uart(port);
+
+    if (len > DMA_CBR1_BNDT) {
+        return false;
+    }
+
+    /* 이전 전송은 끝나서 EN이 내려간 상태 */
+    ch->CFCR = DMA_CH_ALL_FLAGS;
+    u->ICR = USART_ICR_TCCF;
+
+    ch->CTR1 = DMA_CTR1_SINC;
+    ch->CTR2 = (d->tx_request & DMA_CTR2_REQSEL) | DMA_CTR2_DREQ;
+    ch->CBR1 = (uint32_t)len;
+    ch->CSAR = (uint32_t)data;
+    ch->CDAR = (uint32_t)&u->TDR;
+    ch->CLLR = 0;
+    ch->CCR = DMA_CCR_TCIE | DMA_CCR_DTEIE | DMA_CCR_ULEIE | DMA_CCR_USEIE | DMA_CCR_EN;
+
+    return true;
+}
+
+/*===========================================================================
+ * USART
+ *===========================================================================*/
+
+static void h5_start(uart_dma_port_t *port) {
+    USART_TypeDef *u = port_uart(port);
+
+    u->ICR = USART_ICR_IDLECF | USART_ERR_CLEAR;
+    u->CR3 |= USART_CR3_DMAR | USART_CR3_DMAT | USART_CR3_EIE;
+    u->CR1 |= USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_TE | USART_CR1_RE | USART_CR1_UE;
+}
+
+static void h5_stop(uart_dma_port_t *port) {
+    USART_TypeDef *u = port_uart(port);
+
+    u->CR1 &= ~(USART_CR1_IDLEIE | USART_CR1_PEIE);
+    u->CR3 &= ~(USART_CR3_DMAR | USART_CR3_DMAT | USART_CR3_EIE);
+
+    dma_ch_abort(port->desc->rx_dma);
+    dma_ch_abort(port->desc->tx_dma);
+
+    u->ICR = USART_ICR_IDLECF | USART_ERR_CLEAR;
+}
+
+static void h5_set_baudrate(uart_dma_port_t *port, uint32_t baudrate) {
+    uart_dma_id_t id = port_id(port);
+    USART_TypeDef *u = port_uart(port);
+    uint32_t clk = HAL_RCCEx_GetPeriphCLKFreq(uart_dma_extra[id].kernel_clk);
+    uint32_t presc = u->PRESC & USART_PRESC_PRESCALER;
+
+    /* 큐는 비었지만 마지막 바이트가 아직 나가는 중일 수 있음 */
+    (void)uart_dma_hw_wait_tx_idle(id, 10);
+
+    u->CR1 &= ~USART_CR1_UE;
+    u->BRR = UART_DIV_SAMPLING16(clk, baudrate, presc);
+    u->CR1 |= USART_CR1_UE;
+}
+
+static const uart_dma_hw_ops_t h5_hw_ops = {
+    .start = h5_start,
+    .stop = h5_stop,
+    .rx_start = h5_rx_start,
+    .rx_remaining = h5_rx_remaining,
+    .tx_start = h5_tx_start,
+    .set_baudrate = h5_set_baudrate,
+};
+
+/*===========================================================================
+ * FreeRTOS
+ *===========================================================================*/
+
+static void rtos_lock(uart_dma_port_t *port) {
+    xSemaphoreTake((SemaphoreHandle_t)port->os_lock, portMAX_DELAY);
+}
+
+static void rtos_unlock(uart_dma_port_t *port) {
+    xSemaphoreGive((SemaphoreHandle_t)port->os_lock);
+}
+
+static bool rtos_wait(uart_dma_port_t *port, uint32_t timeout_ms) {
+    return xSemaphoreTake((SemaphoreHandle_t)port->os_done, pdMS_TO_TICKS(timeout_ms)) ==
+           pdTRUE;
+}
+
+static void rtos_notify(uart_dma_port_t *port) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xSemaphoreGiveFromISR((SemaphoreHandle_t)port->os_done, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+static uint32_t rtos_now_ms(uart_dma_port_t *port) {
+    (void)port;
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
+static const uart_dma_os_ops_t rtos_ops = {
+    .lock = rtos_lock,
+    .unlock = rtos_unlock,
+    .wait = rtos_wait,
+    .notify = rtos_notify,
+    .now_ms = rtos_now_ms,
+};
+
+/*===========================================================================
+ * API
+ *===========================================================================*/
+
+uart_dma_port_t *uart_dma_hw_port(uart_dma_id_t id) {
+    if (id >= UART_DMA_COUNT) {
+        return NULL;
+    }
+
+    uart_dma_port_t *port = &ports[id];
+
+    if (!port_ready[id]) {
+        uart_dma_port_init(port, &uart_dma_descs[id]);
+        port->os_lock = xSemaphoreCreateMutex();
+        port->os_done = xSemaphoreCreateBinary();
+
+        /* MX_*_Init 보드레이트(115200)와 다르면 표 값으로 */
+        if (uart_dma_descs[id].baudrate != 115200) {
+            h5_set_baudrate(port, uart_dma_descs[id].baudrate);
+        }
+
+        HAL_NVIC_SetPriority(uart_dma_extra[id].tx_irq, UART_DMA_IRQ_PRIO, 0);
+        HAL_NVIC_EnableIRQ(uart_dma_extra[id].tx_irq);
+        port_ready[id] = true;
+    }
+
+    return port;
+}
+
+bool uart_dma_hw_wait_tx_idle(uart_dma_id_t id, uint32_t timeout_ms) {
+    USART_TypeDef *u = uart_dma_descs[id].uart;
+    uint32_t start = HAL_GetTick();
+
+    if (!(u->CR1 & USART_CR1_UE)) {
+        return true;
+    }
+
+    while (uart_tx_is_busy(&ports[id].tx) || !(u->ISR & USART_ISR_TC)) {
+        if ((HAL_GetTick() - start) > timeout_ms) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t uart_dma_hw_autobaud(uart_dma_id_t id, uint32_t samples, uint32_t timeout_ms) {
+    USART_TypeDef *u = uart_dma_descs[id].uart;
+    uint32_t clk = HAL_RCCEx_GetPeriphCLKFreq(uart_dma_extra[id].kernel_clk) /
+                   UARTPrescTable[u->PRESC & USART_PRESC_PRESCALER];
+    uint32_t brr = u->BRR;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t limit = pdMS_TO_TICKS(timeout_ms);
+    uint32_t best = 0;
+
+    /* ABREN/ABRMODE는 UE=0일 때만 쓸 수 있음 */
+    u->CR1 &= ~USART_CR1_UE;
+    u->CR2 = (u->CR2 & ~USART_CR2_ABRMODE) | USART_CR2_ABREN;
+    u->CR1 |= USART_CR1_UE;
+
+    for (uint32_t i = 0; i < samples; i++) {
+        bool timed_out = false;
+
+        /* ABRF를 지우고 다음 하강 엣지에서 다시 측정 */
+        u->RQR = USART_RQR_ABRRQ;
+
+        while (!(u->ISR & (USART_ISR_ABRF | USART_ISR_ABRE))) {
+            if ((xTaskGetTickCount() - start) > limit) {
+                timed_out = true;
+                break;
+            }
+            vTaskDelay(1);
+        }
+
+        if (timed_out) {
+            break;
+        }
+
+        /* 16배 오버샘플링: BRR = 커널 클럭 / 보드레이트 */
+        if (!(u->ISR & USART_ISR_ABRE) && u->BRR >= 16) {
+            uint32_t baud = clk / u->BRR;
+
+            if (baud > best) {
+                best = baud;
+            }
+        }
+    }
+
+    u->CR1 &= ~USART_CR1_UE;
+    u->CR2 &= ~USART_CR2_ABREN;
+    u->BRR = brr;
+    u->CR1 |= USART_CR1_UE;
+
+    return best;
+}
+
+/*===========================================================================
+ * RX 인터럽트
+ *===========================================================================*/
+
+#if UART_DMA_ISR_PROFILE
+static uart_dma_isr_stats_t isr_stats[UART_DMA_COUNT];
+
+static void isr_stats_add(uart_dma_id_t id, uint32_t cycles) {
+    uart_dma_isr_stats_t *st = &isr_stats[id];
+
+    st->count++;
+    st->last = cycles;
+    st->total += cycles;
+    if (cycles > st->max) {
+        st->max = cycles;
+    }
+}
+
+void uart_dma_hw_isr_stats(uart_dma_id_t id, uart_dma_isr_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = isr_stats[id];
+    isr_stats[id] = (uart_dma_isr_stats_t){0};
+    taskEXIT_CRITICAL();
+}
+#endif
+
+static void usart_irq(uart_dma_id_t id) {
+    uart_dma_port_t *port = &ports[id];
+    USART_TypeDef *u = uart_dma_descs[id].uart;
+    uint32_t isr = u->ISR;
+    uint32_t errors = 0;
+
+    if (isr & (USART_ISR_ORE | USART_ISR_FE | USART_ISR_NE | USART_ISR_PE)) {
+        u->ICR = USART_ERR_CLEAR;
+        if (isr & USART_ISR_ORE) {
+            errors |= UART_DMA_ERR_OVERRUN;
+        }
+        if (isr & USART_ISR_FE) {
+            errors |= UART_DMA_ERR_FRAMING;
+        }
+        if (isr & USART_ISR_NE) {
+            errors |= UART_DMA_ERR_NOISE;
+        }
+        if (isr & USART_ISR_PE) {
+            errors |= UART_DMA_ERR_PARITY;
+        }
+    }
+
+    if (isr & USART_ISR_IDLE) {
+        u->ICR = USART_ICR_IDLECF;
+    }
+
+    if (!port_ready[id]) {
+        return;
+    }
+
+    /* 오류 처리가 수신 데이터도 공개하므로 IDLE은 오류가 없을 때만 */
+    if (errors) {
+        uart_dma_port_error_isr(port, errors);
+    }
+    else if (isr & USART_ISR_IDLE) {
+        uart_dma_port_rx_isr(port);
+    }
+}
+
+static void rx_dma_irq(uart_dma_id_t id) {
+    DMA_Channel_TypeDef *ch = uart_dma_descs[id].rx_dma;
+    uint32_t csr = ch->CSR;
+
+    ch->CFCR = csr & (DMA_CSR_TCF | DMA_CSR_HTF | DMA_CH_ERR_FLAGS);
+
+    if (!port_ready[id]) {
+        return;
+    }
+
+    if (csr & DMA_CH_ERR_FLAGS) {
+        uart_dma_port_error_isr(&ports[id], UART_DMA_ERR_RX_DMA);
+    }
+    else if (csr & (DMA_CSR_TCF | DMA_CSR_HTF)) {
+        uart_dma_port_rx_isr(&ports[id]);
+    }
+}
+
+void uart_dma_hw_usart_irq(uart_dma_id_t id) {
+#if UART_DMA_ISR_PROFILE
+    uint32_t start = DWT->CYCCNT;
+
+    usart_irq(id);
+    isr_stats_add(id, DWT->CYCCNT - start);
+#else
+    usart_irq(id);
+#endif
+}
+
+void uart_dma_hw_rx_dma_irq(uart_dma_id_t id) {
+#if UART_DMA_ISR_PROFILE
+    uint32_t start = DWT->CYCCNT;
+
+    rx_dma_irq(id);
+    isr_stats_add(id, DWT->CYCCNT - start);
+#else
+    rx_dma_irq(id);
+#endif
+}
+
+/* TX 채널 인터럽트: 오류여도 완료 처리해서 큐가 멈추지 않게 함 (블록은 유실) */
+static void uart_dma_hw_tx_dma_irq(uart_dma_id_t id) {
+    DMA_Channel_TypeDef *ch = uart_dma_descs[id].tx_dma;
+    uint32_t csr = ch->CSR;
+
+    ch->CFCR = csr & (DMA_CSR_TCF | DMA_CSR_HTF | DMA_CH_ERR_FLAGS);
+
+    if (port_ready[id] && (csr & (DMA_CSR_TCF | DMA_CH_ERR_FLAGS))) {
+        uart_dma_port_tx_isr(&ports[id]);
+    }
+}
+
+/*===========================================================================
+ * TX 채널 인터럽트 핸들러 (CubeMX가 만들지 않는 채널)
+ *===========================================================================*/
+
+void GPDMA2_Channel0_IRQHandler(void) {
+    uart_dma_hw_tx_dma_irq(UART_DMA_GPS);
+}
+
+void GPDMA1_Channel1_IRQHandler(void) {
+    uart_dma_hw_tx_dma_irq(UART_DMA_LTE);
+}
+
+void GPDMA2_Channel1_IRQHandler(void) {
+    uart_dma_hw_tx_dma_irq(UART_DMA_LORA);
+}
+
+void GPDMA1_Channel2_IRQHandler(void) {
+    uart_dma_hw_tx_dma_irq(UART_DMA_BLE);
+}
+
+void GPDMA1_Channel3_IRQHandler(void) {
+    uart_dma_hw_tx_dma_irq(UART_DMA_RS485);
+}
+
+void GPDMA2_Channel2_IRQHandler(void) {
+    uart_dma_hw_tx_dma_irq(UART_DMA_RS232);
+}
@@ -0,0 +1,113 @@
+#ifndef UART_DMA_HW_H
+#define UART_DMA_HW_H
+
+/**
+ * @file uart_dma_hw.h
+ * @brief STM32H5 USART + GPDMA 백엔드 (uart_dma_port 인스턴스 표)
+ *
+ * | 인스턴스 | USART  | RX DMA      | TX DMA      | RX / TX 버퍼 |
+ * |----------|--------|-------------|-------------|--------------|
+ * | GPS      | USART2 | GPDMA2 Ch4  | GPDMA2 Ch0  | 2048 / 2048  |
+ * | LTE      | USART1 | GPDMA1 Ch4  | GPDMA1 Ch1  | 2048 / 1024  |
+ * | LoRa     | USART3 | GPDMA2 Ch5  | GPDMA2 Ch1  | 1024 / 512   |
+ * | BLE      | UART4  | GPDMA1 Ch5  | GPDMA1 Ch2  | 1024 / 512   |
+ * | RS485    | UART5  | GPDMA1 Ch6  | GPDMA1 Ch3  | 512 / 512    |
+ * | RS232    | UART8  | GPDMA2 Ch6  | GPDMA2 Ch2  | 512 / 512    |
+ *
+ * USART 클럭/GPIO 초기화는 CubeMX(MX_*_Init)가 하고, RX 채널은 CubeMX 설정을
+ * 덮어써서 자기 자신을 가리키는 노드 하나짜리 순환 연결 리스트로 다시 구성.
+ * HAL UART/DMA 핸들러는 거치지 않음 (HAL은 수신 오류 시 DMA를 중단함)
+ */
+
+#include "uart_dma_port.h"
+
+/**
+ * @brief RX 인터럽트 DWT 사이클 측정 (0이면 측정 코드 없음)
+ *
+ * USART/RX DMA 인터럽트 한 번의 사이클 수 (이벤트 콜백, 태스크 알림 포함).
+ * DWT->CYCCNT는 main()에서 켬
+ */
+#ifndef UART_DMA_ISR_PROFILE
+#define UART_DMA_ISR_PROFILE 0
+#endif
+
+typedef enum {
+    UART_DMA_GPS = 0,
+    UART_DMA_LTE,
+    UART_DMA_LORA,
+    UART_DMA_BLE,
+    UART_DMA_RS485,
+    UART_DMA_RS232,
+    UART_DMA_COUNT,
+} uart_dma_id_t;
+
+/**
+ * @brief 인스턴스 포트 (처음 호출 시 uart_dma_port_init, RTOS 객체 생성)
+ *
+ * 태스크 컨텍스트에서 호출
+ *
+ * @param id 인스턴스
+ * @return uart_dma_port_t* 포트
+ */
+uart_dma_port_t *uart_dma_hw_port(uart_dma_id_t id);
+
+/**
+ * @brief 마지막 바이트가 선로로 나갈 때까지 대기 (USART TC)
+ *
+ * TX DMA 완료는 TDR에 마지막 바이트를 넣은 시점이라 시프트 레지스터에 한 바이트가
+ * 남아있음. RS485 방향 전환, 보드레이트 변경 전에 사용
+ *
+ * @param id 인스턴스
+ * @param timeout_ms 대기 시간
+ * @return true: 송신 완료
+ */
+bool uart_dma_hw_wait_tx_idle(uart_dma_id_t id, uint32_t timeout_ms);
+
+/**
+ * @brief 상대 장치 송신으로 보드레이트 측정 (USART 자동 보드레이트, 모드 0)
+ *
+ * 모드 0은 시작 비트부터 첫 상승 엣지까지의 Low 구간 길이를 재므로, LSB가 0인
+ * 문자('$' 등)는 실제의 1/2, 1/3로 측정됨. 문자 중간의 하강 엣지에서 시작하는 경우도
+ * 있어서 여러 번 측정해 가장 높은 값(가장 짧은 Low 구간 = 1비트)을 돌려줌.
+ * 측정 중 수신 데이터는 깨질 수 있고, 끝나면 원래 BRR로 복원.
+ * 상대 장치가 주기적으로 송신 중이어야 함 (태스크 컨텍스트, 보드레이트 변경과 동시 호출 금지)
+ *
+ * @param id 인스턴스
+ * @param samples 측정 횟수
+ * @param timeout_ms 전체 대기 시간
+ * @return uint32_t 측정 보드레이트 원본값 (0: 측정 실패)
+ */
+uint32_t uart_dma_hw_autobaud(uart_dma_id_t id, uint32_t samples, uint32_t timeout_ms);
+
+/**
+ * @brief USART 전역 인터럽트 (IDLE, 오류 플래그)
+ *
+ * stm32h5xx_it.c의 USARTx_IRQHandler에서 호출
+ */
+void uart_dma_hw_usart_irq(uart_dma_id_t id);
+
+/**
+ * @brief RX GPDMA 채널 인터럽트 (HT, TC, 전송 오류)
+ *
+ * stm32h5xx_it.c의 GPDMAx_ChannelN_IRQHandler에서 호출
+ */
+void uart_dma_hw_rx_dma_irq(uart_dma_id_t id);
+
+#if UART_DMA_ISR_PROFILE
+typedef struct {
+    uint32_t count; /**< 측정한 인터럽트 수 */
+    uint32_t last;  /**< 마지막 사이클 수 */
+    uint32_t max;   /**< 최대 사이클 수 */
+    uint64_t total; /**< 누적 사이클 수 (평균 = total / count) */
+} uart_dma_isr_stats_t;
+
+/**
+ * @brief 인스턴스의 RX 인터럽트(USART + RX DMA) 사이클 통계 복사 후 초기화
+ *
+ * @param id 인스턴스
+ * @param out 통계
+ */
+void uart_dma_hw_isr_stats(uart_dma_id_t id, uart_dma_isr_stats_t *out);
+#endif
+
+#endif
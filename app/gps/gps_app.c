@@ -2,6 +2,7 @@
 #include "board_config.h"
 #include "event_bus.h"
 #include "gps.h"
+#include "gps_baud.h"
 #include "gps_port.h"
 #include "gps_role.h"
 #include "gps_unicore.h"
@@ -44,8 +45,8 @@ static const char *um982_base_cmds[] = {
 
     "rtcm1033 com1 10\r\n", "rtcm1006 com1 10\r\n",
     "rtcm1074 com1 1\r\n", // gps msm4
-    // "rtcm1124 com1 1\r\n", // beidou msm4
-    // "rtcm1084 com1 1\r\n", // glonass msm4
+    "rtcm1124 com1 1\r\n", // beidou msm4
+    "rtcm1084 com1 1\r\n", // glonass msm4
     "rtcm1094 com1 1\r\n", // galileo msm4
     "gpgga com1 1\r\n",
     // "gpgsv com1 1\r\n",
@@ -76,6 +77,31 @@ static const char *um982_rover_cmds[] = {
     // "config heading length 100 40\r\n",
 };
 
+/*===========================================================================
+ * 수신 필터 (허용 목록)
+ *===========================================================================*/
+
+/**
+ * @brief 디코드할 메시지만 허용하고 나머지는 파서 없이 처리
+ *
+ * - NMEA: 핸들러가 있는 타입(NMEA_MSG_TABLE)만 디코드, 나머지(GSV/GSA 등)는 버림
+ * - Unicore Binary: UNICORE_BIN_MSG_TABLE만 디코드, 나머지는 집계만 (CRC 계산 생략)
+ * - RTCM: 전부 디코드 (Base는 모든 타입을 LoRa로 전달)
+ */
+static void gps_app_filter_init(gps_t *gps) {
+    gps_filter_set_default(gps, GPS_PROTOCOL_NMEA, GPS_FILTER_DROP);
+#define X(name, str, key, handler, field_count, is_urc) \
+    gps_filter_set(gps, GPS_PROTOCOL_NMEA, key, GPS_FILTER_DECODE);
+    NMEA_MSG_TABLE(X)
+#undef X
+
+    gps_filter_set_default(gps, GPS_PROTOCOL_UNICORE_BIN, GPS_FILTER_COUNT);
+#define X(name, msg_id, handler, is_urc) \
+    gps_filter_set(gps, GPS_PROTOCOL_UNICORE_BIN, msg_id, GPS_FILTER_DECODE);
+    UNICORE_BIN_MSG_TABLE(X)
+#undef X
+}
+
 /*===========================================================================
  * GPS 이벤트 핸들러
  *===========================================================================*/
@@ -138,47 +164,20 @@ static void gps_app_evt_handler(gps_t *gps, const gps_event_t *event) {
  * UM982 초기화 함수
  *===========================================================================*/
 
-#define GPS_CMD_MAX_RETRIES    3    /* 최대 재시도 횟수 */
-#define GPS_CMD_RETRY_DELAY_MS 200  /* 재시도 간 대기 시간 (ms) */
-#define GPS_CMD_TIMEOUT_MS     2000 /* 명령어 타임아웃 (ms) */
-#define GPS_CMD_INTERVAL_MS    100  /* 명령어 간 대기 시간 (ms) */
+#define GPS_CMD_WINDOW       4    /* 응답 없이 연달아 보낼 명령 수 */
+#define GPS_CMD_MAX_ATTEMPTS 3    /* 명령당 최대 송신 횟수 */
+#define GPS_CMD_TIMEOUT_MS   1000 /* 송신부터 응답까지 대기 (ms) */
+#define GPS_CMD_DEADLINE_MS  5000 /* 초기화 명령 전체 한도 (ms) */
 
-/**
- * @brief 단일 명령어 전송 (재시도 포함)
- *
- * @param gps GPS 핸들
- * @param cmd 명령어 문자열
- * @param cmd_idx 명령어 인덱스 (로그용)
- * @param total_cmds 전체 명령어 수 (로그용)
- * @return true: 성공, false: 재시도 후에도 실패
- */
-static bool gps_send_cmd_with_retry(gps_t *gps, const char *cmd, size_t cmd_idx,
-                                    size_t total_cmds) {
-    for (int retry = 0; retry < GPS_CMD_MAX_RETRIES; retry++) {
-        if (retry > 0) {
-            LOG_WARN("[%zu/%zu] 재시도 %d/%d: %s", cmd_idx, total_cmds, retry,
-                     GPS_CMD_MAX_RETRIES - 1, cmd);
-            vTaskDelay(pdMS_TO_TICKS(GPS_CMD_RETRY_DELAY_MS));
-        }
-        else {
-            LOG_INFO("[%zu/%zu] UM982 -> %s", cmd_idx, total_cmds, cmd);
-        }
-
-        bool result = gps_send_cmd_sync(gps, cmd, GPS_CMD_TIMEOUT_MS);
-
-        if (result) {
-            LOG_INFO("[%zu/%zu] 성공%s", cmd_idx, total_cmds, retry > 0 ? " (재시도 후)" : "");
-            return true;
-        }
-    }
-
-    LOG_ERR("[%zu/%zu] 실패 - %d회 재시도 후 포기: %s", cmd_idx, total_cmds, GPS_CMD_MAX_RETRIES,
-            cmd);
-    return false;
-}
+static const gps_cmd_batch_cfg_t um982_cmd_cfg = {
+    .window = GPS_CMD_WINDOW,
+    .max_attempts = GPS_CMD_MAX_ATTEMPTS,
+    .timeout_ms = GPS_CMD_TIMEOUT_MS,
+    .deadline_ms = GPS_CMD_DEADLINE_MS,
+};
 
 /**
- * @brief UM982 명령어 배열 전송
+ * @brief UM982 명령어 배열 전송 (파이프라인, 실패한 명령만 재전송)
  *
  * @param gps GPS 핸들
  * @param cmds 명령어 배열
@@ -187,28 +186,38 @@ static bool gps_send_cmd_with_retry(gps_t *gps, const char *cmd, size_t cmd_idx,
  * @return true: 전체 성공, false: 하나 이상 실패
  */
 static bool gps_send_um982_cmds(gps_t *gps, const char **cmds, size_t count, size_t *failed_count) {
-    size_t fail_cnt = 0;
+    gps_cmd_batch_t batch = {0};
+    TickType_t start = xTaskGetTickCount();
+    bool result = gps_send_cmds(gps, &batch, cmds, count, &um982_cmd_cfg);
+    size_t fail_cnt = (batch.count == count) ? gps_cmd_batch_failed(&batch) : count;
 
-    for (size_t i = 0; i < count; i++) {
-        if (!gps_send_cmd_with_retry(gps, cmds[i], i + 1, count)) {
-            fail_cnt++;
+    for (size_t i = 0; i < batch.count; i++) {
+        const gps_cmd_entry_t *e = &batch.entries[i];
+
+        if (e->state == GPS_CMD_ST_FAILED) {
+            LOG_ERR("[%zu/%zu] 실패 (%s, %u회 송신): %s", i + 1, count,
+                    e->error ? "ERROR" : "응답 없음", e->attempts, e->cmd);
         }
-        vTaskDelay(pdMS_TO_TICKS(GPS_CMD_INTERVAL_MS));
     }
 
+    LOG_INFO("UM982 명령 %zu개 %lu ms (송신 %lu, 재시도 %lu, 매칭 안 된 응답 %lu)", count,
+             (unsigned long)((xTaskGetTickCount() - start) * portTICK_PERIOD_MS),
+             (unsigned long)batch.sent, (unsigned long)batch.retries,
+             (unsigned long)batch.unmatched);
+
     if (failed_count) {
         *failed_count = fail_cnt;
     }
 
-    return (fail_cnt == 0);
+    return result;
 }
 
 static bool gps_init_um982_base(gps_t *gps) {
     size_t cmd_count = sizeof(um982_base_cmds) / sizeof(um982_base_cmds[0]);
     size_t failed_count = 0;
 
-    LOG_INFO("UM982 Base 초기화 시작 (%zu 개 명령, 최대 %d회 재시도)", cmd_count,
-             GPS_CMD_MAX_RETRIES);
+    LOG_INFO("UM982 Base 초기화 시작 (%zu 개 명령, 명령당 최대 %d회 송신)", cmd_count,
+             GPS_CMD_MAX_ATTEMPTS);
 
     bool result = gps_send_um982_cmds(gps, um982_base_cmds, cmd_count, &failed_count);
 
@@ -226,8 +235,8 @@ static bool gps_init_um982_rover(gps_t *gps) {
     size_t cmd_count = sizeof(um982_rover_cmds) / sizeof(um982_rover_cmds[0]);
     size_t failed_count = 0;
 
-    LOG_INFO("UM982 Rover 초기화 시작 (%zu 개 명령, 최대 %d회 재시도)", cmd_count,
-             GPS_CMD_MAX_RETRIES);
+    LOG_INFO("UM982 Rover 초기화 시작 (%zu 개 명령, 명령당 최대 %d회 송신)", cmd_count,
+             GPS_CMD_MAX_ATTEMPTS);
 
     bool result = gps_send_um982_cmds(gps, um982_rover_cmds, cmd_count, &failed_count);
 
@@ -241,6 +250,102 @@ static bool gps_init_um982_rover(gps_t *gps) {
     return result;
 }
 
+/*===========================================================================
+ * UM982 보드레이트 협상
+ *===========================================================================*/
+
+#define GPS_BAUD_PROBE_CMD        "VERSIONA"
+#define GPS_BAUD_PROBE_TIMEOUT_MS 300  /* 확인 명령 응답 대기 (115200에서도 충분) */
+#define GPS_BAUD_PROBE_RETRIES    2    /* 속도마다 확인 명령 시도 횟수 */
+#define GPS_BAUD_SEND_TIMEOUT_MS  100  /* CONFIG 전송 완료 대기 */
+#define GPS_BAUD_SETTLE_MS        50   /* CONFIG 후 수신기 속도 전환 대기 */
+#define GPS_BAUD_BOOT_MS          1000 /* 리셋 후 수신기 부팅 대기 */
+
+static bool gps_baud_op_send_sync(void *ctx, const char *cmd) {
+    gps_t *gps = ctx;
+
+    return gps->ops->send_sync(cmd, strlen(cmd), GPS_BAUD_SEND_TIMEOUT_MS) == 0;
+}
+
+static bool gps_baud_op_set_local(void *ctx, uint32_t baudrate) {
+    gps_t *gps = ctx;
+
+    return gps->ops->set_baudrate(baudrate) == 0;
+}
+
+static bool gps_baud_op_probe(void *ctx) {
+    return gps_send_cmd_sync(ctx, GPS_BAUD_PROBE_CMD, GPS_BAUD_PROBE_TIMEOUT_MS);
+}
+
+static uint32_t gps_baud_op_autobaud(void *ctx) {
+    gps_t *gps = ctx;
+
+    return gps->ops->detect_baudrate();
+}
+
+static bool gps_baud_op_reset(void *ctx) {
+    gps_t *gps = ctx;
+
+    return gps->ops->reset() == 0;
+}
+
+static void gps_baud_op_delay(void *ctx, uint32_t ms) {
+    (void)ctx;
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+/**
+ * @brief 수신기와 로컬 USART를 GPS_UM982_BAUDRATE로 올림
+ *
+ * 실패하면 로컬은 115200 (수신기 공장 기본값)으로 남음
+ *
+ * @param gps GPS 핸들
+ * @return true: 협상한 속도로 통신 확인됨
+ */
+static bool gps_init_um982_baudrate(gps_t *gps) {
+    const gps_hal_ops_t *hal = gps->ops;
+    gps_baud_result_t res;
+
+    if (GPS_UM982_BAUDRATE == GPS_BAUD_DEFAULT) {
+        return true;
+    }
+
+    if (!hal->send_sync || !hal->set_baudrate) {
+        LOG_WARN("UM982 보드레이트 변경 미지원 (%d 유지)", GPS_BAUD_DEFAULT);
+        return false;
+    }
+
+    const gps_baud_ops_t ops = {
+        .send_sync = gps_baud_op_send_sync,
+        .set_local = gps_baud_op_set_local,
+        .probe = gps_baud_op_probe,
+        .autobaud = hal->detect_baudrate ? gps_baud_op_autobaud : NULL,
+        .reset = hal->reset ? gps_baud_op_reset : NULL,
+        .delay_ms = gps_baud_op_delay,
+        .ctx = gps,
+    };
+    const gps_baud_cfg_t cfg = {
+        .port = GPS_UM982_PORT,
+        .target = GPS_UM982_BAUDRATE,
+        .probe_retries = GPS_BAUD_PROBE_RETRIES,
+        .settle_ms = GPS_BAUD_SETTLE_MS,
+        .boot_ms = GPS_BAUD_BOOT_MS,
+    };
+
+    bool result = gps_baud_negotiate(&ops, &cfg, &res);
+
+    if (result) {
+        LOG_INFO("UM982 보드레이트 %lu -> %lu (자동 측정 %s, CONFIG %u, 되돌림 %u, 리셋 %u)",
+                 (unsigned long)res.initial, (unsigned long)res.baudrate,
+                 res.autobaud_hit ? "적중" : "실패", res.switches, res.fallbacks, res.resets);
+    }
+    else {
+        LOG_ERR("UM982 보드레이트 협상 실패 (응답 없음, 로컬 %lu)", (unsigned long)res.baudrate);
+    }
+
+    return result;
+}
+
 /*===========================================================================
  * GPS 앱 태스크
  *===========================================================================*/
@@ -262,6 +367,9 @@ static void gps_app_task(void *pvParameter) {
     /* 이벤트 핸들러 등록 */
     gps_set_evt_handler(&ctx->gps, gps_app_evt_handler);
 
+    /* 수신 필터 설정 (수신 시작 전) */
+    gps_app_filter_init(&ctx->gps);
+
     /* 하드웨어 초기화 */
     if (gps_port_init(&ctx->gps) != 0) {
         LOG_ERR("GPS 하드웨어 초기화 실패");
@@ -278,8 +386,10 @@ static void gps_app_task(void *pvParameter) {
     /* 안정화 대기 */
     vTaskDelay(pdMS_TO_TICKS(1000));
 
-    /* UM982 초기화 명령어 전송 (역할에 따라) */
+    /* UM982 링크 속도 협상 후 초기화 명령어 전송 (역할에 따라) */
     if (ctx->type == GPS_TYPE_UM982) {
+        gps_init_um982_baudrate(&ctx->gps);
+
         if (gps_role_is_base()) {
             gps_init_um982_base(&ctx->gps);
         }
@@ -358,16 +468,19 @@ void gps_app_stop(void) {
 
     LOG_INFO("GPS 앱 종료 시작");
 
-    /* 1. 하드웨어 통신 정지 */
-    gps_port_stop(&ctx->gps);
+    /* 1. RX 알림 해제 (ISR이 종료 중인 태스크를 깨우지 않게) */
+    gps_port_detach(&ctx->gps);
 
-    /* 2. GPS 코어 태스크 종료 (gps_process_task) */
+    /* 2. GPS 코어 태스크 종료 (gps_process_task, RX 링 소비자를 먼저 멈춤) */
     gps_stop(&ctx->gps);
 
-    /* 3. 앱 태스크 종료 플래그 설정 */
+    /* 3. 하드웨어 통신 정지 (RX 링 리셋) */
+    gps_port_stop(&ctx->gps);
+
+    /* 4. 앱 태스크 종료 플래그 설정 */
     ctx->enabled = false;
 
-    /* 4. 태스크 종료 대기 */
+    /* 5. 태스크 종료 대기 */
     if (ctx->task) {
         uint32_t wait_count = 0;
         while (eTaskGetState(ctx->task) != eDeleted && wait_count < 50) {
@@ -382,7 +495,7 @@ void gps_app_stop(void) {
         ctx->task = NULL;
     }
 
-    /* 5. 상태 초기화 */
+    /* 6. 상태 초기화 */
     ctx->last_fix = GPS_FIX_INVALID;
 
     LOG_INFO("GPS 앱 종료 완료");
@@ -430,6 +543,53 @@ gps_t *gps_get_handle(void) {
     return &ctx->gps;
 }
 
+/**
+ * @brief 수신 필터 규칙 변경 (런타임)
+ */
+bool gps_app_set_filter(gps_id_t id, gps_protocol_t proto, uint32_t msg_id,
+                        gps_filter_action_t action) {
+    gps_t *gps = gps_get_instance_handle(id);
+
+    if (!gps) {
+        return false;
+    }
+
+    return gps_filter_set(gps, proto, msg_id, action);
+}
+
+/**
+ * @brief 원본 데이터 송신 (RTCM 보정 주입 등, 송신 큐에 넣고 바로 반환)
+ */
+bool gps_send_raw_data(gps_id_t id, const uint8_t *data, size_t len) {
+    gps_t *gps = gps_get_instance_handle(id);
+
+    if (!gps || !gps->ops || !gps->ops->send || !data) {
+        return false;
+    }
+
+    return gps->ops->send((const char *)data, len) == 0;
+}
+
+/**
+ * @brief RX 원본 스트림 탭 출력 대상 변경 (런타임)
+ */
+bool gps_app_set_tap(gps_id_t id, gps_tap_mode_t mode) {
+    gps_t *gps = gps_get_instance_handle(id);
+
+    if (!gps) {
+        return false;
+    }
+
+    const gps_tap_sink_t *sink = gps_tap_port_sink(mode);
+
+    if (mode != GPS_TAP_OFF && !sink) {
+        return false;
+    }
+
+    gps_tap_set_sink(&gps->tap, sink);
+    return true;
+}
+
 /**
  * @brief GPS 핸들 가져오기 (레거시 호환용)
  * @param id 무시됨 (싱글 인스턴스)
@@ -4,6 +4,7 @@
 #include "FreeRTOS.h"
 #include "board_config.h"
 #include "gps.h"
+#include "gps_tap_port.h"
 #include "queue.h"
 #include "semphr.h"
 #include "task.h"
@@ -78,6 +79,33 @@ gps_t *gps_get_handle(void);
  */
 gps_t *gps_get_instance_handle(gps_id_t id);
 
+/**
+ * @brief 수신 필터 규칙 변경 (런타임)
+ *
+ * 예: gps_app_set_filter(GPS_ID_BASE, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V'),
+ *                        GPS_FILTER_COUNT);
+ *
+ * @param id GPS ID
+ * @param proto GPS_PROTOCOL_NMEA / GPS_PROTOCOL_UNICORE_BIN / GPS_PROTOCOL_RTCM
+ * @param msg_id 메시지 ID (NMEA는 GPS_NMEA_KEY로 패킹한 타입)
+ * @param action 처리 방식
+ * @return true: 성공, false: GPS 미실행 또는 규칙 테이블 가득 참
+ */
+bool gps_app_set_filter(gps_id_t id, gps_protocol_t proto, uint32_t msg_id,
+                        gps_filter_action_t action);
+
+/**
+ * @brief RX 원본 스트림 탭 출력 대상 변경 (런타임)
+ *
+ * 수신한 원본 바이트를 파싱 전에 그대로 미러링. 싱크가 느리면 GPS 태스크를
+ * 멈추지 않고 버림 (gps->tap.dropped_bytes로 확인)
+ *
+ * @param id GPS ID
+ * @param mode 출력 대상 (GPS_TAP_OFF: 끄기)
+ * @return true: 성공, false: GPS 미실행 또는 싱크 초기화 실패
+ */
+bool gps_app_set_tap(gps_id_t id, gps_tap_mode_t mode);
+
 /**
  * @brief GGA 평균 데이터 읽기 가능 여부
  *
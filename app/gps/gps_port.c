@@ -1,16 +1,8 @@
 #include "gps_port.h"
-#include "ringbuffer.h"
 #include "board_config.h"
-#include "stm32f4xx_hal.h"
-#include "stm32f4xx_ll_bus.h"
-#include "stm32f4xx_ll_cortex.h"
-#include "stm32f4xx_ll_dma.h"
-#include "stm32f4xx_ll_gpio.h"
-#include "stm32f4xx_ll_pwr.h"
-#include "stm32f4xx_ll_rcc.h"
-#include "stm32f4xx_ll_system.h"
-#include "stm32f4xx_ll_usart.h"
-#include "stm32f4xx_ll_utils.h"
+#include "main.h"
+#include "uart_dma_hw.h"
+#include "uart_dma_notify.h"
 
 #ifndef TAG
 #define TAG "GPS_PORT"
@@ -18,174 +10,45 @@
 
 #include "log.h"
 
-static char gps_recv_buf[2048];
-static char gps_rb_buffer[2048];
-static gps_t *g_gps_instance = NULL;
-static volatile size_t gps_dma_old_pos = 0;
+#define GPS_TX_SPACE_TIMEOUT_MS 200  /* fire-and-forget 송신의 큐 공간 대기 한도 */
+#define GPS_BAUD_TX_TIMEOUT_MS  100  /* 보드레이트 변경 전 송신 큐 비우기 대기 */
+#define GPS_AUTOBAUD_SAMPLES    8    /* 자동 보드레이트 측정 횟수 (최댓값 사용) */
+#define GPS_AUTOBAUD_TIMEOUT_MS 1500 /* 1 Hz NMEA 출력이 최소 한 번 지나가도록 */
 
-static void gps_dma_process_data(void) {
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    uint8_t dummy = 0;
+static uart_dma_port_t *gps_uart;
+static gps_t *g_gps_instance = NULL;
 
-    if (!g_gps_instance || !g_gps_instance->pkt_queue)
-        return;
+/* RX ISR (IDLE/HT/TC/오류): 링 위치는 이미 공개됨, 원인 비트로 태스크만 깨움 */
+static void gps_uart_event(uart_dma_port_t *port, uint32_t events, void *arg) {
+    gps_t *gps = arg;
 
-    // 현재 DMA 위치 계산
-    size_t pos = sizeof(gps_recv_buf) - LL_DMA_GetDataLength(DMA1, LL_DMA_STREAM_5);
-
-    if (pos != gps_dma_old_pos) {
-        if (pos > gps_dma_old_pos) {
-            // 선형: old_pos ~ pos
-            ringbuffer_write(&g_gps_instance->rx_buf, &gps_recv_buf[gps_dma_old_pos],
-                             pos - gps_dma_old_pos);
-        }
-        else {
-            // 순환: old_pos ~ 끝, 0 ~ pos
-            ringbuffer_write(&g_gps_instance->rx_buf, &gps_recv_buf[gps_dma_old_pos],
-                             sizeof(gps_recv_buf) - gps_dma_old_pos);
-            if (pos > 0) {
-                ringbuffer_write(&g_gps_instance->rx_buf, gps_recv_buf, pos);
-            }
-        }
-
-        gps_dma_old_pos = pos;
-        g_gps_instance->parser_ctx.stats.last_rx_tick = xTaskGetTickCountFromISR();
-        xQueueSendFromISR(g_gps_instance->pkt_queue, &dummy, &xHigherPriorityTaskWoken);
+    (void)port;
+    if (events & UART_DMA_EVT_RX) {
+        gps->parser_ctx.stats.last_rx_tick = xTaskGetTickCountFromISR();
     }
 
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-}
-
-
-/**
- * @brief USART2 Initialization Function
- * @param None
- * @retval None
- */
-static void gps_uart2_init(void) {
-    /* USER CODE BEGIN USART2_Init 0 */
-    /* USER CODE END USART2_Init 0 */
-
-    LL_USART_InitTypeDef USART_InitStruct = {0};
-
-    LL_GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-    /* Peripheral clock enable */
-    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_USART2);
-
-    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOA);
-    /**USART2 GPIO Configuration
-  PA2   ------> USART2_TX
-  PA3   ------> USART2_RX
-  */
-    GPIO_InitStruct.Pin = LL_GPIO_PIN_2 | LL_GPIO_PIN_3;
-    GPIO_InitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-    GPIO_InitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-    GPIO_InitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-    GPIO_InitStruct.Pull = LL_GPIO_PULL_NO;
-    GPIO_InitStruct.Alternate = LL_GPIO_AF_7;
-    LL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-
-    /* USART2 DMA Init */
-
-    /* USART2_RX Init */
-    LL_DMA_SetChannelSelection(DMA1, LL_DMA_STREAM_5, LL_DMA_CHANNEL_4);
-
-    LL_DMA_SetDataTransferDirection(DMA1, LL_DMA_STREAM_5, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
-
-    LL_DMA_SetStreamPriorityLevel(DMA1, LL_DMA_STREAM_5, LL_DMA_PRIORITY_LOW);
-
-    LL_DMA_SetMode(DMA1, LL_DMA_STREAM_5, LL_DMA_MODE_CIRCULAR);
-
-    LL_DMA_SetPeriphIncMode(DMA1, LL_DMA_STREAM_5, LL_DMA_PERIPH_NOINCREMENT);
-
-    LL_DMA_SetMemoryIncMode(DMA1, LL_DMA_STREAM_5, LL_DMA_MEMORY_INCREMENT);
-
-    LL_DMA_SetPeriphSize(DMA1, LL_DMA_STREAM_5, LL_DMA_PDATAALIGN_BYTE);
-
-    LL_DMA_SetMemorySize(DMA1, LL_DMA_STREAM_5, LL_DMA_MDATAALIGN_BYTE);
-
-    LL_DMA_DisableFifoMode(DMA1, LL_DMA_STREAM_5);
-
-    /* USART2 interrupt Init */
-    NVIC_SetPriority(USART2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
-    NVIC_EnableIRQ(USART2_IRQn);
-
-    /* USER CODE BEGIN USART2_Init 1 */
-
-    /* USER CODE END USART2_Init 1 */
-    USART_InitStruct.BaudRate = 115200;
-
-    USART_InitStruct.DataWidth = LL_USART_DATAWIDTH_8B;
-    USART_InitStruct.StopBits = LL_USART_STOPBITS_1;
-    USART_InitStruct.Parity = LL_USART_PARITY_NONE;
-    USART_InitStruct.TransferDirection = LL_USART_DIRECTION_TX_RX;
-    USART_InitStruct.HardwareFlowControl = LL_USART_HWCONTROL_NONE;
-    USART_InitStruct.OverSampling = LL_USART_OVERSAMPLING_16;
-    LL_USART_Init(USART2, &USART_InitStruct);
-    LL_USART_ConfigAsyncMode(USART2);
-    /* USER CODE BEGIN USART2_Init 2 */
-
-    /* USER CODE END USART2_Init 2 */
-}
-
-/**
- * Enable DMA controller clock
- */
-static void gps_uart2_dma_init(void) {
-    /* DMA controller clock enable */
-    __HAL_RCC_DMA1_CLK_ENABLE();
-
-    /* DMA interrupt init */
-    /* DMA1_Stream5_IRQn interrupt configuration */
-    NVIC_SetPriority(DMA1_Stream5_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
-    NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+    uart_dma_notify_from_isr(gps->pkt_task, events);
 }
 
 /**
  * @brief GPS 하드웨어 초기화
  *
+ * USART2/GPDMA2 초기화는 CubeMX(MX_USART2_UART_Init), 채널 구성은 uart_dma_hw
  */
-int gps_rtk_uart2_init(void) {
-    gps_uart2_dma_init();
-    gps_uart2_init();
-
+static int gps_rtk_uart2_init(void) {
     return 0;
 }
 
-/**
- * @brief GPS 통신 시작
- *
- */
-void gps_uart2_comm_start(void) {
-    LL_DMA_SetPeriphAddress(DMA1, LL_DMA_STREAM_5, (uint32_t)&USART2->DR);
-    LL_DMA_SetMemoryAddress(DMA1, LL_DMA_STREAM_5, (uint32_t)&gps_recv_buf);
-    LL_DMA_SetDataLength(DMA1, LL_DMA_STREAM_5, sizeof(gps_recv_buf));
-    LL_DMA_EnableIT_HT(DMA1, LL_DMA_STREAM_5);
-    LL_DMA_EnableIT_TC(DMA1, LL_DMA_STREAM_5);
-    LL_DMA_EnableIT_TE(DMA1, LL_DMA_STREAM_5);
-    LL_DMA_EnableIT_FE(DMA1, LL_DMA_STREAM_5);
-    LL_DMA_EnableIT_DME(DMA1, LL_DMA_STREAM_5);
-
-    LL_USART_EnableIT_IDLE(USART2);
-    LL_USART_EnableIT_PE(USART2);
-    LL_USART_EnableIT_ERROR(USART2);
-    LL_USART_EnableDMAReq_RX(USART2);
-
-    LL_DMA_EnableStream(DMA1, LL_DMA_STREAM_5);
-    LL_USART_Enable(USART2);
-}
-
 /**
  * @brief GPS GPIO 핀 동작
  *
  */
-void gps_rtk_gpio_start(void) {
+static void gps_rtk_gpio_start(void) {
     HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET); // RTK Reset pin
     //  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_1, GPIO_PIN_RESET); // RTK WAKEUP pin
 }
 
-int gps_rtk_reset(void) {
+static int gps_rtk_reset(void) {
     HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_RESET);
     HAL_Delay(500);
     HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET);
@@ -197,24 +60,41 @@ int gps_rtk_reset(void) {
  * @brief GPS enable
  *
  */
-int gps_rtk_start(void) {
-    gps_uart2_comm_start();
+static int gps_rtk_start(void) {
+    uart_dma_port_start(gps_uart);
     gps_rtk_gpio_start();
 
     return 0;
 }
 
-int gps_uart2_send(const char *data, size_t len) {
-    for (int i = 0; i < len; i++) {
-        while (!LL_USART_IsActiveFlag_TXE(USART2))
-            ;
-        LL_USART_TransmitData8(USART2, *(data + i));
-    }
+/**
+ * @brief 송신 큐에 넣고 바로 반환 (NTRIP/LoRa RTCM 주입, 명령어)
+ *
+ * 큐가 가득 차 있으면 최대 GPS_TX_SPACE_TIMEOUT_MS까지 공간을 기다림
+ *
+ * @return 0: 전부 큐에 넣음, -1: 일부 또는 전부 버림
+ */
+static int gps_uart2_send(const char *data, size_t len) {
+    size_t queued = uart_dma_port_write(gps_uart, data, len, GPS_TX_SPACE_TIMEOUT_MS);
 
-    while (!LL_USART_IsActiveFlag_TC(USART2))
-        ;
+    return (queued == len) ? 0 : -1;
+}
 
-    return 0;
+/**
+ * @brief 송신 후 마지막 바이트 전송 완료까지 대기 (보드레이트 변경 전 등)
+ *
+ * @return 0: 전송 완료, -1: 시간 초과 또는 실패
+ */
+static int gps_uart2_send_sync(const char *data, size_t len, uint32_t timeout_ms) {
+    return uart_dma_port_write_sync(gps_uart, data, len, timeout_ms) ? 0 : -1;
+}
+
+static int gps_uart2_set_baudrate(uint32_t baudrate) {
+    return uart_dma_port_set_baudrate(gps_uart, baudrate, GPS_BAUD_TX_TIMEOUT_MS) ? 0 : -1;
+}
+
+static uint32_t gps_uart2_detect_baudrate(void) {
+    return uart_dma_hw_autobaud(UART_DMA_GPS, GPS_AUTOBAUD_SAMPLES, GPS_AUTOBAUD_TIMEOUT_MS);
 }
 
 static const gps_hal_ops_t gps_rtk_uart2_ops = {
@@ -223,66 +103,23 @@ static const gps_hal_ops_t gps_rtk_uart2_ops = {
     .start = gps_rtk_start,
     .stop = NULL,
     .send = gps_uart2_send,
+    .send_sync = gps_uart2_send_sync,
     .recv = NULL,
+    .set_baudrate = gps_uart2_set_baudrate,
+    .detect_baudrate = gps_uart2_detect_baudrate,
 };
 
-/**
- * @brief This function handles USART2 global interrupt.
- */
-void USART2_IRQHandler(void) {
-    if (LL_USART_IsActiveFlag_IDLE(USART2)) {
-        LL_USART_ClearFlag_IDLE(USART2);
-        gps_dma_process_data();
-    }
-    if (LL_USART_IsActiveFlag_PE(USART2)) {
-        LL_USART_ClearFlag_PE(USART2);
-    }
-    if (LL_USART_IsActiveFlag_FE(USART2)) {
-        LL_USART_ClearFlag_FE(USART2);
-    }
-    if (LL_USART_IsActiveFlag_ORE(USART2)) {
-        LL_USART_ClearFlag_ORE(USART2);
-    }
-    if (LL_USART_IsActiveFlag_NE(USART2)) {
-        LL_USART_ClearFlag_NE(USART2);
-    }
-}
-
-/**
- * @brief This function handles DMA1 stream5 global interrupt.
- */
-void DMA1_Stream5_IRQHandler(void) {
-    if (LL_DMA_IsActiveFlag_HT5(DMA1)) {
-        LL_DMA_ClearFlag_HT5(DMA1);
-        gps_dma_process_data();
-    }
-
-    if (LL_DMA_IsActiveFlag_TC5(DMA1)) {
-        LL_DMA_ClearFlag_TC5(DMA1);
-        gps_dma_process_data();
-    }
-
-    if (LL_DMA_IsActiveFlag_TE5(DMA1)) {
-        LL_DMA_ClearFlag_TE5(DMA1);
-    }
-
-    // FIFO Error
-    if (LL_DMA_IsActiveFlag_FE5(DMA1)) {
-        LL_DMA_ClearFlag_FE5(DMA1);
-    }
-
-    // Direct Mode Error
-    if (LL_DMA_IsActiveFlag_DME5(DMA1)) {
-        LL_DMA_ClearFlag_DME5(DMA1);
-    }
-}
-
 int gps_port_init(gps_t *gps_handle) {
-    if (gps_handle) {
-        g_gps_instance = gps_handle;
+    if (!gps_handle) {
+        return -1;
     }
 
-    ringbuffer_init(&gps_handle->rx_buf, gps_rb_buffer, sizeof(gps_rb_buffer));
+    g_gps_instance = gps_handle;
+    gps_uart = uart_dma_hw_port(UART_DMA_GPS);
+
+    /* DMA 수신 버퍼를 그대로 GPS RX 링버퍼로 사용 */
+    uart_dma_port_bind_rx(gps_uart, &gps_handle->rx_buf);
+    uart_dma_port_set_event_cb(gps_uart, gps_uart_event, gps_handle);
 
     gps_handle->ops = &gps_rtk_uart2_ops;
     if (gps_handle->ops->init) {
@@ -307,16 +144,11 @@ void gps_port_start(gps_t *gps_handle) {
 /**
  * @brief GPS UART2 통신 정지
  *
- * UART 페리페럴을 리셋하여 모든 통신을 정지합니다.
- * 클럭 리셋으로 UART 레지스터가 초기화되고 DMA 요청도 비활성화됩니다.
+ * USART/DMA 요청과 두 채널을 멈추고 송신 큐, RX 링 위치를 초기화
+ * (재시작 시 DMA는 버퍼 처음부터 씀). gps_stop으로 파서 태스크를 먼저 멈춘 뒤 호출
  */
 static void gps_uart2_comm_stop(void) {
-    /* UART2 페리페럴 리셋 (LL 사용) */
-    LL_APB1_GRP1_ForceReset(LL_APB1_GRP1_PERIPH_USART2);
-    LL_APB1_GRP1_ReleaseReset(LL_APB1_GRP1_PERIPH_USART2);
-
-    /* DMA 위치 초기화 */
-    gps_dma_old_pos = 0;
+    uart_dma_port_stop(gps_uart);
 
     LOG_INFO("GPS UART2 통신 정지 완료");
 }
@@ -362,6 +194,16 @@ void gps_port_stop(gps_t *gps_handle) {
     g_gps_instance = NULL;
 }
 
+/**
+ * @brief RX 알림 해제 (포트는 계속 동작)
+ *
+ * 파서 태스크를 멈추기 전에 호출해서 ISR이 종료 중인 태스크를 깨우지 않게 함
+ */
+void gps_port_detach(gps_t *gps_handle) {
+    (void)gps_handle;
+    uart_dma_port_set_event_cb(gps_uart, NULL, NULL);
+}
+
 /**
  * @brief GPS 포트 리소스 정리
  */
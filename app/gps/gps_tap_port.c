@@ -0,0 +1,137 @@
+/**
+ * @file gps_tap_port.c
+ * @brief GPS RX 원본 스트림 탭 싱크 (RTT, 디버그 UART, 캡처 버퍼)
+ *
+ * 싱크는 처음 선택될 때 초기화되고 이후 계속 유지됨 (탭을 꺼도 메모리 유지).
+ * 모든 싱크는 비차단: 공간이 부족하면 GPS 태스크를 멈추지 않고 버림
+ */
+
+#include "gps_tap_port.h"
+#include "gps_config.h"
+#include "main.h"
+#include "SEGGER_RTT.h"
+#include <stdbool.h>
+
+#ifndef TAG
+#define TAG "GPS_TAP"
+#endif
+
+#include "log.h"
+
+extern UART_HandleTypeDef huart6; /* 디버그 UART (PC6/PC7) */
+
+/*===========================================================================
+ * RTT 싱크
+ *===========================================================================*/
+
+static char rtt_buf[GPS_TAP_RTT_BUF_SIZE];
+static bool rtt_ready = false;
+
+/* NO_BLOCK_TRIM 채널: 들어가는 만큼만 쓰고 바로 반환 */
+static size_t rtt_write(void *ctx, const char *data, size_t len) {
+    (void)ctx;
+    return SEGGER_RTT_Write(GPS_TAP_RTT_CHANNEL, data, (unsigned)len);
+}
+
+static const gps_tap_sink_t rtt_sink = {
+    .write = rtt_write,
+    .ctx = NULL,
+};
+
+static const gps_tap_sink_t *rtt_sink_get(void) {
+    if (!rtt_ready) {
+        if (SEGGER_RTT_ConfigUpBuffer(GPS_TAP_RTT_CHANNEL, "gps_raw", rtt_buf, sizeof(rtt_buf),
+                                      SEGGER_RTT_MODE_NO_BLOCK_TRIM) < 0) {
+            LOG_ERR("RTT channel %d config failed", GPS_TAP_RTT_CHANNEL);
+            return NULL;
+        }
+        rtt_ready = true;
+    }
+
+    return &rtt_sink;
+}
+
+/*===========================================================================
+ * 디버그 UART 싱크
+ *===========================================================================*/
+
+static gps_tap_stream_t uart_stream;
+static uint8_t uart_q_mem[GPS_TAP_UART_Q_SIZE];
+static const gps_tap_sink_t *uart_sink = NULL;
+
+/*
+ * TX DMA 채널이 연결되어 있으면 DMA, 아니면 인터럽트 전송.
+ * 로그 출력이 같은 UART를 쓰는 중이면 HAL_BUSY로 실패하고 블록은 버려짐
+ */
+static bool uart_start(void *ctx, const uint8_t *data, size_t len) {
+    UART_HandleTypeDef *huart = (UART_HandleTypeDef *)ctx;
+    HAL_StatusTypeDef ret;
+
+    if (huart->hdmatx) {
+        ret = HAL_UART_Transmit_DMA(huart, data, (uint16_t)len);
+    } else {
+        ret = HAL_UART_Transmit_IT(huart, data, (uint16_t)len);
+    }
+
+    return ret == HAL_OK;
+}
+
+static const gps_tap_sink_t *uart_sink_get(void) {
+    if (!uart_sink) {
+        uart_sink = gps_tap_stream_init(&uart_stream, uart_q_mem, sizeof(uart_q_mem), uart_start,
+                                        &huart6);
+    }
+
+    return uart_sink;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+    if (huart == &huart6 && uart_sink) {
+        gps_tap_stream_tx_done(&uart_stream);
+    }
+}
+
+/*===========================================================================
+ * 캡처 버퍼 싱크
+ *===========================================================================*/
+
+static gps_tap_capture_t capture;
+static char capture_mem[GPS_TAP_CAPTURE_SIZE];
+static const gps_tap_sink_t *capture_sink = NULL;
+
+/* 선택할 때마다 처음부터 다시 캡처 */
+static const gps_tap_sink_t *capture_sink_get(void) {
+    if (!capture_sink) {
+        capture_sink = gps_tap_capture_init(&capture, capture_mem, sizeof(capture_mem));
+    } else {
+        gps_tap_capture_clear(&capture);
+    }
+
+    return capture_sink;
+}
+
+/*===========================================================================
+ * API
+ *===========================================================================*/
+
+const gps_tap_sink_t *gps_tap_port_sink(gps_tap_mode_t mode) {
+    switch (mode) {
+    case GPS_TAP_RTT:
+        return rtt_sink_get();
+    case GPS_TAP_UART:
+        return uart_sink_get();
+    case GPS_TAP_CAPTURE:
+        return capture_sink_get();
+    case GPS_TAP_OFF:
+    default:
+        return NULL;
+    }
+}
+
+const char *gps_tap_port_capture(size_t *len) {
+    if (len) {
+        *len = capture_sink ? capture.len : 0;
+    }
+
+    return capture_mem;
+}
@@ -0,0 +1,33 @@
+#ifndef GPS_TAP_PORT_H
+#define GPS_TAP_PORT_H
+
+#include "gps_tap.h"
+#include <stddef.h>
+
+/**
+ * @brief RX 원본 스트림 탭 출력 대상
+ */
+typedef enum {
+    GPS_TAP_OFF = 0, /**< 비활성 */
+    GPS_TAP_RTT,     /**< SEGGER RTT up 채널 (GPS_TAP_RTT_CHANNEL) */
+    GPS_TAP_UART,    /**< 디버그 UART(USART6) 비동기 전송 */
+    GPS_TAP_CAPTURE, /**< 캡처 버퍼 (gps_tap_port_capture로 조회) */
+} gps_tap_mode_t;
+
+/**
+ * @brief 출력 대상별 싱크 가져오기 (처음 사용할 때 초기화)
+ *
+ * @param mode 출력 대상
+ * @return const gps_tap_sink_t* 싱크, GPS_TAP_OFF면 NULL
+ */
+const gps_tap_sink_t *gps_tap_port_sink(gps_tap_mode_t mode);
+
+/**
+ * @brief 캡처 버퍼 내용 조회
+ *
+ * @param[out] len 저장된 바이트 수
+ * @return const char* 캡처 버퍼
+ */
+const char *gps_tap_port_capture(size_t *len);
+
+#endif
@@ -6,6 +6,7 @@
 #include "lte_init.h"
 #include "ntrip_app.h"
 #include "timers.h"
+#include "uart_dma_notify.h"
 #include <string.h>
 
 #define TAG "GSM"
@@ -14,10 +15,7 @@
 
 void gsm_socket_monitor_start(void);
 
-char gsm_mem[2048];
-
 gsm_t gsm_handle;
-QueueHandle_t gsm_queue;
 static bool gsm_task_created = false;
 
 void gsm_socket_monitor_stop(void);
@@ -151,13 +149,6 @@ static void gsm_evt_handler(gsm_evt_t evt, void *args) {
  * @param pvParameter
  */
 static void gsm_process_task(void *pvParameter) {
-    size_t pos = 0;
-    size_t old_pos = 0;
-    uint8_t dummy = 0;
-    size_t total_received = 0;
-
-    gsm_queue = xQueueCreate(10, 1);
-
     // 네트워크 체크 타이머 생성 (한 번만, 재사용)
     TimerHandle_t network_timer =
         xTimerCreate("lte_net_chk", pdMS_TO_TICKS(LTE_NETWORK_CHECK_INTERVAL_MS),
@@ -168,6 +159,8 @@ static void gsm_process_task(void *pvParameter) {
     gsm_port_init();
     gsm_start();
 
+    ringbuffer_t *rx = gsm_port_get_rx();
+
     // LTE 초기화 모듈 설정
     lte_set_gsm_handle(&gsm_handle);
     lte_set_network_check_timer(network_timer);
@@ -180,37 +173,29 @@ static void gsm_process_task(void *pvParameter) {
     led_set_state(LED_ID_1, true);
 
     while (1) {
-        xQueueReceive(gsm_queue, &dummy, portMAX_DELAY);
+        /* RX 알림 대기: 여러 번의 ISR이 한 번의 깨어남으로 합쳐짐 */
+        uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
         led_set_toggle(LED_ID_1);
-        pos = gsm_get_rx_pos();
-
-        if (pos != old_pos) {
-            if (pos > old_pos) {
-                size_t len = pos - old_pos;
-                total_received = len;
-                LOG_DEBUG("RX: %u bytes", len);
-                //        LOG_DEBUG_RAW("RAW: ", &gsm_mem[old_pos], len);
-                gsm_parse_process(&gsm_handle, &gsm_mem[old_pos], pos - old_pos);
-            }
-            else {
-                size_t len1 = sizeof(gsm_mem) - old_pos;
-                size_t len2 = pos;
-                total_received = len1 + len2;
-                LOG_DEBUG("RX: %u bytes (wrapped: %u+%u)", total_received, len1, len2);
-
-                //        LOG_DEBUG_RAW("RAW: ", &gsm_mem[old_pos], len1);
-                gsm_parse_process(&gsm_handle, &gsm_mem[old_pos], sizeof(gsm_mem) - old_pos);
-                if (pos > 0) {
-                    //          LOG_DEBUG_RAW("RAW: ", gsm_mem, len2);
-
-                    gsm_parse_process(&gsm_handle, gsm_mem, pos);
-                }
-            }
-            old_pos = pos;
-            if (old_pos == sizeof(gsm_mem)) {
-                old_pos = 0;
-            }
+
+        if (bits & UART_DMA_NOTIFY_OVERFLOW) {
+            LOG_WARN("RX overflow");
+        }
+
+        /* 쌓인 데이터를 한 번에 처리 (DMA 버퍼 경계에서 최대 두 조각) */
+        ringbuffer_span_t spans[2];
+        size_t total_received = ringbuffer_size(rx);
+
+        if (total_received == 0) {
+            continue;
+        }
+
+        size_t span_cnt = ringbuffer_peek_spans(rx, 0, total_received, spans);
+        LOG_DEBUG("RX: %u bytes", total_received);
+        for (size_t i = 0; i < span_cnt; i++) {
+            //        LOG_DEBUG_RAW("RAW: ", spans[i].data, spans[i].len);
+            gsm_parse_process(&gsm_handle, spans[i].data, spans[i].len);
         }
+        ringbuffer_consume(rx, total_received);
     }
 
     vTaskDelete(NULL);
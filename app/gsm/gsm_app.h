@@ -5,8 +5,6 @@
 #include "queue.h"
 #include "task.h"
 
-extern QueueHandle_t gsm_queue;
-
 void gsm_task_create(void *arg);
 void gsm_socket_monitor_start(void);
 void gsm_start_rover(void);
@@ -1,20 +1,11 @@
 #include "gsm_port.h"
 #include "FreeRTOS.h"
-#include "stm32f4xx_hal.h"
-#include "stm32f4xx_ll_bus.h"
-#include "stm32f4xx_ll_cortex.h"
-#include "stm32f4xx_ll_dma.h"
-#include "stm32f4xx_ll_gpio.h"
-#include "stm32f4xx_ll_pwr.h"
-#include "stm32f4xx_ll_rcc.h"
-#include "stm32f4xx_ll_system.h"
-#include "stm32f4xx_ll_usart.h"
-#include "stm32f4xx_ll_utils.h"
+#include "main.h"
 #include "task.h"
+#include "uart_dma_hw.h"
+#include "uart_dma_notify.h"
 
-#define GSM_PORT_UART            USART1
-#define GSM_PORT_UART_DMA        DMA2
-#define GSM_PORT_UART_DMA_STREAM LL_DMA_STREAM_2
+#define GSM_TX_SPACE_TIMEOUT_MS 1000 /* AT 명령/소켓 데이터 큐 공간 대기 한도 */
 
 #define GSM_PORT_GPIO_PORT         GPIOB
 #define GSM_PORT_GPIO_PWR_PIN      GPIO_PIN_3
@@ -22,106 +13,11 @@
 #define GSM_PORT_GPIO_AIRPLANE_PIN GPIO_PIN_5
 #define GSM_PORT_GPIO_WAKEUP_PIN   GPIO_PIN_6
 
-extern char gsm_mem[2048];
-
-/**
- * Enable DMA controller clock
- */
-void gsm_dma_init(void) {
-    /* DMA controller clock enable */
-    __HAL_RCC_DMA2_CLK_ENABLE();
-
-    /* DMA2_Stream2_IRQn interrupt configuration */
-    NVIC_SetPriority(DMA2_Stream2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
-    NVIC_EnableIRQ(DMA2_Stream2_IRQn);
-}
-
-void gsm_uart_init(void) {
-    /* USER CODE BEGIN USART1_Init 0 */
-
-    /* USER CODE END USART1_Init 0 */
-
-    LL_USART_InitTypeDef USART_InitStruct = {0};
-
-    LL_GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-    /* Peripheral clock enable */
-    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART1);
-
-    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOA);
-    /**USART1 GPIO Configuration
-  PA9   ------> USART1_TX
-  PA10   ------> USART1_RX
-  */
-    GPIO_InitStruct.Pin = LL_GPIO_PIN_9 | LL_GPIO_PIN_10;
-    GPIO_InitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-    GPIO_InitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-    GPIO_InitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-    GPIO_InitStruct.Pull = LL_GPIO_PULL_NO;
-    GPIO_InitStruct.Alternate = LL_GPIO_AF_7;
-    LL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-
-    /* USART1 DMA Init */
-
-    /* USART1_RX Init */
-    LL_DMA_SetChannelSelection(DMA2, LL_DMA_STREAM_2, LL_DMA_CHANNEL_4);
-
-    LL_DMA_SetDataTransferDirection(DMA2, LL_DMA_STREAM_2, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
-
-    LL_DMA_SetStreamPriorityLevel(DMA2, LL_DMA_STREAM_2, LL_DMA_PRIORITY_LOW);
-
-    LL_DMA_SetMode(DMA2, LL_DMA_STREAM_2, LL_DMA_MODE_CIRCULAR);
-
-    LL_DMA_SetPeriphIncMode(DMA2, LL_DMA_STREAM_2, LL_DMA_PERIPH_NOINCREMENT);
-
-    LL_DMA_SetMemoryIncMode(DMA2, LL_DMA_STREAM_2, LL_DMA_MEMORY_INCREMENT);
-
-    LL_DMA_SetPeriphSize(DMA2, LL_DMA_STREAM_2, LL_DMA_PDATAALIGN_BYTE);
-
-    LL_DMA_SetMemorySize(DMA2, LL_DMA_STREAM_2, LL_DMA_MDATAALIGN_BYTE);
-
-    LL_DMA_DisableFifoMode(DMA2, LL_DMA_STREAM_2);
-
-    /* USART1 interrupt Init */
-    NVIC_SetPriority(USART1_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
-    NVIC_EnableIRQ(USART1_IRQn);
-
-    /* USER CODE BEGIN USART1_Init 1 */
-
-    /* USER CODE END USART1_Init 1 */
-    USART_InitStruct.BaudRate = 115200;
-    USART_InitStruct.DataWidth = LL_USART_DATAWIDTH_8B;
-    USART_InitStruct.StopBits = LL_USART_STOPBITS_1;
-    USART_InitStruct.Parity = LL_USART_PARITY_NONE;
-    USART_InitStruct.TransferDirection = LL_USART_DIRECTION_TX_RX;
-    USART_InitStruct.HardwareFlowControl = LL_USART_HWCONTROL_NONE;
-    USART_InitStruct.OverSampling = LL_USART_OVERSAMPLING_16;
-    LL_USART_Init(USART1, &USART_InitStruct);
-    LL_USART_ConfigAsyncMode(USART1);
-    LL_USART_Enable(USART1);
-    /* USER CODE BEGIN USART1_Init 2 */
-
-    /* USER CODE END USART1_Init 2 */
-}
+static uart_dma_port_t *gsm_uart;
+static TaskHandle_t gsm_rx_task; /* RX ISR 알림 대상 (gsm_port_init 호출 태스크) */
 
 void gsm_port_comm_start(void) {
-    LL_DMA_SetPeriphAddress(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM,
-                            (uint32_t)&GSM_PORT_UART->DR);
-    LL_DMA_SetMemoryAddress(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM, (uint32_t)&gsm_mem);
-    LL_DMA_SetDataLength(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM, sizeof(gsm_mem));
-    LL_DMA_EnableIT_HT(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
-    LL_DMA_EnableIT_TC(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
-    LL_DMA_EnableIT_TE(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
-    LL_DMA_EnableIT_FE(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
-    LL_DMA_EnableIT_DME(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
-
-    LL_USART_EnableIT_IDLE(GSM_PORT_UART);
-    LL_USART_EnableIT_PE(GSM_PORT_UART);
-    LL_USART_EnableIT_ERROR(GSM_PORT_UART);
-    LL_USART_EnableDMAReq_RX(GSM_PORT_UART);
-
-    LL_DMA_EnableStream(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
-    LL_USART_Enable(GSM_PORT_UART);
+    uart_dma_port_start(gsm_uart);
 }
 
 void gsm_port_gpio_start(void) {
@@ -155,17 +51,32 @@ int gsm_port_power_on(void) {
 }
 
 /**
- * @brief dma 버퍼 위치 반환
+ * @brief RX 링버퍼 (메모리: DMA 수신 버퍼, 읽은 만큼 consume)
+ */
+ringbuffer_t *gsm_port_get_rx(void) {
+    return uart_dma_port_rx(gsm_uart);
+}
+
+/**
+ * @brief AT 명령 송신 (gsm_hal_ops_t.send)
  *
- * @return uint32_t
+ * DMA 송신 큐에 넣고 바로 반환, 큐가 가득 차면 GSM_TX_SPACE_TIMEOUT_MS까지 대기
+ *
+ * @return int 0: 전부 큐에 넣음, -1: 일부 또는 전부 버림
  */
-uint32_t gsm_get_rx_pos(void) {
-    return sizeof(gsm_mem) - LL_DMA_GetDataLength(GSM_PORT_UART_DMA, GSM_PORT_UART_DMA_STREAM);
+int gsm_port_send(const char *data, size_t len) {
+    size_t queued = uart_dma_port_write(gsm_uart, data, len, GSM_TX_SPACE_TIMEOUT_MS);
+
+    return (queued == len) ? 0 : -1;
 }
 
+/**
+ * @brief 포트 준비, 호출한 태스크가 RX 알림을 받음 (gsm_process_task)
+ */
 void gsm_port_init(void) {
-    gsm_dma_init();
-    gsm_uart_init();
+    gsm_rx_task = xTaskGetCurrentTaskHandle();
+    gsm_uart = uart_dma_hw_port(UART_DMA_LTE);
+    uart_dma_port_set_event_cb(gsm_uart, uart_dma_notify_cb, &gsm_rx_task);
 }
 
 void gsm_start(void) {
@@ -197,61 +108,6 @@ int gsm_port_reset(void) {
     return 0;
 }
 
-/**
- * @brief This function handles USART1 global interrupt.
- */
-void USART1_IRQHandler(void) {
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    if (LL_USART_IsActiveFlag_IDLE(GSM_PORT_UART)) {
-        if (gsm_queue != NULL) {
-            uint8_t dummy = 0;
-            xQueueSendFromISR(gsm_queue, &dummy, &xHigherPriorityTaskWoken);
-        }
-        LL_USART_ClearFlag_IDLE(GSM_PORT_UART);
-    }
-    /* USER CODE BEGIN USART1_IRQn 0 */
-
-    if (LL_USART_IsActiveFlag_PE(GSM_PORT_UART)) {
-        LL_USART_ClearFlag_PE(GSM_PORT_UART);
-    }
-    if (LL_USART_IsActiveFlag_FE(GSM_PORT_UART)) {
-        LL_USART_ClearFlag_FE(GSM_PORT_UART);
-    }
-    if (LL_USART_IsActiveFlag_ORE(GSM_PORT_UART)) {
-        LL_USART_ClearFlag_ORE(GSM_PORT_UART);
-    }
-    if (LL_USART_IsActiveFlag_NE(GSM_PORT_UART)) {
-        LL_USART_ClearFlag_NE(GSM_PORT_UART);
-    }
-
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-    /* USER CODE END USART1_IRQn 0 */
-    /* USER CODE BEGIN USART1_IRQn 1 */
-
-    /* USER CODE END USART1_IRQn 1 */
-}
-
-/**
- * @brief This function handles DMA2 stream2 global interrupt.
- */
-void DMA2_Stream2_IRQHandler(void) {
-    /* USER CODE BEGIN DMA2_Stream2_IRQn 0 */
-    LL_DMA_ClearFlag_TC2(GSM_PORT_UART_DMA);
-    LL_DMA_ClearFlag_HT2(GSM_PORT_UART_DMA);
-
-    if (gsm_queue != NULL) {
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        uint8_t dummy = 0;
-        xQueueSendFromISR(gsm_queue, &dummy, &xHigherPriorityTaskWoken);
-        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-    }
-    /* USER CODE END DMA2_Stream2_IRQn 0 */
-    /* USER CODE BEGIN DMA2_Stream2_IRQn 1 */
-
-    /* USER CODE END DMA2_Stream2_IRQn 1 */
-}
-
 void gsm_port_power_off(void) {
     HAL_GPIO_WritePin(GSM_PORT_GPIO_PORT, GSM_PORT_GPIO_PWR_PIN, GPIO_PIN_SET);
     vTaskDelay(pdMS_TO_TICKS(800));
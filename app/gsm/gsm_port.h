@@ -3,12 +3,12 @@
 
 #include <stdbool.h>
 #include "gsm_app.h"
+#include "ringbuffer.h"
 
-void gsm_dma_init(void);
-void gsm_uart_init(void);
 void gsm_port_comm_start(void);
 void gsm_port_gpio_start(void);
-uint32_t gsm_get_rx_pos(void);
+ringbuffer_t *gsm_port_get_rx(void);
+int gsm_port_send(const char *data, size_t len);
 void gsm_port_init(void);
 void gsm_start(void);
 
@@ -7,6 +7,8 @@
 #include "gps_app.h"
 #include "rtcm.h"
 #include "semphr.h"
+#include "uart_dma_notify.h"
+#include "dev_assert.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -249,6 +251,11 @@ static bool lora_parse_at_response(const char *data, size_t len) {
     return false;
 }
 
+/* 기지국이 보내는 최대 길이 프레임을 fragment 하나 여유를 두고 통째로 담아야 함 */
+STATIC_ASSERT(RTCM_REASSEMBLY_BUF_SIZE >= RTCM_MAX_FRAME + RTCM_MAX_FRAGMENT_SIZE,
+              "RTCM_REASSEMBLY_BUF_SIZE too small for RTCM_MAX_FRAME");
+STATIC_ASSERT(RTCM_REASSEMBLY_BUF_SIZE <= UINT16_MAX, "buffer_pos is uint16_t");
+
 /**
  * @brief RTCM fragment 재조립 버퍼 초기화
  */
@@ -563,10 +570,6 @@ static void lora_tx_task(void *pvParameter) {
  * @brief LoRa RX Task (수신 데이터 처리)
  */
 static void lora_process_task(void *pvParameter) {
-    size_t pos = 0;
-    size_t old_pos = 0;
-    uint8_t dummy = 0;
-
     __attribute__((section(".ccmram"))) static char temp_buf[1024];
     LOG_INFO("LoRa RX Task started");
 
@@ -592,235 +595,126 @@ static void lora_process_task(void *pvParameter) {
         led_set_state(3, true);
     }
 
-    while (1) {
-        xQueueReceive(instance.lora.rx_queue, &dummy, portMAX_DELAY);
-
-        pos = lora_port_get_rx_pos();
-        char *lora_recv = lora_port_get_recv_buf();
-
-        if (pos != old_pos) {
-            size_t len = 0;
+    ringbuffer_t *rx = lora_port_get_rx();
 
-            if (pos > old_pos) {
-                len = pos - old_pos;
+    while (1) {
+        /* RX 알림 대기: 여러 번의 ISR이 한 번의 깨어남으로 합쳐짐 */
+        uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
 
-                // 데이터 처리
-                memcpy(temp_buf, &lora_recv[old_pos], len);
-                temp_buf[len] = '\0';
+        if (bits & UART_DMA_NOTIFY_OVERFLOW) {
+            LOG_WARN("LoRa RX overflow");
+        }
 
-                // AT 명령어 응답 처리
-                if (instance.lora.current_cmd_req != NULL) {
-                    bool result = lora_parse_at_response(temp_buf, len);
-                    LOG_INFO("Parse result: %s", result ? "OK" : "ERROR/NONE");
+        /* 쌓인 데이터를 한 번에 꺼냄 (링 경계 처리는 ringbuffer_read) */
+        size_t len = ringbuffer_read(rx, temp_buf, sizeof(temp_buf) - 1);
+        if (len == 0) {
+            continue;
+        }
+        temp_buf[len] = '\0';
 
-                    if (strstr(temp_buf, "OK") || strstr(temp_buf, "ERROR")) {
-                        // 응답 결과 저장
-                        if (instance.lora.current_cmd_req->is_async) {
-                            instance.lora.current_cmd_req->async_result = result;
-                        }
-                        else {
-                            *(instance.lora.current_cmd_req->result) = result;
-                        }
+        // AT 명령어 응답 처리
+        if (instance.lora.current_cmd_req != NULL) {
+            bool result = lora_parse_at_response(temp_buf, len);
+            LOG_INFO("Parse result: %s", result ? "OK" : "ERROR/NONE");
 
-                        // 세마포어 해제 (TX Task로 응답 완료 알림)
-                        xSemaphoreGive(instance.lora.current_cmd_req->response_sem);
-                    }
-                    else {
-                        LOG_WARN("No OK/ERROR in response");
-                    }
+            if (strstr(temp_buf, "OK") || strstr(temp_buf, "ERROR")) {
+                // 응답 결과 저장
+                if (instance.lora.current_cmd_req->is_async) {
+                    instance.lora.current_cmd_req->async_result = result;
                 }
                 else {
-                    LOG_WARN("current_cmd_req is NULL, skipping response handling");
-                }
-
-                // P2P 수신 데이터 처리 (at+recv=...)
-                // 초기화 완료 후에만 처리 (초기화 중 데이터는 무시)
-
-                if ((strstr(temp_buf, "at+recv=") || strstr(temp_buf, "AT+RECV=")) &&
-                    instance.lora.init_complete) {
-                    if (config->lora_mode == LORA_MODE_ROVER) {
-                        led_set_toggle(3);
-                    }
-
-                    lora_p2p_recv_data_t recv_data;
-
-                    if (lora_parse_p2p_recv(temp_buf, &recv_data)) {
-                        // 콜백이 등록되어 있으면 콜백 호출
-                        if (instance.lora.p2p_recv_callback) {
-                            instance.lora.p2p_recv_callback(&recv_data,
-                                                            instance.lora.p2p_recv_user_data);
-                        }
-                        else {
-                            // 콜백이 없으면 RTCM fragment 재조립 및 GPS로 전송
-                            LOG_INFO("P2P data received: %d bytes, RSSI=%d, SNR=%d",
-                                     recv_data.data_len, recv_data.rssi, recv_data.snr);
-
-                            // RTCM fragment 재조립
-                            bool complete = rtcm_reassembly_process(&instance.lora.rtcm_reassembly,
-                                                                    (uint8_t *)recv_data.data,
-                                                                    recv_data.data_len);
-
-                            if (complete) {
-                                // 완전한 RTCM 패킷 수신 - 검증 후 GPS로 전송
-                                if (rtcm_validate_packet(
-                                        instance.lora.rtcm_reassembly.buffer,
-                                        instance.lora.rtcm_reassembly.expected_len)) {
-                                    LOG_INFO("Valid RTCM packet - sending to GPS via UART");
-
-                                    // GPS UART로 직접 전송
-                                    if (!gps_send_raw_data(
-                                            GPS_ID_BASE, instance.lora.rtcm_reassembly.buffer,
-                                            instance.lora.rtcm_reassembly.expected_len)) {
-                                        LOG_ERR("Failed to send RTCM data to GPS");
-                                    }
-                                }
-                                else {
-                                    LOG_ERR("Invalid RTCM packet - discarding");
-                                }
-
-                                // 남은 데이터 처리 (다음 RTCM 패킷의 시작일 수 있음)
-                                if (instance.lora.rtcm_reassembly.buffer_pos >
-                                    instance.lora.rtcm_reassembly.expected_len) {
-                                    size_t remaining = instance.lora.rtcm_reassembly.buffer_pos -
-                                                       instance.lora.rtcm_reassembly.expected_len;
-                                    LOG_INFO("Remaining %d bytes in buffer - moving to front",
-                                             remaining);
-
-                                    // 남은 데이터를 버퍼 앞으로 이동
-                                    memmove(
-                                        instance.lora.rtcm_reassembly.buffer,
-                                        &instance.lora.rtcm_reassembly
-                                             .buffer[instance.lora.rtcm_reassembly.expected_len],
-                                        remaining);
-                                    instance.lora.rtcm_reassembly.buffer_pos = remaining;
-                                    instance.lora.rtcm_reassembly.has_header = false;
-                                    instance.lora.rtcm_reassembly.expected_len = 0;
-
-                                    // 남은 데이터로 다음 패킷 시작 시도
-                                    // (재귀 호출 대신 다음 수신에서 처리됨)
-                                }
-                                else {
-                                    // 남은 데이터가 없으면 완전히 초기화
-                                    rtcm_reassembly_reset(&instance.lora.rtcm_reassembly);
-                                }
-                            }
-                        }
-                    }
-                }
-                else if ((strstr(temp_buf, "at+recv=") || strstr(temp_buf, "AT+RECV=")) &&
-                         !instance.lora.init_complete) {
-                    LOG_WARN("Ignoring P2P data during initialization");
+                    *(instance.lora.current_cmd_req->result) = result;
                 }
 
-                old_pos = pos;
+                // 세마포어 해제 (TX Task로 응답 완료 알림)
+                xSemaphoreGive(instance.lora.current_cmd_req->response_sem);
             }
             else {
-                // Circular buffer wrap-around
-                len = LORA_RECV_BUF_SIZE - old_pos + pos;
+                LOG_WARN("No OK/ERROR in response");
+            }
+        }
+        else {
+            LOG_WARN("current_cmd_req is NULL, skipping response handling");
+        }
 
-                size_t first_part = LORA_RECV_BUF_SIZE - old_pos;
-                memcpy(temp_buf, &lora_recv[old_pos], first_part);
-                memcpy(&temp_buf[first_part], &lora_recv[0], pos);
-                temp_buf[len] = '\0';
+        // P2P 수신 데이터 처리 (at+recv=...)
+        // 초기화 완료 후에만 처리 (초기화 중 데이터는 무시)
 
-                LOG_INFO("LoRa recv (wrap): %s", temp_buf);
+        if ((strstr(temp_buf, "at+recv=") || strstr(temp_buf, "AT+RECV=")) &&
+            instance.lora.init_complete) {
+            if (config->lora_mode == LORA_MODE_ROVER) {
+                led_set_toggle(3);
+            }
 
-                // 동일한 처리 로직
-                if (instance.lora.current_cmd_req != NULL) {
-                    bool result = lora_parse_at_response(temp_buf, len);
+            lora_p2p_recv_data_t recv_data;
 
-                    if (strstr(temp_buf, "OK") || strstr(temp_buf, "ERROR")) {
-                        if (instance.lora.current_cmd_req->is_async) {
-                            instance.lora.current_cmd_req->async_result = result;
+            if (lora_parse_p2p_recv(temp_buf, &recv_data)) {
+                // 콜백이 등록되어 있으면 콜백 호출
+                if (instance.lora.p2p_recv_callback) {
+                    instance.lora.p2p_recv_callback(&recv_data,
+                                                    instance.lora.p2p_recv_user_data);
+                }
+                else {
+                    // 콜백이 없으면 RTCM fragment 재조립 및 GPS로 전송
+                    LOG_INFO("P2P data received: %d bytes, RSSI=%d, SNR=%d",
+                             recv_data.data_len, recv_data.rssi, recv_data.snr);
+
+                    // RTCM fragment 재조립
+                    bool complete = rtcm_reassembly_process(&instance.lora.rtcm_reassembly,
+                                                            (uint8_t *)recv_data.data,
+                                                            recv_data.data_len);
+
+                    if (complete) {
+                        // 완전한 RTCM 패킷 수신 - 검증 후 GPS로 전송
+                        if (rtcm_validate_packet(
+                                instance.lora.rtcm_reassembly.buffer,
+                                instance.lora.rtcm_reassembly.expected_len)) {
+                            LOG_INFO("Valid RTCM packet - sending to GPS via UART");
+
+                            // GPS UART로 직접 전송
+                            if (!gps_send_raw_data(
+                                    GPS_ID_BASE, instance.lora.rtcm_reassembly.buffer,
+                                    instance.lora.rtcm_reassembly.expected_len)) {
+                                LOG_ERR("Failed to send RTCM data to GPS");
+                            }
                         }
                         else {
-                            *(instance.lora.current_cmd_req->result) = result;
+                            LOG_ERR("Invalid RTCM packet - discarding");
                         }
 
-                        xSemaphoreGive(instance.lora.current_cmd_req->response_sem);
-                    }
-                }
-
-                if ((strstr(temp_buf, "at+recv=") || strstr(temp_buf, "AT+RECV=")) &&
-                    instance.lora.init_complete) {
-                    if (config->lora_mode == LORA_MODE_ROVER) {
-                        led_set_toggle(3);
-                    }
-
-                    lora_p2p_recv_data_t recv_data;
-
-                    if (lora_parse_p2p_recv(temp_buf, &recv_data)) {
-                        // 콜백이 등록되어 있으면 콜백 호출
-                        if (instance.lora.p2p_recv_callback) {
-                            instance.lora.p2p_recv_callback(&recv_data,
-                                                            instance.lora.p2p_recv_user_data);
+                        // 남은 데이터 처리 (다음 RTCM 패킷의 시작일 수 있음)
+                        if (instance.lora.rtcm_reassembly.buffer_pos >
+                            instance.lora.rtcm_reassembly.expected_len) {
+                            size_t remaining = instance.lora.rtcm_reassembly.buffer_pos -
+                                               instance.lora.rtcm_reassembly.expected_len;
+                            LOG_INFO("Remaining %d bytes in buffer - moving to front",
+                                     remaining);
+
+                            // 남은 데이터를 버퍼 앞으로 이동
+                            memmove(
+                                instance.lora.rtcm_reassembly.buffer,
+                                &instance.lora.rtcm_reassembly
+                                     .buffer[instance.lora.rtcm_reassembly.expected_len],
+                                remaining);
+                            instance.lora.rtcm_reassembly.buffer_pos = remaining;
+                            instance.lora.rtcm_reassembly.has_header = false;
+                            instance.lora.rtcm_reassembly.expected_len = 0;
+
+                            // 남은 데이터로 다음 패킷 시작 시도
+                            // (재귀 호출 대신 다음 수신에서 처리됨)
                         }
                         else {
-                            // 콜백이 없으면 RTCM fragment 재조립 및 GPS로 전송
-                            LOG_INFO("P2P data received (wrap): %d bytes, RSSI=%d, SNR=%d",
-                                     recv_data.data_len, recv_data.rssi, recv_data.snr);
-
-                            // RTCM fragment 재조립
-                            bool complete = rtcm_reassembly_process(&instance.lora.rtcm_reassembly,
-                                                                    (uint8_t *)recv_data.data,
-                                                                    recv_data.data_len);
-
-                            if (complete) {
-                                // 완전한 RTCM 패킷 수신 - 검증 후 GPS로 전송
-                                if (rtcm_validate_packet(
-                                        instance.lora.rtcm_reassembly.buffer,
-                                        instance.lora.rtcm_reassembly.expected_len)) {
-                                    LOG_INFO("Valid RTCM packet - sending to GPS via UART (wrap)");
-
-                                    // GPS UART로 직접 전송
-                                    if (!gps_send_raw_data(
-                                            GPS_ID_BASE, instance.lora.rtcm_reassembly.buffer,
-                                            instance.lora.rtcm_reassembly.expected_len)) {
-                                        LOG_ERR("Failed to send RTCM data to GPS (wrap)");
-                                    }
-                                }
-                                else {
-                                    LOG_ERR("Invalid RTCM packet - discarding (wrap)");
-                                }
-
-                                // 남은 데이터 처리 (다음 RTCM 패킷의 시작일 수 있음)
-                                if (instance.lora.rtcm_reassembly.buffer_pos >
-                                    instance.lora.rtcm_reassembly.expected_len) {
-                                    size_t remaining = instance.lora.rtcm_reassembly.buffer_pos -
-                                                       instance.lora.rtcm_reassembly.expected_len;
-                                    LOG_INFO(
-                                        "Remaining %d bytes in buffer - moving to front (wrap)",
-                                        remaining);
-
-                                    // 남은 데이터를 버퍼 앞으로 이동
-                                    memmove(
-                                        instance.lora.rtcm_reassembly.buffer,
-                                        &instance.lora.rtcm_reassembly
-                                             .buffer[instance.lora.rtcm_reassembly.expected_len],
-                                        remaining);
-                                    instance.lora.rtcm_reassembly.buffer_pos = remaining;
-                                    instance.lora.rtcm_reassembly.has_header = false;
-                                    instance.lora.rtcm_reassembly.expected_len = 0;
-
-                                    // 남은 데이터로 다음 패킷 시작 시도
-                                    // (재귀 호출 대신 다음 수신에서 처리됨)
-                                }
-                                else {
-                                    // 남은 데이터가 없으면 완전히 초기화
-                                    rtcm_reassembly_reset(&instance.lora.rtcm_reassembly);
-                                }
-                            }
+                            // 남은 데이터가 없으면 완전히 초기화
+                            rtcm_reassembly_reset(&instance.lora.rtcm_reassembly);
                         }
                     }
                 }
-                else if ((strstr(temp_buf, "at+recv=") || strstr(temp_buf, "AT+RECV=")) &&
-                         !instance.lora.init_complete) {
-                    LOG_WARN("Ignoring P2P data during initialization (wrap)");
-                }
-
-                old_pos = pos;
             }
         }
+        else if ((strstr(temp_buf, "at+recv=") || strstr(temp_buf, "AT+RECV=")) &&
+                 !instance.lora.init_complete) {
+            LOG_WARN("Ignoring P2P data during initialization");
+        }
     }
 
     vTaskDelete(NULL);
@@ -842,13 +736,6 @@ void lora_instance_init(void) {
         return;
     }
 
-    // RX 이벤트 큐 생성
-    instance.lora.rx_queue = xQueueCreate(LORA_RX_QUEUE_SIZE, sizeof(uint8_t));
-    if (instance.lora.rx_queue == NULL) {
-        LOG_ERR("LORA RX 큐 생성 실패");
-        return;
-    }
-
     // TX 명령어 큐 생성
     instance.lora.cmd_queue = xQueueCreate(LORA_CMD_QUEUE_SIZE, sizeof(lora_cmd_request_t));
     if (instance.lora.cmd_queue == NULL) {
@@ -856,7 +743,8 @@ void lora_instance_init(void) {
         return;
     }
 
-    lora_port_set_queue(instance.lora.rx_queue);
+    // RX 알림 대상 (태스크는 포트 시작 후 생성, 핸들이 생기기 전 수신은 링에 쌓임)
+    lora_port_set_task(&instance.lora.rx_task);
     instance.lora.mutex = xSemaphoreCreateMutex();
     lora_port_start(&instance.lora);
 
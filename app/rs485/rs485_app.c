@@ -18,6 +18,7 @@
 #include "rs485.h"
 #include "rs485_cmd.h"
 #include "rs485_port.h"
+#include "uart_dma_notify.h"
 
 #ifndef TAG
 #define TAG "RS485_APP"
@@ -126,10 +127,7 @@ static void rs485_tx_task(void *pvParameter) {
 static void rs485_rx_task(void *pvParameter) {
     rs485_instance_t *inst = (rs485_instance_t *)pvParameter;
 
-    size_t pos = 0;
-    size_t old_pos = 0;
-    uint8_t dummy = 0;
-    size_t total_received = 0;
+    ringbuffer_t *rx = rs485_port_get_rx();
 
     LOG_INFO("RS485 RX Task started");
 
@@ -137,37 +135,25 @@ static void rs485_rx_task(void *pvParameter) {
     rs485_send("+READY\r", strlen("+READY\r"));
 
     while (1) {
-        xQueueReceive(inst->rx_queue, &dummy, portMAX_DELAY);
+        /* RX 알림 대기: 여러 번의 ISR이 한 번의 깨어남으로 합쳐짐 */
+        uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
+
+        if (bits & UART_DMA_NOTIFY_OVERFLOW) {
+            LOG_WARN("RS485 RX overflow");
+        }
 
         xSemaphoreTake(inst->mutex, portMAX_DELAY);
 
-        pos = rs485_port_get_rx_pos();
-        char *rs485_recv = rs485_port_get_recv_buf();
+        /* 쌓인 데이터를 한 번에 처리 (DMA 버퍼 경계에서 최대 두 조각) */
+        ringbuffer_span_t spans[2];
+        size_t len = ringbuffer_size(rx);
+        size_t span_cnt = ringbuffer_peek_spans(rx, 0, len, spans);
 
-        if (pos != old_pos) {
-            if (pos > old_pos) {
-                size_t len = pos - old_pos;
-                total_received = len;
-                LOG_DEBUG_RAW("RS485 RX: ", &rs485_recv[old_pos], len);
-                rs485_cmd_parse_process(inst, &rs485_recv[old_pos], pos - old_pos);
-            }
-            else {
-                size_t len1 = RS485_UART_MAX_RECV_SIZE - old_pos;
-                size_t len2 = pos;
-                total_received = len1 + len2;
-                LOG_DEBUG_RAW("RS485 RX: ", &rs485_recv[old_pos], len1);
-                rs485_cmd_parse_process(inst, &rs485_recv[old_pos],
-                                        RS485_UART_MAX_RECV_SIZE - old_pos);
-                if (pos > 0) {
-                    LOG_DEBUG_RAW("RS485 RX: ", rs485_recv, len2);
-                    rs485_cmd_parse_process(inst, rs485_recv, pos);
-                }
-            }
-            old_pos = pos;
-            if (old_pos == RS485_UART_MAX_RECV_SIZE) {
-                old_pos = 0;
-            }
+        for (size_t i = 0; i < span_cnt; i++) {
+            LOG_DEBUG_RAW("RS485 RX: ", spans[i].data, spans[i].len);
+            rs485_cmd_parse_process(inst, spans[i].data, spans[i].len);
         }
+        ringbuffer_consume(rx, len);
 
         xSemaphoreGive(inst->mutex);
     }
@@ -193,14 +179,8 @@ void rs485_init_all(void) {
         return;
     }
 
-    rs485_instance.rx_queue = xQueueCreate(10, sizeof(uint8_t));
-    if (rs485_instance.rx_queue == NULL) {
-        LOG_ERR("RS485 RX 큐 생성 실패");
-        rs485_instance.enabled = false;
-        return;
-    }
-
-    rs485_port_set_queue(rs485_instance.rx_queue);
+    /* RX 알림 대상 (태스크는 포트 시작 후 생성, 그 전 수신은 링에 쌓임) */
+    rs485_port_set_task(&rs485_instance.rx_task);
 
     rs485_instance.tx_queue = xQueueCreate(5, sizeof(rs485_tx_request_t));
     if (rs485_instance.tx_queue == NULL) {
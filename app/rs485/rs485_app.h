@@ -1,7 +1,7 @@
 #ifndef RS485_APP_H
 #define RS485_APP_H
 
-#include "stm32f4xx.h"
+#include "main.h"
 #include "FreeRTOS.h"
 #include "timers.h"
 #include "queue.h"
@@ -11,8 +11,6 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define RS485_UART_MAX_RECV_SIZE 512
-
 extern TimerHandle_t gps_send_timer;
 
 typedef enum {
@@ -42,8 +40,7 @@ typedef struct {
     rs485_t rs485;
     rs485_cmd_parse_state_t parse_stae;
     rs485_cmd_parser_t parser;
-    QueueHandle_t rx_queue;
-    TaskHandle_t rx_task;
+    TaskHandle_t rx_task; /* RX 알림 대상 (UART ISR → 태스크 알림) */
     bool enabled;
 
     QueueHandle_t tx_queue;
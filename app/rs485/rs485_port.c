@@ -1,13 +1,9 @@
 #include "rs485_port.h"
 #include "board_config.h"
-#include "stm32f4xx_hal.h"
-#include "stm32f4xx_ll_bus.h"
-#include "stm32f4xx_ll_cortex.h"
-#include "stm32f4xx_ll_dma.h"
-#include "stm32f4xx_ll_gpio.h"
-#include "stm32f4xx_ll_usart.h"
+#include "main.h"
+#include "uart_dma_hw.h"
 #include "FreeRTOS.h"
-#include "queue.h"
+#include "uart_dma_notify.h"
 
 #ifndef TAG
 #define TAG "RS485_PORT"
@@ -15,12 +11,9 @@
 
 #include "log.h"
 
-#define RS485_PORT_UART            UART5
-#define RS485_PORT_UART_DMA        DMA1
-#define RS485_PORT_UART_DMA_STREAM LL_DMA_STREAM_0
+#define RS485_TX_TIMEOUT_MS 500 /* 송신 완료(마지막 바이트) 대기 한도 */
 
-static char rs485_recv_buf[1][512];
-static QueueHandle_t rs485_queues[1] = {NULL};
+static uart_dma_port_t *rs485_uart;
 
 static void rs485_rx_enable();
 
@@ -31,131 +24,36 @@ static inline void delay_us(uint32_t us) {
         ;
 }
 
-static void rs485_uart5_dma_init(void) {
-    /* Init with LL driver */
-    /* DMA controller clock enable */
-    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
-
-    /* DMA interrupt init */
-    /* DMA1_Stream0_IRQn interrupt configuration */
-    NVIC_SetPriority(DMA1_Stream0_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
-    NVIC_EnableIRQ(DMA1_Stream0_IRQn);
-}
-
-static void rs485_uart5_init(void) {
-    /* USER CODE BEGIN UART5_Init 0 */
-
-    /* USER CODE END UART5_Init 0 */
-
-    LL_USART_InitTypeDef USART_InitStruct = {0};
-
-    LL_GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-    /* Peripheral clock enable */
-    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_UART5);
-
-    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOC);
-    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOD);
-    /**UART5 GPIO Configuration
-  PC12   ------> UART5_TX
-  PD2   ------> UART5_RX
-  */
-    GPIO_InitStruct.Pin = LL_GPIO_PIN_12;
-    GPIO_InitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-    GPIO_InitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-    GPIO_InitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-    GPIO_InitStruct.Pull = LL_GPIO_PULL_NO;
-    GPIO_InitStruct.Alternate = LL_GPIO_AF_8;
-    LL_GPIO_Init(GPIOC, &GPIO_InitStruct);
-
-    GPIO_InitStruct.Pin = LL_GPIO_PIN_2;
-    GPIO_InitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-    GPIO_InitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-    GPIO_InitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-    GPIO_InitStruct.Pull = LL_GPIO_PULL_NO;
-    GPIO_InitStruct.Alternate = LL_GPIO_AF_8;
-    LL_GPIO_Init(GPIOD, &GPIO_InitStruct);
-
-    /* UART5 DMA Init */
-
-    /* UART5_RX Init */
-    LL_DMA_SetChannelSelection(DMA1, LL_DMA_STREAM_0, LL_DMA_CHANNEL_4);
-
-    LL_DMA_SetDataTransferDirection(DMA1, LL_DMA_STREAM_0, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
-
-    LL_DMA_SetStreamPriorityLevel(DMA1, LL_DMA_STREAM_0, LL_DMA_PRIORITY_LOW);
-
-    LL_DMA_SetMode(DMA1, LL_DMA_STREAM_0, LL_DMA_MODE_CIRCULAR);
-
-    LL_DMA_SetPeriphIncMode(DMA1, LL_DMA_STREAM_0, LL_DMA_PERIPH_NOINCREMENT);
-
-    LL_DMA_SetMemoryIncMode(DMA1, LL_DMA_STREAM_0, LL_DMA_MEMORY_INCREMENT);
-
-    LL_DMA_SetPeriphSize(DMA1, LL_DMA_STREAM_0, LL_DMA_PDATAALIGN_BYTE);
-
-    LL_DMA_SetMemorySize(DMA1, LL_DMA_STREAM_0, LL_DMA_MDATAALIGN_BYTE);
-
-    LL_DMA_DisableFifoMode(DMA1, LL_DMA_STREAM_0);
-
-    /* UART5 interrupt Init */
-    NVIC_SetPriority(UART5_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
-    NVIC_EnableIRQ(UART5_IRQn);
-
-    /* USER CODE BEGIN UART5_Init 1 */
-
-    /* USER CODE END UART5_Init 1 */
-    USART_InitStruct.BaudRate = 115200;
-    USART_InitStruct.DataWidth = LL_USART_DATAWIDTH_8B;
-    USART_InitStruct.StopBits = LL_USART_STOPBITS_1;
-    USART_InitStruct.Parity = LL_USART_PARITY_NONE;
-    USART_InitStruct.TransferDirection = LL_USART_DIRECTION_TX_RX;
-    USART_InitStruct.HardwareFlowControl = LL_USART_HWCONTROL_NONE;
-    USART_InitStruct.OverSampling = LL_USART_OVERSAMPLING_16;
-    LL_USART_Init(UART5, &USART_InitStruct);
-    LL_USART_ConfigAsyncMode(UART5);
-    /* USER CODE BEGIN UART5_Init 2 */
-
-    /* USER CODE END UART5_Init 2 */
-}
-
 int rs485_uart5_comm_start(void) {
-    LL_DMA_SetPeriphAddress(DMA1, LL_DMA_STREAM_0, (uint32_t)&UART5->DR);
-    LL_DMA_SetMemoryAddress(DMA1, LL_DMA_STREAM_0, (uint32_t)&rs485_recv_buf[0]);
-    LL_DMA_SetDataLength(DMA1, LL_DMA_STREAM_0, sizeof(rs485_recv_buf[0]));
-    LL_DMA_EnableIT_TE(DMA1, LL_DMA_STREAM_0);
-    LL_DMA_EnableIT_FE(DMA1, LL_DMA_STREAM_0);
-    LL_DMA_EnableIT_DME(DMA1, LL_DMA_STREAM_0);
-
-    LL_USART_EnableIT_IDLE(UART5);
-    LL_USART_EnableIT_PE(UART5);
-    LL_USART_EnableIT_ERROR(UART5);
-    LL_USART_EnableDMAReq_RX(UART5);
-
-    LL_DMA_EnableStream(DMA1, LL_DMA_STREAM_0);
-    LL_USART_Enable(UART5);
+    uart_dma_port_start(rs485_uart);
 
     return 0;
 }
 
+/**
+ * @brief UART5 포트 준비 (USART/GPIO 초기화는 CubeMX, 채널 구성은 uart_dma_hw)
+ */
 int rs485_uart5_hw_init(void) {
-    rs485_uart5_dma_init();
-    rs485_uart5_init();
+    rs485_uart = uart_dma_hw_port(UART_DMA_RS485);
     rs485_rx_enable();
 
     return 0;
 }
 
+/**
+ * @brief 송신 후 마지막 바이트가 선로로 나갈 때까지 대기
+ *
+ * 호출자가 tx_enable → send → rx_enable 순서로 방향을 바꾸므로 DMA 완료가 아니라
+ * USART TC까지 기다려야 마지막 바이트가 잘리지 않음
+ *
+ * @return int 0: 송신 완료, -1: 시간 초과 또는 실패
+ */
 int rs485_uart5_send(const char *data, size_t len) {
-    for (int i = 0; i < len; i++) {
-        while (!LL_USART_IsActiveFlag_TXE(UART5))
-            ;
-        LL_USART_TransmitData8(UART5, *(data + i));
+    if (!uart_dma_port_write_sync(rs485_uart, data, len, RS485_TX_TIMEOUT_MS)) {
+        return -1;
     }
 
-    while (!LL_USART_IsActiveFlag_TC(UART5))
-        ;
-
-    return 0;
+    return uart_dma_hw_wait_tx_idle(UART_DMA_RS485, RS485_TX_TIMEOUT_MS) ? 0 : -1;
 }
 
 void rs485_tx_enable() {
@@ -184,65 +82,6 @@ static const rs485_hal_ops_t rs485_uart5_ops = {
 };
 
 
-#if defined(BOARD_TYPE_ROVER_UNICORE) || defined(BOARD_TYPE_ROVER_UBLOX)
-/**
- * @brief This function handles UART5 global interrupt.
- */
-void UART5_IRQHandler(void) {
-    /* USER CODE BEGIN USART3_IRQn 0 */
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    if (LL_USART_IsActiveFlag_IDLE(UART5)) {
-        if (rs485_queues[0] != NULL) {
-            uint8_t dummy = 0;
-            xQueueSendFromISR(rs485_queues[0], &dummy, &xHigherPriorityTaskWoken);
-        }
-        LL_USART_ClearFlag_IDLE(UART5);
-    }
-
-
-    if (LL_USART_IsActiveFlag_PE(UART5)) {
-        LL_USART_ClearFlag_PE(UART5);
-    }
-    if (LL_USART_IsActiveFlag_FE(UART5)) {
-        LL_USART_ClearFlag_FE(UART5);
-    }
-    if (LL_USART_IsActiveFlag_ORE(UART5)) {
-        LL_USART_ClearFlag_ORE(UART5);
-    }
-    if (LL_USART_IsActiveFlag_NE(UART5)) {
-        LL_USART_ClearFlag_NE(UART5);
-    }
-
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-    /* USER CODE END USART3_IRQn 0 */
-    /* USER CODE BEGIN USART3_IRQn 1 */
-
-    /* USER CODE END USART3_IRQn 1 */
-}
-
-void DMA1_Stream0_IRQHandler(void) {
-    if (LL_DMA_IsActiveFlag_TE0(DMA1)) {
-        LL_DMA_ClearFlag_TE0(DMA1);
-
-        LOG_ERR("RS485 DMA Transfer Error");
-    }
-
-    if (LL_DMA_IsActiveFlag_FE0(DMA1)) {
-        LL_DMA_ClearFlag_FE0(DMA1);
-
-        LOG_ERR("RS485 DMA FIFO Error");
-    }
-
-    if (LL_DMA_IsActiveFlag_DME0(DMA1)) {
-        LL_DMA_ClearFlag_DME0(DMA1);
-
-        LOG_ERR("RS485 DMA Direct Mode Error");
-    }
-}
-
-#endif
-
 int rs485_port_init_instance(rs485_t *rs485_handle) {
     const board_config_t *config = board_get_config();
 
@@ -283,16 +122,18 @@ void rs485_port_stop(rs485_t *rs485_handle) {
     rs485_handle->ops->stop();
 }
 
-uint32_t rs485_port_get_rx_pos() {
-    uint32_t pos = sizeof(rs485_recv_buf[0]) -
-                   LL_DMA_GetDataLength(RS485_PORT_UART_DMA, RS485_PORT_UART_DMA_STREAM);
-    return pos;
-}
-
-char *rs485_port_get_recv_buf() {
-    return rs485_recv_buf[0];
+/**
+ * @brief RX 링버퍼 (메모리: DMA 수신 버퍼)
+ */
+ringbuffer_t *rs485_port_get_rx(void) {
+    return uart_dma_port_rx(rs485_uart);
 }
 
-void rs485_port_set_queue(QueueHandle_t queue) {
-    rs485_queues[0] = queue;
+/**
+ * @brief RX ISR 알림 대상 등록
+ *
+ * @param task 태스크 핸들 변수의 주소 (태스크 생성 전이면 NULL 값, 그동안 알림 생략)
+ */
+void rs485_port_set_task(TaskHandle_t *task) {
+    uart_dma_port_set_event_cb(rs485_uart, uart_dma_notify_cb, task);
 }
\ No newline at end of file
@@ -6,4 +6,14 @@
 // #define USE_GPS_UBLOX
 // #define USE_GPS_UNICORE
 
+/* RX 원본 스트림 탭 싱크 (gps_app_set_tap) */
+#define GPS_TAP_RTT_CHANNEL  2    /* RTT up 채널 (0: 터미널, 1: SystemView 자동 할당) */
+#define GPS_TAP_RTT_BUF_SIZE 1024 /* RTT up 버퍼 크기 */
+#define GPS_TAP_UART_Q_SIZE  1024 /* 디버그 UART 전송 대기 버퍼 크기 */
+#define GPS_TAP_CAPTURE_SIZE 2048 /* 캡처 버퍼 크기 */
+
+/* UM982 링크 보드레이트 (초기화 때 협상, gps_baud.h 표 값) */
+#define GPS_UM982_PORT     "COM1" /* MCU USART2에 연결된 수신기 포트 */
+#define GPS_UM982_BAUDRATE 921600 /* 목표 보드레이트 (115200: 협상 안 함) */
+
 #endif
\ No newline at end of file
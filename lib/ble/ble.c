@@ -29,8 +29,7 @@ bool ble_init(ble_t *ble, const ble_hal_ops_t *ops) {
     ble->handler = NULL;
     ble->user_data = NULL;
 
-    /* 링버퍼 초기화 (GPS처럼) */
-    ringbuffer_init(&ble->rx_buf, ble->rx_buf_mem, sizeof(ble->rx_buf_mem));
+    /* RX 링버퍼는 포트가 DMA 수신 버퍼 위에 초기화 (GPS처럼) */
 
     /* 파서 초기화 */
     ble_parser_init(&ble->parser_ctx);
@@ -68,14 +67,6 @@ void ble_set_evt_handler(ble_t *ble, ble_evt_handler_t handler, void *user_data)
  * 링버퍼 API
  *===========================================================================*/
 
-void ble_rx_write(ble_t *ble, const uint8_t *data, size_t len) {
-    if (!ble || !data || len == 0) {
-        return;
-    }
-
-    ringbuffer_write(&ble->rx_buf, (const char *)data, len);
-}
-
 ringbuffer_t *ble_get_rx_buf(ble_t *ble) {
     if (!ble)
         return NULL;
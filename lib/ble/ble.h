@@ -24,11 +24,14 @@
 #include "ble_types.h"
 #include "ble_parser.h"
 #include "ringbuffer.h"
+#include "dev_assert.h"
 
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
+STATIC_ASSERT(RINGBUFFER_IS_POW2(BLE_RX_BUF_SIZE), "BLE_RX_BUF_SIZE must be a power of two");
+
 /*===========================================================================
  * 이벤트 핸들러 타입
  *===========================================================================*/
@@ -54,8 +57,7 @@ struct ble_s {
     const ble_hal_ops_t *ops; /**< HAL 연산 함수 포인터 */
 
     /*--- RX 버퍼 (GPS처럼 링버퍼 사용) ---*/
-    ringbuffer_t rx_buf;              /**< RX 링버퍼 */
-    char rx_buf_mem[BLE_RX_BUF_SIZE]; /**< RX 버퍼 메모리 */
+    ringbuffer_t rx_buf; /**< RX 링버퍼 (메모리: 포트의 DMA 수신 버퍼) */
 
     /*--- 파서 ---*/
     ble_parser_ctx_t parser_ctx;        /**< 파서 컨텍스트 */
@@ -75,9 +77,8 @@ struct ble_s {
     void *user_data;           /**< 사용자 데이터 */
 
     /*--- RX 태스크 (lib에서 관리) ---*/
-    QueueHandle_t rx_queue; /**< RX 신호 큐 */
-    TaskHandle_t rx_task;   /**< RX 태스크 핸들 */
-    volatile bool running;  /**< 태스크 실행 상태 */
+    TaskHandle_t rx_task;  /**< RX 태스크 핸들 (UART RX 알림 대상) */
+    volatile bool running; /**< 태스크 실행 상태 */
 };
 
 /*===========================================================================
@@ -105,20 +106,9 @@ bool ble_init(ble_t *ble, const ble_hal_ops_t *ops);
 void ble_set_evt_handler(ble_t *ble, ble_evt_handler_t handler, void *user_data);
 
 /*===========================================================================
- * 링버퍼 API (DMA에서 데이터 기록용)
+ * 링버퍼 API
  *===========================================================================*/
 
-/**
- * @brief RX 링버퍼에 데이터 쓰기
- *
- * DMA 인터럽트 또는 IDLE 인터럽트에서 호출
- *
- * @param ble BLE 핸들
- * @param data 수신 데이터
- * @param len 데이터 길이
- */
-void ble_rx_write(ble_t *ble, const uint8_t *data, size_t len);
-
 /**
  * @brief RX 링버퍼 포인터 가져오기
  * @param ble BLE 핸들
@@ -234,13 +224,6 @@ bool ble_rx_task_start(ble_t *ble);
  */
 void ble_rx_task_stop(ble_t *ble);
 
-/**
- * @brief RX 큐 가져오기 (인터럽트에서 신호 전송용)
- * @param ble BLE 핸들
- * @return RX 큐 핸들
- */
-QueueHandle_t ble_get_rx_queue(ble_t *ble);
-
 /*===========================================================================
  * 내부 API (app 레벨에서 사용)
  *===========================================================================*/
@@ -2,11 +2,12 @@
  * @file ble_task.c
  * @brief BLE RX 태스크 구현
  *
- * 인터럽트에서 DMA→링버퍼 쓰기 완료 후 신호 수신
+ * 인터럽트에서 DMA→링버퍼 쓰기 완료 후 태스크 알림 수신
  * 태스크는 링버퍼에서 읽어 파싱 수행
  */
 
 #include "ble.h"
+#include "uart_dma_notify.h"
 #include <string.h>
 
 #ifndef TAG
@@ -20,7 +21,6 @@
  *===========================================================================*/
 #define BLE_RX_TASK_STACK_SIZE 512
 #define BLE_RX_TASK_PRIORITY   3
-#define BLE_RX_QUEUE_SIZE      16
 
 /*===========================================================================
  * 내부 함수
@@ -33,18 +33,26 @@
  */
 static void ble_rx_task_func(void *pvParameter) {
     ble_t *ble = (ble_t *)pvParameter;
-    uint8_t dummy;
 
     LOG_INFO("BLE RX 태스크 시작");
 
     while (ble->running) {
-        /* RX 신호 대기 (타임아웃 100ms) */
-        if (xQueueReceive(ble->rx_queue, &dummy, pdMS_TO_TICKS(100)) == pdTRUE) {
-            /* 링버퍼에서 읽어서 파싱 */
+        /* RX 알림 대기 (타임아웃 100ms, 그 사이 여러 번의 ISR은 한 번으로 합쳐짐) */
+        uint32_t bits = uart_dma_notify_wait(100);
+
+        if (bits & UART_DMA_NOTIFY_STOP) {
+            break;
+        }
+
+        if (bits != 0) {
+            /* 링버퍼에 쌓인 데이터를 모두 읽어서 파싱 */
             ble_process_rx(ble);
         }
     }
 
+    /* 삭제 전에 알림 대상 핸들을 비움 (ISR이 삭제된 태스크에 알리지 않게) */
+    ble->rx_task = NULL;
+
     LOG_INFO("BLE RX 태스크 종료");
     vTaskDelete(NULL);
 }
@@ -63,13 +71,6 @@ bool ble_rx_task_start(ble_t *ble) {
         return true;
     }
 
-    /* RX 큐 생성 */
-    ble->rx_queue = xQueueCreate(BLE_RX_QUEUE_SIZE, sizeof(uint8_t));
-    if (!ble->rx_queue) {
-        LOG_ERR("BLE RX 큐 생성 실패");
-        return false;
-    }
-
     ble->running = true;
 
     /* RX 태스크 생성 */
@@ -79,8 +80,6 @@ bool ble_rx_task_start(ble_t *ble) {
     if (ret != pdPASS) {
         LOG_ERR("BLE RX 태스크 생성 실패");
         ble->running = false;
-        vQueueDelete(ble->rx_queue);
-        ble->rx_queue = NULL;
         return false;
     }
 
@@ -93,25 +92,15 @@ void ble_rx_task_stop(ble_t *ble) {
         return;
     }
 
+    /* 100ms 대기 중인 태스크를 바로 깨움
+     * (태스크가 핸들을 비우고 스스로 삭제되는 사이에 끼어들지 않게 스케줄러 잠금) */
+    vTaskSuspendAll();
+    uart_dma_notify_stop(ble->rx_task);
     ble->running = false;
+    xTaskResumeAll();
 
-    /* 태스크 종료 대기 */
+    /* 태스크 종료 대기 (핸들은 태스크가 스스로 비움) */
     vTaskDelay(pdMS_TO_TICKS(200));
 
-    /* 큐 삭제 */
-    if (ble->rx_queue) {
-        vQueueDelete(ble->rx_queue);
-        ble->rx_queue = NULL;
-    }
-
-    ble->rx_task = NULL;
-
     LOG_INFO("BLE RX 태스크 정지 완료");
 }
-
-QueueHandle_t ble_get_rx_queue(ble_t *ble) {
-    if (!ble) {
-        return NULL;
-    }
-    return ble->rx_queue;
-}
@@ -6,6 +6,7 @@
 #include "gps.h"
 #include "gps_config.h"
 #include "gps_parser.h"
+#include "uart_dma_notify.h"
 #include <string.h>
 
 #ifndef TAG
@@ -31,22 +32,16 @@ bool gps_init(gps_t *gps) {
 
     memset(gps, 0, sizeof(gps_t));
 
-    /* RX 링버퍼 초기화 */
-    ringbuffer_init(&gps->rx_buf, gps->rx_buf_mem, sizeof(gps->rx_buf_mem));
+    /* RX 링버퍼는 포트가 DMA 수신 버퍼 위에 초기화 (gps_port_init) */
 
-    /* RTCM 링버퍼 초기화 */
-    ringbuffer_init(&gps->rtcm_data.rb, gps->rtcm_data.rb_mem, sizeof(gps->rtcm_data.rb_mem));
+    /* RTCM 레코드 링 초기화 (GPS 태스크 → LoRa 태스크, mutex 없음) */
+    record_ring_init(&gps->rtcm_data.ring, gps->rtcm_data.ring_mem,
+                     sizeof(gps->rtcm_data.ring_mem));
 
     /* 파서 초기화 */
     gps_parser_init(gps);
 
-    /* OS 객체 생성 */
-    gps->pkt_queue = xQueueCreate(10, sizeof(uint8_t));
-    if (!gps->pkt_queue) {
-        LOG_ERR("Failed to create pkt_queue");
-        return false;
-    }
-
+    /* OS 객체 생성 (RX 신호는 pkt_task 태스크 알림) */
     gps->mutex = xSemaphoreCreateMutex();
     if (!gps->mutex) {
         LOG_ERR("Failed to create mutex");
@@ -59,13 +54,6 @@ bool gps_init(gps_t *gps) {
         return false;
     }
 
-    /* RTCM 버퍼 mutex 생성 */
-    gps->rtcm_data.mutex = xSemaphoreCreateMutex();
-    if (!gps->rtcm_data.mutex) {
-        LOG_ERR("Failed to create rtcm_mutex");
-        return false;
-    }
-
     /* RX 태스크 생성 */
     BaseType_t ret = xTaskCreate(gps_process_task, "gps_pkt", 1024, (void *)gps,
                                  tskIDLE_PRIORITY + 1, &gps->pkt_task);
@@ -99,11 +87,6 @@ void gps_deinit(gps_t *gps) {
     }
 
     /* 2. OS 객체 삭제 */
-    if (gps->pkt_queue) {
-        vQueueDelete(gps->pkt_queue);
-        gps->pkt_queue = NULL;
-    }
-
     if (gps->mutex) {
         vSemaphoreDelete(gps->mutex);
         gps->mutex = NULL;
@@ -114,11 +97,6 @@ void gps_deinit(gps_t *gps) {
         gps->cmd_sem = NULL;
     }
 
-    if (gps->rtcm_data.mutex) {
-        vSemaphoreDelete(gps->rtcm_data.mutex);
-        gps->rtcm_data.mutex = NULL;
-    }
-
     /* 3. 태스크 핸들 초기화 */
     gps->pkt_task = NULL;
 
@@ -154,7 +132,7 @@ void gps_set_evt_handler(gps_t *gps, gps_evt_handler handler) {
  * @brief GPS 종료 요청
  *
  * 프로세스 태스크를 안전하게 종료시킵니다.
- * 종료 신호를 큐에 보내 portMAX_DELAY 대기를 깨웁니다.
+ * 종료 알림 비트로 portMAX_DELAY 대기를 깨웁니다.
  */
 void gps_stop(gps_t *gps) {
     if (!gps) {
@@ -163,11 +141,11 @@ void gps_stop(gps_t *gps) {
 
     gps->is_running = false;
 
-    /* 큐에 더미 데이터를 보내 portMAX_DELAY 대기를 깨움 */
-    if (gps->pkt_queue) {
-        uint8_t dummy = 0xFF; /* 종료 신호 */
-        xQueueSend(gps->pkt_queue, &dummy, 0);
-    }
+    /* 종료 알림으로 portMAX_DELAY 대기를 깨움
+     * (태스크가 핸들을 비우고 스스로 삭제되는 사이에 끼어들지 않게 스케줄러 잠금) */
+    vTaskSuspendAll();
+    uart_dma_notify_stop(gps->pkt_task);
+    xTaskResumeAll();
 
     /* 태스크가 종료될 때까지 대기 (최대 500ms) */
     uint32_t wait_count = 0;
@@ -227,36 +205,131 @@ bool gps_send_cmd_sync(gps_t *gps, const char *cmd, uint32_t timeout_ms) {
     return result;
 }
 
+static uint32_t gps_now_ms(void) {
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
+bool gps_send_cmds(gps_t *gps, gps_cmd_batch_t *batch, const char *const *cmds, size_t count,
+                   const gps_cmd_batch_cfg_t *cfg) {
+    gps_cmd_ctx_t *cmd_ctx;
+
+    /* 인자 오류로 바로 돌아가도 호출자가 결과(count 0)를 읽을 수 있게 먼저 비움 */
+    if (batch) {
+        memset(batch, 0, sizeof(*batch));
+    }
+
+    if (!gps || !batch || !cmds || !cfg || !gps->ops || !gps->ops->send) {
+        LOG_ERR("Invalid parameters");
+        return false;
+    }
+
+    if (!gps_cmd_batch_init(batch, cmds, count, cfg, gps_now_ms())) {
+        LOG_ERR("Too many commands: %zu", count);
+        return false;
+    }
+
+    /* 단일 명령 송신과 섞이지 않도록 배치 전체를 mutex로 보호 */
+    if (xSemaphoreTake(gps->mutex, portMAX_DELAY) != pdTRUE) {
+        return false;
+    }
+
+    xSemaphoreTake(gps->cmd_sem, 0);
+
+    /* 배치 상태는 이 태스크와 파서 태스크만 바꿈: 인터럽트는 막지 않고 스케줄러만 잠금 */
+    cmd_ctx = &gps->parser_ctx.cmd_ctx;
+    vTaskSuspendAll();
+    cmd_ctx->batch = batch;
+    xTaskResumeAll();
+
+    for (;;) {
+        uint32_t now = gps_now_ms();
+
+        vTaskSuspendAll();
+        const char *cmd = gps_cmd_batch_next(batch, now);
+        bool done = gps_cmd_batch_done(batch);
+        uint32_t wait_ms = gps_cmd_batch_wait_ms(batch, now);
+        xTaskResumeAll();
+
+        if (cmd) {
+            size_t len = strlen(cmd);
+            bool sent = (gps->ops->send(cmd, len) == 0);
+
+            if (sent && (len == 0 || cmd[len - 1] != '\n')) {
+                sent = (gps->ops->send("\r\n", 2) == 0);
+            }
+
+            if (!sent) {
+                /* 송신 큐 시간 초과: 응답 시간 초과까지 기다리지 않고 바로 재시도/실패 */
+                LOG_WARN("CMD TX failed: %s", cmd);
+                vTaskSuspendAll();
+                gps_cmd_batch_on_send_error(batch, cmd);
+                xTaskResumeAll();
+                continue;
+            }
+
+            LOG_DEBUG("CMD TX: %s", cmd);
+            continue;
+        }
+
+        if (done) {
+            break;
+        }
+
+        /* 응답(파서가 시그널) 또는 다음 시간 초과까지 대기 */
+        if (wait_ms == 0) {
+            wait_ms = 1;
+        }
+        xSemaphoreTake(gps->cmd_sem, pdMS_TO_TICKS(wait_ms));
+    }
+
+    vTaskSuspendAll();
+    cmd_ctx->batch = NULL;
+    xTaskResumeAll();
+
+    xSemaphoreGive(gps->mutex);
+
+    return gps_cmd_batch_failed(batch) == 0;
+}
+
 /*===========================================================================
  * GPS 패킷 처리 태스크
  *===========================================================================*/
 
 static void gps_process_task(void *pvParameter) {
     gps_t *gps = (gps_t *)pvParameter;
-    uint8_t dummy;
 
     gps->is_alive = true;
     LOG_INFO("GPS process task started");
 
     while (gps->is_running) {
-        /* RX 신호 대기 (UART ISR에서 queue send) */
-        if (xQueueReceive(gps->pkt_queue, &dummy, portMAX_DELAY) == pdTRUE) {
-            /* 새 파서로 패킷 파싱 */
-            static char buf[2048];
-            size_t len = ringbuffer_size(&gps->rx_buf);
-            if (len > 0) {
-                len = (len > sizeof(buf)) ? sizeof(buf) : len;
-                ringbuffer_peek(&gps->rx_buf, buf, len, 0);
-                LOG_DEBUG_RAW("", buf, len);
-            }
+        /* RX 알림 대기 (UART ISR이 원인 비트를 OR, 여러 번 와도 한 번에 깨어남) */
+        uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
 
-            gps_parser_process(gps);
+        if ((bits & UART_DMA_NOTIFY_STOP) || !gps->is_running) {
+            break;
         }
 
-        /* 주기적 타임아웃 체크 (optional) */
-        /* 여기서 불완전 패킷 타임아웃 처리 등 추가 가능 */
+        if (bits & UART_DMA_NOTIFY_OVERFLOW) {
+            /* 수신 중이던 프레임의 바이트가 유실/덮어써짐: 이어서 하던 스캔 상태 폐기 */
+            gps->parser_ctx.stats.rx_overflows++;
+            gps_parser_flush(gps);
+        }
+        if (bits & UART_DMA_NOTIFY_ERROR) {
+            gps->parser_ctx.stats.rx_line_errors++;
+        }
+
+        /* 링에 쌓인 데이터를 한 번에 처리: 원본 바이트 미러링 (탭 비활성이면 포인터 확인만) */
+        gps_tap_feed(&gps->tap, &gps->rx_buf);
+
+        /* 새 파서로 패킷 파싱 */
+        gps_parser_process(gps);
     }
 
+    /* 정지 후 포트가 rx_buf를 비우므로 이어서 하던 스캔 상태도 여기서 정리 */
+    gps_parser_flush(gps);
+
+    /* 삭제 전에 알림 대상 핸들을 비움 (ISR/gps_stop이 삭제된 태스크에 알리지 않게) */
+    gps->pkt_task = NULL;
     gps->is_alive = false;
     LOG_INFO("GPS process task stopped");
     vTaskDelete(NULL);
@@ -271,7 +344,7 @@ static void gps_process_task(void *pvParameter) {
 
 void gps_parse_process(gps_t *gps, const void *data, size_t len) {
     /* deprecated: 이 함수는 더 이상 사용하지 않음
-     * 대신 UART ISR에서 ringbuffer_write() 후 queue send
+     * 대신 UART DMA가 ringbuffer에 쓰고 ISR이 태스크 알림
      * 그러면 gps_process_task에서 gps_parser_process() 호출
      */
     (void)gps;
@@ -12,16 +12,28 @@
 #include "queue.h"
 
 #include "gps_parser.h"
+#include "gps_tap.h"
 #include "gps_types.h"
 #include "gps_nmea.h"
 #include "gps_unicore.h"
 #include "rtcm.h"
 #include "ringbuffer.h"
+#include "record_ring.h"
+#include "dev_assert.h"
 
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
+/*===========================================================================
+ * 버퍼 크기 상수 (링버퍼는 2의 거듭제곱 크기만 허용)
+ *===========================================================================*/
+#define GPS_RX_BUF_SIZE   2048 /**< RX 링버퍼 (= DMA 수신 버퍼) 크기 */
+#define GPS_RTCM_BUF_SIZE 4096 /**< RTCM 레코드 링 크기 (여러 메시지 큐잉) */
+
+STATIC_ASSERT(RINGBUFFER_IS_POW2(GPS_RX_BUF_SIZE), "GPS_RX_BUF_SIZE must be a power of two");
+STATIC_ASSERT(RINGBUFFER_IS_POW2(GPS_RTCM_BUF_SIZE), "GPS_RTCM_BUF_SIZE must be a power of two");
+
 /*===========================================================================
  * 이벤트 핸들러 타입
  *===========================================================================*/
@@ -51,9 +63,19 @@ typedef struct {
         uint32_t timestamp_ms; /**< 업데이트 시각 */
     } velocity;
 
+    /* === GGA 위치 (GGA가 업데이트, 고정소수점) === */
+    struct {
+        int64_t lat_ndeg;      /**< 위도 (1e-9 degree, 남위 음수) */
+        int64_t lon_ndeg;      /**< 경도 (1e-9 degree, 서경 음수) */
+        int32_t alt_mm;        /**< 해발 고도 (mm) */
+        int32_t geo_sep_mm;    /**< 지오이드 분리 (mm) */
+        uint32_t timestamp_ms; /**< 업데이트 시각 */
+    } gga_position;
+
     /* === 헤딩 (THS가 업데이트) === */
     struct {
-        double heading;        /**< 헤딩 (degree, 0-360) */
+        int32_t heading_udeg;  /**< 헤딩 (1e-6 degree, 0-360) */
+        double heading;        /**< 헤딩 (degree, heading_udeg 환산값) */
         uint8_t mode;          /**< 헤딩 모드 (gps_ths_mode_t) */
         uint32_t timestamp_ms; /**< 업데이트 시각 */
     } heading;
@@ -63,7 +85,8 @@ typedef struct {
         gps_fix_t fix_type;        /**< Fix 타입 (GGA가 업데이트) */
         uint8_t sat_count;         /**< 위성 수 (BESTNAV.sv가 업데이트) */
         uint8_t used_sat_count;    /**< 사용 위성 수 (BESTNAV.used_sv) */
-        float hdop;                /**< HDOP (GGA가 업데이트) */
+        uint16_t hdop_x100;        /**< HDOP x 100 (GGA가 업데이트) */
+        float hdop;                /**< HDOP (hdop_x100 환산값) */
         uint32_t fix_timestamp_ms; /**< Fix 업데이트 시각 */
         uint32_t sat_timestamp_ms; /**< 위성수 업데이트 시각 */
         bool fix_changed;          /**< Fix 상태 변경됨 (이벤트 발생용) */
@@ -75,10 +98,9 @@ typedef struct {
  * RTCM 데이터 저장 구조체 (LoRa 전송용)
  *===========================================================================*/
 typedef struct {
-    ringbuffer_t rb;         /**< RTCM 링버퍼 (여러 메시지 큐잉) */
-    char rb_mem[4096];       /**< 링버퍼 메모리 (RTCM은 큰 편) */
-    SemaphoreHandle_t mutex; /**< RTCM 버퍼 접근 보호 */
-    uint16_t last_msg_type;  /**< 마지막 수신 메시지 타입 */
+    record_ring_t ring; /**< RTCM 프레임 레코드 링 (GPS 태스크 → LoRa 태스크, SPSC) */
+    uint32_t ring_mem[GPS_RTCM_BUF_SIZE / sizeof(uint32_t)]; /**< 링 메모리 (4바이트 정렬) */
+    uint16_t last_msg_type;                                  /**< 마지막 수신 메시지 타입 */
 } gps_rtcm_data_t;
 
 /*===========================================================================
@@ -131,16 +153,15 @@ typedef struct {
  *===========================================================================*/
 typedef struct gps_s {
     /*--- OS 변수 ---*/
-    TaskHandle_t pkt_task;   /**< 패킷 처리 태스크 핸들 */
+    TaskHandle_t pkt_task;   /**< 패킷 처리 태스크 핸들 (RX 알림 대상) */
     SemaphoreHandle_t mutex; /**< 송신 보호 뮤텍스 (gps_send_cmd_sync 전용) */
-    QueueHandle_t pkt_queue; /**< RX 신호 큐 */
 
     /*--- HAL ---*/
     const gps_hal_ops_t *ops; /**< HAL 연산 함수 포인터 */
 
     /*--- RX 버퍼 ---*/
-    ringbuffer_t rx_buf;   /**< RX 링버퍼 */
-    char rx_buf_mem[2048]; /**< RX 버퍼 메모리 */
+    ringbuffer_t rx_buf; /**< RX 링버퍼 (메모리: 포트의 DMA 수신 버퍼) */
+    gps_tap_t tap;       /**< RX 원본 스트림 탭 (디버그 미러링, 기본 비활성) */
 
     /*--- 파서 ---*/
     gps_parser_ctx_t parser_ctx; /**< 파서 컨텍스트 */
@@ -210,6 +231,22 @@ void gps_set_evt_handler(gps_t *gps, gps_evt_handler handler);
  */
 bool gps_send_cmd_sync(gps_t *gps, const char *cmd, uint32_t timeout_ms);
 
+/**
+ * @brief 명령 여러 개를 파이프라인으로 전송 (끝날 때까지 블록)
+ *
+ * 응답을 기다리지 않고 cfg->window개까지 연달아 보내고, 응답 에코로 요청을 찾아
+ * 실패한 명령만 재전송. cfg->deadline_ms 안에 끝남
+ *
+ * @param gps GPS 핸들
+ * @param batch 배치 상태 (반환 후 명령별 결과 확인용, 인자 오류여도 0으로 초기화)
+ * @param cmds 명령 배열
+ * @param count 명령 수 (GPS_CMD_BATCH_MAX 이하)
+ * @param cfg 파이프라인 설정
+ * @return true: 전부 OK 응답
+ */
+bool gps_send_cmds(gps_t *gps, gps_cmd_batch_t *batch, const char *const *cmds, size_t count,
+                   const gps_cmd_batch_cfg_t *cfg);
+
 /*===========================================================================
  * 레거시 API (deprecated - 호환용)
  *===========================================================================*/
@@ -0,0 +1,211 @@
+/**
+ * @file gps_baud.c
+ * @brief UM982 보드레이트 협상 (상태 머신)
+ *
+ * 후보는 목표 이하의 표 값을 빠른 순으로 한 번씩만 시도하므로 끝이 정해져 있음.
+ * 연결을 잃으면 (이전 속도로도 응답 없음) 다시 감지하고, 그래도 못 찾으면
+ * 수신기를 리셋해서 저장된 속도로 되돌린 뒤 감지
+ */
+
+#include "gps_baud.h"
+#include "dev_assert.h"
+#include <stdio.h>
+#include <string.h>
+
+#define GPS_BAUD_SNAP_TOLERANCE_PCT 3 /* 자동 측정 허용 오차 */
+#define GPS_BAUD_MAX_RESETS         2 /* 연결을 잃었을 때 리셋 횟수 한도 */
+
+#define X(rate) rate,
+static const uint32_t baud_rates[] = {GPS_BAUD_RATE_TABLE(X)};
+#undef X
+
+#define BAUD_RATE_COUNT (sizeof(baud_rates) / sizeof(baud_rates[0]))
+
+/*===========================================================================
+ * 유틸리티
+ *===========================================================================*/
+
+uint32_t gps_baud_snap(uint32_t measured) {
+    for (size_t i = 0; i < BAUD_RATE_COUNT; i++) {
+        uint32_t rate = baud_rates[i];
+        uint32_t diff = (measured > rate) ? measured - rate : rate - measured;
+
+        if ((uint64_t)diff * 100 <= (uint64_t)rate * GPS_BAUD_SNAP_TOLERANCE_PCT) {
+            return rate;
+        }
+    }
+
+    return 0;
+}
+
+size_t gps_baud_format_cmd(char *buf, size_t size, const char *port, uint32_t baudrate) {
+    int n = snprintf(buf, size, "CONFIG %s %lu\r\n", port, (unsigned long)baudrate);
+
+    return (n > 0 && (size_t)n < size) ? (size_t)n : 0;
+}
+
+/*===========================================================================
+ * 상태 머신 단계
+ *===========================================================================*/
+
+static bool probe_retry(const gps_baud_ops_t *ops, const gps_baud_cfg_t *cfg) {
+    uint8_t tries = cfg->probe_retries ? cfg->probe_retries : 1;
+
+    for (uint8_t i = 0; i < tries; i++) {
+        if (ops->probe(ops->ctx)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool probe_at(const gps_baud_ops_t *ops, const gps_baud_cfg_t *cfg, uint32_t rate) {
+    return ops->set_local(ops->ctx, rate) && probe_retry(ops, cfg);
+}
+
+/**
+ * @brief 수신기 현재 속도 찾기
+ *
+ * 자동 측정값 → 공장 기본값 → 나머지 표 값(빠른 순)
+ *
+ * @return uint32_t 확인된 속도 (0: 응답 없음)
+ */
+static uint32_t detect(const gps_baud_ops_t *ops, const gps_baud_cfg_t *cfg,
+                       gps_baud_result_t *res) {
+    uint32_t measured = 0;
+
+    if (ops->autobaud) {
+        measured = gps_baud_snap(ops->autobaud(ops->ctx));
+        if (measured && probe_at(ops, cfg, measured)) {
+            res->autobaud_hit = true;
+            return measured;
+        }
+    }
+
+    if (measured != GPS_BAUD_DEFAULT && probe_at(ops, cfg, GPS_BAUD_DEFAULT)) {
+        return GPS_BAUD_DEFAULT;
+    }
+
+    for (size_t i = 0; i < BAUD_RATE_COUNT; i++) {
+        uint32_t rate = baud_rates[i];
+
+        if (rate == GPS_BAUD_DEFAULT || rate == measured) {
+            continue;
+        }
+        if (probe_at(ops, cfg, rate)) {
+            return rate;
+        }
+    }
+
+    return 0;
+}
+
+/*===========================================================================
+ * 협상
+ *===========================================================================*/
+
+bool gps_baud_negotiate(const gps_baud_ops_t *ops, const gps_baud_cfg_t *cfg,
+                        gps_baud_result_t *res) {
+    DEV_ASSERT(ops != NULL && cfg != NULL);
+    DEV_ASSERT(ops->send_sync && ops->set_local && ops->probe && ops->delay_ms);
+
+    gps_baud_result_t scratch;
+    gps_baud_state_t st = GPS_BAUD_ST_DETECT;
+    uint32_t cur = 0;
+    uint32_t trying = 0;
+    size_t next = 0;
+    char cmd[32];
+
+    if (!res) {
+        res = &scratch;
+    }
+    memset(res, 0, sizeof(*res));
+
+    /* 첫 후보: 목표 이하에서 가장 빠른 표 값 */
+    while (next < BAUD_RATE_COUNT && baud_rates[next] > cfg->target) {
+        next++;
+    }
+
+    while (st != GPS_BAUD_ST_DONE && st != GPS_BAUD_ST_FAILED) {
+        switch (st) {
+        case GPS_BAUD_ST_DETECT:
+            cur = detect(ops, cfg, res);
+            while (!cur && ops->reset && res->resets < GPS_BAUD_MAX_RESETS) {
+                res->resets++;
+                ops->reset(ops->ctx);
+                ops->delay_ms(ops->ctx, cfg->boot_ms);
+                cur = detect(ops, cfg, res);
+            }
+
+            if (!cur) {
+                st = GPS_BAUD_ST_FAILED;
+                break;
+            }
+            if (!res->initial) {
+                res->initial = cur;
+            }
+            st = GPS_BAUD_ST_SWITCH;
+            break;
+
+        case GPS_BAUD_ST_SWITCH:
+            if (next >= BAUD_RATE_COUNT) {
+                st = GPS_BAUD_ST_DONE; /* 후보 소진, 현재 속도 유지 */
+                break;
+            }
+
+            trying = baud_rates[next++];
+
+            /* 목표 이내에서 이미 확인된 속도보다 느린 후보로는 내리지 않음 */
+            if (trying == cur || (cur <= cfg->target && trying < cur)) {
+                st = GPS_BAUD_ST_DONE;
+                break;
+            }
+
+            if (!gps_baud_format_cmd(cmd, sizeof(cmd), cfg->port, trying)) {
+                st = GPS_BAUD_ST_FAILED;
+                break;
+            }
+
+            res->switches++;
+            if (!ops->send_sync(ops->ctx, cmd)) {
+                st = GPS_BAUD_ST_REVERT;
+                break;
+            }
+
+            ops->delay_ms(ops->ctx, cfg->settle_ms);
+            st = ops->set_local(ops->ctx, trying) ? GPS_BAUD_ST_VERIFY : GPS_BAUD_ST_REVERT;
+            break;
+
+        case GPS_BAUD_ST_VERIFY:
+            if (probe_retry(ops, cfg)) {
+                cur = trying;
+                st = GPS_BAUD_ST_DONE;
+            }
+            else {
+                st = GPS_BAUD_ST_REVERT;
+            }
+            break;
+
+        case GPS_BAUD_ST_REVERT:
+            /* 수신기가 거부했으면 이전 속도에 그대로 있음, 아니면 연결을 잃음 */
+            res->fallbacks++;
+            st = probe_at(ops, cfg, cur) ? GPS_BAUD_ST_SWITCH : GPS_BAUD_ST_DETECT;
+            break;
+
+        default:
+            st = GPS_BAUD_ST_FAILED;
+            break;
+        }
+    }
+
+    res->state = st;
+    if (st == GPS_BAUD_ST_FAILED) {
+        ops->set_local(ops->ctx, GPS_BAUD_DEFAULT);
+        res->baudrate = GPS_BAUD_DEFAULT;
+        return false;
+    }
+
+    res->baudrate = cur;
+    return true;
+}
@@ -0,0 +1,112 @@
+#ifndef GPS_BAUD_H
+#define GPS_BAUD_H
+
+/**
+ * @file gps_baud.h
+ * @brief UM982 보드레이트 협상 (상태 머신, RTOS/HAL 무관)
+ *
+ * 115200 bps(약 11.5 KB/s)로는 20 Hz BESTNAVB/THS + MSM RTCM을 다 싣지 못해서
+ * 초기화 때 수신기와 로컬 USART를 더 높은 속도로 함께 올림.
+ *
+ *   DETECT  수신기 현재 속도 찾기: 하드웨어 자동 측정값 → 확인, 실패하면 표 순회
+ *   SWITCH  현재 속도로 "CONFIG COMx <rate>" 송신 (전송 완료까지 대기) → 로컬 변경
+ *   VERIFY  새 속도로 확인 명령, OK 에코가 오면 완료
+ *   REVERT  확인 실패: 로컬을 이전 속도로 되돌려 확인 후 한 단계 낮은 속도 시도.
+ *           이전 속도도 응답이 없으면 다시 DETECT (그래도 없으면 수신기 리셋 후 DETECT)
+ *
+ * CONFIG COMx는 저장하지 않으므로 수신기 리셋/전원 재인가 시 저장된 속도로 돌아감.
+ * 그래서 매 초기화마다 DETECT부터 시작
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GPS_BAUD_DEFAULT 115200 /**< UM982 공장 기본값 (CubeMX USART2 초기값) */
+
+/** UM982가 지원하는 보드레이트 (내림차순) */
+#define GPS_BAUD_RATE_TABLE(X)                                                              \
+    X(921600)                                                                               \
+    X(460800)                                                                               \
+    X(230400)                                                                               \
+    X(115200)                                                                               \
+    X(57600)                                                                                \
+    X(38400)                                                                                \
+    X(19200)                                                                                \
+    X(9600)
+
+typedef enum {
+    GPS_BAUD_ST_DETECT = 0,
+    GPS_BAUD_ST_SWITCH,
+    GPS_BAUD_ST_VERIFY,
+    GPS_BAUD_ST_REVERT,
+    GPS_BAUD_ST_DONE,
+    GPS_BAUD_ST_FAILED,
+} gps_baud_state_t;
+
+/**
+ * @brief 플랫폼 연산 (GPS 앱 태스크 컨텍스트에서 호출)
+ */
+typedef struct {
+    /** 명령 송신 후 마지막 바이트가 선로로 나갈 때까지 대기 (응답은 기다리지 않음) */
+    bool (*send_sync)(void *ctx, const char *cmd);
+    /** 로컬 USART 보드레이트 변경 */
+    bool (*set_local)(void *ctx, uint32_t baudrate);
+    /** 확인 명령 송신 후 OK 에코 대기 */
+    bool (*probe)(void *ctx);
+    /** 하드웨어 자동 보드레이트 측정 원본값 (NULL 가능, 0: 측정 실패) */
+    uint32_t (*autobaud)(void *ctx);
+    /** 수신기 하드웨어 리셋 (NULL 가능, 저장된 속도로 복귀) */
+    bool (*reset)(void *ctx);
+    void (*delay_ms)(void *ctx, uint32_t ms);
+    void *ctx; /**< 각 연산에 전달 */
+} gps_baud_ops_t;
+
+typedef struct {
+    const char *port;      /**< 수신기 쪽 포트 이름 (예: "COM1") */
+    uint32_t target;       /**< 목표 보드레이트 (표에 있는 값) */
+    uint8_t probe_retries; /**< 속도마다 확인 명령 시도 횟수 (최소 1) */
+    uint16_t settle_ms;    /**< CONFIG 송신 후 수신기가 속도를 바꿀 때까지 대기 */
+    uint16_t boot_ms;      /**< 리셋 후 수신기 부팅 대기 */
+} gps_baud_cfg_t;
+
+typedef struct {
+    gps_baud_state_t state; /**< 종료 상태 (DONE 또는 FAILED) */
+    uint32_t initial;       /**< 처음 감지한 수신기 속도 (0: 감지 실패) */
+    uint32_t baudrate;      /**< 최종 속도 (로컬 = 수신기, FAILED면 GPS_BAUD_DEFAULT) */
+    bool autobaud_hit;      /**< 자동 측정값이 확인 명령으로 맞았음 */
+    uint8_t switches;       /**< 보낸 CONFIG 명령 수 */
+    uint8_t fallbacks;      /**< 확인 실패로 되돌린 횟수 */
+    uint8_t resets;         /**< 연결을 잃어 수신기를 리셋한 횟수 */
+} gps_baud_result_t;
+
+/**
+ * @brief 측정값을 가장 가까운 표 값으로 맞춤
+ *
+ * @param measured 측정 보드레이트
+ * @return uint32_t 표 값 (오차 3% 초과면 0)
+ */
+uint32_t gps_baud_snap(uint32_t measured);
+
+/**
+ * @brief "CONFIG <port> <rate>\r\n" 명령 생성
+ *
+ * @return size_t 명령 길이 (버퍼 부족이면 0)
+ */
+size_t gps_baud_format_cmd(char *buf, size_t size, const char *port, uint32_t baudrate);
+
+/**
+ * @brief 보드레이트 협상 (끝날 때까지 블록)
+ *
+ * 목표 속도부터 한 단계씩 낮추며 시도하고, 확인된 가장 높은 속도에서 끝냄.
+ * 실패하면 로컬을 GPS_BAUD_DEFAULT로 두고 false 반환
+ *
+ * @param ops 플랫폼 연산
+ * @param cfg 설정
+ * @param res 결과 (NULL 가능)
+ * @return true: 로컬과 수신기가 res->baudrate로 통신 확인됨
+ */
+bool gps_baud_negotiate(const gps_baud_ops_t *ops, const gps_baud_cfg_t *cfg,
+                        gps_baud_result_t *res);
+
+#endif /* GPS_BAUD_H */
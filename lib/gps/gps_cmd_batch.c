@@ -0,0 +1,252 @@
+/**
+ * @file gps_cmd_batch.c
+ * @brief Unicore 명령 파이프라인
+ */
+
+#include "gps_cmd_batch.h"
+#include "dev_assert.h"
+#include <ctype.h>
+#include <string.h>
+
+/*===========================================================================
+ * 에코 비교
+ *===========================================================================*/
+
+/* 앞뒤 공백/CR/LF 제외 범위 */
+static const char *trim(const char *s, size_t len, size_t *out_len) {
+    while (len > 0 && isspace((unsigned char)*s)) {
+        s++;
+        len--;
+    }
+    while (len > 0 && isspace((unsigned char)s[len - 1])) {
+        len--;
+    }
+
+    *out_len = len;
+    return s;
+}
+
+static bool echo_matches(const char *cmd, const char *echo, size_t echo_len) {
+    size_t cmd_len;
+
+    cmd = trim(cmd, strlen(cmd), &cmd_len);
+    if (cmd_len != echo_len) {
+        return false;
+    }
+
+    for (size_t i = 0; i < cmd_len; i++) {
+        if (tolower((unsigned char)cmd[i]) != tolower((unsigned char)echo[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*===========================================================================
+ * 상태 전이
+ *===========================================================================*/
+
+static void settle(gps_cmd_batch_t *batch, gps_cmd_entry_t *e, gps_cmd_state_t st) {
+    e->state = st;
+    batch->remaining--;
+}
+
+/* ERROR 응답 또는 시간 초과: 시도 횟수가 남았으면 다시 대기열로 */
+static void fail_or_retry(gps_cmd_batch_t *batch, gps_cmd_entry_t *e) {
+    if (e->attempts >= batch->cfg.max_attempts) {
+        settle(batch, e, GPS_CMD_ST_FAILED);
+    }
+    else {
+        e->state = GPS_CMD_ST_PENDING;
+    }
+}
+
+static void expire(gps_cmd_batch_t *batch, uint32_t now_ms) {
+    bool over = batch->cfg.deadline_ms && (now_ms - batch->start_ms) >= batch->cfg.deadline_ms;
+
+    for (size_t i = 0; i < batch->count; i++) {
+        gps_cmd_entry_t *e = &batch->entries[i];
+
+        if (e->state == GPS_CMD_ST_INFLIGHT &&
+            (over || (now_ms - e->sent_ms) >= batch->cfg.timeout_ms)) {
+            e->state = GPS_CMD_ST_PENDING;
+            batch->inflight--;
+            fail_or_retry(batch, e);
+        }
+        if (over && e->state == GPS_CMD_ST_PENDING) {
+            settle(batch, e, GPS_CMD_ST_FAILED);
+        }
+    }
+}
+
+/*===========================================================================
+ * API
+ *===========================================================================*/
+
+bool gps_cmd_batch_init(gps_cmd_batch_t *batch, const char *const *cmds, size_t count,
+                        const gps_cmd_batch_cfg_t *cfg, uint32_t now_ms) {
+    DEV_ASSERT(batch != NULL && cfg != NULL);
+
+    memset(batch, 0, sizeof(*batch));
+    if (count > GPS_CMD_BATCH_MAX) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        batch->entries[i].cmd = cmds[i];
+    }
+
+    batch->count = count;
+    batch->remaining = count;
+    batch->cfg = *cfg;
+    batch->cfg.window = cfg->window ? cfg->window : 1;
+    batch->cfg.max_attempts = cfg->max_attempts ? cfg->max_attempts : 1;
+    batch->start_ms = now_ms;
+
+    return true;
+}
+
+const char *gps_cmd_batch_next(gps_cmd_batch_t *batch, uint32_t now_ms) {
+    expire(batch, now_ms);
+
+    if (batch->inflight >= batch->cfg.window) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < batch->count; i++) {
+        gps_cmd_entry_t *e = &batch->entries[i];
+
+        if (e->state != GPS_CMD_ST_PENDING) {
+            continue;
+        }
+
+        e->state = GPS_CMD_ST_INFLIGHT;
+        e->sent_ms = now_ms;
+        e->attempts++;
+        batch->inflight++;
+        batch->sent++;
+        if (e->attempts > 1) {
+            batch->retries++;
+        }
+        return e->cmd;
+    }
+
+    return NULL;
+}
+
+bool gps_cmd_batch_on_send_error(gps_cmd_batch_t *batch, const char *cmd) {
+    for (size_t i = 0; i < batch->count; i++) {
+        gps_cmd_entry_t *e = &batch->entries[i];
+
+        if (e->cmd == cmd && e->state == GPS_CMD_ST_INFLIGHT) {
+            batch->inflight--;
+            e->error = false;
+            e->state = GPS_CMD_ST_PENDING;
+            fail_or_retry(batch, e);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool gps_cmd_batch_on_response(gps_cmd_batch_t *batch, const char *echo, size_t len, bool ok) {
+    gps_cmd_entry_t *match = NULL;
+
+    echo = trim(echo, len, &len);
+
+    for (size_t i = 0; i < batch->count; i++) {
+        gps_cmd_entry_t *e = &batch->entries[i];
+
+        if (!echo_matches(e->cmd, echo, len)) {
+            continue;
+        }
+
+        if (e->state == GPS_CMD_ST_INFLIGHT) {
+            if (!match || match->state != GPS_CMD_ST_INFLIGHT ||
+                (int32_t)(e->sent_ms - match->sent_ms) < 0) {
+                match = e;
+            }
+        }
+        else if (e->state == GPS_CMD_ST_PENDING && e->attempts > 0 && !match) {
+            match = e; /* 시간 초과 후 늦게 온 응답 */
+        }
+    }
+
+    if (!match) {
+        batch->unmatched++;
+        return false;
+    }
+
+    if (match->state == GPS_CMD_ST_INFLIGHT) {
+        batch->inflight--;
+    }
+
+    match->error = !ok;
+    if (ok) {
+        settle(batch, match, GPS_CMD_ST_OK);
+    }
+    else {
+        match->state = GPS_CMD_ST_PENDING;
+        fail_or_retry(batch, match);
+    }
+
+    return true;
+}
+
+bool gps_cmd_batch_done(const gps_cmd_batch_t *batch) {
+    return batch->remaining == 0;
+}
+
+uint32_t gps_cmd_batch_wait_ms(const gps_cmd_batch_t *batch, uint32_t now_ms) {
+    uint32_t wait = UINT32_MAX;
+    bool pending = false;
+
+    if (gps_cmd_batch_done(batch)) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < batch->count; i++) {
+        const gps_cmd_entry_t *e = &batch->entries[i];
+
+        if (e->state == GPS_CMD_ST_INFLIGHT) {
+            uint32_t elapsed = now_ms - e->sent_ms;
+            uint32_t left = (elapsed < batch->cfg.timeout_ms) ? batch->cfg.timeout_ms - elapsed : 0;
+
+            if (left < wait) {
+                wait = left;
+            }
+        }
+        else if (e->state == GPS_CMD_ST_PENDING) {
+            pending = true;
+        }
+    }
+
+    if (pending && batch->inflight < batch->cfg.window) {
+        return 0;
+    }
+
+    if (batch->cfg.deadline_ms) {
+        uint32_t elapsed = now_ms - batch->start_ms;
+        uint32_t left = (elapsed < batch->cfg.deadline_ms) ? batch->cfg.deadline_ms - elapsed : 0;
+
+        if (left < wait) {
+            wait = left;
+        }
+    }
+
+    return wait;
+}
+
+size_t gps_cmd_batch_failed(const gps_cmd_batch_t *batch) {
+    size_t failed = 0;
+
+    for (size_t i = 0; i < batch->count; i++) {
+        if (batch->entries[i].state == GPS_CMD_ST_FAILED) {
+            failed++;
+        }
+    }
+
+    return failed;
+}
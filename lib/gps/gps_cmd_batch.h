@@ -0,0 +1,122 @@
+#ifndef GPS_CMD_BATCH_H
+#define GPS_CMD_BATCH_H
+
+/**
+ * @file gps_cmd_batch.h
+ * @brief Unicore 명령 파이프라인 (응답 에코로 요청 매칭, RTOS/HAL 무관)
+ *
+ * 명령 하나마다 응답을 기다리지 않고 최대 window개까지 연달아 보냄.
+ * UM982는 "$command,<명령>,response: OK*XX"로 명령 문자열을 돌려주므로
+ * 에코로 응답 대기 중인 요청을 찾음 (대소문자, 끝의 CR/LF 무시).
+ *
+ *   PENDING → (next) → INFLIGHT → OK 응답 → OK
+ *                                → ERROR 응답/시간 초과 → PENDING (재시도) 또는 FAILED
+ *
+ * 실패한 명령만 다시 보내고, 전체 한도(deadline_ms)가 지나면 남은 명령은 FAILED.
+ * 상태는 송신 태스크와 파서 태스크가 함께 바꾸므로 호출자가 스케줄러 잠금으로 보호
+ * (ISR은 건드리지 않으므로 인터럽트를 막을 필요 없음)
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GPS_CMD_BATCH_MAX 24 /**< 배치 하나의 최대 명령 수 */
+
+typedef enum {
+    GPS_CMD_ST_PENDING = 0, /**< 송신 대기 (처음 또는 재시도) */
+    GPS_CMD_ST_INFLIGHT,    /**< 송신함, 응답 대기 */
+    GPS_CMD_ST_OK,          /**< OK 응답 */
+    GPS_CMD_ST_FAILED,      /**< 시도 횟수 또는 전체 한도 초과 */
+} gps_cmd_state_t;
+
+typedef struct {
+    const char *cmd;  /**< 명령 문자열 (끝의 "\r\n" 있어도 됨) */
+    uint32_t sent_ms; /**< 마지막 송신 시각 */
+    uint8_t attempts; /**< 송신 횟수 */
+    uint8_t state;    /**< gps_cmd_state_t */
+    bool error;       /**< 마지막 응답이 ERROR (false: 응답 없음) */
+} gps_cmd_entry_t;
+
+typedef struct {
+    uint8_t window;       /**< 응답 없이 보낼 수 있는 최대 명령 수 (최소 1) */
+    uint8_t max_attempts; /**< 명령당 최대 송신 횟수 (최소 1) */
+    uint16_t timeout_ms;  /**< 송신부터 응답까지 대기 */
+    uint32_t deadline_ms; /**< 배치 전체 한도 (0: 없음) */
+} gps_cmd_batch_cfg_t;
+
+typedef struct {
+    gps_cmd_entry_t entries[GPS_CMD_BATCH_MAX];
+    size_t count;
+    gps_cmd_batch_cfg_t cfg;
+    uint32_t start_ms;
+    size_t inflight;    /**< 응답 대기 중인 명령 수 */
+    size_t remaining;   /**< OK/FAILED가 아닌 명령 수 */
+    uint32_t sent;      /**< 총 송신 수 (재시도 포함) */
+    uint32_t retries;   /**< 재시도 송신 수 */
+    uint32_t unmatched; /**< 대기 중인 요청이 없는 응답 수 */
+} gps_cmd_batch_t;
+
+/**
+ * @brief 배치 초기화
+ *
+ * @param batch 배치
+ * @param cmds 명령 배열 (배치가 끝날 때까지 유지)
+ * @param count 명령 수 (GPS_CMD_BATCH_MAX 이하)
+ * @param cfg 설정
+ * @param now_ms 현재 시각
+ * @return false: 명령 수 초과
+ */
+bool gps_cmd_batch_init(gps_cmd_batch_t *batch, const char *const *cmds, size_t count,
+                        const gps_cmd_batch_cfg_t *cfg, uint32_t now_ms);
+
+/**
+ * @brief 다음에 보낼 명령 (INFLIGHT로 표시)
+ *
+ * 시간 초과한 요청과 전체 한도를 먼저 처리. 반환된 명령은 바로 송신
+ *
+ * @return const char* 명령 (NULL: 창이 가득 찼거나 보낼 명령 없음)
+ */
+const char *gps_cmd_batch_next(gps_cmd_batch_t *batch, uint32_t now_ms);
+
+/**
+ * @brief 송신 실패 반영 (next로 받은 명령이 나가지 못함)
+ *
+ * 응답을 기다리지 않고 바로 재시도 대기열로 (시도 횟수는 소모, 한도면 FAILED)
+ *
+ * @param cmd gps_cmd_batch_next가 돌려준 명령
+ * @return true: 응답 대기 중인 요청을 찾음
+ */
+bool gps_cmd_batch_on_send_error(gps_cmd_batch_t *batch, const char *cmd);
+
+/**
+ * @brief 명령 응답 반영
+ *
+ * 같은 명령이 여러 번 대기 중이면 가장 먼저 보낸 요청에 매칭.
+ * 시간 초과 후 늦게 온 응답은 재송신 전이면 그대로 받아들임
+ *
+ * @param echo 응답의 명령 에코 ("$command," 다음부터 ",response:" 앞까지)
+ * @param len 에코 길이
+ * @param ok OK 응답 여부
+ * @return true: 요청에 매칭됨
+ */
+bool gps_cmd_batch_on_response(gps_cmd_batch_t *batch, const char *echo, size_t len, bool ok);
+
+/**
+ * @brief 모든 명령이 OK 또는 FAILED
+ */
+bool gps_cmd_batch_done(const gps_cmd_batch_t *batch);
+
+/**
+ * @brief 다음 시간 초과 또는 전체 한도까지 남은 시간 (응답 대기에 사용)
+ *
+ * @return uint32_t 대기 시간 (0: 지금 보낼 명령이 있거나 완료)
+ */
+uint32_t gps_cmd_batch_wait_ms(const gps_cmd_batch_t *batch, uint32_t now_ms);
+
+/**
+ * @brief FAILED 명령 수
+ */
+size_t gps_cmd_batch_failed(const gps_cmd_batch_t *batch);
+
+#endif /* GPS_CMD_BATCH_H */
@@ -7,6 +7,7 @@
  */
 
 #include "gps_types.h"
+#include "ringbuffer.h"
 
 /**
  * @brief 프로토콜 타입
@@ -31,6 +32,7 @@ typedef enum gps_event_type_e {
     GPS_EVENT_SATELLITE_UPDATED, /**< 위성 정보 업데이트 (GSA, GSV) */
     GPS_EVENT_RTCM_RECEIVED,     /**< RTCM 데이터 수신 (LoRa 전송용) */
     GPS_EVENT_CMD_RESPONSE,      /**< 명령어 응답 수신 (OK/ERROR) */
+    GPS_EVENT_RAW_FRAME,         /**< 원본 프레임 (수신 필터 GPS_FILTER_RAW) */
 } gps_event_type_t;
 
 /**
@@ -94,6 +96,14 @@ typedef struct {
         struct {
             bool success; /**< OK=true, ERROR=false */
         } cmd_response;
+
+        /* 원본 프레임 (링버퍼 직접 참조, 핸들러 호출 중에만 유효) */
+        struct {
+            uint32_t msg_id;            /**< 필터 메시지 ID (NMEA는 GPS_NMEA_KEY) */
+            uint16_t length;            /**< 프레임 전체 길이 */
+            uint8_t span_cnt;           /**< 구간 수 (랩어라운드면 2) */
+            ringbuffer_span_t spans[2]; /**< 프레임 구간 */
+        } raw;
     } data;
 
     /* 디버깅/로깅용 저수준 정보 */
@@ -0,0 +1,317 @@
+/**
+ * @file gps_filter.c
+ * @brief GPS 수신 필터 (메시지 ID별 디코드/원본 전달/집계/버림)
+ *
+ * 프레임 헤더에서 메시지 ID와 프레임 길이만 읽고, 디코드 대상이 아니면
+ * 파서를 거치지 않고 프레임 전체를 한 번에 advance
+ */
+
+#include "gps_filter.h"
+#include "gps.h"
+#include "gps_parser.h"
+#include "gps_proto_def.h"
+#include "gps_unicore_bin.h"
+#include <string.h>
+
+#ifndef TAG
+#define TAG "GPS_FILTER"
+#endif
+
+#include "log.h"
+
+/* 규칙 개수는 설정 태스크가 쓰고 GPS 태스크가 읽음 (규칙 내용 먼저, 개수 나중) */
+#define FILTER_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define FILTER_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* 프레임 식별에 필요한 헤더 길이 */
+#define FILTER_NMEA_PREFIX   6 /* $GPGSV */
+#define FILTER_BIN_PREFIX    8 /* sync(3) + header_len(1) + msg_id(2) + msg_len(2) */
+#define FILTER_RTCM_PREFIX   5 /* preamble(1) + length(2) + msg_type(12-bit) */
+#define FILTER_RTCM_OVERHEAD 6 /* header(3) + CRC24Q(3) */
+
+STATIC_ASSERT(GPS_FILTER_MAX_RULES <= UINT8_MAX, "rule_cnt is uint8_t");
+
+/*===========================================================================
+ * 규칙 조회
+ *===========================================================================*/
+
+static bool proto_supported(gps_protocol_t proto) {
+    return proto == GPS_PROTOCOL_NMEA || proto == GPS_PROTOCOL_UNICORE_BIN ||
+           proto == GPS_PROTOCOL_RTCM;
+}
+
+/**
+ * @return 규칙 인덱스, 없으면 -1
+ */
+static int rule_find(const gps_filter_t *f, uint32_t key) {
+    uint8_t cnt = FILTER_LOAD_ACQUIRE(&f->rule_cnt);
+
+    for (uint8_t i = 0; i < cnt; i++) {
+        if (f->rules[i].key == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 규칙/기본 동작 중 DECODE가 아닌 것이 있는지 다시 계산
+ */
+static void update_active(gps_filter_t *f) {
+    bool active = false;
+
+    for (size_t i = 0; i < GPS_FILTER_PROTO_MAX; i++) {
+        active |= (f->default_action[i] != GPS_FILTER_DECODE);
+    }
+    for (uint8_t i = 0; i < f->rule_cnt; i++) {
+        active |= (f->rules[i].action != GPS_FILTER_DECODE);
+    }
+
+    FILTER_STORE_RELEASE(&f->active, active);
+}
+
+/*===========================================================================
+ * 설정 API
+ *===========================================================================*/
+
+bool gps_filter_set(gps_t *gps, gps_protocol_t proto, uint32_t id, gps_filter_action_t action) {
+    if (!gps || !proto_supported(proto) || action > GPS_FILTER_DROP)
+        return false;
+
+    gps_filter_t *f = &gps->parser_ctx.filter;
+    uint32_t key = GPS_FILTER_KEY(proto, id);
+    int idx = rule_find(f, key);
+
+    if (idx >= 0) {
+        FILTER_STORE_RELEASE(&f->rules[idx].action, (uint8_t)action);
+    }
+    else {
+        if (f->rule_cnt >= GPS_FILTER_MAX_RULES) {
+            LOG_WARN("filter rule table full (proto %d, id %lu)", proto, (unsigned long)id);
+            return false;
+        }
+
+        /* 새 규칙은 개수를 늘리기 전에 내용을 모두 채움 */
+        gps_filter_rule_t *rule = &f->rules[f->rule_cnt];
+        rule->key = key;
+        rule->hits = 0;
+        rule->action = (uint8_t)action;
+        FILTER_STORE_RELEASE(&f->rule_cnt, (uint8_t)(f->rule_cnt + 1));
+    }
+
+    update_active(f);
+    return true;
+}
+
+bool gps_filter_set_default(gps_t *gps, gps_protocol_t proto, gps_filter_action_t action) {
+    if (!gps || !proto_supported(proto) || action > GPS_FILTER_DROP)
+        return false;
+
+    gps_filter_t *f = &gps->parser_ctx.filter;
+    FILTER_STORE_RELEASE(&f->default_action[proto], (uint8_t)action);
+    update_active(f);
+    return true;
+}
+
+gps_filter_action_t gps_filter_get(const gps_t *gps, gps_protocol_t proto, uint32_t id) {
+    if (!gps || !proto_supported(proto))
+        return GPS_FILTER_DECODE;
+
+    const gps_filter_t *f = &gps->parser_ctx.filter;
+    int idx = rule_find(f, GPS_FILTER_KEY(proto, id));
+
+    return (gps_filter_action_t)(idx >= 0 ? f->rules[idx].action : f->default_action[proto]);
+}
+
+uint32_t gps_filter_hits(const gps_t *gps, gps_protocol_t proto, uint32_t id) {
+    if (!gps || !proto_supported(proto))
+        return 0;
+
+    const gps_filter_t *f = &gps->parser_ctx.filter;
+    int idx = rule_find(f, GPS_FILTER_KEY(proto, id));
+
+    return (idx >= 0) ? f->rules[idx].hits : f->default_hits[proto];
+}
+
+/*===========================================================================
+ * 프레임 식별 (메시지 ID + 프레임 길이)
+ *===========================================================================*/
+
+/**
+ * @brief '$' 문장 식별 (NMEA만, $command 응답은 PASS)
+ *
+ * 길이는 처리 방식이 DECODE가 아닐 때만 nmea_frame_len으로 구함 (len = 0)
+ */
+static gps_filter_res_t frame_nmea(ringbuffer_t *rb, uint32_t *id, size_t *len) {
+    char prefix[FILTER_NMEA_PREFIX];
+    if (!ringbuffer_peek(rb, prefix, sizeof(prefix), 0)) {
+        return GPS_FILTER_RES_NEED_MORE;
+    }
+    if (prefix[1] != 'G') {
+        return GPS_FILTER_RES_PASS; /* $command,... */
+    }
+
+    *id = GPS_NMEA_KEY(prefix[3], prefix[4], prefix[5]);
+    *len = 0;
+    return GPS_FILTER_RES_CONSUMED;
+}
+
+/**
+ * @brief NMEA 문장 길이 ('\n'까지, 없으면 '\r'까지)
+ *
+ * '\r' 검색은 지난 호출에서 멈춘 위치(nmea_scan_pos)부터 이어서 함.
+ * GPS_NMEA_MAX_LEN 안에 '\r'이 없으면 파서에 넘겨 기존 경로(PARSE_INVALID)로 처리
+ */
+static gps_filter_res_t nmea_frame_len(gps_t *gps, ringbuffer_t *rb, size_t *len) {
+    gps_filter_t *f = &gps->parser_ctx.filter;
+    size_t available = ringbuffer_size(rb);
+    size_t limit = (available < GPS_NMEA_MAX_LEN) ? available : GPS_NMEA_MAX_LEN;
+    size_t pos = f->nmea_scan_pos;
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = (limit > pos) ? ringbuffer_peek_spans(rb, pos, limit - pos, spans) : 0;
+    const char *cr = NULL;
+
+    for (size_t i = 0; i < span_cnt && !cr; i++) {
+        cr = memchr(spans[i].data, '\r', spans[i].len);
+        pos += cr ? (size_t)(cr - spans[i].data) : spans[i].len;
+    }
+    gps->parser_ctx.stats.scanned_bytes += (cr ? pos + 1 : pos) - f->nmea_scan_pos;
+
+    if (!cr) {
+        f->nmea_scan_pos = (uint8_t)pos;
+        if (limit < GPS_NMEA_MAX_LEN) {
+            return GPS_FILTER_RES_NEED_MORE;
+        }
+        f->nmea_scan_pos = 0;
+        return GPS_FILTER_RES_PASS;
+    }
+
+    char next_char;
+    f->nmea_scan_pos = 0;
+    *len = pos + 1;
+    if (ringbuffer_peek(rb, &next_char, 1, pos + 1) && next_char == '\n') {
+        (*len)++;
+    }
+    return GPS_FILTER_RES_CONSUMED;
+}
+
+/**
+ * @brief Unicore binary 프레임 식별 (헤더 길이 기준, CRC는 보지 않음)
+ */
+static gps_filter_res_t frame_unicore_bin(ringbuffer_t *rb, uint32_t *id, size_t *len) {
+    uint8_t hdr[FILTER_BIN_PREFIX];
+    if (!ringbuffer_peek(rb, (char *)hdr, sizeof(hdr), 0)) {
+        return GPS_FILTER_RES_NEED_MORE;
+    }
+    if (hdr[1] != GPS_UNICORE_BIN_SYNC_2 || hdr[2] != GPS_UNICORE_BIN_SYNC_3) {
+        return GPS_FILTER_RES_PASS;
+    }
+
+    size_t total = GPS_UNICORE_BIN_HEADER_SIZE + (size_t)(hdr[6] | (hdr[7] << 8)) +
+                   GPS_UNICORE_BIN_CRC_SIZE;
+    if (total > GPS_MAX_PACKET_LEN) {
+        return GPS_FILTER_RES_PASS; /* 파서가 PARSE_INVALID로 처리 */
+    }
+
+    *id = (uint32_t)(hdr[4] | (hdr[5] << 8));
+    *len = total;
+    return GPS_FILTER_RES_CONSUMED;
+}
+
+/**
+ * @brief RTCM3 프레임 식별 (10-bit 길이 기준, CRC는 보지 않음)
+ */
+static gps_filter_res_t frame_rtcm(ringbuffer_t *rb, uint32_t *id, size_t *len) {
+    uint8_t hdr[FILTER_RTCM_PREFIX];
+    if (!ringbuffer_peek(rb, (char *)hdr, sizeof(hdr), 0)) {
+        return GPS_FILTER_RES_NEED_MORE;
+    }
+
+    if (hdr[1] & 0xFC) {
+        return GPS_FILTER_RES_PASS; /* 예약 비트가 0이 아님: RTCM 아님 */
+    }
+
+    size_t payload_len = ((size_t)(hdr[1] & 0x03) << 8) | hdr[2];
+    if (payload_len < 2) {
+        return GPS_FILTER_RES_PASS; /* 메시지 타입 없음 */
+    }
+
+    *id = (uint32_t)((hdr[3] << 4) | (hdr[4] >> 4));
+    *len = payload_len + FILTER_RTCM_OVERHEAD;
+    return GPS_FILTER_RES_CONSUMED;
+}
+
+/*===========================================================================
+ * 파서 루프용
+ *===========================================================================*/
+
+gps_filter_res_t gps_filter_process(gps_t *gps, ringbuffer_t *rb, uint8_t first) {
+    gps_filter_t *f = &gps->parser_ctx.filter;
+    gps_protocol_t proto;
+    gps_filter_res_t res;
+    uint32_t id = 0;
+    size_t len = 0;
+
+    switch (first) {
+    case GPS_ASCII_SYNC:
+        proto = GPS_PROTOCOL_NMEA;
+        res = frame_nmea(rb, &id, &len);
+        break;
+    case GPS_UNICORE_BIN_SYNC_1:
+        proto = GPS_PROTOCOL_UNICORE_BIN;
+        res = frame_unicore_bin(rb, &id, &len);
+        break;
+    case GPS_RTCM_SYNC:
+        proto = GPS_PROTOCOL_RTCM;
+        res = frame_rtcm(rb, &id, &len);
+        break;
+    default:
+        return GPS_FILTER_RES_PASS;
+    }
+
+    if (res != GPS_FILTER_RES_CONSUMED) {
+        return res;
+    }
+
+    int idx = rule_find(f, GPS_FILTER_KEY(proto, id));
+    gps_filter_rule_t *rule = (idx >= 0) ? &f->rules[idx] : NULL;
+    uint8_t action = __atomic_load_n(rule ? &rule->action : &f->default_action[proto],
+                                     __ATOMIC_RELAXED);
+
+    if (action == GPS_FILTER_DECODE) {
+        f->nmea_scan_pos = 0; /* 수신 중 규칙이 DECODE로 바뀐 경우 */
+        return GPS_FILTER_RES_PASS;
+    }
+
+    if (len == 0 && (res = nmea_frame_len(gps, rb, &len)) != GPS_FILTER_RES_CONSUMED) {
+        return res;
+    }
+
+    /* 버리거나 원본으로 넘길 프레임은 끝까지 받은 뒤 한 번에 처리 */
+    if (ringbuffer_size(rb) < len) {
+        return GPS_FILTER_RES_NEED_MORE;
+    }
+
+    if (action == GPS_FILTER_RAW || action == GPS_FILTER_COUNT) {
+        if (rule) {
+            rule->hits++;
+        }
+        else {
+            f->default_hits[proto]++;
+        }
+    }
+
+    if (action == GPS_FILTER_RAW && gps->handler) {
+        gps_event_t event = {.type = GPS_EVENT_RAW_FRAME,
+                             .protocol = proto,
+                             .timestamp_ms = xTaskGetTickCount(),
+                             .data.raw.msg_id = id,
+                             .data.raw.length = (uint16_t)len};
+        event.data.raw.span_cnt = (uint8_t)ringbuffer_peek_spans(rb, 0, len, event.data.raw.spans);
+        gps->handler(gps, &event);
+    }
+
+    ringbuffer_advance(rb, len);
+    gps->parser_ctx.stats.filtered_packets++;
+    return GPS_FILTER_RES_CONSUMED;
+}
@@ -0,0 +1,126 @@
+#ifndef GPS_FILTER_H
+#define GPS_FILTER_H
+
+/**
+ * @file gps_filter.h
+ * @brief GPS 수신 필터 (메시지 ID별 디코드/원본 전달/집계/버림)
+ *
+ * 프로토콜 파서 앞에서 프레임 헤더만 보고 메시지 ID를 식별해 처리 방식을 결정.
+ * 디코드 대상이 아닌 프레임은 파서를 거치지 않고 길이(Binary, RTCM) 또는
+ * 종단 문자(NMEA)로 한 번에 건너뛰므로, 수신기 출력 구성이 바뀌어도
+ * (GSV/GSA 폭주, 잘못된 설정 후 ASCII 로그 등) GPS 태스크 부하가 늘지 않음.
+ *
+ * - 규칙이 없고 기본 동작이 모두 DECODE면 비활성 (파서 루프에서 플래그 하나만 확인)
+ * - Unicore 명령어 응답($command,...)은 필터 대상 아님 (명령어 동기화에 필요)
+ * - Binary/RTCM은 CRC 검증 없이 헤더 길이로 건너뜀 (CRC 오류 시 파서와 동일한 정책)
+ *
+ * 규칙 변경은 다른 태스크(gps_app 등)에서 해도 됨: 규칙 추가는 내용을 채운 뒤
+ * 개수를 release로 늘리고, 동작 변경은 1바이트 저장이라 GPS 태스크가 반쯤 쓰인
+ * 규칙을 보지 않음. 규칙을 쓰는 태스크는 하나여야 함
+ */
+
+#include "gps_event.h"
+#include "ringbuffer.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GPS_FILTER_MAX_RULES 16                      /**< 인스턴스당 최대 규칙 수 */
+#define GPS_FILTER_PROTO_MAX (GPS_PROTOCOL_RTCM + 1) /**< 프로토콜별 기본 동작 배열 크기 */
+
+/**
+ * @brief 메시지별 처리 방식
+ */
+typedef enum {
+    GPS_FILTER_DECODE = 0, /**< 파서로 디코드 (기본값) */
+    GPS_FILTER_RAW,        /**< 디코드 없이 원본 프레임을 GPS_EVENT_RAW_FRAME으로 전달 */
+    GPS_FILTER_COUNT,      /**< 수신 횟수만 집계하고 버림 */
+    GPS_FILTER_DROP,       /**< 집계 없이 버림 */
+} gps_filter_action_t;
+
+/**
+ * @brief 필터 규칙 (프로토콜 + 메시지 ID → 처리 방식)
+ *
+ * id: NMEA는 GPS_NMEA_KEY로 패킹한 타입 3글자, Unicore Binary는 메시지 ID,
+ *     RTCM은 메시지 타입 (12-bit)
+ */
+typedef struct {
+    uint32_t key;   /**< GPS_FILTER_KEY(proto, id) */
+    uint32_t hits;  /**< RAW/COUNT로 처리한 프레임 수 */
+    uint8_t action; /**< gps_filter_action_t */
+} gps_filter_rule_t;
+
+#define GPS_FILTER_KEY(proto, id) (((uint32_t)(proto) << 24) | ((uint32_t)(id) & 0xFFFFFFu))
+
+/**
+ * @brief 인스턴스별 필터 상태 (gps_parser_ctx_t에 포함, 0으로 초기화하면 전부 DECODE)
+ */
+typedef struct {
+    bool active;                                  /**< DECODE가 아닌 설정이 하나라도 있음 */
+    uint8_t rule_cnt;                             /**< 사용 중인 규칙 수 */
+    uint8_t nmea_scan_pos;                        /**< 버리는 NMEA 문장의 '\r' 검색 재개 위치 */
+    uint8_t default_action[GPS_FILTER_PROTO_MAX]; /**< 규칙 없는 ID의 처리 방식 */
+    uint32_t default_hits[GPS_FILTER_PROTO_MAX];  /**< 기본 동작으로 RAW/COUNT 처리한 수 */
+    gps_filter_rule_t rules[GPS_FILTER_MAX_RULES];
+} gps_filter_t;
+
+/**
+ * @brief 필터 처리 결과
+ */
+typedef enum {
+    GPS_FILTER_RES_PASS = 0,  /**< 디코드 대상 (또는 식별 불가) → 프로토콜 파서로 진행 */
+    GPS_FILTER_RES_CONSUMED,  /**< 필터가 프레임을 처리하고 advance함 */
+    GPS_FILTER_RES_NEED_MORE, /**< 프레임 식별/길이 확인에 데이터 부족 */
+} gps_filter_res_t;
+
+/*===========================================================================
+ * 설정 API (런타임 변경 가능)
+ *===========================================================================*/
+
+/**
+ * @brief 메시지 ID별 처리 방식 설정
+ *
+ * @param gps GPS 핸들
+ * @param proto GPS_PROTOCOL_NMEA / GPS_PROTOCOL_UNICORE_BIN / GPS_PROTOCOL_RTCM
+ * @param id 메시지 ID (NMEA는 GPS_NMEA_KEY('G', 'S', 'V') 형태)
+ * @param action 처리 방식
+ * @return true 성공, false 프로토콜 미지원 또는 규칙 테이블 가득 참
+ */
+bool gps_filter_set(gps_t *gps, gps_protocol_t proto, uint32_t id, gps_filter_action_t action);
+
+/**
+ * @brief 규칙이 없는 메시지 ID의 처리 방식 설정
+ *
+ * 예: NMEA 기본값을 DROP으로 두고 GGA/THS만 DECODE로 등록하면 허용 목록 방식
+ *
+ * @param gps GPS 핸들
+ * @param proto 프로토콜
+ * @param action 처리 방식
+ * @return true 성공, false 프로토콜 미지원
+ */
+bool gps_filter_set_default(gps_t *gps, gps_protocol_t proto, gps_filter_action_t action);
+
+/**
+ * @brief 메시지 ID의 현재 처리 방식 조회
+ */
+gps_filter_action_t gps_filter_get(const gps_t *gps, gps_protocol_t proto, uint32_t id);
+
+/**
+ * @brief 메시지 ID를 RAW/COUNT로 처리한 횟수 (규칙 없으면 프로토콜 기본 동작 집계)
+ */
+uint32_t gps_filter_hits(const gps_t *gps, gps_protocol_t proto, uint32_t id);
+
+/*===========================================================================
+ * 파서 루프용 (gps_parser.c)
+ *===========================================================================*/
+
+/**
+ * @brief 링버퍼 맨 앞 프레임에 필터 적용
+ *
+ * @param gps GPS 핸들
+ * @param rb 수신 링버퍼
+ * @param first 맨 앞 바이트 (파서 루프가 이미 peek한 값)
+ * @return 처리 결과
+ */
+gps_filter_res_t gps_filter_process(gps_t *gps, ringbuffer_t *rb, uint8_t first);
+
+#endif /* GPS_FILTER_H */
@@ -0,0 +1,116 @@
+/**
+ * @file gps_fixed.c
+ * @brief NMEA 숫자 필드 → 고정소수점 정수 변환
+ */
+
+#include "gps_fixed.h"
+#include "dev_assert.h"
+#include <stddef.h>
+
+#define DDMM_MAX_INT_DIGITS  5 /* DDDMM */
+#define DDMM_MAX_FRAC_DIGITS 9 /* 분 소수부 (1e-9 분 단위까지) */
+
+static const uint32_t pow10_tbl[10] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u,
+};
+
+static inline bool is_digit(char c) {
+    return (unsigned)(c - '0') < 10u;
+}
+
+bool gps_fixed_parse_ddmm(const char *str, int64_t *ndeg) {
+    DEV_ASSERT(str != NULL);
+    DEV_ASSERT(ndeg != NULL);
+
+    const char *p = str;
+    uint32_t int_part = 0;
+    uint64_t frac_e9 = 0; /* 분 소수부 (1e-9 분) */
+    uint8_t digits = 0;
+
+    *ndeg = 0;
+
+    for (; is_digit(*p); p++) {
+        if (++digits > DDMM_MAX_INT_DIGITS) {
+            return false;
+        }
+        int_part = int_part * 10 + (uint32_t)(*p - '0');
+    }
+
+    if (*p == '.') {
+        uint8_t n = 0;
+
+        for (p++; is_digit(*p); p++, n++) {
+            if (n < DDMM_MAX_FRAC_DIGITS) {
+                frac_e9 += (uint64_t)(*p - '0') * pow10_tbl[DDMM_MAX_FRAC_DIGITS - 1 - n];
+            }
+        }
+        digits += (n > 0);
+    }
+
+    if (digits == 0) {
+        return false;
+    }
+
+    /* DDMM → 도 + 분/60, 분은 1e-9 분 단위 정수라 /60을 정수 반올림으로 처리 */
+    uint64_t min_e9 = (uint64_t)(int_part % 100) * pow10_tbl[9] + frac_e9;
+
+    *ndeg = (int64_t)(int_part / 100) * GPS_FIXED_NDEG_PER_DEG + (int64_t)((min_e9 + 30) / 60);
+    return true;
+}
+
+bool gps_fixed_parse_decimal(const char *str, uint8_t frac_digits, int32_t *out) {
+    DEV_ASSERT(str != NULL);
+    DEV_ASSERT(out != NULL);
+    DEV_ASSERT(frac_digits <= 9);
+
+    const char *p = str;
+    bool neg = false;
+    int64_t val = 0;
+    uint8_t digits = 0;
+    uint8_t n = 0;
+    bool round_up = false;
+
+    *out = 0;
+
+    if (*p == '-') {
+        neg = true;
+        p++;
+    }
+
+    for (; is_digit(*p); p++, digits++) {
+        val = val * 10 + (*p - '0');
+        if (val > INT32_MAX) {
+            return false;
+        }
+    }
+
+    if (*p == '.') {
+        for (p++; is_digit(*p); p++, digits++) {
+            if (n < frac_digits) {
+                val = val * 10 + (*p - '0');
+                n++;
+            }
+            else if (n == frac_digits) {
+                /* 남길 자리 다음 한 자리로 반올림, 이후는 무시 */
+                round_up = (*p >= '5');
+                n++;
+            }
+        }
+    }
+
+    if (digits == 0) {
+        return false;
+    }
+
+    if (n < frac_digits) {
+        val *= pow10_tbl[frac_digits - n];
+    }
+    val += round_up;
+
+    if (val > INT32_MAX) {
+        return false;
+    }
+
+    *out = (int32_t)(neg ? -val : val);
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef GPS_FIXED_H
+#define GPS_FIXED_H
+
+/**
+ * @file gps_fixed.h
+ * @brief NMEA 숫자 필드 → 고정소수점 정수 변환
+ *
+ * atof/double을 거치지 않고 필드 문자열을 바로 스케일된 정수로 바꿈.
+ * Cortex-M33은 double FPU가 없어서 atof + 나눗셈이 소프트웨어 에뮬레이션됨.
+ * 모든 함수는 필드 구분자(',', '*', '\0')나 숫자가 아닌 문자에서 멈춤.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPS_FIXED_NDEG_PER_DEG 1000000000LL /**< 1 degree = 1e9 nanodegree */
+
+/**
+ * @brief 위도/경도 (DDMM.MMMMMMM / DDDMM.MMMMMMM) → nanodegree
+ *
+ * 분 소수부는 9자리까지 사용 (그 이후 자리는 무시, 1e-11 degree 미만).
+ * 분 → 도 변환(/60)은 정수로 반올림. 소수부 7자리 이하(수신기 최대 출력)면
+ * 반올림 경계(.5)에 걸리지 않으므로 double 계산을 llround한 값과 항상 같음
+ *
+ * @param str 필드 시작
+ * @param[out] ndeg 절대값 (nanodegree, 부호는 N/S, E/W 필드로 판단)
+ * @return true 변환 성공
+ * @return false 빈 필드 또는 형식 오류 (*ndeg = 0)
+ */
+bool gps_fixed_parse_ddmm(const char *str, int64_t *ndeg);
+
+/**
+ * @brief 10진 소수 → 10^frac_digits 배 정수 (예: 고도 "499.6", 3 → 499600 mm)
+ *
+ * frac_digits보다 긴 소수부는 다음 자리로 반올림 (0에서 먼 쪽).
+ *
+ * @param str 필드 시작 ('-' 허용)
+ * @param frac_digits 남길 소수 자릿수 (0~9)
+ * @param[out] out 변환 값
+ * @return true 변환 성공
+ * @return false 빈 필드, 형식 오류 또는 int32 범위 초과 (*out = 0)
+ */
+bool gps_fixed_parse_decimal(const char *str, uint8_t frac_digits, int32_t *out);
+
+#endif
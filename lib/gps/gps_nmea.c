@@ -7,6 +7,7 @@
 #include "gps.h"
 #include "gps_parser.h"
 #include "gps_proto_def.h"
+#include "gps_fixed.h"
 #include "dev_assert.h"
 #include <string.h>
 #include <stdlib.h>
@@ -20,33 +21,61 @@
 /*===========================================================================
  * 내부 함수 선언
  *===========================================================================*/
-static double parse_lat_lon_str(const char *str);
-static void nmea_parse_gga(gps_t *gps, const char *buf, size_t len);
-static void nmea_parse_rmc(gps_t *gps, const char *buf, size_t len);
-static void nmea_parse_ths(gps_t *gps, const char *buf, size_t len);
-static bool nmea_verify_crc(const char *buf, size_t len, size_t *star_pos);
-static size_t nmea_count_fields(const char *buf, size_t len);
+static void nmea_parse_gga(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok);
+static void nmea_parse_rmc(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok);
+static void nmea_parse_ths(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok);
+static bool nmea_scan(gps_nmea_parser_t *tok, ringbuffer_t *rb, size_t *cr_pos);
 
 /*===========================================================================
  * X-Macro 기반 핸들러 테이블
  *===========================================================================*/
-typedef void (*nmea_handler_t)(gps_t *gps, const char *buf, size_t len);
+/* buf: '$'부터 시작하는 문장, tok->field_off로 필드에 바로 접근 */
+typedef void (*nmea_handler_t)(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok);
 
 static const struct {
     gps_nmea_msg_t msg_id; /* enum 값 명시적으로 저장 */
     const char *str;
+    uint32_t key;
     nmea_handler_t handler;
     uint8_t field_count;
     bool is_urc;
 } nmea_msg_table[] = {
-#define X(name, str, handler, field_count, is_urc) \
-    {GPS_NMEA_MSG_##name, str, handler, field_count, is_urc},
+#define X(name, str, key, handler, field_count, is_urc) \
+    {GPS_NMEA_MSG_##name, str, key, handler, field_count, is_urc},
     NMEA_MSG_TABLE(X)
 #undef X
 };
 
 #define NMEA_MSG_TABLE_SIZE (sizeof(nmea_msg_table) / sizeof(nmea_msg_table[0]))
 
+/* 테이블 인덱스 (슬롯 테이블 초기화용) */
+enum {
+#define X(name, str, key, handler, field_count, is_urc) NMEA_IDX_##name,
+    NMEA_MSG_TABLE(X)
+#undef X
+};
+
+/**
+ * @brief 완전 해시 슬롯 → 테이블 인덱스 + 1 (0 = 빈 슬롯)
+ *
+ * 문장 타입 3글자를 키로 패킹해 해시 한 번 + 키 비교 한 번으로 조회 (strncmp 루프 대체)
+ */
+static const uint8_t nmea_msg_slot[1u << GPS_NMEA_HASH_BITS] = {
+#define X(name, str, key, handler, field_count, is_urc) [GPS_NMEA_HASH(key)] = NMEA_IDX_##name + 1,
+    NMEA_MSG_TABLE(X)
+#undef X
+};
+
+/* 타입은 3글자 고정 (키와 문자열 일치는 test_gps_nmea에서 확인) */
+#define X(name, str, key, handler, field_count, is_urc) \
+    STATIC_ASSERT(sizeof(str) == 4, "NMEA type " #name " must be 3 chars");
+NMEA_MSG_TABLE(X)
+#undef X
+
+STATIC_ASSERT(NMEA_MSG_TABLE_SIZE <= (1u << GPS_NMEA_HASH_BITS), "NMEA hash slots too few");
+
+STATIC_ASSERT(GPS_NMEA_MAX_LEN <= UINT8_MAX, "NMEA tokenizer offsets are uint8_t");
+
 /*===========================================================================
  * X-Macro 기반 문자열 변환 함수
  *===========================================================================*/
@@ -57,8 +86,8 @@ static const char *nmea_msg_to_str(gps_nmea_msg_t msg_id) {
         return "INVALID";
 
     switch (msg_id) {
-#define X(name, str, handler, field_count, is_urc) \
-    case GPS_NMEA_MSG_##name:                      \
+#define X(name, str, key, handler, field_count, is_urc) \
+    case GPS_NMEA_MSG_##name:                           \
         return str;
         NMEA_MSG_TABLE(X)
 #undef X
@@ -68,68 +97,103 @@ static const char *nmea_msg_to_str(gps_nmea_msg_t msg_id) {
 }
 
 /*===========================================================================
- * NMEA 패킷 파싱 (Chain 방식)
+ * 메시지 타입 조회 (완전 해시)
  *===========================================================================*/
 
-parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
-    /* 1. 첫 바이트 확인 - '$' 아니면 NOT_MINE */
-    char first;
-    if (!ringbuffer_peek(rb, &first, 1, 0)) {
-        return PARSE_NEED_MORE;
-    }
-    if (first != '$') {
-        return PARSE_NOT_MINE;
-    }
+/**
+ * @brief 문장 타입 3글자로 테이블 인덱스 조회
+ *
+ * @return 테이블 인덱스, 미등록 타입이면 -1
+ */
+static int nmea_msg_find(const char *type) {
+    uint32_t key = GPS_NMEA_KEY(type[0], type[1], type[2]);
+    uint8_t slot = nmea_msg_slot[GPS_NMEA_HASH(key)];
 
-    /* 2. 메시지 타입 확인 (6바이트: $GPGGA 형태) */
-    char prefix[7];
-    if (!ringbuffer_peek(rb, prefix, 6, 0)) {
-        return PARSE_NEED_MORE;
+    if (slot == 0 || nmea_msg_table[slot - 1].key != key) {
+        return -1;
     }
-    prefix[6] = '\0';
+    return slot - 1;
+}
 
-    /* 3. NMEA 메시지인지 확인 (GP, GN, GL, GA, GB로 시작) */
-    const char *talker = &prefix[1]; /* $ 다음 */
-    if (!(talker[0] == 'G' && (talker[1] == 'P' || talker[1] == 'N' || talker[1] == 'L' ||
-                               talker[1] == 'A' || talker[1] == 'B'))) {
-        return PARSE_NOT_MINE; /* Unicore ASCII일 수 있음 ($command,...) */
-    }
+gps_nmea_msg_t gps_nmea_msg_lookup(const char *type) {
+    DEV_ASSERT(type != NULL);
+
+    int idx = nmea_msg_find(type);
+    return (idx < 0) ? GPS_NMEA_MSG_NONE : nmea_msg_table[idx].msg_id;
+}
+
+/*===========================================================================
+ * NMEA 패킷 파싱 (스트리밍 토크나이저)
+ *===========================================================================*/
+
+parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
+    gps_nmea_parser_t *tok = &gps->parser_ctx.nmea;
 
-    /* 4. 메시지 타입 확인 (GGA, RMC, THS 등) */
-    const char *msg_type = &prefix[3]; /* 탈커 ID 다음 */
-    gps_nmea_msg_t msg_id = GPS_NMEA_MSG_NONE;
-    int msg_idx = -1;
-
-    for (size_t i = 0; i < NMEA_MSG_TABLE_SIZE; i++) {
-        DEV_ASSERT(nmea_msg_table[i].str != NULL);
-        if (strncmp(msg_type, nmea_msg_table[i].str, 3) == 0) {
-            msg_id = nmea_msg_table[i].msg_id; /* 테이블에서 직접 읽기 */
-            msg_idx = i;
-            break;
+    if (tok->scan_pos == 0) {
+        /* 새 문장: 접두어 확인은 문장당 한 번만 */
+
+        /* 1. 첫 바이트 확인 - '$' 아니면 NOT_MINE */
+        char first;
+        if (!ringbuffer_peek(rb, &first, 1, 0)) {
+            return PARSE_NEED_MORE;
+        }
+        if (first != '$') {
+            return PARSE_NOT_MINE;
+        }
+
+        /* 2. 메시지 타입 확인 (6바이트: $GPGGA 형태) */
+        char prefix[7];
+        if (!ringbuffer_peek(rb, prefix, 6, 0)) {
+            return PARSE_NEED_MORE;
+        }
+        prefix[6] = '\0';
+
+        /* 3. NMEA 메시지인지 확인 (GP, GN, GL, GA, GB로 시작) */
+        const char *talker = &prefix[1]; /* $ 다음 */
+        if (!(talker[0] == 'G' && (talker[1] == 'P' || talker[1] == 'N' || talker[1] == 'L' ||
+                                   talker[1] == 'A' || talker[1] == 'B'))) {
+            return PARSE_NOT_MINE; /* Unicore ASCII일 수 있음 ($command,...) */
+        }
+
+        /* 4. 메시지 타입 확인 (GGA, RMC, THS 등) */
+        int msg_idx = nmea_msg_find(&prefix[3]); /* 탈커 ID 다음 */
+
+        if (msg_idx < 0) {
+            return PARSE_NOT_MINE; /* 알 수 없는 NMEA 메시지 */
         }
-    }
 
-    if (msg_id == GPS_NMEA_MSG_NONE) {
-        return PARSE_NOT_MINE; /* 알 수 없는 NMEA 메시지 */
+        /* 5. 토크나이저 시작 ('$' 다음부터, 0번 필드 = 주소 필드) */
+        memset(tok, 0, sizeof(*tok));
+        tok->msg_idx = (uint8_t)msg_idx;
+        tok->scan_pos = 1;
+        tok->field_off[0] = 1;
+        tok->field_cnt = 1;
     }
 
-    /* 테이블 인덱스와 enum 값이 일치하는지 검증 */
-    DEV_ASSERT(msg_idx >= 0 && msg_idx < (int)NMEA_MSG_TABLE_SIZE);
-    DEV_ASSERT(nmea_msg_table[msg_idx].msg_id == msg_id);
+    DEV_ASSERT(tok->msg_idx < NMEA_MSG_TABLE_SIZE);
+    gps_nmea_msg_t msg_id = nmea_msg_table[tok->msg_idx].msg_id;
 
-    /* 5. '\r' 찾기 (패킷 끝) */
+    /* 6. 새로 들어온 바이트만 검사하며 '\r'까지 토큰화 */
     size_t cr_pos;
-    if (!ringbuffer_find_char(rb, '\r', GPS_NMEA_MAX_LEN, &cr_pos)) {
+    size_t scan_start = tok->scan_pos;
+    bool found = nmea_scan(tok, rb, &cr_pos);
+
+    gps->parser_ctx.stats.scanned_bytes += (found ? cr_pos + 1 : tok->scan_pos) - scan_start;
+    if (!found) {
         /* '\r' 없음 - 최대 길이 초과하면 INVALID */
-        if (ringbuffer_size(rb) >= GPS_NMEA_MAX_LEN) {
+        if (tok->scan_pos >= GPS_NMEA_MAX_LEN) {
             LOG_WARN("NMEA packet too long without \\r, dropping");
+            memset(tok, 0, sizeof(*tok));
             return PARSE_INVALID;
         }
-        /* 데이터 부족, 더 기다림 */
+        /* 데이터 부족, 다음 호출에서 scan_pos부터 이어서 검사 */
         return PARSE_NEED_MORE;
     }
 
-    /* 6. 전체 패킷 peek */
+    /* 토크나이저 상태는 이 문장에서 끝 (아래 모든 경로가 문장을 소비함) */
+    gps_nmea_parser_t done = *tok;
+    memset(tok, 0, sizeof(*tok));
+
     size_t pkt_len = cr_pos + 1; /* '\r' 포함 */
 
     /* '\n'도 있으면 포함 */
@@ -138,35 +202,54 @@ parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
         pkt_len++;
     }
 
-    char buf[GPS_NMEA_MAX_LEN + 1];
-    if (!ringbuffer_peek(rb, buf, cr_pos, 0)) {
-        return PARSE_NEED_MORE;
-    }
-    buf[cr_pos] = '\0';
-
     /* 7. Field count 검증 */
-    size_t field_count = nmea_count_fields(buf, cr_pos);
-    DEV_ASSERT(nmea_msg_table[msg_idx].field_count > 0);
-    if (field_count < nmea_msg_table[msg_idx].field_count) {
+    DEV_ASSERT(nmea_msg_table[done.msg_idx].field_count > 0);
+    if (done.field_cnt < nmea_msg_table[done.msg_idx].field_count) {
         /* 필드 수 부족 - 잘못된 패킷 */
-        LOG_WARN("NMEA %s field count mismatch: got %zu, expected %d", nmea_msg_to_str(msg_id),
-                 field_count, nmea_msg_table[msg_idx].field_count);
+        LOG_WARN("NMEA %s field count mismatch: got %u, expected %d", nmea_msg_to_str(msg_id),
+                 done.field_cnt, nmea_msg_table[done.msg_idx].field_count);
         ringbuffer_advance(rb, pkt_len);
         return PARSE_INVALID;
     }
 
-    /* 8. CRC 검증 */
-    size_t star_pos;
-    if (!nmea_verify_crc(buf, cr_pos, &star_pos)) {
+    /* 8. CRC 검증 (XOR은 토큰화하면서 누적됨, '*' 뒤 2자리와 비교) */
+    char crc_hex[2];
+    if (done.star_pos == 0 || (size_t)done.star_pos + 3 > cr_pos ||
+        !ringbuffer_peek(rb, crc_hex, 2, done.star_pos + 1) || hex_to_byte(crc_hex) != done.crc) {
         gps->parser_ctx.stats.crc_errors++;
         ringbuffer_advance(rb, pkt_len);
         return PARSE_INVALID;
     }
 
-    /* 9. 데이터 파싱 */
-    if (nmea_msg_table[msg_idx].handler) {
-        nmea_msg_table[msg_idx].handler(gps, buf, star_pos);
+    /* 9. 데이터 파싱 (문장이 연속이면 링버퍼에서 바로, 랩어라운드된 경우만 복사) */
+    ringbuffer_span_t spans[2];
+    char copy[GPS_NMEA_MAX_LEN + 1];
+    const char *buf;
+
+    if (ringbuffer_peek_spans(rb, 0, cr_pos, spans) == 1) {
+        buf = spans[0].data;
+    }
+    else {
+        ringbuffer_peek(rb, copy, cr_pos, 0);
+        copy[cr_pos] = '\0';
+        buf = copy;
+    }
+
+    if (nmea_msg_table[done.msg_idx].handler) {
+        nmea_msg_table[done.msg_idx].handler(gps, buf, &done);
+    }
+
+#if defined(USE_STORE_RAW_GGA)
+    /* GGA raw 데이터 저장 */
+    if (msg_id == GPS_NMEA_MSG_GGA && cr_pos < sizeof(gps->nmea_data.gga_raw) - 2) {
+        memcpy(gps->nmea_data.gga_raw, buf, cr_pos);
+        gps->nmea_data.gga_raw[cr_pos] = '\r';
+        gps->nmea_data.gga_raw[cr_pos + 1] = '\n';
+        gps->nmea_data.gga_raw[cr_pos + 2] = '\0';
+        gps->nmea_data.gga_raw_pos = cr_pos + 2;
+        gps->nmea_data.gga_is_rdy = true;
     }
+#endif
 
     /* 10. advance 및 이벤트 */
     ringbuffer_advance(rb, pkt_len);
@@ -174,7 +257,7 @@ parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
     gps->parser_ctx.stats.last_nmea_tick = xTaskGetTickCount();
 
     /* URC이면 고수준 이벤트 핸들러 호출 */
-    if (nmea_msg_table[msg_idx].is_urc && gps->handler) {
+    if (nmea_msg_table[done.msg_idx].is_urc && gps->handler) {
         gps_event_t event = {.protocol = GPS_PROTOCOL_NMEA,
                              .timestamp_ms = xTaskGetTickCount(),
                              .source.nmea_msg_id = msg_id};
@@ -192,7 +275,7 @@ parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
         else if (msg_id == GPS_NMEA_MSG_THS) {
             /* 헤딩 업데이트 이벤트 */
             event.type = GPS_EVENT_HEADING_UPDATED;
-            event.data.heading.heading = gps->nmea_data.ths.heading;
+            event.data.heading.heading = gps->data.heading.heading;
             event.data.heading.pitch = 0.0; /* THS에는 pitch 없음 */
             event.data.heading.heading_std = 0.0f;
             event.data.heading.status = gps->nmea_data.ths.mode;
@@ -206,18 +289,6 @@ parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
         }
     }
 
-#if defined(USE_STORE_RAW_GGA)
-    /* GGA raw 데이터 저장 */
-    if (msg_id == GPS_NMEA_MSG_GGA && cr_pos < sizeof(gps->nmea_data.gga_raw) - 2) {
-        memcpy(gps->nmea_data.gga_raw, buf, cr_pos);
-        gps->nmea_data.gga_raw[cr_pos] = '\r';
-        gps->nmea_data.gga_raw[cr_pos + 1] = '\n';
-        gps->nmea_data.gga_raw[cr_pos + 2] = '\0';
-        gps->nmea_data.gga_raw_pos = cr_pos + 2;
-        gps->nmea_data.gga_is_rdy = true;
-    }
-#endif
-
     return PARSE_OK;
 }
 
@@ -226,79 +297,94 @@ parse_result_t nmea_try_parse(gps_t *gps, ringbuffer_t *rb) {
  *===========================================================================*/
 
 /**
- * @brief NMEA CRC 검증
+ * @brief 새로 들어온 바이트 토큰화 (scan_pos부터 '\r'까지)
+ *
+ * 바이트마다 한 번씩만 보며 필드 시작 오프셋과 XOR 체크섬을 누적함.
+ * '*' 이후(체크섬 자리)는 '\r'만 찾음
+ *
+ * @param tok 토크나이저 상태 (scan_pos 진행)
+ * @param rb ringbuffer
+ * @param[out] cr_pos '\r' 오프셋
+ * @return true '\r' 찾음
+ * @return false 아직 '\r' 없음 (GPS_NMEA_MAX_LEN까지 검사)
  */
-static bool nmea_verify_crc(const char *buf, size_t len, size_t *star_pos) {
-    /* '*' 찾기 */
-    const char *star = memchr(buf, '*', len);
-    if (!star || (size_t)(star - buf + 3) > len) {
-        return false; /* checksum 형식 오류 */
+static bool nmea_scan(gps_nmea_parser_t *tok, ringbuffer_t *rb, size_t *cr_pos) {
+    size_t available = ringbuffer_size(rb);
+    size_t limit = (available < GPS_NMEA_MAX_LEN) ? available : GPS_NMEA_MAX_LEN;
+
+    if (limit <= tok->scan_pos) {
+        return false;
     }
 
-    *star_pos = star - buf;
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, tok->scan_pos, limit - tok->scan_pos, spans);
+    size_t pos = tok->scan_pos;
+    uint8_t crc = tok->crc;
 
-    /* CRC 계산 ($ 다음부터 * 전까지) */
-    uint8_t calc_crc = 0;
-    for (const char *p = buf + 1; p < star; p++) {
-        calc_crc ^= (uint8_t)*p;
-    }
+    for (size_t i = 0; i < span_cnt; i++) {
+        const char *data = spans[i].data;
 
-    /* 수신된 CRC */
-    uint8_t recv_crc = hex_to_byte(star + 1);
+        for (size_t j = 0; j < spans[i].len; j++, pos++) {
+            char c = data[j];
 
-    return (calc_crc == recv_crc);
-}
+            if (c == '\r') {
+                tok->crc = crc;
+                tok->scan_pos = (uint8_t)pos;
+                *cr_pos = pos;
+                return true;
+            }
+            if (tok->star_pos != 0) {
+                continue; /* 체크섬 hex 자리 */
+            }
+            if (c == '*') {
+                tok->star_pos = (uint8_t)pos;
+                continue;
+            }
 
-/**
- * @brief NMEA 필드 수 카운트
- */
-static size_t nmea_count_fields(const char *buf, size_t len) {
-    size_t count = 1; /* 최소 1개 필드 */
-    for (size_t i = 0; i < len; i++) {
-        if (buf[i] == ',')
-            count++;
-        if (buf[i] == '*')
-            break;
+            crc ^= (uint8_t)c;
+            if (c == ',') {
+                if (tok->field_cnt < GPS_NMEA_MAX_FIELDS) {
+                    tok->field_off[tok->field_cnt] = (uint8_t)(pos + 1);
+                }
+                tok->field_cnt++;
+            }
+        }
     }
-    return count;
+
+    tok->crc = crc;
+    tok->scan_pos = (uint8_t)pos;
+    return false;
 }
 
 /**
- * @brief 위도/경도 파싱 (DDMM.MMMM 형식)
+ * @brief n번째 필드 시작 위치 (오프셋 테이블 조회, O(1))
+ * @return 필드 시작 포인터, 필드가 없으면 NULL
  */
-static double parse_lat_lon_str(const char *str) {
-    if (!str || *str == ',' || *str == '*')
-        return 0.0;
-    double val = atof(str);
-    double deg = (double)((int)(val / 100));
-    double min = val - (deg * 100);
-    return deg + (min / 60.0);
+static const char *nmea_field(const char *buf, const gps_nmea_parser_t *tok, uint8_t n) {
+    if (n >= tok->field_cnt || n >= GPS_NMEA_MAX_FIELDS) {
+        return NULL;
+    }
+    return buf + tok->field_off[n];
 }
 
 /**
- * @brief 문자열에서 다음 필드 시작 위치 찾기
+ * @brief 위도/경도 필드를 nanodegree로 파싱 (DDMM.MMMM 형식, 빈 필드는 0)
  */
-static const char *get_field(const char *buf, size_t len, int field_num) {
-    int current = 0;
-    const char *p = buf;
-    const char *end = buf + len;
-
-    while (p < end && current < field_num) {
-        if (*p == ',')
-            current++;
-        p++;
-    }
-
-    return (current == field_num) ? p : NULL;
+static int64_t parse_field_ndeg(const char *field) {
+    int64_t ndeg = 0;
+    if (field)
+        gps_fixed_parse_ddmm(field, &ndeg);
+    return ndeg;
 }
 
 /**
- * @brief 필드 값을 double로 파싱
+ * @brief 필드 값을 10^frac_digits 배 정수로 파싱 (빈 필드는 0)
  */
-static double parse_field_double(const char *field) {
-    if (!field || *field == ',' || *field == '*')
-        return 0.0;
-    return atof(field);
+static int32_t parse_field_fixed(const char *field, uint8_t frac_digits) {
+    int32_t val = 0;
+    if (field)
+        gps_fixed_parse_decimal(field, frac_digits, &val);
+    return val;
 }
 
 /**
@@ -322,11 +408,11 @@ static char parse_field_char(const char *field) {
 /*===========================================================================
  * GGA 파싱
  *===========================================================================*/
-static void nmea_parse_gga(gps_t *gps, const char *buf, size_t len) {
+static void nmea_parse_gga(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok) {
     const char *field;
 
     /* Field 1: Time (HHMMSS.ss) */
-    field = get_field(buf, len, 1);
+    field = nmea_field(buf, tok, 1);
     if (field && *field != ',') {
         gps->nmea_data.gga.hour = (field[0] - '0') * 10 + (field[1] - '0');
         gps->nmea_data.gga.min = (field[2] - '0') * 10 + (field[3] - '0');
@@ -334,44 +420,55 @@ static void nmea_parse_gga(gps_t *gps, const char *buf, size_t len) {
     }
 
     /* Field 2: Latitude */
-    field = get_field(buf, len, 2);
-    if (field)
-        gps->nmea_data.gga.lat = parse_lat_lon_str(field);
+    field = nmea_field(buf, tok, 2);
+    gps->nmea_data.gga.lat_ndeg = parse_field_ndeg(field);
 
     /* Field 3: N/S */
-    field = get_field(buf, len, 3);
+    field = nmea_field(buf, tok, 3);
     gps->nmea_data.gga.ns = parse_field_char(field);
 
     /* Field 4: Longitude */
-    field = get_field(buf, len, 4);
-    if (field)
-        gps->nmea_data.gga.lon = parse_lat_lon_str(field);
+    field = nmea_field(buf, tok, 4);
+    gps->nmea_data.gga.lon_ndeg = parse_field_ndeg(field);
 
     /* Field 5: E/W */
-    field = get_field(buf, len, 5);
+    field = nmea_field(buf, tok, 5);
     gps->nmea_data.gga.ew = parse_field_char(field);
 
     /* Field 6: Fix quality */
-    field = get_field(buf, len, 6);
+    field = nmea_field(buf, tok, 6);
     gps->nmea_data.gga.fix = (gps_fix_t)parse_field_int(field);
 
     /* Field 7: Number of satellites */
-    field = get_field(buf, len, 7);
+    field = nmea_field(buf, tok, 7);
     gps->nmea_data.gga.sat_num = parse_field_int(field);
 
     /* Field 8: HDOP */
-    field = get_field(buf, len, 8);
-    gps->nmea_data.gga.hdop = parse_field_double(field);
+    field = nmea_field(buf, tok, 8);
+    int32_t hdop = parse_field_fixed(field, 2);
+    if (hdop < 0)
+        hdop = 0;
+    else if (hdop > UINT16_MAX)
+        hdop = UINT16_MAX;
+    gps->nmea_data.gga.hdop_x100 = (uint16_t)hdop;
 
     /* Field 9: Altitude */
-    field = get_field(buf, len, 9);
-    gps->nmea_data.gga.alt = parse_field_double(field);
+    field = nmea_field(buf, tok, 9);
+    gps->nmea_data.gga.alt_mm = parse_field_fixed(field, 3);
 
     /* Field 11: Geoid separation */
-    field = get_field(buf, len, 11);
-    gps->nmea_data.gga.geo_sep = parse_field_double(field);
+    field = nmea_field(buf, tok, 11);
+    gps->nmea_data.gga.geo_sep_mm = parse_field_fixed(field, 3);
+
+    /* === 공용 데이터 업데이트 === */
+    const gps_gga_t *gga = &gps->nmea_data.gga;
+
+    gps->data.gga_position.lat_ndeg = (gga->ns == 'S') ? -gga->lat_ndeg : gga->lat_ndeg;
+    gps->data.gga_position.lon_ndeg = (gga->ew == 'W') ? -gga->lon_ndeg : gga->lon_ndeg;
+    gps->data.gga_position.alt_mm = gga->alt_mm;
+    gps->data.gga_position.geo_sep_mm = gga->geo_sep_mm;
+    gps->data.gga_position.timestamp_ms = xTaskGetTickCount();
 
-    /* === 공용 데이터 업데이트 (fix_type, hdop만) === */
     gps_fix_t new_fix = gps->nmea_data.gga.fix;
 
     /* fix_type이 변경된 경우에만 업데이트 */
@@ -384,36 +481,38 @@ static void nmea_parse_gga(gps_t *gps, const char *buf, size_t len) {
         gps->data.status.fix_changed = false;
     }
 
-    /* hdop은 항상 업데이트 */
-    gps->data.status.hdop = gps->nmea_data.gga.hdop;
+    /* hdop은 항상 업데이트 (float 환산은 단정밀도 FPU 연산) */
+    gps->data.status.hdop_x100 = gga->hdop_x100;
+    gps->data.status.hdop = (float)gga->hdop_x100 / 100.0f;
 }
 
 /*===========================================================================
  * RMC 파싱 (간략화 - 필요시 확장)
  *===========================================================================*/
-static void nmea_parse_rmc(gps_t *gps, const char *buf, size_t len) {
+static void nmea_parse_rmc(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok) {
     /* RMC 파싱 구현 필요시 추가 */
     (void)gps;
     (void)buf;
-    (void)len;
+    (void)tok;
 }
 
 /*===========================================================================
  * THS 파싱 (Heading)
  *===========================================================================*/
-static void nmea_parse_ths(gps_t *gps, const char *buf, size_t len) {
+static void nmea_parse_ths(gps_t *gps, const char *buf, const gps_nmea_parser_t *tok) {
     const char *field;
 
     /* Field 1: Heading */
-    field = get_field(buf, len, 1);
-    gps->nmea_data.ths.heading = parse_field_double(field);
+    field = nmea_field(buf, tok, 1);
+    gps->nmea_data.ths.heading_udeg = parse_field_fixed(field, 6);
 
     /* Field 2: Mode */
-    field = get_field(buf, len, 2);
+    field = nmea_field(buf, tok, 2);
     gps->nmea_data.ths.mode = (gps_ths_mode_t)parse_field_char(field);
 
     /* === 공용 데이터 업데이트 === */
-    gps->data.heading.heading = gps->nmea_data.ths.heading;
+    gps->data.heading.heading_udeg = gps->nmea_data.ths.heading_udeg;
+    gps->data.heading.heading = (double)gps->nmea_data.ths.heading_udeg * 1e-6;
     gps->data.heading.mode = (uint8_t)gps->nmea_data.ths.mode;
     gps->data.heading.timestamp_ms = xTaskGetTickCount();
 }
@@ -5,8 +5,6 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define GPS_NMEA_TERM_SIZE 20
-
 /**
  * @brief GGA quality fix 상태
  *
@@ -30,20 +28,21 @@ typedef enum {
  * $xxGGA,time,lat,NS,lon,EW,quality,numSV,HDOP,alt,altUnit,sep,sepUnit,diffAge,diffStation*cs\r\n
  * @note 패킷 예시
  * $GPGGA,092725.00,4717.11399,N,00833.91590,E,1,08,1.01,499.6,M,48.0,M,,*5B\r\n
+ * @note 숫자 필드는 double 없이 고정소수점 정수로 저장 (gps_fixed.h)
  */
 typedef struct {
     uint8_t hour;
     uint8_t min;
     uint8_t sec;
-    double lat;
+    int64_t lat_ndeg; /**< 위도 절대값 (1e-9 degree, 방향은 ns) */
     char ns;
-    double lon;
+    int64_t lon_ndeg; /**< 경도 절대값 (1e-9 degree, 방향은 ew) */
     char ew;
     gps_fix_t fix;
     uint8_t sat_num;
-    double hdop;
-    double alt;
-    double geo_sep;
+    uint16_t hdop_x100; /**< HDOP x 100 */
+    int32_t alt_mm;     /**< 해발 고도 (mm) */
+    int32_t geo_sep_mm; /**< 지오이드 분리 (mm) */
 } gps_gga_t;
 
 typedef enum {
@@ -55,7 +54,7 @@ typedef enum {
 } gps_ths_mode_t;
 
 typedef struct {
-    double heading;
+    int32_t heading_udeg; /**< 헤딩 (1e-6 degree, 0-360) */
     gps_ths_mode_t mode;
 } gps_ths_t;
 
@@ -73,18 +72,30 @@ typedef struct {
     gps_ths_t ths;
 } gps_nmea_data_t;
 
+#define GPS_NMEA_MAX_FIELDS 24 /**< 오프셋을 기록하는 최대 필드 수 */
+
 /**
- * @brief NMEA 파싱에 필요한 변수
+ * @brief NMEA 스트리밍 토크나이저 상태
  *
+ * 링버퍼 맨 앞의 문장 하나를 바이트 단위로 한 번만 훑으며 필드 오프셋과
+ * XOR 체크섬을 누적함. '\r'이 아직 안 왔으면 scan_pos에서 이어서 검사하므로
+ * 이미 본 바이트를 다시 보지 않음. 오프셋은 '$' 기준 (GPS_NMEA_MAX_LEN 이하)
  */
 typedef struct {
-    char term_str[GPS_NMEA_TERM_SIZE];
-    uint8_t term_pos;
-    uint8_t term_num;
-
-    gps_nmea_msg_t msg_type;
-    uint8_t crc;
-    uint8_t star;
+    uint8_t scan_pos;                       /**< 다음에 검사할 오프셋 (0이면 새 문장) */
+    uint8_t msg_idx;                        /**< 메시지 테이블 인덱스 */
+    uint8_t crc;                            /**< '$' 다음부터 '*' 전까지 누적 XOR */
+    uint8_t star_pos;                       /**< '*' 오프셋 (0이면 아직 없음) */
+    uint8_t field_cnt;                      /**< '*' 전까지의 필드 수 (주소 필드 포함) */
+    uint8_t field_off[GPS_NMEA_MAX_FIELDS]; /**< 필드 시작 오프셋 (0번 = 주소 필드) */
 } gps_nmea_parser_t;
 
+/**
+ * @brief 문장 타입 3글자(탈커 제외, 예: "GGA")로 메시지 조회
+ *
+ * @param type 타입 문자열 (3바이트 이상, NUL 종료 불필요)
+ * @return GPS_NMEA_MSG_xxx, 미등록 타입이면 GPS_NMEA_MSG_NONE
+ */
+gps_nmea_msg_t gps_nmea_msg_lookup(const char *type);
+
 #endif
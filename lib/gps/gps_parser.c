@@ -1,9 +1,10 @@
 /**
  * @file gps_parser.c
- * @brief GPS 메인 파서 (Chain 방식)
+ * @brief GPS 메인 파서 (첫 바이트 디스패치)
  *
- * 각 프로토콜 파서를 순차적으로 호출하여 패킷 파싱
- * NMEA -> Unicore ASCII -> Unicore Binary -> RTCM
+ * 프레임 첫 바이트로 프로토콜 파서를 하나만 골라 호출
+ * '$' -> NMEA / Unicore ASCII (접두어로 구분), 0xAA -> Unicore Binary, 0xD3 -> RTCM
+ * 수신 필터가 켜져 있으면 디스패치 전에 메시지 ID로 디코드 여부를 먼저 결정
  */
 
 #include "gps_parser.h"
@@ -21,23 +22,6 @@
  * 유틸리티 함수 구현
  *===========================================================================*/
 
-bool ringbuffer_find_char(ringbuffer_t *rb, char ch, size_t max_search, size_t *pos) {
-    size_t available = ringbuffer_size(rb);
-    size_t search_len = (max_search < available) ? max_search : available;
-
-    for (size_t i = 0; i < search_len; i++) {
-        char c;
-        if (!ringbuffer_peek(rb, &c, 1, i)) {
-            return false;
-        }
-        if (c == ch) {
-            *pos = i;
-            return true;
-        }
-    }
-    return false;
-}
-
 uint8_t hex_char_to_num(char ch) {
     if (ch >= '0' && ch <= '9')
         return ch - '0';
@@ -64,40 +48,145 @@ void gps_parser_init(gps_t *gps) {
     LOG_INFO("GPS parser initialized");
 }
 
+void gps_parser_flush(gps_t *gps) {
+    if (!gps)
+        return;
+
+    memset(&gps->parser_ctx.nmea, 0, sizeof(gps->parser_ctx.nmea));
+    memset(&gps->parser_ctx.rtcm, 0, sizeof(gps->parser_ctx.rtcm));
+    memset(&gps->parser_ctx.unicore_bin, 0, sizeof(gps->parser_ctx.unicore_bin));
+    gps->parser_ctx.filter.nmea_scan_pos = 0;
+}
+
 /*===========================================================================
- * 메인 파서 루프 (Chain 방식)
+ * 첫 바이트 디스패치
  *===========================================================================*/
 
-parse_result_t gps_parser_process(gps_t *gps) {
-    if (!gps)
-        return PARSE_INVALID;
+typedef parse_result_t (*gps_try_parse_fn_t)(gps_t *gps, ringbuffer_t *rb);
 
-    ringbuffer_t *rb = &gps->rx_buf;
-    parse_result_t result = PARSE_NEED_MORE;
+/**
+ * @brief '$' 계열 접두어 분류
+ *
+ * '$' 다음 한 바이트로 NMEA 탈커(G*)와 Unicore 응답($command,)을 구분하여
+ * 해당 파서 하나만 호출. 세부 형식 검사는 각 파서가 수행
+ */
+static parse_result_t ascii_try_parse(gps_t *gps, ringbuffer_t *rb) {
+    char prefix[2];
+    if (!ringbuffer_peek(rb, prefix, sizeof(prefix), 0)) {
+        return PARSE_NEED_MORE;
+    }
 
-    while (ringbuffer_size(rb) > 0) {
-        /*
-         * Chain 방식: 각 파서가 "내 패킷인지" 판단
-         * NOT_MINE 리턴하면 다음 파서로 넘어감
-         */
+    switch (prefix[1]) {
+    case 'G': /* $GPxxx, $GNxxx 등 */
+        return nmea_try_parse(gps, rb);
+    case 'c': /* $command,response:... */
+        return unicore_ascii_try_parse(gps, rb);
+    default:
+        return PARSE_NOT_MINE;
+    }
+}
 
-        /* 1. NMEA 시도 ($GPxxx, $GNxxx 등) */
-        result = nmea_try_parse(gps, rb);
+/* 첫 바이트 -> 파서 (NULL이면 어떤 프레임의 시작도 아님) */
+static const gps_try_parse_fn_t dispatch_table[256] = {
+    [GPS_ASCII_SYNC] = ascii_try_parse,
+    [GPS_UNICORE_BIN_SYNC_1] = unicore_bin_try_parse,
+    [GPS_RTCM_SYNC] = rtcm_try_parse,
+};
 
-        /* 2. NMEA가 아니면 Unicore ASCII 시도 ($command,response:...) */
-        if (result == PARSE_NOT_MINE) {
-            result = unicore_ascii_try_parse(gps, rb);
-        }
+/* 재동기 대상 문자 (dispatch_table 키와 동일하게 유지) */
+static const char sync_set[] = {GPS_ASCII_SYNC, (char)GPS_UNICORE_BIN_SYNC_1, (char)GPS_RTCM_SYNC,
+                                '\0'};
+
+/**
+ * @brief 후보 위치의 0xAA가 Unicore binary 동기(0xAA 0x44 0xB5)가 아닌지
+ *
+ * 뒤 두 바이트가 아직 안 왔으면 후보로 남김 (다음 수신 때 파서가 판단)
+ */
+static bool is_false_bin_sync(ringbuffer_t *rb, size_t pos) {
+    uint8_t sync[3];
+
+    if (!ringbuffer_peek(rb, (char *)sync, sizeof(sync), pos)) {
+        return false;
+    }
+
+    return sync[0] == GPS_UNICORE_BIN_SYNC_1 &&
+           (sync[1] != GPS_UNICORE_BIN_SYNC_2 || sync[2] != GPS_UNICORE_BIN_SYNC_3);
+}
+
+/**
+ * @brief 다음 동기 바이트 후보까지 한 번에 버림
+ *
+ * 현재 위치의 바이트는 이미 거부됐으므로 건너뛰고, 그 뒤에서 후보('$', 0xD3,
+ * 0xAA 0x44 0xB5)를 memchr로 찾음. RTCM/binary 페이로드의 단독 0xAA는 뒤 두 바이트를
+ * 확인해서 건너뜀. 후보가 없으면 현재 수신된 데이터 전체를 버림
+ *
+ * @return 버린 바이트 수 (1 이상)
+ */
+static size_t gps_parser_resync(ringbuffer_t *rb) {
+    size_t skipped = 1;
+    size_t pos;
+
+    ringbuffer_advance(rb, 1);
+
+    for (;;) {
+        size_t available = ringbuffer_size(rb);
 
-        /* 3. Unicore ASCII도 아니면 Unicore Binary 시도 (0xAA 0x44 0xB5) */
-        if (result == PARSE_NOT_MINE) {
-            result = unicore_bin_try_parse(gps, rb);
+        if (!ringbuffer_find_any_of(rb, sync_set, available, &pos)) {
+            pos = available;
+            break;
         }
+        if (!is_false_bin_sync(rb, pos)) {
+            break;
+        }
+
+        ringbuffer_advance(rb, pos + 1);
+        skipped += pos + 1;
+    }
 
-        /* 4. RTCM 시도 (0xD3) */
-        if (result == PARSE_NOT_MINE) {
-            result = rtcm_try_parse(gps, rb);
+    ringbuffer_advance(rb, pos);
+    return skipped + pos;
+}
+
+/**
+ * @brief 링버퍼 맨 앞 프레임을 이미 파서가 이어서 처리 중인지
+ *
+ * 진행 중인 프레임은 처음 볼 때 필터를 통과한 프레임이므로 필터를 다시 거치지 않음
+ */
+static inline bool frame_in_progress(const gps_parser_ctx_t *ctx) {
+    return ctx->nmea.scan_pos != 0 || ctx->rtcm.total_len != 0 || ctx->unicore_bin.total_len != 0;
+}
+
+/*===========================================================================
+ * 메인 파서 루프
+ *===========================================================================*/
+
+parse_result_t gps_parser_process(gps_t *gps) {
+    if (!gps)
+        return PARSE_INVALID;
+
+    ringbuffer_t *rb = &gps->rx_buf;
+    parse_result_t result;
+    uint8_t first;
+
+    while (ringbuffer_peek(rb, (char *)&first, 1, 0)) {
+        /* 수신 필터: 디코드 대상이 아닌 프레임은 파서 없이 통째로 처리 */
+        if (__atomic_load_n(&gps->parser_ctx.filter.active, __ATOMIC_ACQUIRE) &&
+            !frame_in_progress(&gps->parser_ctx)) {
+            gps_filter_res_t fres = gps_filter_process(gps, rb, first);
+            if (fres == GPS_FILTER_RES_CONSUMED) {
+                continue;
+            }
+            if (fres == GPS_FILTER_RES_NEED_MORE) {
+                return PARSE_NEED_MORE;
+            }
         }
+        else {
+            gps->parser_ctx.filter.nmea_scan_pos = 0; /* 필터가 꺼지면 검색 위치 무효 */
+        }
+
+        /* 첫 바이트로 파서 하나만 선택 (프레임마다 파서 체인을 돌지 않음) */
+        gps_try_parse_fn_t try_parse = dispatch_table[first];
+        result = try_parse ? try_parse(gps, rb) : PARSE_NOT_MINE;
 
         /* 결과 처리 */
         switch (result) {
@@ -117,9 +206,8 @@ parse_result_t gps_parser_process(gps_t *gps) {
             continue;
 
         case PARSE_NOT_MINE:
-            /* 모든 파서가 거부, 알 수 없는 바이트 skip */
-            gps->parser_ctx.stats.unknown_packets++;
-            ringbuffer_advance(rb, 1);
+            /* 담당 파서 없음 또는 거부, 다음 동기 바이트 후보까지 skip (바이트 단위 집계) */
+            gps->parser_ctx.stats.unknown_packets += gps_parser_resync(rb);
             continue;
         }
     }
@@ -5,9 +5,9 @@
  * @file gps_parser.h
  * @brief GPS 파서 인터페이스
  *
- * Chain 방식의 프로토콜 파서
- * - 각 프로토콜 파서가 "내 패킷인지" 판단
- * - 아니면 다음 파서로 넘김
+ * 첫 바이트 디스패치 방식의 프로토콜 파서
+ * - 프레임 첫 바이트('$', 0xAA, 0xD3)로 담당 파서를 하나만 선택
+ * - 선택된 파서가 "내 패킷인지" 최종 판단
  */
 
 #include <stdint.h>
@@ -15,12 +15,15 @@
 #include <stddef.h>
 #include "ringbuffer.h"
 #include "gps_event.h"
+#include "gps_cmd_batch.h"
+#include "gps_filter.h"
+#include "gps_nmea.h"
 
 /*===========================================================================
  * 파서 결과 타입
  *===========================================================================*/
 typedef enum {
-    PARSE_NOT_MINE = 0, /**< 이 프로토콜 아님 -> 다음 파서 시도 */
+    PARSE_NOT_MINE = 0, /**< 이 프로토콜 아님 -> 다음 동기 바이트까지 skip */
     PARSE_NEED_MORE,    /**< 내 패킷 맞지만 데이터 부족 -> 루프 탈출, 대기 */
     PARSE_OK,           /**< 파싱 완료, advance 됨 -> 계속 루프 */
     PARSE_INVALID,      /**< 내 패킷인데 잘못됨 (CRC 등) -> 1 byte skip */
@@ -30,8 +33,9 @@ typedef enum {
  * 명령어 응답 대기 컨텍스트
  *===========================================================================*/
 typedef struct {
-    bool waiting;   /**< 응답 대기 중 여부 */
-    bool result_ok; /**< 응답 결과 (OK/ERROR) */
+    bool waiting;           /**< 응답 대기 중 여부 */
+    bool result_ok;         /**< 응답 결과 (OK/ERROR) */
+    gps_cmd_batch_t *batch; /**< 파이프라인 배치 (NULL: 단일 명령, 스케줄러 잠금 중 접근) */
 } gps_cmd_ctx_t;
 
 /*===========================================================================
@@ -45,7 +49,11 @@ typedef struct {
     uint32_t rtcm_packets;        /**< RTCM 패킷 수 */
     uint32_t crc_errors;          /**< CRC 오류 수 */
     uint32_t invalid_packets;     /**< 잘못된 패킷 수 */
-    uint32_t unknown_packets;     /**< 알 수 없는 패킷 (skip) */
+    uint32_t unknown_packets;     /**< 알 수 없는 데이터 (skip한 바이트 수) */
+    uint32_t filtered_packets;    /**< 수신 필터가 디코드 없이 처리한 프레임 수 */
+    uint32_t scanned_bytes;       /**< 파서가 검사한 바이트 수 (CRC/토큰화, 바이트당 한 번) */
+    uint32_t rx_overflows;        /**< 수신 유실 알림 수 (링 넘침, USART overrun) */
+    uint32_t rx_line_errors;      /**< 라인/DMA 오류 알림 수 */
 
     /* 수신 시간 추적 */
     uint32_t last_rx_tick;   /**< 마지막 수신 tick (xTaskGetTickCount) */
@@ -53,12 +61,64 @@ typedef struct {
     uint32_t last_rtcm_tick; /**< 마지막 RTCM 수신 tick */
 } gps_parser_stats_t;
 
+/*===========================================================================
+ * 길이 기반 프레임 진행 상태 (RTCM, Unicore Binary)
+ *===========================================================================*/
+
+/**
+ * @brief 링버퍼 맨 앞 프레임의 CRC 누적 상태
+ *
+ * 헤더는 프레임당 한 번만 해석하고, CRC는 새로 들어온 바이트에만 누적함.
+ * DMA가 프레임을 여러 번에 나눠 넘겨도 바이트마다 한 번씩만 검사
+ */
+typedef struct {
+    uint16_t total_len; /**< 프레임 전체 길이 (0이면 새 프레임) */
+    uint16_t scan_pos;  /**< CRC에 누적한 바이트 수 (프레임 시작 기준) */
+    uint32_t crc;       /**< 누적 CRC */
+} gps_frame_scan_t;
+
+typedef uint32_t (*gps_crc_update_fn_t)(uint32_t crc, const void *data, size_t len);
+
+/**
+ * @brief 새로 들어온 바이트만 CRC에 누적 (body_len까지)
+ *
+ * @param scan 프레임 진행 상태
+ * @param rb ringbuffer
+ * @param body_len CRC 대상 길이 (프레임에서 CRC 필드를 뺀 길이)
+ * @param update CRC 누적 함수 (crc24q_update, crc32_update)
+ * @return 이번에 검사한 바이트 수
+ */
+static inline size_t gps_frame_scan_crc(gps_frame_scan_t *scan, ringbuffer_t *rb, size_t body_len,
+                                        gps_crc_update_fn_t update) {
+    size_t available = ringbuffer_size(rb);
+    size_t limit = (available < body_len) ? available : body_len;
+
+    if (limit <= scan->scan_pos) {
+        return 0;
+    }
+
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, scan->scan_pos, limit - scan->scan_pos, spans);
+
+    for (size_t i = 0; i < span_cnt; i++) {
+        scan->crc = update(scan->crc, spans[i].data, spans[i].len);
+    }
+
+    size_t n = limit - scan->scan_pos;
+    scan->scan_pos = (uint16_t)limit;
+    return n;
+}
+
 /*===========================================================================
  * 파서 컨텍스트
  *===========================================================================*/
 typedef struct {
-    gps_cmd_ctx_t cmd_ctx;    /**< 명령어 응답 컨텍스트 */
-    gps_parser_stats_t stats; /**< 파서 통계 */
+    gps_cmd_ctx_t cmd_ctx;        /**< 명령어 응답 컨텍스트 */
+    gps_nmea_parser_t nmea;       /**< NMEA 토크나이저 (문장 수신 중 상태 유지) */
+    gps_frame_scan_t rtcm;        /**< RTCM 프레임 진행 상태 */
+    gps_frame_scan_t unicore_bin; /**< Unicore Binary 프레임 진행 상태 */
+    gps_filter_t filter;          /**< 수신 필터 (메시지 ID별 처리 방식) */
+    gps_parser_stats_t stats;     /**< 파서 통계 */
 } gps_parser_ctx_t;
 
 /*===========================================================================
@@ -71,11 +131,21 @@ typedef struct {
  */
 void gps_parser_init(gps_t *gps);
 
+/**
+ * @brief 수신 중이던 프레임 상태 초기화
+ *
+ * rx_buf를 리셋(통신 재시작 등)하거나 수신 데이터가 유실(DMA 랩, 오버런)됐을 때 호출.
+ * 스캔 상태는 파서 태스크만 쓰므로 파서 태스크에서 호출. 통계는 유지됨
+ *
+ * @param gps GPS 핸들
+ */
+void gps_parser_flush(gps_t *gps);
+
 /**
  * @brief GPS 패킷 파싱 (메인 루프)
  *
  * ringbuffer에서 데이터를 읽어 파싱
- * Chain 방식: NMEA -> Unicore ASCII -> Unicore Binary -> RTCM
+ * 첫 바이트 디스패치: '$' -> NMEA / Unicore ASCII, 0xAA -> Unicore Binary, 0xD3 -> RTCM
  *
  * @param gps GPS 핸들
  * @return 마지막 파싱 결과
@@ -135,16 +205,6 @@ parse_result_t rtcm_try_parse(gps_t *gps, ringbuffer_t *rb);
  * 유틸리티 함수
  *===========================================================================*/
 
-/**
- * @brief ringbuffer에서 특정 문자 위치 찾기
- * @param rb ringbuffer
- * @param ch 찾을 문자
- * @param max_search 최대 검색 범위
- * @param[out] pos 찾은 위치
- * @return true: 찾음, false: 못 찾음
- */
-bool ringbuffer_find_char(ringbuffer_t *rb, char ch, size_t max_search, size_t *pos);
-
 /**
  * @brief HEX 문자를 숫자로 변환
  * @param ch HEX 문자 ('0'-'9', 'A'-'F', 'a'-'f')
@@ -9,11 +9,31 @@
  * UM982 GPS 기준
  */
 
+/*===========================================================================
+ * 메시지 타입 키 (문자를 32비트 정수로 패킹, switch/해시 테이블 인덱스로 사용)
+ * 문자 리터럴로 지정해야 상수식이 됨 ("GGA"[0]은 case 라벨에 못 씀)
+ *===========================================================================*/
+#define GPS_NMEA_KEY(a, b, c) \
+    (((uint32_t)(uint8_t)(a) << 16) | ((uint32_t)(uint8_t)(b) << 8) | (uint32_t)(uint8_t)(c))
+
+#define GPS_RESP_KEY(a, b, c, d) (((uint32_t)(uint8_t)(a) << 24) | GPS_NMEA_KEY(b, c, d))
+
+/**
+ * @brief NMEA 문장 타입 완전 해시 (키 → 2^GPS_NMEA_HASH_BITS 슬롯)
+ *
+ * 곱셈 상수는 표준 타입 14개(GGA THS GSV GSA RMC VTG GLL ZDA GST HDT ROT GNS GRS TRA)가
+ * 16슬롯에서 충돌하지 않도록 고른 값. 새 타입이 충돌하면 슬롯 테이블 초기화에서
+ * -Woverride-init 경고가 나고 test_gps_nmea가 실패함 → 상수를 다시 고를 것
+ */
+#define GPS_NMEA_HASH_BITS 4
+#define GPS_NMEA_HASH(key) (((uint32_t)(key) * 0x70358A27u) >> (32 - GPS_NMEA_HASH_BITS))
+
 /*===========================================================================
  * NMEA 183 메시지 정의 (UM982 지원)
- * X(name, str, handler, field_count, is_urc)
+ * X(name, str, key, handler, field_count, is_urc)
  *   - name: enum 이름 suffix (GGA, RMC 등) → GPS_NMEA_MSG_GGA로 자동 생성
  *   - str: 메시지 문자열 ("GGA", "RMC" 등)
+ *   - key: GPS_NMEA_KEY로 패킹한 str (탈커 다음 3글자)
  *   - handler: 파싱 핸들러 함수 (NULL이면 무시)
  *   - field_count: 최소 필드 수 (delimiter ',' 기준, 0이면 체크 안함)
  *   - is_urc: URC(비동기 데이터) 여부
@@ -21,20 +41,21 @@
  * NOTE: enum 값은 GPS_NMEA_MSG_NONE(0) 다음부터 자동으로 1, 2, 3... 할당됨
  *       테이블에서는 생성된 enum 값을 명시적으로 저장하여 안전하게 매핑
  *===========================================================================*/
-#define NMEA_MSG_TABLE(X)                                                            \
-    X(GGA, "GGA", nmea_parse_gga, 14, true) /* Global Positioning System Fix Data */ \
-    X(THS, "THS", nmea_parse_ths, 2, true)  /* True Heading and Status */
+#define NMEA_MSG_TABLE(X)                                                                   \
+    X(GGA, "GGA", GPS_NMEA_KEY('G', 'G', 'A'), nmea_parse_gga, 14, true) /* GPS Fix Data */ \
+    X(THS, "THS", GPS_NMEA_KEY('T', 'H', 'S'), nmea_parse_ths, 2, true)  /* True Heading */
 
 /*===========================================================================
  * Unicore ASCII 응답 정의 (Command Response)
- * X(name, str)
+ * X(name, str, key)
  *   - name: enum 이름 (GPS_UNICORE_RESP_xxx)
  *   - str: 응답 문자열
+ *   - key: GPS_RESP_KEY로 패킹한 응답 앞 4글자 (짧으면 0으로 채움)
  *===========================================================================*/
-#define UNICORE_RESP_TABLE(X) \
-    X(OK, "OK")               \
-    X(ERROR, "ERROR")         \
-    X(UNKNOWN, "")
+#define UNICORE_RESP_TABLE(X)                           \
+    X(OK, "OK", GPS_RESP_KEY('O', 'K', 0, 0))           \
+    X(ERROR, "ERROR", GPS_RESP_KEY('E', 'R', 'R', 'O')) \
+    X(UNKNOWN, "", 0)
 
 /*===========================================================================
  * Unicore Binary 메시지 정의 (UM982 지원)
@@ -44,9 +65,9 @@
  *   - handler: 파싱 핸들러 함수 (NULL이면 무시)
  *   - is_urc: URC 여부
  *===========================================================================*/
-#define UNICORE_BIN_MSG_TABLE(X)                                                          \
-    X(BESTNAV, 2118, unicore_bin_parse_bestnav, true) /* Best GNSS position & velocity */ \
-    X(HEADING2, 2120, NULL, true)                     /* Dual-antenna heading */
+#define UNICORE_BIN_MSG_TABLE(X)                                                            \
+    X(BESTNAV, 2118, unicore_bin_parse_bestnav, true)   /* Best GNSS position & velocity */ \
+    X(HEADING2, 2120, unicore_bin_parse_heading2, true) /* Dual-antenna heading */
 
 
 /*===========================================================================
@@ -72,4 +93,8 @@
 #define GPS_NMEA_MAX_LEN      120 // NMEA 최대 길이
 #define GPS_UNICORE_ASCII_MAX 128 // Unicore ASCII 최대 길이
 
+/* 프레임 첫 바이트 (gps_parser.c 디스패치 테이블 키) */
+#define GPS_ASCII_SYNC '$'  // NMEA, Unicore ASCII 공통
+#define GPS_RTCM_SYNC  0xD3 // RTCM3 preamble
+
 #endif /* GPS_PROTO_DEF_H */
@@ -0,0 +1,163 @@
+/**
+ * @file gps_tap.c
+ * @brief GPS 수신 원본 스트림 탭 (RX 바이트 미러링)
+ *
+ * 링버퍼 인덱스로 마지막으로 넘긴 위치를 기억하고, 그 이후 바이트를
+ * ringbuffer_peek_spans 구간 그대로 싱크에 전달
+ */
+
+#include "gps_tap.h"
+#include "dev_assert.h"
+#include <string.h>
+
+/* 싱크 포인터는 설정 태스크가 쓰고 GPS 태스크가 읽음 */
+#define TAP_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/*===========================================================================
+ * 탭
+ *===========================================================================*/
+
+void gps_tap_set_sink(gps_tap_t *tap, const gps_tap_sink_t *sink) {
+    DEV_ASSERT(tap != NULL);
+
+    TAP_STORE_RELEASE(&tap->sink, sink);
+}
+
+void gps_tap_feed_sink(gps_tap_t *tap, ringbuffer_t *rb, const gps_tap_sink_t *sink) {
+    /* size 계산이 DMA overflow 시 tail을 당기므로 tail은 그 뒤에 읽음 */
+    size_t size = ringbuffer_size(rb);
+    size_t tail = rb->tail;
+    size_t offset = tap->pos - tail;
+
+    /* 처음 켜졌거나, 링버퍼 리셋/overflow로 pos가 데이터 밖이면 남은 데이터부터 */
+    if (!tap->synced || offset > size) {
+        offset = 0;
+        tap->synced = true;
+    }
+
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, offset, size - offset, spans);
+
+    for (size_t i = 0; i < span_cnt; i++) {
+        size_t accepted = sink->write(sink->ctx, spans[i].data, spans[i].len);
+
+        if (accepted > spans[i].len) {
+            accepted = spans[i].len;
+        }
+        tap->tapped_bytes += accepted;
+        tap->dropped_bytes += spans[i].len - accepted;
+    }
+
+    tap->pos = tail + size;
+}
+
+/*===========================================================================
+ * 캡처 버퍼 싱크
+ *===========================================================================*/
+
+static size_t capture_write(void *ctx, const char *data, size_t len) {
+    gps_tap_capture_t *cap = (gps_tap_capture_t *)ctx;
+    size_t room = cap->size - cap->len;
+
+    if (len > room) {
+        len = room;
+    }
+
+    memcpy(&cap->buf[cap->len], data, len);
+    cap->len += len;
+
+    return len;
+}
+
+const gps_tap_sink_t *gps_tap_capture_init(gps_tap_capture_t *cap, char *buf, size_t size) {
+    DEV_ASSERT(cap != NULL);
+    DEV_ASSERT(buf != NULL || size == 0);
+
+    cap->sink.write = capture_write;
+    cap->sink.ctx = cap;
+    cap->buf = buf;
+    cap->size = size;
+    cap->len = 0;
+
+    return &cap->sink;
+}
+
+void gps_tap_capture_clear(gps_tap_capture_t *cap) {
+    DEV_ASSERT(cap != NULL);
+
+    cap->len = 0;
+}
+
+/*===========================================================================
+ * 스트림 싱크
+ *===========================================================================*/
+
+/*
+ * busy를 먼저 잡은 쪽이 다음 블록 전송을 시작.
+ * 완료 ISR이 빈 버퍼를 확인한 직후 태스크가 데이터를 넣으면 그 데이터는
+ * 다음 write까지 대기함 (탭 특성상 지연만 생기고 유실은 없음)
+ */
+static void stream_kick(gps_tap_stream_t *st) {
+    if (__atomic_exchange_n(&st->busy, 1, __ATOMIC_ACQ_REL)) {
+        return;
+    }
+
+    size_t len;
+    const uint8_t *blk = bipbuffer_read_acquire(&st->bb, &len);
+
+    if (blk) {
+        st->in_flight = len;
+        if (st->start(st->start_ctx, blk, len)) {
+            return;
+        }
+
+        /* 시작 실패: 블록은 버리고 다음 write에서 재시도 */
+        bipbuffer_read_release(&st->bb, len);
+        st->in_flight = 0;
+    }
+
+    TAP_STORE_RELEASE(&st->busy, 0);
+}
+
+static size_t stream_write(void *ctx, const char *data, size_t len) {
+    gps_tap_stream_t *st = (gps_tap_stream_t *)ctx;
+    uint8_t *dst = bipbuffer_reserve(&st->bb, len);
+
+    if (!dst) {
+        stream_kick(st);
+        return 0;
+    }
+
+    memcpy(dst, data, len);
+    bipbuffer_commit(&st->bb, len);
+    stream_kick(st);
+
+    return len;
+}
+
+const gps_tap_sink_t *gps_tap_stream_init(gps_tap_stream_t *st, void *mem, size_t size,
+                                          gps_tap_stream_start_fn start, void *start_ctx) {
+    DEV_ASSERT(st != NULL);
+    DEV_ASSERT(mem != NULL);
+    DEV_ASSERT(start != NULL);
+
+    bipbuffer_init(&st->bb, mem, size);
+    st->sink.write = stream_write;
+    st->sink.ctx = st;
+    st->start = start;
+    st->start_ctx = start_ctx;
+    st->in_flight = 0;
+    st->busy = 0;
+
+    return &st->sink;
+}
+
+void gps_tap_stream_tx_done(gps_tap_stream_t *st) {
+    DEV_ASSERT(st != NULL);
+
+    bipbuffer_read_release(&st->bb, st->in_flight);
+    st->in_flight = 0;
+    TAP_STORE_RELEASE(&st->busy, 0);
+
+    stream_kick(st);
+}
@@ -0,0 +1,175 @@
+#ifndef GPS_TAP_H
+#define GPS_TAP_H
+
+/**
+ * @file gps_tap.h
+ * @brief GPS 수신 원본 스트림 탭 (RX 바이트 미러링)
+ *
+ * GPS 태스크가 깨어날 때마다 RX 링버퍼에 새로 들어온 바이트만 골라 싱크로 넘김.
+ * 링버퍼 내부 메모리를 구간(span) 그대로 넘기므로 탭 자체의 복사는 없고,
+ * 복사가 필요하면 싱크가 자기 버퍼로 한 번만 함.
+ *
+ * - 싱크가 NULL이면 비활성: 파서 호출 전 포인터 하나만 확인 (gps_tap_feed 인라인)
+ * - 싱크 write는 비차단이어야 함. 받지 못한 바이트는 버리고 dropped로 집계
+ *   (디버그 출력이 느려도 GPS 태스크는 멈추지 않음)
+ * - 싱크 교체는 다른 태스크에서 해도 됨 (포인터 1개 release 저장).
+ *   다시 켜면 그 시점 링버퍼에 남아 있는 데이터부터 미러링함
+ *
+ * 기본 제공 싱크:
+ * - 캡처 버퍼: 고정 버퍼가 찰 때까지 저장 (프레임 디버깅, 테스트용)
+ * - 스트림: bip-buffer에 모았다가 연속 블록 단위로 전송 시작 콜백 호출
+ *   (디버그 UART DMA TX 등, 완료 ISR에서 gps_tap_stream_tx_done 호출)
+ * 플랫폼 싱크(RTT 등)는 gps_tap_sink_t를 직접 채워 사용
+ */
+
+#include "bipbuffer.h"
+#include "ringbuffer.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 탭 싱크
+ *
+ * write는 GPS 태스크 컨텍스트에서 호출되며 대기하면 안 됨
+ */
+typedef struct {
+    /**
+     * @brief 원본 바이트 전달 (비차단)
+     * @return 받아들인 바이트 수 (나머지는 버려짐)
+     */
+    size_t (*write)(void *ctx, const char *data, size_t len);
+    void *ctx; /**< write에 전달되는 싱크 상태 */
+} gps_tap_sink_t;
+
+/**
+ * @brief 인스턴스별 탭 상태 (gps_t에 포함, 0으로 초기화하면 비활성)
+ */
+typedef struct {
+    const gps_tap_sink_t *sink; /**< 현재 싱크 (NULL이면 비활성) */
+    size_t pos;                 /**< 다음에 미러링할 RX 링버퍼 인덱스 (free-running) */
+    bool synced;                /**< pos가 유효함 (비활성 → 활성 전환 시 false) */
+    uint32_t tapped_bytes;      /**< 싱크가 받은 바이트 수 */
+    uint32_t dropped_bytes;     /**< 싱크가 받지 못해 버린 바이트 수 */
+} gps_tap_t;
+
+/*===========================================================================
+ * 탭 API
+ *===========================================================================*/
+
+/**
+ * @brief 싱크 설정 (런타임 변경 가능)
+ *
+ * 이전 싱크는 다음 gps_tap_feed부터 호출되지 않음. 이미 진행 중인
+ * write가 끝날 때까지 이전 싱크 메모리는 유지해야 함
+ *
+ * @param tap 탭 상태
+ * @param sink 새 싱크 (NULL이면 비활성)
+ */
+void gps_tap_set_sink(gps_tap_t *tap, const gps_tap_sink_t *sink);
+
+/**
+ * @brief 싱크로 새 RX 바이트 전달 (gps_tap_feed 내부용)
+ */
+void gps_tap_feed_sink(gps_tap_t *tap, ringbuffer_t *rb, const gps_tap_sink_t *sink);
+
+/**
+ * @brief 마지막 호출 이후 RX 링버퍼에 들어온 바이트를 싱크로 전달
+ *
+ * GPS 태스크에서 파서 호출 전에 호출. 비활성이면 포인터 확인만 함
+ *
+ * @param tap 탭 상태
+ * @param rb RX 링버퍼 (소비자 = 호출 태스크)
+ */
+static inline void gps_tap_feed(gps_tap_t *tap, ringbuffer_t *rb) {
+    const gps_tap_sink_t *sink = __atomic_load_n(&tap->sink, __ATOMIC_ACQUIRE);
+
+    if (sink) {
+        gps_tap_feed_sink(tap, rb, sink);
+    } else {
+        tap->synced = false;
+    }
+}
+
+/*===========================================================================
+ * 캡처 버퍼 싱크
+ *===========================================================================*/
+
+/**
+ * @brief 캡처 버퍼 싱크 (가득 차면 이후 바이트는 버림)
+ */
+typedef struct {
+    gps_tap_sink_t sink; /**< gps_tap_set_sink에 넘길 싱크 */
+    char *buf;           /**< 캡처 메모리 */
+    size_t size;         /**< 캡처 메모리 크기 */
+    volatile size_t len; /**< 저장된 바이트 수 */
+} gps_tap_capture_t;
+
+/**
+ * @brief 캡처 싱크 초기화
+ *
+ * @param cap 캡처 싱크
+ * @param buf 캡처 메모리
+ * @param size 캡처 메모리 크기
+ * @return const gps_tap_sink_t* gps_tap_set_sink에 넘길 싱크
+ */
+const gps_tap_sink_t *gps_tap_capture_init(gps_tap_capture_t *cap, char *buf, size_t size);
+
+/**
+ * @brief 캡처 비우기 (다시 처음부터 저장)
+ *
+ * @param cap 캡처 싱크
+ */
+void gps_tap_capture_clear(gps_tap_capture_t *cap);
+
+/*===========================================================================
+ * 스트림 싱크 (비동기 전송 장치용)
+ *===========================================================================*/
+
+/**
+ * @brief 전송 시작 콜백
+ *
+ * data는 gps_tap_stream_tx_done 호출 전까지 유효함
+ *
+ * @return true: 전송 시작됨, false: 시작 실패 (블록은 버려짐)
+ */
+typedef bool (*gps_tap_stream_start_fn)(void *ctx, const uint8_t *data, size_t len);
+
+/**
+ * @brief 스트림 싱크 (bip-buffer + 전송 1개 진행)
+ *
+ * write(GPS 태스크)가 생산자, 전송 시작/완료가 소비자. 전송 시작은
+ * busy 플래그를 먼저 잡은 쪽(태스크 또는 완료 ISR)만 하므로 소비자는 항상 하나
+ */
+typedef struct {
+    gps_tap_sink_t sink;           /**< gps_tap_set_sink에 넘길 싱크 */
+    bipbuffer_t bb;                /**< 전송 대기 데이터 */
+    gps_tap_stream_start_fn start; /**< 전송 시작 콜백 */
+    void *start_ctx;               /**< start에 전달되는 컨텍스트 */
+    volatile size_t in_flight;     /**< 전송 중인 블록 길이 */
+    volatile uint8_t busy;         /**< 전송 진행 중 (소비자 소유권) */
+} gps_tap_stream_t;
+
+/**
+ * @brief 스트림 싱크 초기화
+ *
+ * @param st 스트림 싱크
+ * @param mem 대기 버퍼 메모리
+ * @param size 대기 버퍼 크기
+ * @param start 전송 시작 콜백
+ * @param start_ctx start에 전달되는 컨텍스트
+ * @return const gps_tap_sink_t* gps_tap_set_sink에 넘길 싱크
+ */
+const gps_tap_sink_t *gps_tap_stream_init(gps_tap_stream_t *st, void *mem, size_t size,
+                                          gps_tap_stream_start_fn start, void *start_ctx);
+
+/**
+ * @brief 전송 완료 통지 (전송 완료 ISR에서 호출)
+ *
+ * 전송한 블록을 반환하고 대기 데이터가 있으면 다음 전송을 바로 시작
+ *
+ * @param st 스트림 싱크
+ */
+void gps_tap_stream_tx_done(gps_tap_stream_t *st);
+
+#endif /* GPS_TAP_H */
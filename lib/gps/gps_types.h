@@ -25,7 +25,7 @@ typedef enum { GPS_PARSE_STATE_NONE = 0, GPS_PARSE_STATE_INVALID = UINT8_MAX } g
 
 typedef enum {
     GPS_NMEA_MSG_NONE = 0,
-#define X(name, str, handler, field_count, is_urc) GPS_NMEA_MSG_##name,
+#define X(name, str, key, handler, field_count, is_urc) GPS_NMEA_MSG_##name,
     NMEA_MSG_TABLE(X)
 #undef X
         GPS_NMEA_MSG_INVALID = UINT8_MAX
@@ -50,8 +50,15 @@ typedef struct {
     int (*start)(void);
     int (*stop)(void);
     int (*reset)(void);
+    /** 송신 큐에 넣고 바로 반환 (비차단) */
     int (*send)(const char *data, size_t len);
+    /** 송신 후 전송 완료까지 대기 (NULL이면 미지원) */
+    int (*send_sync)(const char *data, size_t len, uint32_t timeout_ms);
     int (*recv)(char *buf, size_t len);
+    /** 로컬 UART 보드레이트 변경 (송신 큐를 비운 뒤, NULL이면 미지원) */
+    int (*set_baudrate)(uint32_t baudrate);
+    /** 수신기 송신으로 보드레이트 측정 (0: 실패, NULL이면 미지원) */
+    uint32_t (*detect_baudrate)(void);
 } gps_hal_ops_t;
 
 #endif /* GPS_TYPES_H */
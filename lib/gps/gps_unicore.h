@@ -19,7 +19,7 @@ typedef enum { GPS_UNICORE_MSG_NONE = 0, GPS_UNICORE_MSG_COMMAND = 1 } gps_unico
  */
 typedef enum {
     GPS_UNICORE_RESP_NONE = 0,
-#define X(name, str) GPS_UNICORE_RESP_##name,
+#define X(name, str, key) GPS_UNICORE_RESP_##name,
     UNICORE_RESP_TABLE(X)
 #undef X
 } gps_unicore_resp_t;
@@ -97,9 +97,38 @@ typedef struct __attribute__((packed)) {
     float horspd_std;
 } hpd_unicore_bestnavb_t;
 
+typedef struct __attribute__((packed)) {
+    uint32_t sol_status;
+    uint32_t pos_type;
+    float length;  ///< baseline length (m)
+    float heading; ///< heading (degree, 0-360)
+    float pitch;   ///< pitch (degree)
+    float reserved;
+    float heading_dev; ///< heading deviation (degree)
+    float pitch_dev;
+    char rover_id[4];
+    char master_id[4];
+    uint8_t sv;
+    uint8_t used_sv;
+    uint8_t obs;
+    uint8_t multi;
+    uint8_t reserved2;
+    uint8_t ext_sol_stat;
+    uint8_t galileo_bds3_sig_mask;
+    uint8_t gps_glonass_bds2_sig_mask;
+} hpd_unicore_heading2b_t;
+
 /* gps_unicore_bin_data_t는 gps.h에서 정의됨 (header 필드 포함) */
 
 gps_unicore_resp_t gps_get_unicore_response(gps_t *gps);
+
+/**
+ * @brief "response:" 뒤 응답 문자열로 응답 타입 조회 (앞 4글자 키 switch)
+ *
+ * @param str 응답 문자열 (NUL 종료)
+ * @return GPS_UNICORE_RESP_xxx, 미등록 응답이면 GPS_UNICORE_RESP_UNKNOWN
+ */
+gps_unicore_resp_t gps_unicore_resp_lookup(const char *str);
 uint8_t gps_parse_unicore_term(gps_t *gps);
 uint8_t gps_parse_unicore_bin(gps_t *gps);
 
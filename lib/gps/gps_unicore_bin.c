@@ -0,0 +1,86 @@
+/**
+ * @file gps_unicore_bin.c
+ * @brief Unicore binary 프레임 뷰 + 필드 접근자
+ */
+
+#include "gps_unicore_bin.h"
+#include "dev_assert.h"
+#include <string.h>
+
+/**
+ * @brief 프레임 오프셋에서 n바이트를 little-endian 정수로 읽기
+ *
+ * 필드가 한 구간 안에 있으면 바로 읽고, 랩어라운드 경계에 걸친 경우만 바이트 단위로 조합
+ */
+static uint64_t frame_read_le(const gps_unicore_bin_frame_t *frame, size_t off, size_t n) {
+    DEV_ASSERT(off + n <= frame->len);
+
+    const ringbuffer_span_t *s = &frame->spans[0];
+    uint64_t v = 0;
+
+    if (off >= s->len) {
+        off -= s->len;
+        s++;
+    }
+
+    if (off + n <= s->len) {
+        const uint8_t *p = (const uint8_t *)s->data + off;
+        for (size_t i = n; i > 0; i--) {
+            v = (v << 8) | p[i - 1];
+        }
+        return v;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        size_t o = off + i;
+        const uint8_t *p = (o < s->len) ? (const uint8_t *)s->data + o
+                                        : (const uint8_t *)s[1].data + (o - s->len);
+        v |= (uint64_t)*p << (8 * i);
+    }
+    return v;
+}
+
+void gps_unicore_bin_frame_init(gps_unicore_bin_frame_t *frame, const ringbuffer_span_t *spans,
+                                size_t span_cnt) {
+    DEV_ASSERT(frame != NULL);
+    DEV_ASSERT(spans != NULL);
+    DEV_ASSERT(span_cnt == 1 || span_cnt == 2);
+
+    frame->spans[0] = spans[0];
+    if (span_cnt == 2) {
+        frame->spans[1] = spans[1];
+    }
+    else {
+        frame->spans[1].data = NULL;
+        frame->spans[1].len = 0;
+    }
+    frame->len = frame->spans[0].len + frame->spans[1].len;
+}
+
+uint8_t gps_unicore_bin_u8(const gps_unicore_bin_frame_t *frame, size_t off) {
+    return (uint8_t)frame_read_le(frame, off, 1);
+}
+
+uint16_t gps_unicore_bin_u16(const gps_unicore_bin_frame_t *frame, size_t off) {
+    return (uint16_t)frame_read_le(frame, off, 2);
+}
+
+uint32_t gps_unicore_bin_u32(const gps_unicore_bin_frame_t *frame, size_t off) {
+    return (uint32_t)frame_read_le(frame, off, 4);
+}
+
+float gps_unicore_bin_f32(const gps_unicore_bin_frame_t *frame, size_t off) {
+    uint32_t bits = (uint32_t)frame_read_le(frame, off, 4);
+    float v;
+
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+double gps_unicore_bin_f64(const gps_unicore_bin_frame_t *frame, size_t off) {
+    uint64_t bits = frame_read_le(frame, off, 8);
+    double v;
+
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
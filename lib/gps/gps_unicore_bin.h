@@ -0,0 +1,114 @@
+#ifndef GPS_UNICORE_BIN_H
+#define GPS_UNICORE_BIN_H
+
+/**
+ * @file gps_unicore_bin.h
+ * @brief Unicore binary 프레임 뷰 (링버퍼 구간 직접 참조) + 필드 접근자
+ *
+ * 프레임을 복사하지 않고 링버퍼 구간(최대 2개) 위에서 헤더를 해석하고,
+ * 필드는 소비자가 요청할 때만 little-endian으로 읽음.
+ * 페이로드 오프셋은 hpd_unicore_*_t 패킹 구조체의 offsetof로 계산
+ * (구조체는 레이아웃 정의로만 사용, 복사 대상 아님).
+ */
+
+#include "gps_unicore.h"
+#include "ringbuffer.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GPS_UNICORE_BIN_CRC_SIZE 4
+
+/**
+ * @brief Unicore binary 프레임 뷰 (헤더 + 페이로드 + CRC32)
+ */
+typedef struct {
+    ringbuffer_span_t spans[2]; /**< 프레임 구간 (spans[1].len == 0이면 연속) */
+    size_t len;                 /**< 프레임 전체 길이 */
+} gps_unicore_bin_frame_t;
+
+/**
+ * @brief 링버퍼 구간으로 프레임 뷰 설정
+ *
+ * @param frame 프레임 뷰
+ * @param spans ringbuffer_peek_spans 결과
+ * @param span_cnt 구간 개수 (1 또는 2)
+ */
+void gps_unicore_bin_frame_init(gps_unicore_bin_frame_t *frame, const ringbuffer_span_t *spans,
+                                size_t span_cnt);
+
+/*===========================================================================
+ * 기본 읽기 (프레임 오프셋, little-endian)
+ *===========================================================================*/
+
+uint8_t gps_unicore_bin_u8(const gps_unicore_bin_frame_t *frame, size_t off);
+uint16_t gps_unicore_bin_u16(const gps_unicore_bin_frame_t *frame, size_t off);
+uint32_t gps_unicore_bin_u32(const gps_unicore_bin_frame_t *frame, size_t off);
+float gps_unicore_bin_f32(const gps_unicore_bin_frame_t *frame, size_t off);
+double gps_unicore_bin_f64(const gps_unicore_bin_frame_t *frame, size_t off);
+
+/*===========================================================================
+ * 타입별 접근자 (X-Macro로 자동 생성)
+ * X(name, type, reader, offset)
+ *===========================================================================*/
+
+#define UNICORE_BIN_HEADER_FIELDS(X)                                           \
+    X(msg_id, uint16_t, u16, offsetof(gps_unicore_bin_header_t, message_id))   \
+    X(msg_len, uint16_t, u16, offsetof(gps_unicore_bin_header_t, message_len)) \
+    X(week, uint16_t, u16, offsetof(gps_unicore_bin_header_t, wm))             \
+    X(tow_ms, uint32_t, u32, offsetof(gps_unicore_bin_header_t, ms))
+
+#define UNICORE_BESTNAV_OFF(field) \
+    (GPS_UNICORE_BIN_HEADER_SIZE + offsetof(hpd_unicore_bestnavb_t, field))
+
+#define UNICORE_BESTNAV_FIELDS(X)                              \
+    X(pos_type, uint32_t, u32, UNICORE_BESTNAV_OFF(pos_type))  \
+    X(lat, double, f64, UNICORE_BESTNAV_OFF(lat))              \
+    X(lon, double, f64, UNICORE_BESTNAV_OFF(lon))              \
+    X(height, double, f64, UNICORE_BESTNAV_OFF(height))        \
+    X(lat_dev, float, f32, UNICORE_BESTNAV_OFF(lat_dev))       \
+    X(lon_dev, float, f32, UNICORE_BESTNAV_OFF(lon_dev))       \
+    X(height_dev, float, f32, UNICORE_BESTNAV_OFF(height_dev)) \
+    X(sv, uint8_t, u8, UNICORE_BESTNAV_OFF(sv))                \
+    X(used_sv, uint8_t, u8, UNICORE_BESTNAV_OFF(used_sv))      \
+    X(hor_speed, double, f64, UNICORE_BESTNAV_OFF(hor_speed))  \
+    X(trk_gnd, double, f64, UNICORE_BESTNAV_OFF(trk_gnd))      \
+    X(vert_speed, double, f64, UNICORE_BESTNAV_OFF(vert_speed))
+
+#define UNICORE_HEADING2_OFF(field) \
+    (GPS_UNICORE_BIN_HEADER_SIZE + offsetof(hpd_unicore_heading2b_t, field))
+
+#define UNICORE_HEADING2_FIELDS(X)                                 \
+    X(sol_status, uint32_t, u32, UNICORE_HEADING2_OFF(sol_status)) \
+    X(pos_type, uint32_t, u32, UNICORE_HEADING2_OFF(pos_type))     \
+    X(length, float, f32, UNICORE_HEADING2_OFF(length))            \
+    X(heading, float, f32, UNICORE_HEADING2_OFF(heading))          \
+    X(pitch, float, f32, UNICORE_HEADING2_OFF(pitch))              \
+    X(heading_dev, float, f32, UNICORE_HEADING2_OFF(heading_dev))  \
+    X(pitch_dev, float, f32, UNICORE_HEADING2_OFF(pitch_dev))      \
+    X(sv, uint8_t, u8, UNICORE_HEADING2_OFF(sv))                   \
+    X(used_sv, uint8_t, u8, UNICORE_HEADING2_OFF(used_sv))
+
+/* gps_unicore_bin_msg_id(), gps_unicore_bestnav_lat(), gps_unicore_heading2_pitch() ... */
+#define X(name, type, reader, off)                                                    \
+    static inline type gps_unicore_bin_##name(const gps_unicore_bin_frame_t *frame) { \
+        return (type)gps_unicore_bin_##reader(frame, (off));                          \
+    }
+UNICORE_BIN_HEADER_FIELDS(X)
+#undef X
+
+#define X(name, type, reader, off)                                                        \
+    static inline type gps_unicore_bestnav_##name(const gps_unicore_bin_frame_t *frame) { \
+        return (type)gps_unicore_bin_##reader(frame, (off));                              \
+    }
+UNICORE_BESTNAV_FIELDS(X)
+#undef X
+
+#define X(name, type, reader, off)                                                         \
+    static inline type gps_unicore_heading2_##name(const gps_unicore_bin_frame_t *frame) { \
+        return (type)gps_unicore_bin_##reader(frame, (off));                               \
+    }
+UNICORE_HEADING2_FIELDS(X)
+#undef X
+
+#endif
@@ -3,6 +3,7 @@
 #include "gps_parser.h"
 #include "gps_proto_def.h"
 #include "lora_app.h"
+#include "crc.h"
 #include "dev_assert.h"
 #include "FreeRTOS.h"
 #include "task.h"
@@ -15,6 +16,7 @@
 
 #include "log.h"
 
+
 /*===========================================================================
  * X-Macro 기반 문자열 변환 함수
  *===========================================================================*/
@@ -36,15 +38,13 @@ static const char *rtcm_msg_to_str(uint16_t msg_type) {
 /*===========================================================================
  * RTCM 상수
  *===========================================================================*/
-#define RTCM_PREAMBLE    0xD3
-#define RTCM_HEADER_SIZE 3    /* preamble(1) + length(2) */
-#define RTCM_CRC_SIZE    3    /* CRC24Q */
-#define RTCM_MIN_PACKET  6    /* header(3) + CRC(3) */
-#define RTCM_MAX_PAYLOAD 1023 /* 10-bit length field max */
+#define RTCM_PREAMBLE   GPS_RTCM_SYNC
+#define RTCM_MIN_PACKET 6 /* header(3) + CRC(3) */
 
-// HEX ASCII로 변환하면 데이터가 2배 증가:
-// LoRa 최대 236 HEX 문자 = 118 바이트 binary
-#define RTCM_MAX_FRAGMENT_SIZE 118 // Max binary size per fragment
+/* 최대 길이 프레임이 수신 링버퍼(용량 size-1)와 레코드 링에 통째로 들어가야 함 */
+STATIC_ASSERT(GPS_RX_BUF_SIZE - 1 >= RTCM_MAX_FRAME, "GPS_RX_BUF_SIZE too small for RTCM");
+STATIC_ASSERT(GPS_RTCM_BUF_SIZE >= 2 * (RTCM_MAX_FRAME + sizeof(record_ring_hdr_t) + 4),
+              "GPS_RTCM_BUF_SIZE too small for RTCM");
 
 // LoRa Time on Air calculation (SF7, BW125, CR4/5, Preamble 8)
 // HEX 변환: 1 byte -> 2 HEX chars
@@ -95,9 +95,10 @@ void rtcm_tx_task_init(void) {
 }
 
 /**
- * @brief RTCM 데이터를 LoRa로 전송 (링버퍼에서 읽기)
+ * @brief RTCM 데이터를 LoRa로 전송 (레코드 링에서 읽기)
  *
- * 링버퍼에서 RTCM 패킷을 하나씩 읽어서 LoRa로 전송합니다.
+ * 레코드 링에서 RTCM 프레임을 하나씩 꺼내 LoRa로 전송합니다.
+ * 프레임은 링 메모리에서 직접 참조하며 (복사/잠금 없음),
  * 여러 RTCM 메시지가 큐잉되어 있으면 하나씩 순차 전송됩니다.
  *
  * @param gps GPS 핸들
@@ -109,46 +110,15 @@ bool rtcm_send_to_lora(gps_t *gps) {
         return false;
     }
 
-    /* RTCM 링버퍼에서 패킷 읽기 */
-    uint8_t packet[GPS_MAX_PACKET_LEN];
-    size_t rtcm_len = 0;
-
-    if (xSemaphoreTake(gps->rtcm_data.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
-        LOG_ERR("Failed to acquire RTCM mutex");
-        return false;
-    }
-
-    /* 링버퍼 크기 확인 */
-    if (ringbuffer_size(&gps->rtcm_data.rb) < RTCM_MIN_PACKET) {
-        xSemaphoreGive(gps->rtcm_data.mutex);
+    /* 레코드 단위라 헤더 재파싱 불필요 (길이/타입은 레코드 헤더에 있음) */
+    const record_ring_hdr_t *rec = record_ring_peek(&gps->rtcm_data.ring);
+    if (!rec) {
         return false; /* 데이터 없음 */
     }
 
-    /* 헤더 peek (preamble + length) */
-    uint8_t header[RTCM_HEADER_SIZE];
-    if (!ringbuffer_peek(&gps->rtcm_data.rb, (char *)header, RTCM_HEADER_SIZE, 0)) {
-        xSemaphoreGive(gps->rtcm_data.mutex);
-        return false;
-    }
-
-    /* 페이로드 길이 추출 */
-    uint16_t payload_len = ((header[1] & 0x03) << 8) | header[2];
-    rtcm_len = RTCM_HEADER_SIZE + payload_len + RTCM_CRC_SIZE;
-
-    /* 전체 패킷 읽기 */
-    if (ringbuffer_size(&gps->rtcm_data.rb) < rtcm_len || rtcm_len > GPS_MAX_PACKET_LEN) {
-        xSemaphoreGive(gps->rtcm_data.mutex);
-        return false;
-    }
-
-    ringbuffer_read(&gps->rtcm_data.rb, (char *)packet, rtcm_len);
-    xSemaphoreGive(gps->rtcm_data.mutex);
-
-    /* 메시지 타입 추출 */
-    uint16_t msg_type = 0;
-    if (payload_len >= 2) {
-        msg_type = (packet[3] << 4) | ((packet[4] >> 4) & 0x0F);
-    }
+    const uint8_t *packet = record_ring_payload(rec);
+    size_t rtcm_len = rec->len;
+    uint16_t msg_type = rec->type;
 
     /* Fragment 계산 및 전송 */
     uint8_t total_fragments = (rtcm_len + RTCM_MAX_FRAGMENT_SIZE - 1) / RTCM_MAX_FRAGMENT_SIZE;
@@ -165,15 +135,19 @@ bool rtcm_send_to_lora(gps_t *gps) {
         LOG_DEBUG("Queueing fragment %d/%d: %d bytes", i + 1, total_fragments, fragment_len);
 
         bool is_last = (i == total_fragments - 1);
-        lora_command_callback_t callback = is_last ? rtcm_last_fragment_callback : NULL;
+        lora_cmd_callback_t callback = is_last ? rtcm_last_fragment_callback : NULL;
         void *user_data = is_last ? (void *)(uintptr_t)msg_type : NULL;
 
         if (!lora_send_p2p_raw_async(&packet[offset], fragment_len, toa_ms, callback, user_data)) {
             LOG_ERR("Failed to queue fragment %d/%d - LoRa TX queue full?", i + 1, total_fragments);
+            record_ring_pop(&gps->rtcm_data.ring);
             return false;
         }
     }
 
+    /* lora_send_p2p_raw_async가 명령을 만들며 복사하므로 여기서 해제 */
+    record_ring_pop(&gps->rtcm_data.ring);
+
     LOG_INFO("All %d fragments queued to LoRa TX task", total_fragments);
     return true;
 }
@@ -186,21 +160,7 @@ bool rtcm_send_to_lora(gps_t *gps) {
  * @return 24-bit CRC 값
  */
 uint32_t rtcm_calc_crc(const uint8_t *buffer, size_t len) {
-    // CRC24Q polynomial: 0x1864CFB
-    uint32_t crc = 0;
-
-    for (size_t i = 0; i < len; i++) {
-        crc ^= ((uint32_t)buffer[i]) << 16;
-
-        for (int j = 0; j < 8; j++) {
-            crc <<= 1;
-            if (crc & 0x1000000) {
-                crc ^= 0x1864CFB;
-            }
-        }
-    }
-
-    return crc & 0xFFFFFF;
+    return crc24q_update(0, buffer, len);
 }
 
 /**
@@ -252,55 +212,72 @@ bool rtcm_validate_packet(const uint8_t *buffer, size_t len) {
  * RTCM 패킷 파싱 (Chain 방식)
  *===========================================================================*/
 
-parse_result_t rtcm_try_parse(gps_t *gps, ringbuffer_t *rb) {
-    /* 1. 첫 바이트 확인 - 0xD3 아니면 NOT_MINE */
-    uint8_t first;
-    if (!ringbuffer_peek(rb, (char *)&first, 1, 0)) {
-        return PARSE_NEED_MORE;
-    }
-    if (first != RTCM_PREAMBLE) {
-        return PARSE_NOT_MINE;
+/**
+ * @brief 링버퍼 구간(최대 2개)에서 프레임 오프셋의 바이트 읽기
+ */
+static inline uint8_t span_byte(const ringbuffer_span_t spans[2], size_t off) {
+    if (off < spans[0].len) {
+        return (uint8_t)spans[0].data[off];
     }
+    return (uint8_t)spans[1].data[off - spans[0].len];
+}
 
-    /* 2. 헤더 (3바이트) peek */
-    if (ringbuffer_size(rb) < RTCM_HEADER_SIZE) {
-        return PARSE_NEED_MORE;
-    }
+parse_result_t rtcm_try_parse(gps_t *gps, ringbuffer_t *rb) {
+    gps_frame_scan_t *scan = &gps->parser_ctx.rtcm;
 
-    uint8_t header[RTCM_HEADER_SIZE];
-    if (!ringbuffer_peek(rb, (char *)header, RTCM_HEADER_SIZE, 0)) {
-        return PARSE_NEED_MORE;
-    }
+    if (scan->total_len == 0) {
+        /* 새 프레임: 헤더 해석은 프레임당 한 번만 */
 
-    /* 3. 페이로드 길이 추출 (10-bit) */
-    uint16_t payload_len = ((header[1] & 0x03) << 8) | header[2];
+        /* 1. 첫 바이트 확인 - 0xD3 아니면 NOT_MINE */
+        uint8_t first;
+        if (!ringbuffer_peek(rb, (char *)&first, 1, 0)) {
+            return PARSE_NEED_MORE;
+        }
+        if (first != RTCM_PREAMBLE) {
+            return PARSE_NOT_MINE;
+        }
 
-    if (payload_len > RTCM_MAX_PAYLOAD) {
-        /* 비정상적인 길이 */
-        return PARSE_INVALID;
+        /* 2. 헤더 (3바이트) peek */
+        uint8_t header[RTCM_HEADER_SIZE];
+        if (!ringbuffer_peek(rb, (char *)header, RTCM_HEADER_SIZE, 0)) {
+            return PARSE_NEED_MORE;
+        }
+
+        /* 3. 예약 비트(6-bit)는 0 - 아니면 데이터 속 우연한 0xD3 */
+        if (header[1] & 0xFC) {
+            return PARSE_NOT_MINE;
+        }
+
+        /* 페이로드 길이 추출 (10-bit) */
+        uint16_t payload_len = ((header[1] & 0x03) << 8) | header[2];
+
+        /* 4. 전체 패킷 길이 = 헤더(3) + 페이로드 + CRC(3) */
+        scan->total_len = RTCM_HEADER_SIZE + payload_len + RTCM_CRC_SIZE;
+        scan->scan_pos = 0;
+        scan->crc = 0;
     }
 
-    /* 4. 전체 패킷 길이 = 헤더(3) + 페이로드 + CRC(3) */
-    size_t total_len = RTCM_HEADER_SIZE + payload_len + RTCM_CRC_SIZE;
+    size_t total_len = scan->total_len;
+    size_t crc_off = total_len - RTCM_CRC_SIZE;
+
+    /* 5. CRC24Q는 새로 들어온 바이트에만 누적 (이미 본 바이트는 다시 보지 않음) */
+    gps->parser_ctx.stats.scanned_bytes += gps_frame_scan_crc(scan, rb, crc_off, crc24q_update);
 
     if (ringbuffer_size(rb) < total_len) {
         return PARSE_NEED_MORE;
     }
 
-    /* 5. 전체 패킷 peek */
-    uint8_t packet[GPS_MAX_PACKET_LEN];
-    if (total_len > GPS_MAX_PACKET_LEN) {
-        return PARSE_INVALID;
-    }
+    /* 프레임 진행 상태는 여기서 끝 (아래 모든 경로가 프레임을 소비함) */
+    uint32_t calc_crc = scan->crc;
+    memset(scan, 0, sizeof(*scan));
 
-    if (!ringbuffer_peek(rb, (char *)packet, total_len, 0)) {
-        return PARSE_NEED_MORE;
-    }
+    /* 6. 전체 패킷 구간 (링버퍼 내부 메모리 직접 참조, 복사 없음, 최대 1029바이트) */
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, 0, total_len, spans);
 
-    /* 6. CRC24Q 검증 */
-    uint32_t calc_crc = rtcm_calc_crc(packet, total_len - RTCM_CRC_SIZE);
-    uint32_t recv_crc = ((uint32_t)packet[total_len - 3] << 16) |
-                        ((uint32_t)packet[total_len - 2] << 8) | packet[total_len - 1];
+    uint32_t recv_crc = ((uint32_t)span_byte(spans, crc_off) << 16) |
+                        ((uint32_t)span_byte(spans, crc_off + 1) << 8) |
+                        span_byte(spans, crc_off + 2);
 
     if (calc_crc != recv_crc) {
         gps->parser_ctx.stats.crc_errors++;
@@ -308,26 +285,27 @@ parse_result_t rtcm_try_parse(gps_t *gps, ringbuffer_t *rb) {
         return PARSE_INVALID;
     }
 
+    uint16_t payload_len = (uint16_t)(total_len - RTCM_HEADER_SIZE - RTCM_CRC_SIZE);
+
     /* 7. 메시지 타입 추출 (12-bit, 페이로드 첫 12비트) */
     uint16_t msg_type = 0;
     if (payload_len >= 2) {
-        msg_type = (packet[3] << 4) | ((packet[4] >> 4) & 0x0F);
+        msg_type = (uint16_t)((span_byte(spans, RTCM_HEADER_SIZE) << 4) |
+                              (span_byte(spans, RTCM_HEADER_SIZE + 1) >> 4));
     }
 
-    /* 8. RTCM 데이터를 링버퍼에 저장 (LoRa 전송용) */
-    if (xSemaphoreTake(gps->rtcm_data.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        /* 버퍼 공간 확인 후 쓰기 */
-        if (ringbuffer_free_size(&gps->rtcm_data.rb) >= total_len) {
-            ringbuffer_write(&gps->rtcm_data.rb, (char *)packet, total_len);
-            gps->rtcm_data.last_msg_type = msg_type;
-        }
-        else {
-            LOG_WARN("RTCM buffer full, dropped msg_type=%d", msg_type);
+    /* 8. RTCM 프레임을 레코드 링에 저장 (LoRa 전송용, 수신 링버퍼에서 직접 복사) */
+    uint8_t *dst = record_ring_reserve(&gps->rtcm_data.ring, total_len);
+    if (dst) {
+        for (size_t i = 0; i < span_cnt; i++) {
+            memcpy(dst, spans[i].data, spans[i].len);
+            dst += spans[i].len;
         }
-        xSemaphoreGive(gps->rtcm_data.mutex);
+        record_ring_commit(&gps->rtcm_data.ring, total_len, msg_type, xTaskGetTickCount());
+        gps->rtcm_data.last_msg_type = msg_type;
     }
     else {
-        LOG_ERR("Failed to acquire RTCM mutex");
+        LOG_WARN("RTCM buffer full, dropped msg_type=%d", msg_type);
     }
 
     /* 9. advance */
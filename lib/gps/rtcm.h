@@ -6,6 +6,15 @@
 #include <stdio.h>
 #include "gps_types.h"
 
+#define RTCM_HEADER_SIZE 3    /* preamble(1) + length(2) */
+#define RTCM_CRC_SIZE    3    /* CRC24Q */
+#define RTCM_MAX_PAYLOAD 1023 /* 10-bit length field max */
+#define RTCM_MAX_FRAME   (RTCM_HEADER_SIZE + RTCM_MAX_PAYLOAD + RTCM_CRC_SIZE) /* 1029 */
+
+// HEX ASCII로 변환하면 데이터가 2배 증가:
+// LoRa 최대 236 HEX 문자 = 118 바이트 binary
+#define RTCM_MAX_FRAGMENT_SIZE 118 // Max binary size per fragment
+
 typedef struct {
     uint16_t msg_len;     // RTCM 메시지 길이 (10비트)
     uint16_t msg_type;    // RTCM 메시지 타입 (12비트)
@@ -1,7 +1,5 @@
 #include "gsm.h"
 #include "parser.h" // parser.c 함수 사용
-#include "stm32f4xx_hal.h"
-#include "stm32f4xx_ll_usart.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -816,22 +814,10 @@ void gsm_send_at_cgdcont(gsm_t *gsm, gsm_at_mode_t at_mode, gsm_pdp_context_t *c
     }
 }
 
-int gsm_uart_send(const char *data, size_t len) {
-    for (int i = 0; i < len; i++) {
-        while (!LL_USART_IsActiveFlag_TXE(USART1))
-            ;
-        LL_USART_TransmitData8(USART1, *(data + i));
-    }
-
-    while (!LL_USART_IsActiveFlag_TC(USART1))
-        ;
-
-    return 0;
-}
-
 extern int gsm_port_reset(void);
+extern int gsm_port_send(const char *data, size_t len);
 
-static const gsm_hal_ops_t stm32_hal_ops = {.reset = gsm_port_reset, .send = gsm_uart_send};
+static const gsm_hal_ops_t stm32_hal_ops = {.reset = gsm_port_reset, .send = gsm_port_send};
 
 void gsm_init(gsm_t *gsm, evt_handler_t handler, void *args) {
     memset(gsm, 0, sizeof(gsm_t));
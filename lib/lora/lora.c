@@ -42,11 +42,6 @@ void lora_deinit(lora_t *lora) {
     lora_task_stop(lora);
 
     /* 큐 삭제 */
-    if (lora->rx_queue != NULL) {
-        vQueueDelete(lora->rx_queue);
-        lora->rx_queue = NULL;
-    }
-
     if (lora->cmd_queue != NULL) {
         vQueueDelete(lora->cmd_queue);
         lora->cmd_queue = NULL;
@@ -82,10 +77,12 @@ void lora_task_stop(lora_t *lora) {
         return;
     }
 
-    /* RX 태스크 삭제 */
+    /* RX 태스크 삭제 (핸들을 먼저 비워 UART ISR이 삭제된 태스크에 알리지 않게 함) */
     if (lora->rx_task != NULL) {
-        vTaskDelete(lora->rx_task);
+        TaskHandle_t rx_task = lora->rx_task;
+
         lora->rx_task = NULL;
+        vTaskDelete(rx_task);
         LOG_INFO("LoRa RX Task 삭제");
     }
 
@@ -100,13 +97,6 @@ void lora_task_stop(lora_t *lora) {
     lora->rx_task_ready = false;
 }
 
-QueueHandle_t lora_get_rx_queue(lora_t *lora) {
-    if (!lora) {
-        return NULL;
-    }
-    return lora->rx_queue;
-}
-
 /*===========================================================================
  * P2P 수신 콜백 API
  *===========================================================================*/
@@ -19,6 +19,7 @@
 #include "task.h"
 #include "semphr.h"
 #include "queue.h"
+#include "rtcm.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -28,7 +29,6 @@
  * 설정
  *===========================================================================*/
 #define LORA_CMD_QUEUE_SIZE    25
-#define LORA_RX_QUEUE_SIZE     10
 #define LORA_AT_CMD_TIMEOUT_MS 2000
 #define LORA_INIT_MAX_RETRY    3
 #define LORA_INIT_TIMEOUT_MS   2000
@@ -37,7 +37,8 @@
 /*===========================================================================
  * RTCM 재조립 버퍼
  *===========================================================================*/
-#define RTCM_REASSEMBLY_BUF_SIZE   512
+/* 최대 길이 RTCM 프레임 + 프리앰블 앞 잔여/다음 프레임 앞부분이 섞인 fragment 하나 */
+#define RTCM_REASSEMBLY_BUF_SIZE   (RTCM_MAX_FRAME + RTCM_MAX_FRAGMENT_SIZE)
 #define RTCM_REASSEMBLY_TIMEOUT_MS 5000
 
 typedef struct {
@@ -114,9 +115,8 @@ struct lora_s {
     const lora_hal_ops_t *ops;
 
     /*--- RX/TX 태스크 ---*/
-    QueueHandle_t rx_queue;
     QueueHandle_t cmd_queue;
-    TaskHandle_t rx_task;
+    TaskHandle_t rx_task; /* RX 알림 대상 (UART ISR → 태스크 알림) */
     TaskHandle_t tx_task;
     SemaphoreHandle_t mutex;
 
@@ -176,13 +176,6 @@ bool lora_task_start(lora_t *lora);
  */
 void lora_task_stop(lora_t *lora);
 
-/**
- * @brief RX 큐 가져오기 (인터럽트용)
- * @param lora LoRa 핸들
- * @return RX 큐 핸들
- */
-QueueHandle_t lora_get_rx_queue(lora_t *lora);
-
 /*===========================================================================
  * 명령어 API
  *===========================================================================*/
@@ -0,0 +1,95 @@
+#ifndef BIPBUFFER_H
+#define BIPBUFFER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Bip-buffer (두 영역 순환 버퍼)
+ *
+ * 예약 영역을 항상 연속 메모리로 돌려줌. 버퍼 끝에 공간이 부족하면
+ * 끝부분을 버리고(watermark 표시) 버퍼 처음부터 예약함.
+ * 생산자는 예약한 메모리에 직접 포맷하고, 소비자(DMA TX 등)는
+ * 연속 블록을 그대로 전송하므로 중간 복사가 없음.
+ *
+ * 단일 생산자 / 단일 소비자 lock-free:
+ * write, last는 생산자만, read는 소비자만 씀 (ringbuffer SPSC와 같은 규칙).
+ * 인덱스는 메모리 오프셋 그대로이며 크기 제약(2의 거듭제곱) 없음.
+ */
+typedef struct {
+    uint8_t *buffer;
+    size_t size;           /**< 버퍼 크기 */
+    volatile size_t write; /**< 쓰기 끝 오프셋 (생산자 소유) */
+    volatile size_t read;  /**< 읽기 시작 오프셋 (소비자 소유) */
+    volatile size_t last;  /**< 랩 이후 상위 영역의 데이터 끝 (watermark, 생산자 소유) */
+    size_t reserve_start;  /**< 예약 시작 오프셋 (생산자 전용) */
+    size_t reserve_len;    /**< 예약 길이 (생산자 전용, 0이면 예약 없음) */
+} bipbuffer_t;
+
+/**
+ * @brief bip-buffer 초기화
+ *
+ * @param bb bip-buffer 핸들
+ * @param buffer 버퍼
+ * @param size 버퍼 크기
+ */
+void bipbuffer_init(bipbuffer_t *bb, void *buffer, size_t size);
+
+/**
+ * @brief bip-buffer 리셋 (생산자/소비자 동작 중 호출 금지)
+ *
+ * @param bb bip-buffer 핸들
+ */
+void bipbuffer_reset(bipbuffer_t *bb);
+
+/**
+ * @brief 연속 공간 예약 (생산자)
+ *
+ * 한 번에 하나의 예약만 유효하며 bipbuffer_commit 전까지 소비자에게 보이지 않음
+ *
+ * @param bb bip-buffer 핸들
+ * @param len 예약 길이
+ * @return uint8_t* 연속 len 바이트 영역, 공간 부족이면 NULL
+ */
+uint8_t *bipbuffer_reserve(bipbuffer_t *bb, size_t len);
+
+/**
+ * @brief 예약 영역 중 len 바이트 공개 (생산자)
+ *
+ * 나머지 예약 영역은 반환됨. len == 0이면 예약 취소.
+ *
+ * @param bb bip-buffer 핸들
+ * @param len 실제로 쓴 바이트 수 (예약 길이 이하)
+ */
+void bipbuffer_commit(bipbuffer_t *bb, size_t len);
+
+/**
+ * @brief 읽을 수 있는 연속 블록 (소비자)
+ *
+ * 반환된 블록은 bipbuffer_read_release 전까지 유효함
+ *
+ * @param bb bip-buffer 핸들
+ * @param[out] len 블록 길이
+ * @return const uint8_t* 블록 시작, 비어있으면 NULL
+ */
+const uint8_t *bipbuffer_read_acquire(bipbuffer_t *bb, size_t *len);
+
+/**
+ * @brief 읽은 데이터 반환 (소비자)
+ *
+ * @param bb bip-buffer 핸들
+ * @param len 반환할 바이트 수 (read_acquire 길이 이하)
+ */
+void bipbuffer_read_release(bipbuffer_t *bb, size_t len);
+
+/**
+ * @brief 버퍼가 비어있는지 확인
+ *
+ * @param bb bip-buffer 핸들
+ * @return true 비어있음
+ * @return false 데이터 있음
+ */
+bool bipbuffer_is_empty(bipbuffer_t *bb);
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef BROADCAST_RING_H
+#define BROADCAST_RING_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ringbuffer.h"
+
+/**
+ * @brief 등록 가능한 최대 reader 수
+ */
+#ifndef BROADCAST_RING_MAX_READERS
+#define BROADCAST_RING_MAX_READERS 4
+#endif
+
+/**
+ * @brief 느린 reader 처리 정책
+ *
+ * - OVERWRITE: writer는 기다리지 않음. 한 바퀴 이상 밀린 reader는 가장 오래된
+ *   데이터를 잃고, 잃은 바이트 수는 reader별 drop_cnt에 누적 (다른 reader 영향 없음).
+ * - SLOWEST: 가장 느린 reader 기준으로 공간이 없으면 writer가 쓰기 전체를 버림
+ *   (ring의 drop_cnt에 누적). reader는 데이터를 잃지 않음.
+ */
+typedef enum {
+    BROADCAST_RING_POLICY_OVERWRITE = 0, /**< reader별 drop 집계 (기본) */
+    BROADCAST_RING_POLICY_SLOWEST,       /**< 가장 느린 reader 기준 writer drop */
+} broadcast_ring_policy_t;
+
+typedef struct broadcast_ring_s broadcast_ring_t;
+
+/**
+ * @brief broadcast ring reader (소비자별 읽기 커서)
+ *
+ * cursor, drop_cnt는 해당 reader 컨텍스트만 씀
+ */
+typedef struct {
+    broadcast_ring_t *ring;   /**< 등록된 ring (미등록 시 NULL) */
+    volatile size_t cursor;   /**< 읽기 인덱스 (free-running) */
+    volatile size_t drop_cnt; /**< 덮어쓰여 잃은 바이트 수 (OVERWRITE 정책) */
+} broadcast_reader_t;
+
+/**
+ * @brief 단일 writer / 다중 reader broadcast ring
+ *
+ * writer는 한 번만 쓰고, 각 reader는 자기 커서만 전진시킴 (reader 수만큼 복사 없음).
+ * 인덱스 규칙은 ringbuffer와 동일 (free-running, 메모리 위치 = 인덱스 & mask).
+ */
+struct broadcast_ring_s {
+    char *buffer;
+    size_t size;               /**< 버퍼 크기 (2의 거듭제곱) */
+    size_t mask;               /**< size - 1 */
+    volatile size_t head;      /**< 공개된 쓰기 인덱스 */
+    volatile size_t write_end; /**< 쓰기 중인 구간 끝 (reader의 덮어쓰기 검출용) */
+    broadcast_ring_policy_t policy;
+    broadcast_reader_t *readers[BROADCAST_RING_MAX_READERS];
+    size_t reader_cnt;
+    volatile size_t drop_cnt; /**< writer가 버린 바이트 수 (SLOWEST 정책) */
+};
+
+/**
+ * @brief broadcast ring 초기화
+ *
+ * @param ring ring 핸들
+ * @param buffer 버퍼
+ * @param size 버퍼 크기 (2의 거듭제곱, RINGBUFFER_IS_POW2 참고)
+ */
+void broadcast_ring_init(broadcast_ring_t *ring, char *buffer, size_t size);
+
+/**
+ * @brief 느린 reader 처리 정책 설정 (writer/reader 동작 전 호출)
+ *
+ * @param ring ring 핸들
+ * @param policy 정책
+ */
+void broadcast_ring_set_policy(broadcast_ring_t *ring, broadcast_ring_policy_t policy);
+
+/**
+ * @brief reader 등록
+ *
+ * 등록 시점 이후에 쓰인 데이터부터 읽음.
+ * reader 목록은 writer가 읽으므로 writer 동작 전에 등록해야 함.
+ *
+ * @param ring ring 핸들
+ * @param reader reader 핸들
+ * @return true 등록 성공
+ * @return false 최대 reader 수 초과
+ */
+bool broadcast_ring_attach(broadcast_ring_t *ring, broadcast_reader_t *reader);
+
+/**
+ * @brief reader 등록 해제 (writer 동작 중 호출 금지)
+ *
+ * @param reader reader 핸들
+ */
+void broadcast_ring_detach(broadcast_reader_t *reader);
+
+/**
+ * @brief 데이터 쓰기 (writer 전용)
+ *
+ * 쓰기는 전부 또는 전무: SLOWEST 정책에서 공간이 부족하면 쓰기 전체를 버림
+ *
+ * @param ring ring 핸들
+ * @param data 데이터
+ * @param len 데이터 길이 (size - 1 이하)
+ * @return true 쓰기 성공
+ * @return false 공간 부족으로 버림 (SLOWEST 정책)
+ */
+bool broadcast_ring_write(broadcast_ring_t *ring, const char *data, size_t len);
+
+/**
+ * @brief writer가 버린 바이트 수 (SLOWEST 정책)
+ *
+ * @param ring ring 핸들
+ * @return size_t 버린 바이트 수
+ */
+size_t broadcast_ring_get_drop_count(broadcast_ring_t *ring);
+
+/**
+ * @brief reader가 읽을 수 있는 데이터 길이
+ *
+ * @param reader reader 핸들
+ * @return size_t 데이터 길이
+ */
+size_t broadcast_reader_size(broadcast_reader_t *reader);
+
+/**
+ * @brief reader 다중 바이트 읽기 (복사)
+ *
+ * 복사 중 writer가 해당 구간을 덮어쓰면 버리고 최신 데이터부터 다시 읽음
+ *
+ * @param reader reader 핸들
+ * @param data 데이터 버퍼
+ * @param len 읽을 바이트 수
+ * @return size_t 읽은 바이트 수
+ */
+size_t broadcast_reader_read(broadcast_reader_t *reader, char *data, size_t len);
+
+/**
+ * @brief reader 데이터를 복사 없이 연속 구간으로 반환
+ *
+ * OVERWRITE 정책에서는 처리 도중 덮어쓰일 수 있으므로
+ * broadcast_reader_consume 결과로 유효성을 확인해야 함.
+ *
+ * @param reader reader 핸들
+ * @param offset 읽기 위치로부터의 오프셋
+ * @param len 요청 길이
+ * @param spans 구간 배열 (2개)
+ * @return size_t 구간 개수 (1 또는 2), 데이터 부족 또는 len == 0이면 0
+ */
+size_t broadcast_reader_peek_spans(broadcast_reader_t *reader, size_t offset, size_t len,
+                                   ringbuffer_span_t spans[2]);
+
+/**
+ * @brief peek_spans로 처리한 데이터 소비
+ *
+ * @param reader reader 핸들
+ * @param len 소비할 바이트 수
+ * @return true 성공 (처리한 데이터가 유효했음)
+ * @return false 데이터 부족, 또는 처리 도중 덮어쓰임 (최신 위치로 재동기화, 결과 폐기 필요)
+ */
+bool broadcast_reader_consume(broadcast_reader_t *reader, size_t len);
+
+/**
+ * @brief reader가 잃은 바이트 수 (OVERWRITE 정책)
+ *
+ * @param reader reader 핸들
+ * @return size_t 잃은 바이트 수
+ */
+size_t broadcast_reader_get_drop_count(broadcast_reader_t *reader);
+
+#endif
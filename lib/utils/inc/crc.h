@@ -0,0 +1,93 @@
+#ifndef CRC_H
+#define CRC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*===========================================================================
+ * CRC24Q (RTCM3)
+ *===========================================================================*/
+
+/**
+ * @brief CRC24Q 구현 선택 (크기/속도 트레이드오프)
+ *
+ * - 0: 비트 단위 (테이블 없음, 바이트당 8회 shift/XOR)
+ * - 1: 바이트 테이블 (1KB)
+ * - 4: slicing-by-4 (4KB, 4바이트씩 처리)
+ * - 8: slicing-by-8 (8KB, 8바이트씩 처리)
+ */
+#ifndef CRC24Q_SLICE
+#define CRC24Q_SLICE 8
+#endif
+
+/**
+ * @brief CRC24Q 누적 계산 (RTCM3, 다항식 0x1864CFB, 초기값 0)
+ *
+ * 이전 결과를 crc로 넘기면 이어서 계산하므로 링버퍼 구간(span) 단위로
+ * 나눠서 넣어도 한 번에 계산한 값과 같음
+ *
+ * @param crc 이전 CRC 값 (시작 시 0)
+ * @param data 데이터
+ * @param len 데이터 길이
+ * @return 24-bit CRC 값
+ */
+uint32_t crc24q_update(uint32_t crc, const void *data, size_t len);
+
+/*===========================================================================
+ * CRC32 (Unicore binary, reflected 0xEDB88320, 초기값 0, 최종 XOR 없음)
+ *===========================================================================*/
+
+/**
+ * @brief 이보다 짧은 구간은 하드웨어를 쓰지 않음 (설정 비용이 더 큼)
+ */
+#ifndef CRC32_HW_MIN_LEN
+#define CRC32_HW_MIN_LEN 32
+#endif
+
+/**
+ * @brief CRC32 하드웨어 인터페이스 (포트에서 등록)
+ */
+typedef struct {
+    /**
+     * @brief 하드웨어로 CRC32 누적 계산
+     *
+     * @param[in,out] crc 이전 CRC 값, 성공 시 결과로 갱신
+     * @param data 데이터
+     * @param len 데이터 길이
+     * @return true 계산 완료
+     * @return false 주변장치 사용 중 (crc 변경 없음, 소프트웨어로 계산)
+     */
+    bool (*calc)(uint32_t *crc, const void *data, size_t len);
+} crc32_hal_ops_t;
+
+/**
+ * @brief CRC32 하드웨어 등록 (태스크 시작 전 호출, NULL이면 소프트웨어만 사용)
+ *
+ * @param ops 하드웨어 인터페이스
+ */
+void crc32_set_hal(const crc32_hal_ops_t *ops);
+
+/**
+ * @brief CRC32 누적 계산 (하드웨어 우선, 없거나 사용 중이면 소프트웨어)
+ *
+ * 이전 결과를 crc로 넘기면 링버퍼 구간 단위로 이어서 계산 가능 (시작 시 0)
+ *
+ * @param crc 이전 CRC 값 (시작 시 0)
+ * @param data 데이터
+ * @param len 데이터 길이
+ * @return CRC32 값
+ */
+uint32_t crc32_update(uint32_t crc, const void *data, size_t len);
+
+/**
+ * @brief CRC32 누적 계산 (소프트웨어 slicing-by-8, 8KB 테이블)
+ *
+ * @param crc 이전 CRC 값 (시작 시 0)
+ * @param data 데이터
+ * @param len 데이터 길이
+ * @return CRC32 값
+ */
+uint32_t crc32_update_sw(uint32_t crc, const void *data, size_t len);
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef RECORD_RING_H
+#define RECORD_RING_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ringbuffer.h"
+
+/**
+ * @brief 레코드 헤더 (버퍼 안에서 페이로드 바로 앞에 위치)
+ */
+typedef struct {
+    uint16_t len;       /**< 페이로드 길이 */
+    uint16_t type;      /**< 사용자 정의 타입 (예: RTCM 메시지 번호) */
+    uint32_t timestamp; /**< 사용자 정의 시각 (예: tick) */
+} record_ring_hdr_t;
+
+/**
+ * @brief 레코드 단위 SPSC 링 (길이 헤더 + 페이로드)
+ *
+ * 레코드는 메모리상 항상 연속이며 버퍼 끝에 남은 공간이 부족하면
+ * 랩 마커를 두고 버퍼 처음부터 씀 (레코드가 쪼개지지 않음).
+ * 공간이 없으면 레코드 전체를 버림 (부분 기록 없음).
+ * 생산자는 head만, 소비자는 tail만 씀 (ringbuffer SPSC와 같은 규칙).
+ */
+typedef struct {
+    uint8_t *buffer;
+    size_t size;              /**< 버퍼 크기 (2의 거듭제곱) */
+    size_t mask;              /**< size - 1 */
+    volatile size_t head;     /**< 쓰기 인덱스 (생산자 소유, free-running) */
+    volatile size_t tail;     /**< 읽기 인덱스 (소비자 소유, free-running) */
+    size_t reserved;          /**< reserve된 레코드 위치 (생산자 전용) */
+    volatile size_t drop_cnt; /**< 공간 부족으로 버린 레코드 수 */
+} record_ring_t;
+
+/**
+ * @brief 레코드 페이로드 포인터
+ *
+ * @param hdr record_ring_peek 반환값
+ * @return 헤더 바로 뒤의 페이로드 (링 내부 메모리)
+ */
+static inline const uint8_t *record_ring_payload(const record_ring_hdr_t *hdr) {
+    return (const uint8_t *)(hdr + 1);
+}
+
+/**
+ * @brief 레코드 링 초기화
+ *
+ * @param rr 레코드 링 핸들
+ * @param buffer 버퍼 (4바이트 정렬)
+ * @param size 버퍼 크기 (2의 거듭제곱, RINGBUFFER_IS_POW2 참고)
+ */
+void record_ring_init(record_ring_t *rr, void *buffer, size_t size);
+
+/**
+ * @brief 레코드 링 리셋 (생산자/소비자 동작 중 호출 금지)
+ *
+ * @param rr 레코드 링 핸들
+ */
+void record_ring_reset(record_ring_t *rr);
+
+/**
+ * @brief 레코드 공간 예약 (생산자)
+ *
+ * 반환된 영역에 페이로드를 직접 쓴 뒤 record_ring_commit으로 공개.
+ * 한 번에 하나의 예약만 유효함.
+ *
+ * @param rr 레코드 링 핸들
+ * @param len 페이로드 길이
+ * @return uint8_t* 페이로드 쓰기 영역, 공간 부족이면 NULL (drop_cnt 증가)
+ */
+uint8_t *record_ring_reserve(record_ring_t *rr, size_t len);
+
+/**
+ * @brief 예약한 레코드 공개 (생산자)
+ *
+ * @param rr 레코드 링 핸들
+ * @param len 실제 페이로드 길이 (reserve 길이 이하)
+ * @param type 레코드 타입
+ * @param timestamp 레코드 시각
+ */
+void record_ring_commit(record_ring_t *rr, size_t len, uint16_t type, uint32_t timestamp);
+
+/**
+ * @brief 레코드 복사 기록 (reserve + memcpy + commit)
+ *
+ * @param rr 레코드 링 핸들
+ * @param data 페이로드
+ * @param len 페이로드 길이
+ * @param type 레코드 타입
+ * @param timestamp 레코드 시각
+ * @return true 기록 성공
+ * @return false 공간 부족으로 버림
+ */
+bool record_ring_push(record_ring_t *rr, const void *data, size_t len, uint16_t type,
+                      uint32_t timestamp);
+
+/**
+ * @brief 가장 오래된 레코드를 복사 없이 참조 (소비자)
+ *
+ * 반환된 포인터는 record_ring_pop 호출 전까지 유효함
+ *
+ * @param rr 레코드 링 핸들
+ * @return const record_ring_hdr_t* 레코드 헤더, 비어있으면 NULL
+ */
+const record_ring_hdr_t *record_ring_peek(record_ring_t *rr);
+
+/**
+ * @brief 가장 오래된 레코드 제거 (소비자)
+ *
+ * @param rr 레코드 링 핸들
+ * @return true 제거함
+ * @return false 비어있음
+ */
+bool record_ring_pop(record_ring_t *rr);
+
+/**
+ * @brief 레코드 링이 비어있는지 확인
+ *
+ * @param rr 레코드 링 핸들
+ * @return true 비어있음
+ * @return false 레코드 있음
+ */
+bool record_ring_is_empty(record_ring_t *rr);
+
+/**
+ * @brief 공간 부족으로 버린 레코드 수
+ *
+ * @param rr 레코드 링 핸들
+ * @return size_t 버린 레코드 수
+ */
+size_t record_ring_get_drop_count(record_ring_t *rr);
+
+#endif
@@ -5,28 +5,95 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * @brief 링버퍼 크기가 2의 거듭제곱인지 확인 (컴파일 타임 상수식)
+ *
+ * 버퍼 크기 정의부에서 STATIC_ASSERT와 함께 사용
+ */
+#define RINGBUFFER_IS_POW2(n) (((n) != 0) && ((((n) - 1) & (n)) == 0))
+
+/**
+ * @brief 링버퍼 동작 모드
+ *
+ * - OVERWRITE: 공간 부족 시 가장 오래된 데이터를 덮어씀 (tail 이동).
+ *   생산자가 소비자 인덱스를 건드리므로 단일 컨텍스트에서만 안전함.
+ * - SPSC: 단일 생산자(ISR 등) / 단일 소비자(Task) lock-free 모드.
+ *   생산자는 head만, 소비자는 tail만 쓰고 acquire/release 순서로 인덱스를 공개.
+ *   공간 부족 시 새 데이터를 버리고 overflow로 보고 (기존 데이터 보존).
+ * - DMA: 순환 DMA 수신 버퍼 자체를 링 메모리로 사용 (복사 없음).
+ *   데이터는 DMA가 직접 쓰고, ISR은 ringbuffer_dma_update로 위치만 공개.
+ *   write/reserve 계열 호출 금지. 소비자가 한 바퀴 이상 밀리면 overflow로 보고.
+ */
+typedef enum {
+    RINGBUFFER_MODE_OVERWRITE = 0, /**< 오래된 데이터 덮어쓰기 (기본) */
+    RINGBUFFER_MODE_SPSC,          /**< 단일 생산자/단일 소비자 lock-free */
+    RINGBUFFER_MODE_DMA,           /**< 순환 DMA 버퍼 직접 사용 (생산자 = DMA) */
+} ringbuffer_mode_t;
+
 /**
  * @brief 링 버퍼 구조체
- * 
+ *
+ * head/tail은 계속 증가하는 인덱스이며 메모리 위치는 (인덱스 & mask).
+ * 데이터 길이는 head - tail 한 번의 뺄셈으로 구함 (modulo 없음).
+ *
+ * @note SPSC 모드에서 head, is_overflow, overflow_cnt는 생산자만 쓰고
+ *       tail은 소비자만 씀
  */
 typedef struct {
     char *buffer;
-    volatile size_t head;
-    volatile size_t tail;
-    size_t size;
-    bool is_overflow;
-    size_t overflow_cnt;
+    volatile size_t head; /**< 쓰기 인덱스 (생산자 소유, free-running) */
+    volatile size_t tail; /**< 읽기 인덱스 (소비자 소유, free-running) */
+    size_t size;          /**< 버퍼 크기 (2의 거듭제곱) */
+    size_t mask;          /**< size - 1 */
+    ringbuffer_mode_t mode;
+    volatile bool is_overflow;
+    volatile size_t overflow_cnt; /**< 덮어쓴(OVERWRITE) 또는 버린(SPSC) 바이트 수 */
 } ringbuffer_t;
 
+/**
+ * @brief 링버퍼 내부 메모리의 연속 구간 (zero-copy 접근용)
+ *
+ * 데이터가 버퍼 끝에서 랩어라운드되면 최대 2개의 구간으로 나뉨
+ */
+typedef struct {
+    const char *data; /**< 링버퍼 내부 메모리 포인터 */
+    size_t len;       /**< 구간 길이 */
+} ringbuffer_span_t;
+
 /**
  * @brief 링버퍼 초기화
- * 
+ *
+ * 사용 가능한 용량은 size - 1 바이트
+ *
  * @param rb 링버퍼 핸들
  * @param buffer 버퍼
- * @param size 버퍼 크기
+ * @param size 버퍼 크기 (2의 거듭제곱, RINGBUFFER_IS_POW2 참고)
  */
 void ringbuffer_init(ringbuffer_t *rb, char *buffer, size_t size);
 
+/**
+ * @brief 링버퍼 동작 모드 설정
+ *
+ * 생산자/소비자가 동작하기 전 (초기화 직후)에 호출해야 함
+ *
+ * @param rb 링버퍼 핸들
+ * @param mode 동작 모드
+ */
+void ringbuffer_set_mode(ringbuffer_t *rb, ringbuffer_mode_t mode);
+
+/**
+ * @brief DMA 쓰기 위치 공개 (RINGBUFFER_MODE_DMA 전용, ISR에서 호출)
+ *
+ * 데이터 복사 없이 head만 DMA 위치까지 전진시킴.
+ * 두 번의 호출 사이에 버퍼 크기 이상 수신되면 구분할 수 없으므로
+ * DMA HT/TC 인터럽트에서도 호출해야 함.
+ *
+ * @param rb 링버퍼 핸들
+ * @param dma_pos DMA 쓰기 위치 (버퍼 크기 - 남은 전송 카운트)
+ * @return size_t 새로 수신된 바이트 수
+ */
+size_t ringbuffer_dma_update(ringbuffer_t *rb, size_t dma_pos);
+
 /**
  * @brief 링버퍼 해제
  * 
@@ -36,7 +103,9 @@ void ringbuffer_deinit(ringbuffer_t *rb);
 
 /**
  * @brief 링버퍼 리셋
- * 
+ *
+ * @note head/tail을 모두 쓰므로 생산자/소비자가 동작 중일 때 호출 금지
+ *
  * @param rb 링버퍼 핸들
  */
 void ringbuffer_reset(ringbuffer_t *rb);
@@ -102,20 +171,25 @@ size_t ringbuffer_free_size(ringbuffer_t *rb);
 
 /**
  * @brief 링버퍼 다중 바이트 쓰기
- * 
+ *
+ * SPSC 모드에서는 여유 공간만큼만 쓰고 나머지는 버림 (overflow_cnt에 누적)
+ *
  * @param rb 링버퍼 핸들
  * @param data 데이터 버퍼
  * @param len 데이터 길이
+ * @return size_t 실제로 쓴 바이트 수 (OVERWRITE 모드는 항상 len)
  */
-void ringbuffer_write(ringbuffer_t *rb, const char *data, size_t len);
+size_t ringbuffer_write(ringbuffer_t *rb, const char *data, size_t len);
 
 /**
  * @brief 링버퍼 1바이트 쓰기
- * 
+ *
  * @param rb 링버퍼 핸들
  * @param data 데이터
+ * @return true 쓰기 성공
+ * @return false 버퍼 가득참으로 버림 (SPSC 모드)
  */
-void ringbuffer_write_byte(ringbuffer_t *rb, char data);
+bool ringbuffer_write_byte(ringbuffer_t *rb, char data);
 
 /**
  * @brief 링버퍼 다중 바이트 읽기
@@ -149,6 +223,106 @@ bool ringbuffer_peek(ringbuffer_t *rb, char *data, size_t len, size_t offset);
  */
 bool ringbuffer_peek_byte(ringbuffer_t *rb, char *data);
 
+/**
+ * @brief 읽을 수 있는 데이터를 복사 없이 연속 구간으로 반환
+ *
+ * offset 위치부터 len 바이트를 최대 2개의 구간으로 돌려줌.
+ * 반환된 포인터는 ringbuffer_consume/advance 호출 전까지만 유효함.
+ *
+ * @param rb 링버퍼 핸들
+ * @param offset 읽기 위치로부터의 오프셋
+ * @param len 요청 길이
+ * @param spans 구간 배열 (2개)
+ * @return size_t 구간 개수 (1 또는 2), 데이터 부족 또는 len == 0이면 0
+ */
+size_t ringbuffer_peek_spans(ringbuffer_t *rb, size_t offset, size_t len,
+                             ringbuffer_span_t spans[2]);
+
+/**
+ * @brief peek_spans로 처리한 데이터 소비
+ *
+ * advance와 달리 데이터가 부족하면 아무것도 하지 않음
+ *
+ * @param rb 링버퍼 핸들
+ * @param len 소비할 바이트 수
+ * @return true 성공
+ * @return false 데이터 부족 (변경 없음)
+ */
+bool ringbuffer_consume(ringbuffer_t *rb, size_t len);
+
+/**
+ * @brief 쓰기 위치의 연속 여유 공간 예약 (생산자 측 zero-copy)
+ *
+ * 반환된 영역에 직접 쓴 뒤 ringbuffer_commit으로 공개함.
+ * 랩어라운드 지점까지만 반환하므로 남은 데이터는 commit 후 다시 reserve.
+ *
+ * @param rb 링버퍼 핸들
+ * @param ptr 쓰기 가능한 영역 포인터 (출력)
+ * @return size_t 연속으로 쓸 수 있는 바이트 수 (0이면 가득참)
+ */
+size_t ringbuffer_reserve(ringbuffer_t *rb, char **ptr);
+
+/**
+ * @brief reserve로 예약한 영역 중 len 바이트를 공개
+ *
+ * @param rb 링버퍼 핸들
+ * @param len 실제로 쓴 바이트 수 (reserve 반환값 이하)
+ */
+void ringbuffer_commit(ringbuffer_t *rb, size_t len);
+
+/**
+ * @brief 특정 문자 위치 찾기
+ *
+ * 랩어라운드된 두 구간을 memchr로 검색 (바이트 단위 peek 없음)
+ *
+ * @param rb 링버퍼 핸들
+ * @param ch 찾을 문자
+ * @param max_search 최대 검색 범위
+ * @param[out] pos 찾은 위치 (읽기 위치 기준 오프셋)
+ * @return true 찾음
+ * @return false 못 찾음
+ */
+bool ringbuffer_find_char(ringbuffer_t *rb, char ch, size_t max_search, size_t *pos);
+
+/**
+ * @brief 문자 집합 중 하나가 처음 나오는 위치 찾기
+ *
+ * @param rb 링버퍼 핸들
+ * @param set 찾을 문자 집합 (NUL 종료 문자열, '\0'은 찾을 수 없음)
+ * @param max_search 최대 검색 범위
+ * @param[out] pos 찾은 위치 (읽기 위치 기준 오프셋)
+ * @return true 찾음
+ * @return false 못 찾음
+ */
+bool ringbuffer_find_any_of(ringbuffer_t *rb, const char *set, size_t max_search, size_t *pos);
+
+/**
+ * @brief 바이트 시퀀스 시작 위치 찾기
+ *
+ * 시퀀스 전체가 처음 max_search 바이트 안에 있어야 찾은 것으로 봄
+ *
+ * @param rb 링버퍼 핸들
+ * @param seq 찾을 시퀀스
+ * @param seq_len 시퀀스 길이 (1 이상)
+ * @param max_search 최대 검색 범위
+ * @param[out] pos 찾은 시작 위치 (읽기 위치 기준 오프셋)
+ * @return true 찾음
+ * @return false 못 찾음
+ */
+bool ringbuffer_find_seq(ringbuffer_t *rb, const char *seq, size_t seq_len, size_t max_search,
+                         size_t *pos);
+
+/**
+ * @brief 읽기 위치를 len 바이트 전진 (데이터 버림)
+ *
+ * 남은 데이터보다 크면 OVERWRITE 모드는 버퍼를 리셋하고,
+ * SPSC/DMA 모드는 현재 데이터까지만 버림 (생산자 인덱스는 건드리지 않음)
+ *
+ * @param rb 링버퍼 핸들
+ * @param len 전진할 바이트 수
+ * @return true 성공
+ * @return false 데이터 부족
+ */
 bool ringbuffer_advance(ringbuffer_t *rb, size_t len);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef UART_DMA_NOTIFY_H
+#define UART_DMA_NOTIFY_H
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "uart_dma_port.h"
+
+/**
+ * @brief uart_dma_port ISR 이벤트 → 소유 태스크 직접 알림
+ *
+ * 더미 바이트 큐 대신 xTaskNotifyFromISR(eSetBits)로 원인 비트를 태스크 알림 값에
+ * OR. 태스크가 깨어나기 전 여러 번 인터럽트가 와도 알림 하나로 합쳐지고 (큐가 차서
+ * 신호를 잃는 일 없음), 태스크는 링에 쌓인 데이터를 한 번에 처리.
+ *
+ * 알림 값 0번 인덱스를 사용하므로 소유 태스크는 다른 용도로 태스크 알림을 쓰지 않아야 함
+ */
+
+/*===========================================================================
+ * 알림 비트 (하위 비트는 UART_DMA_EVT_*와 같은 값)
+ *===========================================================================*/
+#define UART_DMA_NOTIFY_RX       UART_DMA_EVT_RX       /**< 새 수신 데이터 */
+#define UART_DMA_NOTIFY_OVERFLOW UART_DMA_EVT_OVERFLOW /**< 수신 데이터 유실 */
+#define UART_DMA_NOTIFY_ERROR    UART_DMA_EVT_ERROR    /**< 라인/DMA 오류 */
+#define UART_DMA_NOTIFY_STOP     (1u << 31)            /**< 태스크 종료 요청 (태스크에서 전송) */
+
+#define UART_DMA_NOTIFY_ALL                                                                 \
+    (UART_DMA_NOTIFY_RX | UART_DMA_NOTIFY_OVERFLOW | UART_DMA_NOTIFY_ERROR | UART_DMA_NOTIFY_STOP)
+
+/**
+ * @brief 이벤트 비트를 태스크에 알림 (ISR 컨텍스트)
+ *
+ * 포트별 이벤트 콜백에서 추가 처리 후 호출 (예: GPS 마지막 수신 tick 기록)
+ *
+ * @param task 소유 태스크 (NULL이면 무시)
+ * @param events UART_DMA_EVT_* 비트
+ */
+void uart_dma_notify_from_isr(TaskHandle_t task, uint32_t events);
+
+/**
+ * @brief uart_dma_port_set_event_cb용 기본 콜백
+ *
+ * arg는 태스크 핸들 변수의 주소 (TaskHandle_t *). 포트를 태스크 생성 전에
+ * 시작해도 되고, 핸들이 아직 NULL이면 알림을 건너뜀
+ */
+void uart_dma_notify_cb(uart_dma_port_t *port, uint32_t events, void *arg);
+
+/**
+ * @brief 태스크 종료 요청 (태스크 컨텍스트)
+ *
+ * @param task 소유 태스크
+ */
+void uart_dma_notify_stop(TaskHandle_t task);
+
+/**
+ * @brief 알림 대기 후 쌓인 비트를 모두 꺼냄 (소유 태스크에서 호출)
+ *
+ * @param timeout_ms 대기 시간 (portMAX_DELAY: 무한)
+ * @return uint32_t UART_DMA_NOTIFY_* 비트 (0: 시간 초과)
+ */
+uint32_t uart_dma_notify_wait(uint32_t timeout_ms);
+
+#endif
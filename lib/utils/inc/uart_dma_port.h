@@ -0,0 +1,254 @@
+#ifndef UART_DMA_PORT_H
+#define UART_DMA_PORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ringbuffer.h"
+#include "uart_tx.h"
+
+/**
+ * @brief DMA UART 포트 공통 계층
+ *
+ * GPS, LTE, LoRa, BLE, RS485 등 모든 UART 트랜스포트가 같은 방식으로 동작:
+ * - RX: 순환 DMA 버퍼를 그대로 DMA 모드 링버퍼로 사용 (복사 없음).
+ *   IDLE/HT/TC 인터럽트에서 uart_dma_port_rx_isr가 DMA 쓰기 위치만 공개
+ * - TX: uart_tx 큐로 DMA 전송 (바이트마다 TXE 대기 없음)
+ *
+ * 주변장치 접근은 uart_dma_hw_ops_t로 분리되어 있어서 보드 백엔드(STM32H5
+ * USART + GPDMA)와 호스트 가짜 주변장치가 같은 코드를 구동함.
+ * 인스턴스별 USART, DMA 채널, 버퍼는 uart_dma_desc_t 표로 정의.
+ */
+
+/*===========================================================================
+ * ISR → 소유 태스크 이벤트 (on_event 인자, 비트 OR)
+ *===========================================================================*/
+#define UART_DMA_EVT_RX       (1u << 0) /**< 새 수신 데이터 공개됨 */
+#define UART_DMA_EVT_OVERFLOW (1u << 1) /**< 수신 데이터 유실 (링 추월 또는 USART 오버런) */
+#define UART_DMA_EVT_ERROR    (1u << 2) /**< 프레이밍/노이즈/패리티 또는 DMA 오류 */
+
+/*===========================================================================
+ * 하드웨어 오류 (uart_dma_port_error_isr 인자, 비트 OR)
+ *===========================================================================*/
+#define UART_DMA_ERR_OVERRUN (1u << 0) /**< USART 오버런 (DMA가 바이트를 놓침) */
+#define UART_DMA_ERR_FRAMING (1u << 1) /**< 프레이밍 오류 */
+#define UART_DMA_ERR_NOISE   (1u << 2) /**< 노이즈 */
+#define UART_DMA_ERR_PARITY  (1u << 3) /**< 패리티 오류 */
+#define UART_DMA_ERR_RX_DMA  (1u << 4) /**< RX DMA 전송 오류 (채널 정지됨, 재시작 필요) */
+
+typedef struct uart_dma_port uart_dma_port_t;
+
+/**
+ * @brief 주변장치 연산 (백엔드가 제공)
+ *
+ * 모두 desc의 uart/rx_dma/tx_dma를 해석해서 동작. rx_start/rx_remaining/tx_start는
+ * ISR에서도 호출됨 (대기 금지)
+ */
+typedef struct {
+    /** @brief USART 활성화 (RX/TX DMA 요청, 오류/IDLE 인터럽트 포함) */
+    void (*start)(uart_dma_port_t *port);
+    /** @brief USART와 RX/TX DMA 정지 */
+    void (*stop)(uart_dma_port_t *port);
+    /**
+     * @brief 순환 RX DMA (재)시작
+     *
+     * 첫 바퀴는 rx_buf[offset]부터 끝까지, 이후는 버퍼 전체를 반복
+     * (링 위치가 끊기지 않도록 DMA 오류 후에는 마지막 쓰기 위치에서 이어감)
+     */
+    void (*rx_start)(uart_dma_port_t *port, size_t offset);
+    /** @brief 현재 RX DMA 블록의 남은 전송 수 (쓰기 위치 = rx_size - 남은 수) */
+    size_t (*rx_remaining)(uart_dma_port_t *port);
+    /** @brief TX DMA 시작 (이전 전송은 끝난 상태, 완료 시 uart_dma_port_tx_isr) */
+    bool (*tx_start)(uart_dma_port_t *port, const uint8_t *data, size_t len);
+    /** @brief 보드레이트 변경 (마지막 바이트 송신 완료 후 적용, NULL 가능) */
+    void (*set_baudrate)(uart_dma_port_t *port, uint32_t baudrate);
+} uart_dma_hw_ops_t;
+
+/**
+ * @brief RTOS 연산 (TX 큐 대기/보호, NULL이면 대기 없는 단일 생산자)
+ */
+typedef struct {
+    void (*lock)(uart_dma_port_t *port);                     /**< 송신자 간 보호 */
+    void (*unlock)(uart_dma_port_t *port);                   /**< lock 해제 */
+    bool (*wait)(uart_dma_port_t *port, uint32_t timeout_ms); /**< TX 완료 통지 대기 */
+    void (*notify)(uart_dma_port_t *port);                   /**< TX 완료 통지 (ISR) */
+    uint32_t (*now_ms)(uart_dma_port_t *port);               /**< 현재 시각 (ms) */
+} uart_dma_os_ops_t;
+
+/**
+ * @brief 인스턴스 기술자 (보드 백엔드 표의 한 행, 상수)
+ */
+typedef struct {
+    const char *name;            /**< 로그용 이름 */
+    void *uart;                  /**< USART 인스턴스 (백엔드 해석) */
+    void *rx_dma;                /**< 순환 RX DMA 채널 */
+    void *tx_dma;                /**< TX DMA 채널 (NULL: 송신 없음) */
+    uint32_t rx_request;         /**< RX DMA 요청 번호 */
+    uint32_t tx_request;         /**< TX DMA 요청 번호 */
+    uint32_t baudrate;           /**< 초기 보드레이트 */
+    char *rx_buf;                /**< 순환 DMA 수신 버퍼 = RX 링 메모리 */
+    size_t rx_size;              /**< 수신 버퍼 크기 (2의 거듭제곱) */
+    uint8_t *tx_buf;             /**< TX 큐 메모리 (DMA 접근 가능 영역) */
+    size_t tx_size;              /**< TX 큐 크기 */
+    const uart_dma_hw_ops_t *hw; /**< 주변장치 연산 */
+    const uart_dma_os_ops_t *os; /**< RTOS 연산 (NULL 가능) */
+} uart_dma_desc_t;
+
+/**
+ * @brief ISR 이벤트 콜백 (UART_DMA_EVT_* 비트, ISR 컨텍스트)
+ */
+typedef void (*uart_dma_event_cb_t)(uart_dma_port_t *port, uint32_t events, void *arg);
+
+/**
+ * @brief 포트 실행 상태
+ */
+struct uart_dma_port {
+    const uart_dma_desc_t *desc;  /**< 기술자 */
+    ringbuffer_t *rx;             /**< RX 링 (기본 rx_ring, bind_rx로 교체) */
+    ringbuffer_t rx_ring;         /**< 내장 RX 링 */
+    uart_tx_t tx;                 /**< TX 큐 */
+    uart_tx_ops_t tx_ops;         /**< uart_tx → hw/os 연결 */
+    uart_dma_event_cb_t on_event; /**< ISR 이벤트 콜백 */
+    void *event_arg;              /**< 콜백 인자 */
+    void *os_lock;                /**< 송신자 보호 객체 (백엔드가 생성) */
+    void *os_done;                /**< TX 완료 통지 객체 (백엔드가 생성) */
+    size_t rx_overflow_seen;      /**< 이벤트로 보고한 링 overflow 누적 */
+    volatile uint32_t rx_events;  /**< 데이터가 공개된 RX 인터럽트 수 */
+    volatile uint32_t overruns;   /**< USART 오버런 횟수 */
+    volatile uint32_t errors;     /**< 그 밖의 수신 오류 횟수 */
+    bool running;                 /**< start ~ stop 사이 */
+};
+
+/**
+ * @brief 포트 초기화 (주변장치는 건드리지 않음)
+ *
+ * @param port 포트
+ * @param desc 기술자 (수명 동안 유지)
+ */
+void uart_dma_port_init(uart_dma_port_t *port, const uart_dma_desc_t *desc);
+
+/**
+ * @brief 외부 링버퍼를 RX 링으로 사용 (파서가 구조체 안의 링을 읽는 경우)
+ *
+ * rb를 desc->rx_buf 위에 DMA 모드로 초기화. start 전에 호출
+ *
+ * @param port 포트
+ * @param rb 링버퍼
+ */
+void uart_dma_port_bind_rx(uart_dma_port_t *port, ringbuffer_t *rb);
+
+/**
+ * @brief ISR 이벤트 콜백 등록 (start 전에 호출)
+ *
+ * 해제(cb = NULL)는 동작 중에도 가능: 알림 대상 태스크를 멈추기 전에 먼저 해제
+ *
+ * @param port 포트
+ * @param cb 콜백 (NULL: 해제)
+ * @param arg 콜백 인자
+ */
+void uart_dma_port_set_event_cb(uart_dma_port_t *port, uart_dma_event_cb_t cb, void *arg);
+
+/**
+ * @brief 수신/송신 시작 (RX는 링 쓰기 위치에서 이어서 받음)
+ *
+ * @param port 포트
+ */
+void uart_dma_port_start(uart_dma_port_t *port);
+
+/**
+ * @brief 정지: DMA를 멈추고 RX 링과 TX 큐를 비움
+ *
+ * RX 링의 소비자 인덱스도 되돌리므로 링을 읽는 태스크를 먼저 멈춘 뒤 호출
+ *
+ * @param port 포트
+ */
+void uart_dma_port_stop(uart_dma_port_t *port);
+
+/**
+ * @brief RX 링 (DMA 모드, 소비자는 peek_spans/advance/read로 읽음)
+ *
+ * @param port 포트
+ * @return ringbuffer_t* RX 링
+ */
+ringbuffer_t *uart_dma_port_rx(uart_dma_port_t *port);
+
+/**
+ * @brief 현재 DMA 쓰기 위치 (rx_buf 인덱스, 0 ~ rx_size)
+ *
+ * 버퍼를 직접 위치로 추적하는 소비자용
+ *
+ * @param port 포트
+ * @return size_t 쓰기 위치
+ */
+size_t uart_dma_port_rx_pos(uart_dma_port_t *port);
+
+/**
+ * @brief 송신 큐에 넣고 바로 반환 (uart_tx_write)
+ *
+ * @param port 포트
+ * @param data 송신 데이터
+ * @param len 길이
+ * @param timeout_ms 큐 공간 대기 시간
+ * @return size_t 큐에 넣은 바이트 수
+ */
+size_t uart_dma_port_write(uart_dma_port_t *port, const void *data, size_t len,
+                           uint32_t timeout_ms);
+
+/**
+ * @brief 송신 후 전송 완료까지 대기 (uart_tx_write_sync)
+ *
+ * @param port 포트
+ * @param data 송신 데이터
+ * @param len 길이
+ * @param timeout_ms 전체 대기 시간
+ * @return true: 전송 완료
+ */
+bool uart_dma_port_write_sync(uart_dma_port_t *port, const void *data, size_t len,
+                              uint32_t timeout_ms);
+
+/**
+ * @brief 큐에 넣은 데이터가 모두 나갈 때까지 대기
+ *
+ * @param port 포트
+ * @param timeout_ms 대기 시간
+ * @return true: 큐가 비었음
+ */
+bool uart_dma_port_flush(uart_dma_port_t *port, uint32_t timeout_ms);
+
+/**
+ * @brief 보드레이트 변경 (송신 큐를 비운 뒤 적용)
+ *
+ * @param port 포트
+ * @param baudrate 보드레이트
+ * @param timeout_ms 송신 큐 대기 시간
+ * @return true: 변경됨, false: 큐가 비지 않았거나 지원 안 함
+ */
+bool uart_dma_port_set_baudrate(uart_dma_port_t *port, uint32_t baudrate, uint32_t timeout_ms);
+
+/**
+ * @brief RX 이벤트 (USART IDLE, DMA HT/TC ISR에서 호출)
+ *
+ * DMA 쓰기 위치를 링에 공개하고 새 데이터가 있으면 on_event 호출
+ *
+ * @param port 포트
+ */
+void uart_dma_port_rx_isr(uart_dma_port_t *port);
+
+/**
+ * @brief 수신 오류 (USART 오류, RX DMA 오류 ISR에서 호출)
+ *
+ * 그때까지 받은 데이터를 공개하고, RX DMA가 멈췄으면 마지막 쓰기 위치에서 재시작
+ *
+ * @param port 포트
+ * @param errors UART_DMA_ERR_* 비트
+ */
+void uart_dma_port_error_isr(uart_dma_port_t *port, uint32_t errors);
+
+/**
+ * @brief TX DMA 완료 (TX DMA TC/오류 ISR에서 호출)
+ *
+ * @param port 포트
+ */
+void uart_dma_port_tx_isr(uart_dma_port_t *port);
+
+#endif
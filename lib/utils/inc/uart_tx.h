@@ -0,0 +1,138 @@
+#ifndef UART_TX_H
+#define UART_TX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "bipbuffer.h"
+
+/**
+ * @brief 비차단 UART TX 엔진 (DMA 전송 큐)
+ *
+ * 송신 데이터를 bip-buffer 큐에 복사하고, 연속 블록 단위로 DMA 전송을 시작.
+ * 전송 완료 ISR(uart_tx_dma_done)이 다음 블록을 바로 이어서 시작하므로
+ * 큐에 데이터가 있는 동안 블록 사이 공백은 ISR 지연 한 번뿐이고, CPU는 바이트마다
+ * TXE를 기다리지 않음.
+ *
+ * 호출자는 두 가지 방식 중 선택:
+ * - uart_tx_write: 큐에 넣고 바로 반환 (fire-and-forget). timeout_ms 동안은
+ *   큐 공간을 기다리고, 0이면 공간이 없을 때 바로 실패
+ * - uart_tx_write_sync: 큐에 넣고 그 데이터의 전송 완료까지 대기 (timeout 포함)
+ *
+ * 생산자(태스크)는 여러 개일 수 있음 (ops->lock으로 직렬화, 한 번의 write는
+ * 다른 write와 섞이지 않음). 소비자는 busy 플래그를 잡은 쪽(태스크 또는 완료 ISR)
+ * 하나뿐. ISR에서 write 호출 금지.
+ */
+
+/**
+ * @brief 플랫폼 연산 (포트가 제공)
+ */
+typedef struct {
+    /**
+     * @brief DMA 전송 시작 (태스크/ISR 컨텍스트, 대기 금지)
+     * @return true: 시작됨 (완료 시 uart_tx_dma_done 호출), false: 실패 (블록은 버림)
+     */
+    bool (*start)(void *ctx, const uint8_t *data, size_t len);
+    void (*lock)(void *ctx);   /**< 생산자 간 보호 (NULL이면 생산자 1개) */
+    void (*unlock)(void *ctx); /**< lock 해제 */
+    /**
+     * @brief 완료 통지 대기 (NULL이면 대기 불가 → timeout은 0으로 취급)
+     * @return true: 통지 받음, false: 시간 초과
+     */
+    bool (*wait)(void *ctx, uint32_t timeout_ms);
+    void (*notify)(void *ctx);     /**< 블록 전송 완료 통지 (ISR 컨텍스트, NULL 가능) */
+    uint32_t (*now_ms)(void *ctx); /**< 현재 시각 (ms, wait가 있으면 필수) */
+} uart_tx_ops_t;
+
+/**
+ * @brief TX 엔진 상태
+ *
+ * queued/sent는 누적 바이트 수 (wrap 허용). sent가 어떤 write의 끝 위치를
+ * 지나면 그 write는 전송 완료
+ */
+typedef struct {
+    const uart_tx_ops_t *ops;   /**< 플랫폼 연산 */
+    void *ctx;                  /**< ops에 전달되는 컨텍스트 */
+    bipbuffer_t q;              /**< 송신 대기 큐 */
+    size_t max_chunk;           /**< 한 번에 예약하는 최대 길이 (큐 크기 / 2) */
+    volatile uint32_t queued;   /**< 큐에 넣은 누적 바이트 (생산자) */
+    volatile uint32_t sent;     /**< 전송 완료(또는 시작 실패로 버린) 누적 바이트 (소비자) */
+    volatile uint32_t lost_end; /**< 마지막으로 버린 블록의 끝 위치 (누적) */
+    volatile size_t in_flight;  /**< 전송 중인 블록 길이 */
+    volatile uint8_t busy;      /**< 전송 진행 중 (소비자 소유권) */
+    uint32_t dropped;           /**< 큐 공간 부족으로 넣지 못한 바이트 */
+    uint32_t start_errors;      /**< DMA 시작 실패 횟수 */
+} uart_tx_t;
+
+/**
+ * @brief TX 엔진 초기화
+ *
+ * @param tx TX 엔진
+ * @param mem 큐 메모리 (DMA가 접근 가능한 영역)
+ * @param size 큐 크기
+ * @param ops 플랫폼 연산 (start 필수)
+ * @param ctx ops에 전달되는 컨텍스트
+ */
+void uart_tx_init(uart_tx_t *tx, void *mem, size_t size, const uart_tx_ops_t *ops, void *ctx);
+
+/**
+ * @brief 큐와 진행 상태 비우기 (DMA 정지 후 호출)
+ *
+ * 큐에 남은 데이터는 버려지고, 기다리던 write_sync/flush는 바로 반환됨
+ *
+ * @param tx TX 엔진
+ */
+void uart_tx_reset(uart_tx_t *tx);
+
+/**
+ * @brief 큐에 넣고 바로 반환 (fire-and-forget)
+ *
+ * 큐 공간이 부족하면 전송 완료를 기다리며 timeout_ms까지 재시도.
+ * 데이터는 복사되므로 반환 후 버퍼를 재사용해도 됨
+ *
+ * @param tx TX 엔진
+ * @param data 송신 데이터
+ * @param len 길이
+ * @param timeout_ms 큐 공간 대기 시간 (0: 대기 안 함)
+ * @return size_t 큐에 넣은 바이트 수 (len보다 작으면 나머지는 버려짐)
+ */
+size_t uart_tx_write(uart_tx_t *tx, const void *data, size_t len, uint32_t timeout_ms);
+
+/**
+ * @brief 큐에 넣고 전송 완료까지 대기
+ *
+ * @param tx TX 엔진
+ * @param data 송신 데이터
+ * @param len 길이
+ * @param timeout_ms 큐 공간 대기 + 전송 완료 대기 전체 시간
+ * @return true: 전부 전송됨, false: 시간 초과, 큐 공간 부족 또는 전송 실패
+ */
+bool uart_tx_write_sync(uart_tx_t *tx, const void *data, size_t len, uint32_t timeout_ms);
+
+/**
+ * @brief 지금까지 큐에 넣은 데이터가 모두 전송될 때까지 대기
+ *
+ * @param tx TX 엔진
+ * @param timeout_ms 대기 시간
+ * @return true: 큐가 비었음, false: 시간 초과
+ */
+bool uart_tx_flush(uart_tx_t *tx, uint32_t timeout_ms);
+
+/**
+ * @brief 블록 전송 완료 (DMA TC ISR에서 호출)
+ *
+ * 전송한 블록을 반환하고 대기 데이터가 있으면 다음 블록을 바로 시작한 뒤 통지
+ *
+ * @param tx TX 엔진
+ */
+void uart_tx_dma_done(uart_tx_t *tx);
+
+/**
+ * @brief 전송 대기 또는 진행 중인 데이터가 있는지 확인
+ *
+ * @param tx TX 엔진
+ * @return true: 전송할 데이터 있음
+ */
+bool uart_tx_is_busy(uart_tx_t *tx);
+
+#endif
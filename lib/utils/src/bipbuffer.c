@@ -0,0 +1,147 @@
+#include <string.h>
+#include "bipbuffer.h"
+#include "dev_assert.h"
+
+#ifndef TAG
+#define TAG "bipbuffer"
+#endif
+
+#include "log.h"
+
+/* acquire/release 규칙은 ringbuffer.c와 동일 */
+#define BB_LOAD_RELAXED(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+#define BB_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define BB_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/*
+ * 상태
+ * - 정방향 (write >= read): 데이터 [read, write), 여유 [write, size) + [0, read)
+ * - 역방향 (write < read): 데이터 [read, last) + [0, write), 여유 [write, read)
+ *   역방향에서 write는 read에 도달하지 않음 (같으면 빈 상태와 구분 불가)
+ */
+
+void bipbuffer_init(bipbuffer_t *bb, void *buffer, size_t size) {
+    DEV_ASSERT(bb != NULL);
+    DEV_ASSERT(buffer != NULL);
+    DEV_ASSERT(size > 0);
+
+    bb->buffer = buffer;
+    bb->size = size;
+    bipbuffer_reset(bb);
+}
+
+void bipbuffer_reset(bipbuffer_t *bb) {
+    DEV_ASSERT(bb != NULL);
+
+    bb->write = 0;
+    bb->read = 0;
+    bb->last = bb->size;
+    bb->reserve_start = 0;
+    bb->reserve_len = 0;
+}
+
+uint8_t *bipbuffer_reserve(bipbuffer_t *bb, size_t len) {
+    DEV_ASSERT(bb != NULL);
+    DEV_ASSERT(bb->reserve_len == 0);
+
+    if (len == 0) {
+        return NULL;
+    }
+
+    size_t write = BB_LOAD_RELAXED(&bb->write);
+    size_t read = BB_LOAD_ACQUIRE(&bb->read);
+    size_t start;
+
+    if (write < read) {
+        /* 역방향: read 직전까지만 */
+        if (len >= read - write) {
+            return NULL;
+        }
+        start = write;
+    }
+    else if (bb->size - write >= len) {
+        /* 정방향: 끝부분에 연속 공간 있음 */
+        start = write;
+    }
+    else if (len < read) {
+        /* 끝부분 부족: 처음부터 예약 (commit 시 last로 끝부분 포기) */
+        start = 0;
+    }
+    else {
+        return NULL;
+    }
+
+    bb->reserve_start = start;
+    bb->reserve_len = len;
+    return &bb->buffer[start];
+}
+
+void bipbuffer_commit(bipbuffer_t *bb, size_t len) {
+    DEV_ASSERT(bb != NULL);
+    DEV_ASSERT(len <= bb->reserve_len);
+
+    if (bb->reserve_len == 0) {
+        return;
+    }
+
+    size_t write = BB_LOAD_RELAXED(&bb->write);
+    size_t start = bb->reserve_start;
+
+    bb->reserve_len = 0;
+
+    if (len == 0) {
+        return;
+    }
+
+    if (start != write) {
+        /* 랩: 상위 영역은 이전 write까지만 유효 (write 공개 전에 last 기록) */
+        bb->last = write;
+    }
+
+    BB_STORE_RELEASE(&bb->write, start + len);
+}
+
+const uint8_t *bipbuffer_read_acquire(bipbuffer_t *bb, size_t *len) {
+    DEV_ASSERT(bb != NULL);
+    DEV_ASSERT(len != NULL);
+
+    size_t write = BB_LOAD_ACQUIRE(&bb->write);
+    size_t read = BB_LOAD_RELAXED(&bb->read);
+
+    if (write < read) {
+        size_t last = BB_LOAD_RELAXED(&bb->last);
+
+        if (read == last) {
+            /* 상위 영역 소진: 하위 영역으로 이동 */
+            read = 0;
+            BB_STORE_RELEASE(&bb->read, read);
+        }
+        else {
+            *len = last - read;
+            return &bb->buffer[read];
+        }
+    }
+
+    if (write == read) {
+        *len = 0;
+        return NULL;
+    }
+
+    *len = write - read;
+    return &bb->buffer[read];
+}
+
+void bipbuffer_read_release(bipbuffer_t *bb, size_t len) {
+    DEV_ASSERT(bb != NULL);
+
+    size_t read = BB_LOAD_RELAXED(&bb->read);
+
+    BB_STORE_RELEASE(&bb->read, read + len);
+}
+
+bool bipbuffer_is_empty(bipbuffer_t *bb) {
+    DEV_ASSERT(bb != NULL);
+
+    /* 역방향(write < read)이면 하위 영역에 항상 데이터가 있음 */
+    return BB_LOAD_ACQUIRE(&bb->write) == BB_LOAD_ACQUIRE(&bb->read);
+}
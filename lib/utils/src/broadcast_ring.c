@@ -0,0 +1,269 @@
+#include <string.h>
+#include "broadcast_ring.h"
+#include "dev_assert.h"
+
+#ifndef TAG
+#define TAG "broadcast_ring"
+#endif
+
+#include "log.h"
+
+/*
+ * 인덱스 접근 순서 (acquire/release 규칙은 ringbuffer.c와 동일)
+ * - writer: write_end 공개 → 데이터 쓰기 → head release
+ * - reader: write_end 확인(재동기화) → head acquire → 데이터 읽기 → acquire fence →
+ *   write_end 재확인
+ *   write_end - mask 이전 위치는 writer가 이미 덮어썼거나 덮어쓰는 중으로 간주
+ */
+#define BR_LOAD_RELAXED(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+#define BR_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define BR_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+static inline size_t br_idx(const broadcast_ring_t *ring, size_t pos) {
+    return pos & ring->mask;
+}
+
+/*
+ * cursor 위치의 데이터가 덮어쓰였는지 확인
+ * (cursor <= head <= write_end 이므로 부호 없는 뺄셈이 곧 거리)
+ */
+static inline bool br_is_lapped(const broadcast_ring_t *ring, size_t write_end, size_t cursor) {
+    return write_end - cursor > ring->mask;
+}
+
+/*
+ * reader 커서가 덮어쓰인 구간에 있으면 가장 오래된 유효 위치로 옮기고 잃은 바이트를 집계
+ * @return 보정된 커서
+ */
+static size_t br_resync(broadcast_reader_t *reader, size_t cursor) {
+    broadcast_ring_t *ring = reader->ring;
+    size_t write_end = BR_LOAD_ACQUIRE(&ring->write_end);
+
+    if (br_is_lapped(ring, write_end, cursor)) {
+        size_t oldest = write_end - ring->mask;
+        reader->drop_cnt += oldest - cursor;
+        cursor = oldest;
+        BR_STORE_RELEASE(&reader->cursor, cursor);
+    }
+
+    return cursor;
+}
+
+void broadcast_ring_init(broadcast_ring_t *ring, char *buffer, size_t size) {
+    DEV_ASSERT(ring != NULL);
+    DEV_ASSERT(buffer != NULL);
+    DEV_ASSERT_MSG(RINGBUFFER_IS_POW2(size), "broadcast ring size must be a power of two");
+
+    memset(ring, 0, sizeof(broadcast_ring_t));
+    ring->buffer = buffer;
+    ring->size = size;
+    ring->mask = size - 1;
+    ring->policy = BROADCAST_RING_POLICY_OVERWRITE;
+}
+
+void broadcast_ring_set_policy(broadcast_ring_t *ring, broadcast_ring_policy_t policy) {
+    DEV_ASSERT(ring != NULL);
+
+    ring->policy = policy;
+}
+
+bool broadcast_ring_attach(broadcast_ring_t *ring, broadcast_reader_t *reader) {
+    DEV_ASSERT(ring != NULL);
+    DEV_ASSERT(reader != NULL);
+    DEV_ASSERT(reader->ring == NULL);
+
+    if (ring->reader_cnt >= BROADCAST_RING_MAX_READERS) {
+        LOG_ERR("broadcast ring reader limit reached (%d)", BROADCAST_RING_MAX_READERS);
+        return false;
+    }
+
+    reader->ring = ring;
+    reader->cursor = BR_LOAD_ACQUIRE(&ring->head);
+    reader->drop_cnt = 0;
+    ring->readers[ring->reader_cnt++] = reader;
+
+    return true;
+}
+
+void broadcast_ring_detach(broadcast_reader_t *reader) {
+    DEV_ASSERT(reader != NULL);
+
+    broadcast_ring_t *ring = reader->ring;
+    if (ring == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < ring->reader_cnt; i++) {
+        if (ring->readers[i] == reader) {
+            ring->readers[i] = ring->readers[--ring->reader_cnt];
+            ring->readers[ring->reader_cnt] = NULL;
+            break;
+        }
+    }
+
+    reader->ring = NULL;
+}
+
+/* 가장 느린 reader 기준 여유 공간 (reader가 없으면 전체 용량) */
+static size_t br_min_free(broadcast_ring_t *ring, size_t head) {
+    size_t min_free = ring->mask;
+
+    for (size_t i = 0; i < ring->reader_cnt; i++) {
+        size_t used = head - BR_LOAD_ACQUIRE(&ring->readers[i]->cursor);
+        size_t free_space = (used < ring->mask) ? ring->mask - used : 0;
+
+        if (free_space < min_free) {
+            min_free = free_space;
+        }
+    }
+
+    return min_free;
+}
+
+bool broadcast_ring_write(broadcast_ring_t *ring, const char *data, size_t len) {
+    DEV_ASSERT(ring != NULL);
+    DEV_ASSERT(data != NULL);
+    DEV_ASSERT(len < ring->size);
+
+    if (len == 0) {
+        return true;
+    }
+
+    size_t head = BR_LOAD_RELAXED(&ring->head);
+
+    if (ring->policy == BROADCAST_RING_POLICY_SLOWEST && len > br_min_free(ring, head)) {
+        ring->drop_cnt += len;
+        return false;
+    }
+
+    /* 덮어쓸 구간을 먼저 공개하고, 데이터 쓰기가 그 뒤에 보이도록 함 */
+    BR_STORE_RELEASE(&ring->write_end, head + len);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    size_t start = br_idx(ring, head);
+    size_t first_chunk = ring->size - start;
+
+    if (first_chunk >= len) {
+        memcpy(&ring->buffer[start], data, len);
+    }
+    else {
+        memcpy(&ring->buffer[start], data, first_chunk);
+        memcpy(&ring->buffer[0], data + first_chunk, len - first_chunk);
+    }
+
+    BR_STORE_RELEASE(&ring->head, head + len);
+
+    return true;
+}
+
+size_t broadcast_ring_get_drop_count(broadcast_ring_t *ring) {
+    DEV_ASSERT(ring != NULL);
+
+    return ring->drop_cnt;
+}
+
+size_t broadcast_reader_size(broadcast_reader_t *reader) {
+    DEV_ASSERT(reader != NULL && reader->ring != NULL);
+
+    size_t cursor = br_resync(reader, BR_LOAD_RELAXED(&reader->cursor));
+    size_t head = BR_LOAD_ACQUIRE(&reader->ring->head);
+
+    return head - cursor;
+}
+
+size_t broadcast_reader_read(broadcast_reader_t *reader, char *data, size_t len) {
+    DEV_ASSERT(reader != NULL && reader->ring != NULL);
+    DEV_ASSERT(data != NULL);
+
+    broadcast_ring_t *ring = reader->ring;
+
+    for (;;) {
+        size_t cursor = br_resync(reader, BR_LOAD_RELAXED(&reader->cursor));
+        size_t head = BR_LOAD_ACQUIRE(&ring->head);
+        size_t available = head - cursor;
+        size_t read_len = (len <= available) ? len : available;
+
+        if (read_len == 0) {
+            return 0;
+        }
+
+        size_t start = br_idx(ring, cursor);
+        size_t first_chunk = ring->size - start;
+
+        if (first_chunk >= read_len) {
+            memcpy(data, &ring->buffer[start], read_len);
+        }
+        else {
+            memcpy(data, &ring->buffer[start], first_chunk);
+            memcpy(data + first_chunk, &ring->buffer[0], read_len - first_chunk);
+        }
+
+        /* 복사하는 동안 writer가 읽은 구간을 덮어쓰지 않았는지 확인 */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (!br_is_lapped(ring, BR_LOAD_RELAXED(&ring->write_end), cursor)) {
+            BR_STORE_RELEASE(&reader->cursor, cursor + read_len);
+            return read_len;
+        }
+    }
+}
+
+size_t broadcast_reader_peek_spans(broadcast_reader_t *reader, size_t offset, size_t len,
+                                   ringbuffer_span_t spans[2]) {
+    DEV_ASSERT(reader != NULL && reader->ring != NULL);
+    DEV_ASSERT(spans != NULL);
+
+    if (len == 0) {
+        return 0;
+    }
+
+    broadcast_ring_t *ring = reader->ring;
+    size_t cursor = br_resync(reader, BR_LOAD_RELAXED(&reader->cursor));
+    size_t head = BR_LOAD_ACQUIRE(&ring->head);
+    size_t current_size = head - cursor;
+
+    if (offset >= current_size || len > (current_size - offset)) {
+        return 0;
+    }
+
+    size_t start = br_idx(ring, cursor + offset);
+    size_t first_chunk = ring->size - start;
+
+    spans[0].data = &ring->buffer[start];
+
+    if (first_chunk >= len) {
+        spans[0].len = len;
+        return 1;
+    }
+
+    spans[0].len = first_chunk;
+    spans[1].data = &ring->buffer[0];
+    spans[1].len = len - first_chunk;
+    return 2;
+}
+
+bool broadcast_reader_consume(broadcast_reader_t *reader, size_t len) {
+    DEV_ASSERT(reader != NULL && reader->ring != NULL);
+
+    broadcast_ring_t *ring = reader->ring;
+    size_t head = BR_LOAD_ACQUIRE(&ring->head);
+    size_t cursor = BR_LOAD_RELAXED(&reader->cursor);
+
+    if (len > head - cursor) {
+        return false;
+    }
+
+    /* peek_spans 이후 처리 도중 덮어쓰였으면 결과 폐기 */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (br_resync(reader, cursor) != cursor) {
+        return false;
+    }
+
+    BR_STORE_RELEASE(&reader->cursor, cursor + len);
+    return true;
+}
+
+size_t broadcast_reader_get_drop_count(broadcast_reader_t *reader) {
+    DEV_ASSERT(reader != NULL);
+
+    return reader->drop_cnt;
+}
@@ -0,0 +1,838 @@
+#include "crc.h"
+#include "dev_assert.h"
+
+#if CRC24Q_SLICE != 0 && CRC24Q_SLICE != 1 && CRC24Q_SLICE != 4 && CRC24Q_SLICE != 8
+#error "CRC24Q_SLICE must be 0, 1, 4 or 8"
+#endif
+
+/*===========================================================================
+ * CRC24Q (RTCM3)
+ *===========================================================================*/
+
+#define CRC24Q_POLY 0x1864CFBUL
+
+#if CRC24Q_SLICE > 0
+/*
+ * 테이블 값은 CRC를 32비트 상위 정렬(crc << 8)한 형태.
+ * crc24q_table[k][b] = 바이트 b 뒤에 0 바이트 k개가 이어질 때의 CRC
+ * (다항식 0x864CFB, MSB 우선). slicing-by-N은 테이블 N개 사용
+ */
+static const uint32_t crc24q_table[CRC24Q_SLICE][256] = {
+    {
+        0x00000000UL, 0x864cfb00UL, 0x8ad50d00UL, 0x0c99f600UL, 0x93e6e100UL, 0x15aa1a00UL,
+        0x1933ec00UL, 0x9f7f1700UL, 0xa1813900UL, 0x27cdc200UL, 0x2b543400UL, 0xad18cf00UL,
+        0x3267d800UL, 0xb42b2300UL, 0xb8b2d500UL, 0x3efe2e00UL, 0xc54e8900UL, 0x43027200UL,
+        0x4f9b8400UL, 0xc9d77f00UL, 0x56a86800UL, 0xd0e49300UL, 0xdc7d6500UL, 0x5a319e00UL,
+        0x64cfb000UL, 0xe2834b00UL, 0xee1abd00UL, 0x68564600UL, 0xf7295100UL, 0x7165aa00UL,
+        0x7dfc5c00UL, 0xfbb0a700UL, 0x0cd1e900UL, 0x8a9d1200UL, 0x8604e400UL, 0x00481f00UL,
+        0x9f370800UL, 0x197bf300UL, 0x15e20500UL, 0x93aefe00UL, 0xad50d000UL, 0x2b1c2b00UL,
+        0x2785dd00UL, 0xa1c92600UL, 0x3eb63100UL, 0xb8faca00UL, 0xb4633c00UL, 0x322fc700UL,
+        0xc99f6000UL, 0x4fd39b00UL, 0x434a6d00UL, 0xc5069600UL, 0x5a798100UL, 0xdc357a00UL,
+        0xd0ac8c00UL, 0x56e07700UL, 0x681e5900UL, 0xee52a200UL, 0xe2cb5400UL, 0x6487af00UL,
+        0xfbf8b800UL, 0x7db44300UL, 0x712db500UL, 0xf7614e00UL, 0x19a3d200UL, 0x9fef2900UL,
+        0x9376df00UL, 0x153a2400UL, 0x8a453300UL, 0x0c09c800UL, 0x00903e00UL, 0x86dcc500UL,
+        0xb822eb00UL, 0x3e6e1000UL, 0x32f7e600UL, 0xb4bb1d00UL, 0x2bc40a00UL, 0xad88f100UL,
+        0xa1110700UL, 0x275dfc00UL, 0xdced5b00UL, 0x5aa1a000UL, 0x56385600UL, 0xd074ad00UL,
+        0x4f0bba00UL, 0xc9474100UL, 0xc5deb700UL, 0x43924c00UL, 0x7d6c6200UL, 0xfb209900UL,
+        0xf7b96f00UL, 0x71f59400UL, 0xee8a8300UL, 0x68c67800UL, 0x645f8e00UL, 0xe2137500UL,
+        0x15723b00UL, 0x933ec000UL, 0x9fa73600UL, 0x19ebcd00UL, 0x8694da00UL, 0x00d82100UL,
+        0x0c41d700UL, 0x8a0d2c00UL, 0xb4f30200UL, 0x32bff900UL, 0x3e260f00UL, 0xb86af400UL,
+        0x2715e300UL, 0xa1591800UL, 0xadc0ee00UL, 0x2b8c1500UL, 0xd03cb200UL, 0x56704900UL,
+        0x5ae9bf00UL, 0xdca54400UL, 0x43da5300UL, 0xc596a800UL, 0xc90f5e00UL, 0x4f43a500UL,
+        0x71bd8b00UL, 0xf7f17000UL, 0xfb688600UL, 0x7d247d00UL, 0xe25b6a00UL, 0x64179100UL,
+        0x688e6700UL, 0xeec29c00UL, 0x3347a400UL, 0xb50b5f00UL, 0xb992a900UL, 0x3fde5200UL,
+        0xa0a14500UL, 0x26edbe00UL, 0x2a744800UL, 0xac38b300UL, 0x92c69d00UL, 0x148a6600UL,
+        0x18139000UL, 0x9e5f6b00UL, 0x01207c00UL, 0x876c8700UL, 0x8bf57100UL, 0x0db98a00UL,
+        0xf6092d00UL, 0x7045d600UL, 0x7cdc2000UL, 0xfa90db00UL, 0x65efcc00UL, 0xe3a33700UL,
+        0xef3ac100UL, 0x69763a00UL, 0x57881400UL, 0xd1c4ef00UL, 0xdd5d1900UL, 0x5b11e200UL,
+        0xc46ef500UL, 0x42220e00UL, 0x4ebbf800UL, 0xc8f70300UL, 0x3f964d00UL, 0xb9dab600UL,
+        0xb5434000UL, 0x330fbb00UL, 0xac70ac00UL, 0x2a3c5700UL, 0x26a5a100UL, 0xa0e95a00UL,
+        0x9e177400UL, 0x185b8f00UL, 0x14c27900UL, 0x928e8200UL, 0x0df19500UL, 0x8bbd6e00UL,
+        0x87249800UL, 0x01686300UL, 0xfad8c400UL, 0x7c943f00UL, 0x700dc900UL, 0xf6413200UL,
+        0x693e2500UL, 0xef72de00UL, 0xe3eb2800UL, 0x65a7d300UL, 0x5b59fd00UL, 0xdd150600UL,
+        0xd18cf000UL, 0x57c00b00UL, 0xc8bf1c00UL, 0x4ef3e700UL, 0x426a1100UL, 0xc426ea00UL,
+        0x2ae47600UL, 0xaca88d00UL, 0xa0317b00UL, 0x267d8000UL, 0xb9029700UL, 0x3f4e6c00UL,
+        0x33d79a00UL, 0xb59b6100UL, 0x8b654f00UL, 0x0d29b400UL, 0x01b04200UL, 0x87fcb900UL,
+        0x1883ae00UL, 0x9ecf5500UL, 0x9256a300UL, 0x141a5800UL, 0xefaaff00UL, 0x69e60400UL,
+        0x657ff200UL, 0xe3330900UL, 0x7c4c1e00UL, 0xfa00e500UL, 0xf6991300UL, 0x70d5e800UL,
+        0x4e2bc600UL, 0xc8673d00UL, 0xc4fecb00UL, 0x42b23000UL, 0xddcd2700UL, 0x5b81dc00UL,
+        0x57182a00UL, 0xd154d100UL, 0x26359f00UL, 0xa0796400UL, 0xace09200UL, 0x2aac6900UL,
+        0xb5d37e00UL, 0x339f8500UL, 0x3f067300UL, 0xb94a8800UL, 0x87b4a600UL, 0x01f85d00UL,
+        0x0d61ab00UL, 0x8b2d5000UL, 0x14524700UL, 0x921ebc00UL, 0x9e874a00UL, 0x18cbb100UL,
+        0xe37b1600UL, 0x6537ed00UL, 0x69ae1b00UL, 0xefe2e000UL, 0x709df700UL, 0xf6d10c00UL,
+        0xfa48fa00UL, 0x7c040100UL, 0x42fa2f00UL, 0xc4b6d400UL, 0xc82f2200UL, 0x4e63d900UL,
+        0xd11cce00UL, 0x57503500UL, 0x5bc9c300UL, 0xdd853800UL},
+#if CRC24Q_SLICE >= 4
+    {
+        0x00000000UL, 0x668f4800UL, 0xcd1e9000UL, 0xab91d800UL, 0x1c71db00UL, 0x7afe9300UL,
+        0xd16f4b00UL, 0xb7e00300UL, 0x38e3b600UL, 0x5e6cfe00UL, 0xf5fd2600UL, 0x93726e00UL,
+        0x24926d00UL, 0x421d2500UL, 0xe98cfd00UL, 0x8f03b500UL, 0x71c76c00UL, 0x17482400UL,
+        0xbcd9fc00UL, 0xda56b400UL, 0x6db6b700UL, 0x0b39ff00UL, 0xa0a82700UL, 0xc6276f00UL,
+        0x4924da00UL, 0x2fab9200UL, 0x843a4a00UL, 0xe2b50200UL, 0x55550100UL, 0x33da4900UL,
+        0x984b9100UL, 0xfec4d900UL, 0xe38ed800UL, 0x85019000UL, 0x2e904800UL, 0x481f0000UL,
+        0xffff0300UL, 0x99704b00UL, 0x32e19300UL, 0x546edb00UL, 0xdb6d6e00UL, 0xbde22600UL,
+        0x1673fe00UL, 0x70fcb600UL, 0xc71cb500UL, 0xa193fd00UL, 0x0a022500UL, 0x6c8d6d00UL,
+        0x9249b400UL, 0xf4c6fc00UL, 0x5f572400UL, 0x39d86c00UL, 0x8e386f00UL, 0xe8b72700UL,
+        0x4326ff00UL, 0x25a9b700UL, 0xaaaa0200UL, 0xcc254a00UL, 0x67b49200UL, 0x013bda00UL,
+        0xb6dbd900UL, 0xd0549100UL, 0x7bc54900UL, 0x1d4a0100UL, 0x41514b00UL, 0x27de0300UL,
+        0x8c4fdb00UL, 0xeac09300UL, 0x5d209000UL, 0x3bafd800UL, 0x903e0000UL, 0xf6b14800UL,
+        0x79b2fd00UL, 0x1f3db500UL, 0xb4ac6d00UL, 0xd2232500UL, 0x65c32600UL, 0x034c6e00UL,
+        0xa8ddb600UL, 0xce52fe00UL, 0x30962700UL, 0x56196f00UL, 0xfd88b700UL, 0x9b07ff00UL,
+        0x2ce7fc00UL, 0x4a68b400UL, 0xe1f96c00UL, 0x87762400UL, 0x08759100UL, 0x6efad900UL,
+        0xc56b0100UL, 0xa3e44900UL, 0x14044a00UL, 0x728b0200UL, 0xd91ada00UL, 0xbf959200UL,
+        0xa2df9300UL, 0xc450db00UL, 0x6fc10300UL, 0x094e4b00UL, 0xbeae4800UL, 0xd8210000UL,
+        0x73b0d800UL, 0x153f9000UL, 0x9a3c2500UL, 0xfcb36d00UL, 0x5722b500UL, 0x31adfd00UL,
+        0x864dfe00UL, 0xe0c2b600UL, 0x4b536e00UL, 0x2ddc2600UL, 0xd318ff00UL, 0xb597b700UL,
+        0x1e066f00UL, 0x78892700UL, 0xcf692400UL, 0xa9e66c00UL, 0x0277b400UL, 0x64f8fc00UL,
+        0xebfb4900UL, 0x8d740100UL, 0x26e5d900UL, 0x406a9100UL, 0xf78a9200UL, 0x9105da00UL,
+        0x3a940200UL, 0x5c1b4a00UL, 0x82a29600UL, 0xe42dde00UL, 0x4fbc0600UL, 0x29334e00UL,
+        0x9ed34d00UL, 0xf85c0500UL, 0x53cddd00UL, 0x35429500UL, 0xba412000UL, 0xdcce6800UL,
+        0x775fb000UL, 0x11d0f800UL, 0xa630fb00UL, 0xc0bfb300UL, 0x6b2e6b00UL, 0x0da12300UL,
+        0xf365fa00UL, 0x95eab200UL, 0x3e7b6a00UL, 0x58f42200UL, 0xef142100UL, 0x899b6900UL,
+        0x220ab100UL, 0x4485f900UL, 0xcb864c00UL, 0xad090400UL, 0x0698dc00UL, 0x60179400UL,
+        0xd7f79700UL, 0xb178df00UL, 0x1ae90700UL, 0x7c664f00UL, 0x612c4e00UL, 0x07a30600UL,
+        0xac32de00UL, 0xcabd9600UL, 0x7d5d9500UL, 0x1bd2dd00UL, 0xb0430500UL, 0xd6cc4d00UL,
+        0x59cff800UL, 0x3f40b000UL, 0x94d16800UL, 0xf25e2000UL, 0x45be2300UL, 0x23316b00UL,
+        0x88a0b300UL, 0xee2ffb00UL, 0x10eb2200UL, 0x76646a00UL, 0xddf5b200UL, 0xbb7afa00UL,
+        0x0c9af900UL, 0x6a15b100UL, 0xc1846900UL, 0xa70b2100UL, 0x28089400UL, 0x4e87dc00UL,
+        0xe5160400UL, 0x83994c00UL, 0x34794f00UL, 0x52f60700UL, 0xf967df00UL, 0x9fe89700UL,
+        0xc3f3dd00UL, 0xa57c9500UL, 0x0eed4d00UL, 0x68620500UL, 0xdf820600UL, 0xb90d4e00UL,
+        0x129c9600UL, 0x7413de00UL, 0xfb106b00UL, 0x9d9f2300UL, 0x360efb00UL, 0x5081b300UL,
+        0xe761b000UL, 0x81eef800UL, 0x2a7f2000UL, 0x4cf06800UL, 0xb234b100UL, 0xd4bbf900UL,
+        0x7f2a2100UL, 0x19a56900UL, 0xae456a00UL, 0xc8ca2200UL, 0x635bfa00UL, 0x05d4b200UL,
+        0x8ad70700UL, 0xec584f00UL, 0x47c99700UL, 0x2146df00UL, 0x96a6dc00UL, 0xf0299400UL,
+        0x5bb84c00UL, 0x3d370400UL, 0x207d0500UL, 0x46f24d00UL, 0xed639500UL, 0x8becdd00UL,
+        0x3c0cde00UL, 0x5a839600UL, 0xf1124e00UL, 0x979d0600UL, 0x189eb300UL, 0x7e11fb00UL,
+        0xd5802300UL, 0xb30f6b00UL, 0x04ef6800UL, 0x62602000UL, 0xc9f1f800UL, 0xaf7eb000UL,
+        0x51ba6900UL, 0x37352100UL, 0x9ca4f900UL, 0xfa2bb100UL, 0x4dcbb200UL, 0x2b44fa00UL,
+        0x80d52200UL, 0xe65a6a00UL, 0x6959df00UL, 0x0fd69700UL, 0xa4474f00UL, 0xc2c80700UL,
+        0x75280400UL, 0x13a74c00UL, 0xb8369400UL, 0xdeb9dc00UL},
+    {
+        0x00000000UL, 0x8309d700UL, 0x805f5500UL, 0x03568200UL, 0x86f25100UL, 0x05fb8600UL,
+        0x06ad0400UL, 0x85a4d300UL, 0x8ba85900UL, 0x08a18e00UL, 0x0bf70c00UL, 0x88fedb00UL,
+        0x0d5a0800UL, 0x8e53df00UL, 0x8d055d00UL, 0x0e0c8a00UL, 0x911c4900UL, 0x12159e00UL,
+        0x11431c00UL, 0x924acb00UL, 0x17ee1800UL, 0x94e7cf00UL, 0x97b14d00UL, 0x14b89a00UL,
+        0x1ab41000UL, 0x99bdc700UL, 0x9aeb4500UL, 0x19e29200UL, 0x9c464100UL, 0x1f4f9600UL,
+        0x1c191400UL, 0x9f10c300UL, 0xa4746900UL, 0x277dbe00UL, 0x242b3c00UL, 0xa722eb00UL,
+        0x22863800UL, 0xa18fef00UL, 0xa2d96d00UL, 0x21d0ba00UL, 0x2fdc3000UL, 0xacd5e700UL,
+        0xaf836500UL, 0x2c8ab200UL, 0xa92e6100UL, 0x2a27b600UL, 0x29713400UL, 0xaa78e300UL,
+        0x35682000UL, 0xb661f700UL, 0xb5377500UL, 0x363ea200UL, 0xb39a7100UL, 0x3093a600UL,
+        0x33c52400UL, 0xb0ccf300UL, 0xbec07900UL, 0x3dc9ae00UL, 0x3e9f2c00UL, 0xbd96fb00UL,
+        0x38322800UL, 0xbb3bff00UL, 0xb86d7d00UL, 0x3b64aa00UL, 0xcea42900UL, 0x4dadfe00UL,
+        0x4efb7c00UL, 0xcdf2ab00UL, 0x48567800UL, 0xcb5faf00UL, 0xc8092d00UL, 0x4b00fa00UL,
+        0x450c7000UL, 0xc605a700UL, 0xc5532500UL, 0x465af200UL, 0xc3fe2100UL, 0x40f7f600UL,
+        0x43a17400UL, 0xc0a8a300UL, 0x5fb86000UL, 0xdcb1b700UL, 0xdfe73500UL, 0x5ceee200UL,
+        0xd94a3100UL, 0x5a43e600UL, 0x59156400UL, 0xda1cb300UL, 0xd4103900UL, 0x5719ee00UL,
+        0x544f6c00UL, 0xd746bb00UL, 0x52e26800UL, 0xd1ebbf00UL, 0xd2bd3d00UL, 0x51b4ea00UL,
+        0x6ad04000UL, 0xe9d99700UL, 0xea8f1500UL, 0x6986c200UL, 0xec221100UL, 0x6f2bc600UL,
+        0x6c7d4400UL, 0xef749300UL, 0xe1781900UL, 0x6271ce00UL, 0x61274c00UL, 0xe22e9b00UL,
+        0x678a4800UL, 0xe4839f00UL, 0xe7d51d00UL, 0x64dcca00UL, 0xfbcc0900UL, 0x78c5de00UL,
+        0x7b935c00UL, 0xf89a8b00UL, 0x7d3e5800UL, 0xfe378f00UL, 0xfd610d00UL, 0x7e68da00UL,
+        0x70645000UL, 0xf36d8700UL, 0xf03b0500UL, 0x7332d200UL, 0xf6960100UL, 0x759fd600UL,
+        0x76c95400UL, 0xf5c08300UL, 0x1b04a900UL, 0x980d7e00UL, 0x9b5bfc00UL, 0x18522b00UL,
+        0x9df6f800UL, 0x1eff2f00UL, 0x1da9ad00UL, 0x9ea07a00UL, 0x90acf000UL, 0x13a52700UL,
+        0x10f3a500UL, 0x93fa7200UL, 0x165ea100UL, 0x95577600UL, 0x9601f400UL, 0x15082300UL,
+        0x8a18e000UL, 0x09113700UL, 0x0a47b500UL, 0x894e6200UL, 0x0ceab100UL, 0x8fe36600UL,
+        0x8cb5e400UL, 0x0fbc3300UL, 0x01b0b900UL, 0x82b96e00UL, 0x81efec00UL, 0x02e63b00UL,
+        0x8742e800UL, 0x044b3f00UL, 0x071dbd00UL, 0x84146a00UL, 0xbf70c000UL, 0x3c791700UL,
+        0x3f2f9500UL, 0xbc264200UL, 0x39829100UL, 0xba8b4600UL, 0xb9ddc400UL, 0x3ad41300UL,
+        0x34d89900UL, 0xb7d14e00UL, 0xb487cc00UL, 0x378e1b00UL, 0xb22ac800UL, 0x31231f00UL,
+        0x32759d00UL, 0xb17c4a00UL, 0x2e6c8900UL, 0xad655e00UL, 0xae33dc00UL, 0x2d3a0b00UL,
+        0xa89ed800UL, 0x2b970f00UL, 0x28c18d00UL, 0xabc85a00UL, 0xa5c4d000UL, 0x26cd0700UL,
+        0x259b8500UL, 0xa6925200UL, 0x23368100UL, 0xa03f5600UL, 0xa369d400UL, 0x20600300UL,
+        0xd5a08000UL, 0x56a95700UL, 0x55ffd500UL, 0xd6f60200UL, 0x5352d100UL, 0xd05b0600UL,
+        0xd30d8400UL, 0x50045300UL, 0x5e08d900UL, 0xdd010e00UL, 0xde578c00UL, 0x5d5e5b00UL,
+        0xd8fa8800UL, 0x5bf35f00UL, 0x58a5dd00UL, 0xdbac0a00UL, 0x44bcc900UL, 0xc7b51e00UL,
+        0xc4e39c00UL, 0x47ea4b00UL, 0xc24e9800UL, 0x41474f00UL, 0x4211cd00UL, 0xc1181a00UL,
+        0xcf149000UL, 0x4c1d4700UL, 0x4f4bc500UL, 0xcc421200UL, 0x49e6c100UL, 0xcaef1600UL,
+        0xc9b99400UL, 0x4ab04300UL, 0x71d4e900UL, 0xf2dd3e00UL, 0xf18bbc00UL, 0x72826b00UL,
+        0xf726b800UL, 0x742f6f00UL, 0x7779ed00UL, 0xf4703a00UL, 0xfa7cb000UL, 0x79756700UL,
+        0x7a23e500UL, 0xf92a3200UL, 0x7c8ee100UL, 0xff873600UL, 0xfcd1b400UL, 0x7fd86300UL,
+        0xe0c8a000UL, 0x63c17700UL, 0x6097f500UL, 0xe39e2200UL, 0x663af100UL, 0xe5332600UL,
+        0xe665a400UL, 0x656c7300UL, 0x6b60f900UL, 0xe8692e00UL, 0xeb3fac00UL, 0x68367b00UL,
+        0xed92a800UL, 0x6e9b7f00UL, 0x6dcdfd00UL, 0xeec42a00UL},
+    {
+        0x00000000UL, 0x36095200UL, 0x6c12a400UL, 0x5a1bf600UL, 0xd8254800UL, 0xee2c1a00UL,
+        0xb437ec00UL, 0x823ebe00UL, 0x36066b00UL, 0x000f3900UL, 0x5a14cf00UL, 0x6c1d9d00UL,
+        0xee232300UL, 0xd82a7100UL, 0x82318700UL, 0xb438d500UL, 0x6c0cd600UL, 0x5a058400UL,
+        0x001e7200UL, 0x36172000UL, 0xb4299e00UL, 0x8220cc00UL, 0xd83b3a00UL, 0xee326800UL,
+        0x5a0abd00UL, 0x6c03ef00UL, 0x36181900UL, 0x00114b00UL, 0x822ff500UL, 0xb426a700UL,
+        0xee3d5100UL, 0xd8340300UL, 0xd819ac00UL, 0xee10fe00UL, 0xb40b0800UL, 0x82025a00UL,
+        0x003ce400UL, 0x3635b600UL, 0x6c2e4000UL, 0x5a271200UL, 0xee1fc700UL, 0xd8169500UL,
+        0x820d6300UL, 0xb4043100UL, 0x363a8f00UL, 0x0033dd00UL, 0x5a282b00UL, 0x6c217900UL,
+        0xb4157a00UL, 0x821c2800UL, 0xd807de00UL, 0xee0e8c00UL, 0x6c303200UL, 0x5a396000UL,
+        0x00229600UL, 0x362bc400UL, 0x82131100UL, 0xb41a4300UL, 0xee01b500UL, 0xd808e700UL,
+        0x5a365900UL, 0x6c3f0b00UL, 0x3624fd00UL, 0x002daf00UL, 0x367fa300UL, 0x0076f100UL,
+        0x5a6d0700UL, 0x6c645500UL, 0xee5aeb00UL, 0xd853b900UL, 0x82484f00UL, 0xb4411d00UL,
+        0x0079c800UL, 0x36709a00UL, 0x6c6b6c00UL, 0x5a623e00UL, 0xd85c8000UL, 0xee55d200UL,
+        0xb44e2400UL, 0x82477600UL, 0x5a737500UL, 0x6c7a2700UL, 0x3661d100UL, 0x00688300UL,
+        0x82563d00UL, 0xb45f6f00UL, 0xee449900UL, 0xd84dcb00UL, 0x6c751e00UL, 0x5a7c4c00UL,
+        0x0067ba00UL, 0x366ee800UL, 0xb4505600UL, 0x82590400UL, 0xd842f200UL, 0xee4ba000UL,
+        0xee660f00UL, 0xd86f5d00UL, 0x8274ab00UL, 0xb47df900UL, 0x36434700UL, 0x004a1500UL,
+        0x5a51e300UL, 0x6c58b100UL, 0xd8606400UL, 0xee693600UL, 0xb472c000UL, 0x827b9200UL,
+        0x00452c00UL, 0x364c7e00UL, 0x6c578800UL, 0x5a5eda00UL, 0x826ad900UL, 0xb4638b00UL,
+        0xee787d00UL, 0xd8712f00UL, 0x5a4f9100UL, 0x6c46c300UL, 0x365d3500UL, 0x00546700UL,
+        0xb46cb200UL, 0x8265e000UL, 0xd87e1600UL, 0xee774400UL, 0x6c49fa00UL, 0x5a40a800UL,
+        0x005b5e00UL, 0x36520c00UL, 0x6cff4600UL, 0x5af61400UL, 0x00ede200UL, 0x36e4b000UL,
+        0xb4da0e00UL, 0x82d35c00UL, 0xd8c8aa00UL, 0xeec1f800UL, 0x5af92d00UL, 0x6cf07f00UL,
+        0x36eb8900UL, 0x00e2db00UL, 0x82dc6500UL, 0xb4d53700UL, 0xeecec100UL, 0xd8c79300UL,
+        0x00f39000UL, 0x36fac200UL, 0x6ce13400UL, 0x5ae86600UL, 0xd8d6d800UL, 0xeedf8a00UL,
+        0xb4c47c00UL, 0x82cd2e00UL, 0x36f5fb00UL, 0x00fca900UL, 0x5ae75f00UL, 0x6cee0d00UL,
+        0xeed0b300UL, 0xd8d9e100UL, 0x82c21700UL, 0xb4cb4500UL, 0xb4e6ea00UL, 0x82efb800UL,
+        0xd8f44e00UL, 0xeefd1c00UL, 0x6cc3a200UL, 0x5acaf000UL, 0x00d10600UL, 0x36d85400UL,
+        0x82e08100UL, 0xb4e9d300UL, 0xeef22500UL, 0xd8fb7700UL, 0x5ac5c900UL, 0x6ccc9b00UL,
+        0x36d76d00UL, 0x00de3f00UL, 0xd8ea3c00UL, 0xeee36e00UL, 0xb4f89800UL, 0x82f1ca00UL,
+        0x00cf7400UL, 0x36c62600UL, 0x6cddd000UL, 0x5ad48200UL, 0xeeec5700UL, 0xd8e50500UL,
+        0x82fef300UL, 0xb4f7a100UL, 0x36c91f00UL, 0x00c04d00UL, 0x5adbbb00UL, 0x6cd2e900UL,
+        0x5a80e500UL, 0x6c89b700UL, 0x36924100UL, 0x009b1300UL, 0x82a5ad00UL, 0xb4acff00UL,
+        0xeeb70900UL, 0xd8be5b00UL, 0x6c868e00UL, 0x5a8fdc00UL, 0x00942a00UL, 0x369d7800UL,
+        0xb4a3c600UL, 0x82aa9400UL, 0xd8b16200UL, 0xeeb83000UL, 0x368c3300UL, 0x00856100UL,
+        0x5a9e9700UL, 0x6c97c500UL, 0xeea97b00UL, 0xd8a02900UL, 0x82bbdf00UL, 0xb4b28d00UL,
+        0x008a5800UL, 0x36830a00UL, 0x6c98fc00UL, 0x5a91ae00UL, 0xd8af1000UL, 0xeea64200UL,
+        0xb4bdb400UL, 0x82b4e600UL, 0x82994900UL, 0xb4901b00UL, 0xee8bed00UL, 0xd882bf00UL,
+        0x5abc0100UL, 0x6cb55300UL, 0x36aea500UL, 0x00a7f700UL, 0xb49f2200UL, 0x82967000UL,
+        0xd88d8600UL, 0xee84d400UL, 0x6cba6a00UL, 0x5ab33800UL, 0x00a8ce00UL, 0x36a19c00UL,
+        0xee959f00UL, 0xd89ccd00UL, 0x82873b00UL, 0xb48e6900UL, 0x36b0d700UL, 0x00b98500UL,
+        0x5aa27300UL, 0x6cab2100UL, 0xd893f400UL, 0xee9aa600UL, 0xb4815000UL, 0x82880200UL,
+        0x00b6bc00UL, 0x36bfee00UL, 0x6ca41800UL, 0x5aad4a00UL},
+#endif
+#if CRC24Q_SLICE >= 8
+    {
+        0x00000000UL, 0xd9fe8c00UL, 0x35b1e300UL, 0xec4f6f00UL, 0x6b63c600UL, 0xb29d4a00UL,
+        0x5ed22500UL, 0x872ca900UL, 0xd6c78c00UL, 0x0f390000UL, 0xe3766f00UL, 0x3a88e300UL,
+        0xbda44a00UL, 0x645ac600UL, 0x8815a900UL, 0x51eb2500UL, 0x2bc3e300UL, 0xf23d6f00UL,
+        0x1e720000UL, 0xc78c8c00UL, 0x40a02500UL, 0x995ea900UL, 0x7511c600UL, 0xacef4a00UL,
+        0xfd046f00UL, 0x24fae300UL, 0xc8b58c00UL, 0x114b0000UL, 0x9667a900UL, 0x4f992500UL,
+        0xa3d64a00UL, 0x7a28c600UL, 0x5787c600UL, 0x8e794a00UL, 0x62362500UL, 0xbbc8a900UL,
+        0x3ce40000UL, 0xe51a8c00UL, 0x0955e300UL, 0xd0ab6f00UL, 0x81404a00UL, 0x58bec600UL,
+        0xb4f1a900UL, 0x6d0f2500UL, 0xea238c00UL, 0x33dd0000UL, 0xdf926f00UL, 0x066ce300UL,
+        0x7c442500UL, 0xa5baa900UL, 0x49f5c600UL, 0x900b4a00UL, 0x1727e300UL, 0xced96f00UL,
+        0x22960000UL, 0xfb688c00UL, 0xaa83a900UL, 0x737d2500UL, 0x9f324a00UL, 0x46ccc600UL,
+        0xc1e06f00UL, 0x181ee300UL, 0xf4518c00UL, 0x2daf0000UL, 0xaf0f8c00UL, 0x76f10000UL,
+        0x9abe6f00UL, 0x4340e300UL, 0xc46c4a00UL, 0x1d92c600UL, 0xf1dda900UL, 0x28232500UL,
+        0x79c80000UL, 0xa0368c00UL, 0x4c79e300UL, 0x95876f00UL, 0x12abc600UL, 0xcb554a00UL,
+        0x271a2500UL, 0xfee4a900UL, 0x84cc6f00UL, 0x5d32e300UL, 0xb17d8c00UL, 0x68830000UL,
+        0xefafa900UL, 0x36512500UL, 0xda1e4a00UL, 0x03e0c600UL, 0x520be300UL, 0x8bf56f00UL,
+        0x67ba0000UL, 0xbe448c00UL, 0x39682500UL, 0xe096a900UL, 0x0cd9c600UL, 0xd5274a00UL,
+        0xf8884a00UL, 0x2176c600UL, 0xcd39a900UL, 0x14c72500UL, 0x93eb8c00UL, 0x4a150000UL,
+        0xa65a6f00UL, 0x7fa4e300UL, 0x2e4fc600UL, 0xf7b14a00UL, 0x1bfe2500UL, 0xc200a900UL,
+        0x452c0000UL, 0x9cd28c00UL, 0x709de300UL, 0xa9636f00UL, 0xd34ba900UL, 0x0ab52500UL,
+        0xe6fa4a00UL, 0x3f04c600UL, 0xb8286f00UL, 0x61d6e300UL, 0x8d998c00UL, 0x54670000UL,
+        0x058c2500UL, 0xdc72a900UL, 0x303dc600UL, 0xe9c34a00UL, 0x6eefe300UL, 0xb7116f00UL,
+        0x5b5e0000UL, 0x82a08c00UL, 0xd853e300UL, 0x01ad6f00UL, 0xede20000UL, 0x341c8c00UL,
+        0xb3302500UL, 0x6acea900UL, 0x8681c600UL, 0x5f7f4a00UL, 0x0e946f00UL, 0xd76ae300UL,
+        0x3b258c00UL, 0xe2db0000UL, 0x65f7a900UL, 0xbc092500UL, 0x50464a00UL, 0x89b8c600UL,
+        0xf3900000UL, 0x2a6e8c00UL, 0xc621e300UL, 0x1fdf6f00UL, 0x98f3c600UL, 0x410d4a00UL,
+        0xad422500UL, 0x74bca900UL, 0x25578c00UL, 0xfca90000UL, 0x10e66f00UL, 0xc918e300UL,
+        0x4e344a00UL, 0x97cac600UL, 0x7b85a900UL, 0xa27b2500UL, 0x8fd42500UL, 0x562aa900UL,
+        0xba65c600UL, 0x639b4a00UL, 0xe4b7e300UL, 0x3d496f00UL, 0xd1060000UL, 0x08f88c00UL,
+        0x5913a900UL, 0x80ed2500UL, 0x6ca24a00UL, 0xb55cc600UL, 0x32706f00UL, 0xeb8ee300UL,
+        0x07c18c00UL, 0xde3f0000UL, 0xa417c600UL, 0x7de94a00UL, 0x91a62500UL, 0x4858a900UL,
+        0xcf740000UL, 0x168a8c00UL, 0xfac5e300UL, 0x233b6f00UL, 0x72d04a00UL, 0xab2ec600UL,
+        0x4761a900UL, 0x9e9f2500UL, 0x19b38c00UL, 0xc04d0000UL, 0x2c026f00UL, 0xf5fce300UL,
+        0x775c6f00UL, 0xaea2e300UL, 0x42ed8c00UL, 0x9b130000UL, 0x1c3fa900UL, 0xc5c12500UL,
+        0x298e4a00UL, 0xf070c600UL, 0xa19be300UL, 0x78656f00UL, 0x942a0000UL, 0x4dd48c00UL,
+        0xcaf82500UL, 0x1306a900UL, 0xff49c600UL, 0x26b74a00UL, 0x5c9f8c00UL, 0x85610000UL,
+        0x692e6f00UL, 0xb0d0e300UL, 0x37fc4a00UL, 0xee02c600UL, 0x024da900UL, 0xdbb32500UL,
+        0x8a580000UL, 0x53a68c00UL, 0xbfe9e300UL, 0x66176f00UL, 0xe13bc600UL, 0x38c54a00UL,
+        0xd48a2500UL, 0x0d74a900UL, 0x20dba900UL, 0xf9252500UL, 0x156a4a00UL, 0xcc94c600UL,
+        0x4bb86f00UL, 0x9246e300UL, 0x7e098c00UL, 0xa7f70000UL, 0xf61c2500UL, 0x2fe2a900UL,
+        0xc3adc600UL, 0x1a534a00UL, 0x9d7fe300UL, 0x44816f00UL, 0xa8ce0000UL, 0x71308c00UL,
+        0x0b184a00UL, 0xd2e6c600UL, 0x3ea9a900UL, 0xe7572500UL, 0x607b8c00UL, 0xb9850000UL,
+        0x55ca6f00UL, 0x8c34e300UL, 0xdddfc600UL, 0x04214a00UL, 0xe86e2500UL, 0x3190a900UL,
+        0xb6bc0000UL, 0x6f428c00UL, 0x830de300UL, 0x5af36f00UL},
+    {
+        0x00000000UL, 0x36eb3d00UL, 0x6dd67a00UL, 0x5b3d4700UL, 0xdbacf400UL, 0xed47c900UL,
+        0xb67a8e00UL, 0x8091b300UL, 0x31151300UL, 0x07fe2e00UL, 0x5cc36900UL, 0x6a285400UL,
+        0xeab9e700UL, 0xdc52da00UL, 0x876f9d00UL, 0xb184a000UL, 0x622a2600UL, 0x54c11b00UL,
+        0x0ffc5c00UL, 0x39176100UL, 0xb986d200UL, 0x8f6def00UL, 0xd450a800UL, 0xe2bb9500UL,
+        0x533f3500UL, 0x65d40800UL, 0x3ee94f00UL, 0x08027200UL, 0x8893c100UL, 0xbe78fc00UL,
+        0xe545bb00UL, 0xd3ae8600UL, 0xc4544c00UL, 0xf2bf7100UL, 0xa9823600UL, 0x9f690b00UL,
+        0x1ff8b800UL, 0x29138500UL, 0x722ec200UL, 0x44c5ff00UL, 0xf5415f00UL, 0xc3aa6200UL,
+        0x98972500UL, 0xae7c1800UL, 0x2eedab00UL, 0x18069600UL, 0x433bd100UL, 0x75d0ec00UL,
+        0xa67e6a00UL, 0x90955700UL, 0xcba81000UL, 0xfd432d00UL, 0x7dd29e00UL, 0x4b39a300UL,
+        0x1004e400UL, 0x26efd900UL, 0x976b7900UL, 0xa1804400UL, 0xfabd0300UL, 0xcc563e00UL,
+        0x4cc78d00UL, 0x7a2cb000UL, 0x2111f700UL, 0x17faca00UL, 0x0ee46300UL, 0x380f5e00UL,
+        0x63321900UL, 0x55d92400UL, 0xd5489700UL, 0xe3a3aa00UL, 0xb89eed00UL, 0x8e75d000UL,
+        0x3ff17000UL, 0x091a4d00UL, 0x52270a00UL, 0x64cc3700UL, 0xe45d8400UL, 0xd2b6b900UL,
+        0x898bfe00UL, 0xbf60c300UL, 0x6cce4500UL, 0x5a257800UL, 0x01183f00UL, 0x37f30200UL,
+        0xb762b100UL, 0x81898c00UL, 0xdab4cb00UL, 0xec5ff600UL, 0x5ddb5600UL, 0x6b306b00UL,
+        0x300d2c00UL, 0x06e61100UL, 0x8677a200UL, 0xb09c9f00UL, 0xeba1d800UL, 0xdd4ae500UL,
+        0xcab02f00UL, 0xfc5b1200UL, 0xa7665500UL, 0x918d6800UL, 0x111cdb00UL, 0x27f7e600UL,
+        0x7ccaa100UL, 0x4a219c00UL, 0xfba53c00UL, 0xcd4e0100UL, 0x96734600UL, 0xa0987b00UL,
+        0x2009c800UL, 0x16e2f500UL, 0x4ddfb200UL, 0x7b348f00UL, 0xa89a0900UL, 0x9e713400UL,
+        0xc54c7300UL, 0xf3a74e00UL, 0x7336fd00UL, 0x45ddc000UL, 0x1ee08700UL, 0x280bba00UL,
+        0x998f1a00UL, 0xaf642700UL, 0xf4596000UL, 0xc2b25d00UL, 0x4223ee00UL, 0x74c8d300UL,
+        0x2ff59400UL, 0x191ea900UL, 0x1dc8c600UL, 0x2b23fb00UL, 0x701ebc00UL, 0x46f58100UL,
+        0xc6643200UL, 0xf08f0f00UL, 0xabb24800UL, 0x9d597500UL, 0x2cddd500UL, 0x1a36e800UL,
+        0x410baf00UL, 0x77e09200UL, 0xf7712100UL, 0xc19a1c00UL, 0x9aa75b00UL, 0xac4c6600UL,
+        0x7fe2e000UL, 0x4909dd00UL, 0x12349a00UL, 0x24dfa700UL, 0xa44e1400UL, 0x92a52900UL,
+        0xc9986e00UL, 0xff735300UL, 0x4ef7f300UL, 0x781cce00UL, 0x23218900UL, 0x15cab400UL,
+        0x955b0700UL, 0xa3b03a00UL, 0xf88d7d00UL, 0xce664000UL, 0xd99c8a00UL, 0xef77b700UL,
+        0xb44af000UL, 0x82a1cd00UL, 0x02307e00UL, 0x34db4300UL, 0x6fe60400UL, 0x590d3900UL,
+        0xe8899900UL, 0xde62a400UL, 0x855fe300UL, 0xb3b4de00UL, 0x33256d00UL, 0x05ce5000UL,
+        0x5ef31700UL, 0x68182a00UL, 0xbbb6ac00UL, 0x8d5d9100UL, 0xd660d600UL, 0xe08beb00UL,
+        0x601a5800UL, 0x56f16500UL, 0x0dcc2200UL, 0x3b271f00UL, 0x8aa3bf00UL, 0xbc488200UL,
+        0xe775c500UL, 0xd19ef800UL, 0x510f4b00UL, 0x67e47600UL, 0x3cd93100UL, 0x0a320c00UL,
+        0x132ca500UL, 0x25c79800UL, 0x7efadf00UL, 0x4811e200UL, 0xc8805100UL, 0xfe6b6c00UL,
+        0xa5562b00UL, 0x93bd1600UL, 0x2239b600UL, 0x14d28b00UL, 0x4fefcc00UL, 0x7904f100UL,
+        0xf9954200UL, 0xcf7e7f00UL, 0x94433800UL, 0xa2a80500UL, 0x71068300UL, 0x47edbe00UL,
+        0x1cd0f900UL, 0x2a3bc400UL, 0xaaaa7700UL, 0x9c414a00UL, 0xc77c0d00UL, 0xf1973000UL,
+        0x40139000UL, 0x76f8ad00UL, 0x2dc5ea00UL, 0x1b2ed700UL, 0x9bbf6400UL, 0xad545900UL,
+        0xf6691e00UL, 0xc0822300UL, 0xd778e900UL, 0xe193d400UL, 0xbaae9300UL, 0x8c45ae00UL,
+        0x0cd41d00UL, 0x3a3f2000UL, 0x61026700UL, 0x57e95a00UL, 0xe66dfa00UL, 0xd086c700UL,
+        0x8bbb8000UL, 0xbd50bd00UL, 0x3dc10e00UL, 0x0b2a3300UL, 0x50177400UL, 0x66fc4900UL,
+        0xb552cf00UL, 0x83b9f200UL, 0xd884b500UL, 0xee6f8800UL, 0x6efe3b00UL, 0x58150600UL,
+        0x03284100UL, 0x35c37c00UL, 0x8447dc00UL, 0xb2ace100UL, 0xe991a600UL, 0xdf7a9b00UL,
+        0x5feb2800UL, 0x69001500UL, 0x323d5200UL, 0x04d66f00UL},
+    {
+        0x00000000UL, 0x3b918c00UL, 0x77231800UL, 0x4cb29400UL, 0xee463000UL, 0xd5d7bc00UL,
+        0x99652800UL, 0xa2f4a400UL, 0x5ac09b00UL, 0x61511700UL, 0x2de38300UL, 0x16720f00UL,
+        0xb486ab00UL, 0x8f172700UL, 0xc3a5b300UL, 0xf8343f00UL, 0xb5813600UL, 0x8e10ba00UL,
+        0xc2a22e00UL, 0xf933a200UL, 0x5bc70600UL, 0x60568a00UL, 0x2ce41e00UL, 0x17759200UL,
+        0xef41ad00UL, 0xd4d02100UL, 0x9862b500UL, 0xa3f33900UL, 0x01079d00UL, 0x3a961100UL,
+        0x76248500UL, 0x4db50900UL, 0xed4e9700UL, 0xd6df1b00UL, 0x9a6d8f00UL, 0xa1fc0300UL,
+        0x0308a700UL, 0x38992b00UL, 0x742bbf00UL, 0x4fba3300UL, 0xb78e0c00UL, 0x8c1f8000UL,
+        0xc0ad1400UL, 0xfb3c9800UL, 0x59c83c00UL, 0x6259b000UL, 0x2eeb2400UL, 0x157aa800UL,
+        0x58cfa100UL, 0x635e2d00UL, 0x2fecb900UL, 0x147d3500UL, 0xb6899100UL, 0x8d181d00UL,
+        0xc1aa8900UL, 0xfa3b0500UL, 0x020f3a00UL, 0x399eb600UL, 0x752c2200UL, 0x4ebdae00UL,
+        0xec490a00UL, 0xd7d88600UL, 0x9b6a1200UL, 0xa0fb9e00UL, 0x5cd1d500UL, 0x67405900UL,
+        0x2bf2cd00UL, 0x10634100UL, 0xb297e500UL, 0x89066900UL, 0xc5b4fd00UL, 0xfe257100UL,
+        0x06114e00UL, 0x3d80c200UL, 0x71325600UL, 0x4aa3da00UL, 0xe8577e00UL, 0xd3c6f200UL,
+        0x9f746600UL, 0xa4e5ea00UL, 0xe950e300UL, 0xd2c16f00UL, 0x9e73fb00UL, 0xa5e27700UL,
+        0x0716d300UL, 0x3c875f00UL, 0x7035cb00UL, 0x4ba44700UL, 0xb3907800UL, 0x8801f400UL,
+        0xc4b36000UL, 0xff22ec00UL, 0x5dd64800UL, 0x6647c400UL, 0x2af55000UL, 0x1164dc00UL,
+        0xb19f4200UL, 0x8a0ece00UL, 0xc6bc5a00UL, 0xfd2dd600UL, 0x5fd97200UL, 0x6448fe00UL,
+        0x28fa6a00UL, 0x136be600UL, 0xeb5fd900UL, 0xd0ce5500UL, 0x9c7cc100UL, 0xa7ed4d00UL,
+        0x0519e900UL, 0x3e886500UL, 0x723af100UL, 0x49ab7d00UL, 0x041e7400UL, 0x3f8ff800UL,
+        0x733d6c00UL, 0x48ace000UL, 0xea584400UL, 0xd1c9c800UL, 0x9d7b5c00UL, 0xa6ead000UL,
+        0x5edeef00UL, 0x654f6300UL, 0x29fdf700UL, 0x126c7b00UL, 0xb098df00UL, 0x8b095300UL,
+        0xc7bbc700UL, 0xfc2a4b00UL, 0xb9a3aa00UL, 0x82322600UL, 0xce80b200UL, 0xf5113e00UL,
+        0x57e59a00UL, 0x6c741600UL, 0x20c68200UL, 0x1b570e00UL, 0xe3633100UL, 0xd8f2bd00UL,
+        0x94402900UL, 0xafd1a500UL, 0x0d250100UL, 0x36b48d00UL, 0x7a061900UL, 0x41979500UL,
+        0x0c229c00UL, 0x37b31000UL, 0x7b018400UL, 0x40900800UL, 0xe264ac00UL, 0xd9f52000UL,
+        0x9547b400UL, 0xaed63800UL, 0x56e20700UL, 0x6d738b00UL, 0x21c11f00UL, 0x1a509300UL,
+        0xb8a43700UL, 0x8335bb00UL, 0xcf872f00UL, 0xf416a300UL, 0x54ed3d00UL, 0x6f7cb100UL,
+        0x23ce2500UL, 0x185fa900UL, 0xbaab0d00UL, 0x813a8100UL, 0xcd881500UL, 0xf6199900UL,
+        0x0e2da600UL, 0x35bc2a00UL, 0x790ebe00UL, 0x429f3200UL, 0xe06b9600UL, 0xdbfa1a00UL,
+        0x97488e00UL, 0xacd90200UL, 0xe16c0b00UL, 0xdafd8700UL, 0x964f1300UL, 0xadde9f00UL,
+        0x0f2a3b00UL, 0x34bbb700UL, 0x78092300UL, 0x4398af00UL, 0xbbac9000UL, 0x803d1c00UL,
+        0xcc8f8800UL, 0xf71e0400UL, 0x55eaa000UL, 0x6e7b2c00UL, 0x22c9b800UL, 0x19583400UL,
+        0xe5727f00UL, 0xdee3f300UL, 0x92516700UL, 0xa9c0eb00UL, 0x0b344f00UL, 0x30a5c300UL,
+        0x7c175700UL, 0x4786db00UL, 0xbfb2e400UL, 0x84236800UL, 0xc891fc00UL, 0xf3007000UL,
+        0x51f4d400UL, 0x6a655800UL, 0x26d7cc00UL, 0x1d464000UL, 0x50f34900UL, 0x6b62c500UL,
+        0x27d05100UL, 0x1c41dd00UL, 0xbeb57900UL, 0x8524f500UL, 0xc9966100UL, 0xf207ed00UL,
+        0x0a33d200UL, 0x31a25e00UL, 0x7d10ca00UL, 0x46814600UL, 0xe475e200UL, 0xdfe46e00UL,
+        0x9356fa00UL, 0xa8c77600UL, 0x083ce800UL, 0x33ad6400UL, 0x7f1ff000UL, 0x448e7c00UL,
+        0xe67ad800UL, 0xddeb5400UL, 0x9159c000UL, 0xaac84c00UL, 0x52fc7300UL, 0x696dff00UL,
+        0x25df6b00UL, 0x1e4ee700UL, 0xbcba4300UL, 0x872bcf00UL, 0xcb995b00UL, 0xf008d700UL,
+        0xbdbdde00UL, 0x862c5200UL, 0xca9ec600UL, 0xf10f4a00UL, 0x53fbee00UL, 0x686a6200UL,
+        0x24d8f600UL, 0x1f497a00UL, 0xe77d4500UL, 0xdcecc900UL, 0x905e5d00UL, 0xabcfd100UL,
+        0x093b7500UL, 0x32aaf900UL, 0x7e186d00UL, 0x4589e100UL},
+    {
+        0x00000000UL, 0xf50baf00UL, 0x6c5ba500UL, 0x99500a00UL, 0xd8b74a00UL, 0x2dbce500UL,
+        0xb4ecef00UL, 0x41e74000UL, 0x37226f00UL, 0xc229c000UL, 0x5b79ca00UL, 0xae726500UL,
+        0xef952500UL, 0x1a9e8a00UL, 0x83ce8000UL, 0x76c52f00UL, 0x6e44de00UL, 0x9b4f7100UL,
+        0x021f7b00UL, 0xf714d400UL, 0xb6f39400UL, 0x43f83b00UL, 0xdaa83100UL, 0x2fa39e00UL,
+        0x5966b100UL, 0xac6d1e00UL, 0x353d1400UL, 0xc036bb00UL, 0x81d1fb00UL, 0x74da5400UL,
+        0xed8a5e00UL, 0x1881f100UL, 0xdc89bc00UL, 0x29821300UL, 0xb0d21900UL, 0x45d9b600UL,
+        0x043ef600UL, 0xf1355900UL, 0x68655300UL, 0x9d6efc00UL, 0xebabd300UL, 0x1ea07c00UL,
+        0x87f07600UL, 0x72fbd900UL, 0x331c9900UL, 0xc6173600UL, 0x5f473c00UL, 0xaa4c9300UL,
+        0xb2cd6200UL, 0x47c6cd00UL, 0xde96c700UL, 0x2b9d6800UL, 0x6a7a2800UL, 0x9f718700UL,
+        0x06218d00UL, 0xf32a2200UL, 0x85ef0d00UL, 0x70e4a200UL, 0xe9b4a800UL, 0x1cbf0700UL,
+        0x5d584700UL, 0xa853e800UL, 0x3103e200UL, 0xc4084d00UL, 0x3f5f8300UL, 0xca542c00UL,
+        0x53042600UL, 0xa60f8900UL, 0xe7e8c900UL, 0x12e36600UL, 0x8bb36c00UL, 0x7eb8c300UL,
+        0x087dec00UL, 0xfd764300UL, 0x64264900UL, 0x912de600UL, 0xd0caa600UL, 0x25c10900UL,
+        0xbc910300UL, 0x499aac00UL, 0x511b5d00UL, 0xa410f200UL, 0x3d40f800UL, 0xc84b5700UL,
+        0x89ac1700UL, 0x7ca7b800UL, 0xe5f7b200UL, 0x10fc1d00UL, 0x66393200UL, 0x93329d00UL,
+        0x0a629700UL, 0xff693800UL, 0xbe8e7800UL, 0x4b85d700UL, 0xd2d5dd00UL, 0x27de7200UL,
+        0xe3d63f00UL, 0x16dd9000UL, 0x8f8d9a00UL, 0x7a863500UL, 0x3b617500UL, 0xce6ada00UL,
+        0x573ad000UL, 0xa2317f00UL, 0xd4f45000UL, 0x21ffff00UL, 0xb8aff500UL, 0x4da45a00UL,
+        0x0c431a00UL, 0xf948b500UL, 0x6018bf00UL, 0x95131000UL, 0x8d92e100UL, 0x78994e00UL,
+        0xe1c94400UL, 0x14c2eb00UL, 0x5525ab00UL, 0xa02e0400UL, 0x397e0e00UL, 0xcc75a100UL,
+        0xbab08e00UL, 0x4fbb2100UL, 0xd6eb2b00UL, 0x23e08400UL, 0x6207c400UL, 0x970c6b00UL,
+        0x0e5c6100UL, 0xfb57ce00UL, 0x7ebf0600UL, 0x8bb4a900UL, 0x12e4a300UL, 0xe7ef0c00UL,
+        0xa6084c00UL, 0x5303e300UL, 0xca53e900UL, 0x3f584600UL, 0x499d6900UL, 0xbc96c600UL,
+        0x25c6cc00UL, 0xd0cd6300UL, 0x912a2300UL, 0x64218c00UL, 0xfd718600UL, 0x087a2900UL,
+        0x10fbd800UL, 0xe5f07700UL, 0x7ca07d00UL, 0x89abd200UL, 0xc84c9200UL, 0x3d473d00UL,
+        0xa4173700UL, 0x511c9800UL, 0x27d9b700UL, 0xd2d21800UL, 0x4b821200UL, 0xbe89bd00UL,
+        0xff6efd00UL, 0x0a655200UL, 0x93355800UL, 0x663ef700UL, 0xa236ba00UL, 0x573d1500UL,
+        0xce6d1f00UL, 0x3b66b000UL, 0x7a81f000UL, 0x8f8a5f00UL, 0x16da5500UL, 0xe3d1fa00UL,
+        0x9514d500UL, 0x601f7a00UL, 0xf94f7000UL, 0x0c44df00UL, 0x4da39f00UL, 0xb8a83000UL,
+        0x21f83a00UL, 0xd4f39500UL, 0xcc726400UL, 0x3979cb00UL, 0xa029c100UL, 0x55226e00UL,
+        0x14c52e00UL, 0xe1ce8100UL, 0x789e8b00UL, 0x8d952400UL, 0xfb500b00UL, 0x0e5ba400UL,
+        0x970bae00UL, 0x62000100UL, 0x23e74100UL, 0xd6ecee00UL, 0x4fbce400UL, 0xbab74b00UL,
+        0x41e08500UL, 0xb4eb2a00UL, 0x2dbb2000UL, 0xd8b08f00UL, 0x9957cf00UL, 0x6c5c6000UL,
+        0xf50c6a00UL, 0x0007c500UL, 0x76c2ea00UL, 0x83c94500UL, 0x1a994f00UL, 0xef92e000UL,
+        0xae75a000UL, 0x5b7e0f00UL, 0xc22e0500UL, 0x3725aa00UL, 0x2fa45b00UL, 0xdaaff400UL,
+        0x43fffe00UL, 0xb6f45100UL, 0xf7131100UL, 0x0218be00UL, 0x9b48b400UL, 0x6e431b00UL,
+        0x18863400UL, 0xed8d9b00UL, 0x74dd9100UL, 0x81d63e00UL, 0xc0317e00UL, 0x353ad100UL,
+        0xac6adb00UL, 0x59617400UL, 0x9d693900UL, 0x68629600UL, 0xf1329c00UL, 0x04393300UL,
+        0x45de7300UL, 0xb0d5dc00UL, 0x2985d600UL, 0xdc8e7900UL, 0xaa4b5600UL, 0x5f40f900UL,
+        0xc610f300UL, 0x331b5c00UL, 0x72fc1c00UL, 0x87f7b300UL, 0x1ea7b900UL, 0xebac1600UL,
+        0xf32de700UL, 0x06264800UL, 0x9f764200UL, 0x6a7ded00UL, 0x2b9aad00UL, 0xde910200UL,
+        0x47c10800UL, 0xb2caa700UL, 0xc40f8800UL, 0x31042700UL, 0xa8542d00UL, 0x5d5f8200UL,
+        0x1cb8c200UL, 0xe9b36d00UL, 0x70e36700UL, 0x85e8c800UL},
+#endif
+};
+#endif /* CRC24Q_SLICE > 0 */
+
+#if CRC24Q_SLICE >= 4
+static inline uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+#endif
+
+uint32_t crc24q_update(uint32_t crc, const void *data, size_t len) {
+    DEV_ASSERT(data != NULL || len == 0);
+
+    const uint8_t *p = data;
+
+#if CRC24Q_SLICE == 0
+    crc &= 0xFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint32_t)p[i] << 16;
+
+        for (int j = 0; j < 8; j++) {
+            crc <<= 1;
+            if (crc & 0x1000000) {
+                crc ^= CRC24Q_POLY;
+            }
+        }
+    }
+    return crc & 0xFFFFFF;
+#else
+    uint32_t c = (crc & 0xFFFFFF) << 8; /* 상위 정렬 */
+
+#if CRC24Q_SLICE == 8
+    for (; len >= 8; len -= 8, p += 8) {
+        uint32_t hi = c ^ load_be32(p);
+        uint32_t lo = load_be32(p + 4);
+
+        c = crc24q_table[7][hi >> 24] ^ crc24q_table[6][(hi >> 16) & 0xFF] ^
+            crc24q_table[5][(hi >> 8) & 0xFF] ^ crc24q_table[4][hi & 0xFF] ^
+            crc24q_table[3][lo >> 24] ^ crc24q_table[2][(lo >> 16) & 0xFF] ^
+            crc24q_table[1][(lo >> 8) & 0xFF] ^ crc24q_table[0][lo & 0xFF];
+    }
+#endif
+#if CRC24Q_SLICE >= 4
+    for (; len >= 4; len -= 4, p += 4) {
+        c ^= load_be32(p);
+        c = crc24q_table[3][c >> 24] ^ crc24q_table[2][(c >> 16) & 0xFF] ^
+            crc24q_table[1][(c >> 8) & 0xFF] ^ crc24q_table[0][c & 0xFF];
+    }
+#endif
+    for (; len > 0; len--, p++) {
+        c = (c << 8) ^ crc24q_table[0][(c >> 24) ^ *p];
+    }
+    return c >> 8;
+#endif
+}
+
+/*===========================================================================
+ * CRC32 (Unicore binary)
+ *===========================================================================*/
+
+/*
+ * crc32_table[k][b] = 바이트 b 뒤에 0 바이트 k개가 이어질 때의 CRC
+ * (reflected 0xEDB88320, LSB 우선). [0]은 바이트 단위 테이블
+ */
+static const uint32_t crc32_table[8][256] = {
+    {
+        0x00000000UL, 0x77073096UL, 0xee0e612cUL, 0x990951baUL, 0x076dc419UL, 0x706af48fUL,
+        0xe963a535UL, 0x9e6495a3UL, 0x0edb8832UL, 0x79dcb8a4UL, 0xe0d5e91eUL, 0x97d2d988UL,
+        0x09b64c2bUL, 0x7eb17cbdUL, 0xe7b82d07UL, 0x90bf1d91UL, 0x1db71064UL, 0x6ab020f2UL,
+        0xf3b97148UL, 0x84be41deUL, 0x1adad47dUL, 0x6ddde4ebUL, 0xf4d4b551UL, 0x83d385c7UL,
+        0x136c9856UL, 0x646ba8c0UL, 0xfd62f97aUL, 0x8a65c9ecUL, 0x14015c4fUL, 0x63066cd9UL,
+        0xfa0f3d63UL, 0x8d080df5UL, 0x3b6e20c8UL, 0x4c69105eUL, 0xd56041e4UL, 0xa2677172UL,
+        0x3c03e4d1UL, 0x4b04d447UL, 0xd20d85fdUL, 0xa50ab56bUL, 0x35b5a8faUL, 0x42b2986cUL,
+        0xdbbbc9d6UL, 0xacbcf940UL, 0x32d86ce3UL, 0x45df5c75UL, 0xdcd60dcfUL, 0xabd13d59UL,
+        0x26d930acUL, 0x51de003aUL, 0xc8d75180UL, 0xbfd06116UL, 0x21b4f4b5UL, 0x56b3c423UL,
+        0xcfba9599UL, 0xb8bda50fUL, 0x2802b89eUL, 0x5f058808UL, 0xc60cd9b2UL, 0xb10be924UL,
+        0x2f6f7c87UL, 0x58684c11UL, 0xc1611dabUL, 0xb6662d3dUL, 0x76dc4190UL, 0x01db7106UL,
+        0x98d220bcUL, 0xefd5102aUL, 0x71b18589UL, 0x06b6b51fUL, 0x9fbfe4a5UL, 0xe8b8d433UL,
+        0x7807c9a2UL, 0x0f00f934UL, 0x9609a88eUL, 0xe10e9818UL, 0x7f6a0dbbUL, 0x086d3d2dUL,
+        0x91646c97UL, 0xe6635c01UL, 0x6b6b51f4UL, 0x1c6c6162UL, 0x856530d8UL, 0xf262004eUL,
+        0x6c0695edUL, 0x1b01a57bUL, 0x8208f4c1UL, 0xf50fc457UL, 0x65b0d9c6UL, 0x12b7e950UL,
+        0x8bbeb8eaUL, 0xfcb9887cUL, 0x62dd1ddfUL, 0x15da2d49UL, 0x8cd37cf3UL, 0xfbd44c65UL,
+        0x4db26158UL, 0x3ab551ceUL, 0xa3bc0074UL, 0xd4bb30e2UL, 0x4adfa541UL, 0x3dd895d7UL,
+        0xa4d1c46dUL, 0xd3d6f4fbUL, 0x4369e96aUL, 0x346ed9fcUL, 0xad678846UL, 0xda60b8d0UL,
+        0x44042d73UL, 0x33031de5UL, 0xaa0a4c5fUL, 0xdd0d7cc9UL, 0x5005713cUL, 0x270241aaUL,
+        0xbe0b1010UL, 0xc90c2086UL, 0x5768b525UL, 0x206f85b3UL, 0xb966d409UL, 0xce61e49fUL,
+        0x5edef90eUL, 0x29d9c998UL, 0xb0d09822UL, 0xc7d7a8b4UL, 0x59b33d17UL, 0x2eb40d81UL,
+        0xb7bd5c3bUL, 0xc0ba6cadUL, 0xedb88320UL, 0x9abfb3b6UL, 0x03b6e20cUL, 0x74b1d29aUL,
+        0xead54739UL, 0x9dd277afUL, 0x04db2615UL, 0x73dc1683UL, 0xe3630b12UL, 0x94643b84UL,
+        0x0d6d6a3eUL, 0x7a6a5aa8UL, 0xe40ecf0bUL, 0x9309ff9dUL, 0x0a00ae27UL, 0x7d079eb1UL,
+        0xf00f9344UL, 0x8708a3d2UL, 0x1e01f268UL, 0x6906c2feUL, 0xf762575dUL, 0x806567cbUL,
+        0x196c3671UL, 0x6e6b06e7UL, 0xfed41b76UL, 0x89d32be0UL, 0x10da7a5aUL, 0x67dd4accUL,
+        0xf9b9df6fUL, 0x8ebeeff9UL, 0x17b7be43UL, 0x60b08ed5UL, 0xd6d6a3e8UL, 0xa1d1937eUL,
+        0x38d8c2c4UL, 0x4fdff252UL, 0xd1bb67f1UL, 0xa6bc5767UL, 0x3fb506ddUL, 0x48b2364bUL,
+        0xd80d2bdaUL, 0xaf0a1b4cUL, 0x36034af6UL, 0x41047a60UL, 0xdf60efc3UL, 0xa867df55UL,
+        0x316e8eefUL, 0x4669be79UL, 0xcb61b38cUL, 0xbc66831aUL, 0x256fd2a0UL, 0x5268e236UL,
+        0xcc0c7795UL, 0xbb0b4703UL, 0x220216b9UL, 0x5505262fUL, 0xc5ba3bbeUL, 0xb2bd0b28UL,
+        0x2bb45a92UL, 0x5cb36a04UL, 0xc2d7ffa7UL, 0xb5d0cf31UL, 0x2cd99e8bUL, 0x5bdeae1dUL,
+        0x9b64c2b0UL, 0xec63f226UL, 0x756aa39cUL, 0x026d930aUL, 0x9c0906a9UL, 0xeb0e363fUL,
+        0x72076785UL, 0x05005713UL, 0x95bf4a82UL, 0xe2b87a14UL, 0x7bb12baeUL, 0x0cb61b38UL,
+        0x92d28e9bUL, 0xe5d5be0dUL, 0x7cdcefb7UL, 0x0bdbdf21UL, 0x86d3d2d4UL, 0xf1d4e242UL,
+        0x68ddb3f8UL, 0x1fda836eUL, 0x81be16cdUL, 0xf6b9265bUL, 0x6fb077e1UL, 0x18b74777UL,
+        0x88085ae6UL, 0xff0f6a70UL, 0x66063bcaUL, 0x11010b5cUL, 0x8f659effUL, 0xf862ae69UL,
+        0x616bffd3UL, 0x166ccf45UL, 0xa00ae278UL, 0xd70dd2eeUL, 0x4e048354UL, 0x3903b3c2UL,
+        0xa7672661UL, 0xd06016f7UL, 0x4969474dUL, 0x3e6e77dbUL, 0xaed16a4aUL, 0xd9d65adcUL,
+        0x40df0b66UL, 0x37d83bf0UL, 0xa9bcae53UL, 0xdebb9ec5UL, 0x47b2cf7fUL, 0x30b5ffe9UL,
+        0xbdbdf21cUL, 0xcabac28aUL, 0x53b39330UL, 0x24b4a3a6UL, 0xbad03605UL, 0xcdd70693UL,
+        0x54de5729UL, 0x23d967bfUL, 0xb3667a2eUL, 0xc4614ab8UL, 0x5d681b02UL, 0x2a6f2b94UL,
+        0xb40bbe37UL, 0xc30c8ea1UL, 0x5a05df1bUL, 0x2d02ef8dUL},
+    {
+        0x00000000UL, 0x191b3141UL, 0x32366282UL, 0x2b2d53c3UL, 0x646cc504UL, 0x7d77f445UL,
+        0x565aa786UL, 0x4f4196c7UL, 0xc8d98a08UL, 0xd1c2bb49UL, 0xfaefe88aUL, 0xe3f4d9cbUL,
+        0xacb54f0cUL, 0xb5ae7e4dUL, 0x9e832d8eUL, 0x87981ccfUL, 0x4ac21251UL, 0x53d92310UL,
+        0x78f470d3UL, 0x61ef4192UL, 0x2eaed755UL, 0x37b5e614UL, 0x1c98b5d7UL, 0x05838496UL,
+        0x821b9859UL, 0x9b00a918UL, 0xb02dfadbUL, 0xa936cb9aUL, 0xe6775d5dUL, 0xff6c6c1cUL,
+        0xd4413fdfUL, 0xcd5a0e9eUL, 0x958424a2UL, 0x8c9f15e3UL, 0xa7b24620UL, 0xbea97761UL,
+        0xf1e8e1a6UL, 0xe8f3d0e7UL, 0xc3de8324UL, 0xdac5b265UL, 0x5d5daeaaUL, 0x44469febUL,
+        0x6f6bcc28UL, 0x7670fd69UL, 0x39316baeUL, 0x202a5aefUL, 0x0b07092cUL, 0x121c386dUL,
+        0xdf4636f3UL, 0xc65d07b2UL, 0xed705471UL, 0xf46b6530UL, 0xbb2af3f7UL, 0xa231c2b6UL,
+        0x891c9175UL, 0x9007a034UL, 0x179fbcfbUL, 0x0e848dbaUL, 0x25a9de79UL, 0x3cb2ef38UL,
+        0x73f379ffUL, 0x6ae848beUL, 0x41c51b7dUL, 0x58de2a3cUL, 0xf0794f05UL, 0xe9627e44UL,
+        0xc24f2d87UL, 0xdb541cc6UL, 0x94158a01UL, 0x8d0ebb40UL, 0xa623e883UL, 0xbf38d9c2UL,
+        0x38a0c50dUL, 0x21bbf44cUL, 0x0a96a78fUL, 0x138d96ceUL, 0x5ccc0009UL, 0x45d73148UL,
+        0x6efa628bUL, 0x77e153caUL, 0xbabb5d54UL, 0xa3a06c15UL, 0x888d3fd6UL, 0x91960e97UL,
+        0xded79850UL, 0xc7cca911UL, 0xece1fad2UL, 0xf5facb93UL, 0x7262d75cUL, 0x6b79e61dUL,
+        0x4054b5deUL, 0x594f849fUL, 0x160e1258UL, 0x0f152319UL, 0x243870daUL, 0x3d23419bUL,
+        0x65fd6ba7UL, 0x7ce65ae6UL, 0x57cb0925UL, 0x4ed03864UL, 0x0191aea3UL, 0x188a9fe2UL,
+        0x33a7cc21UL, 0x2abcfd60UL, 0xad24e1afUL, 0xb43fd0eeUL, 0x9f12832dUL, 0x8609b26cUL,
+        0xc94824abUL, 0xd05315eaUL, 0xfb7e4629UL, 0xe2657768UL, 0x2f3f79f6UL, 0x362448b7UL,
+        0x1d091b74UL, 0x04122a35UL, 0x4b53bcf2UL, 0x52488db3UL, 0x7965de70UL, 0x607eef31UL,
+        0xe7e6f3feUL, 0xfefdc2bfUL, 0xd5d0917cUL, 0xcccba03dUL, 0x838a36faUL, 0x9a9107bbUL,
+        0xb1bc5478UL, 0xa8a76539UL, 0x3b83984bUL, 0x2298a90aUL, 0x09b5fac9UL, 0x10aecb88UL,
+        0x5fef5d4fUL, 0x46f46c0eUL, 0x6dd93fcdUL, 0x74c20e8cUL, 0xf35a1243UL, 0xea412302UL,
+        0xc16c70c1UL, 0xd8774180UL, 0x9736d747UL, 0x8e2de606UL, 0xa500b5c5UL, 0xbc1b8484UL,
+        0x71418a1aUL, 0x685abb5bUL, 0x4377e898UL, 0x5a6cd9d9UL, 0x152d4f1eUL, 0x0c367e5fUL,
+        0x271b2d9cUL, 0x3e001cddUL, 0xb9980012UL, 0xa0833153UL, 0x8bae6290UL, 0x92b553d1UL,
+        0xddf4c516UL, 0xc4eff457UL, 0xefc2a794UL, 0xf6d996d5UL, 0xae07bce9UL, 0xb71c8da8UL,
+        0x9c31de6bUL, 0x852aef2aUL, 0xca6b79edUL, 0xd37048acUL, 0xf85d1b6fUL, 0xe1462a2eUL,
+        0x66de36e1UL, 0x7fc507a0UL, 0x54e85463UL, 0x4df36522UL, 0x02b2f3e5UL, 0x1ba9c2a4UL,
+        0x30849167UL, 0x299fa026UL, 0xe4c5aeb8UL, 0xfdde9ff9UL, 0xd6f3cc3aUL, 0xcfe8fd7bUL,
+        0x80a96bbcUL, 0x99b25afdUL, 0xb29f093eUL, 0xab84387fUL, 0x2c1c24b0UL, 0x350715f1UL,
+        0x1e2a4632UL, 0x07317773UL, 0x4870e1b4UL, 0x516bd0f5UL, 0x7a468336UL, 0x635db277UL,
+        0xcbfad74eUL, 0xd2e1e60fUL, 0xf9ccb5ccUL, 0xe0d7848dUL, 0xaf96124aUL, 0xb68d230bUL,
+        0x9da070c8UL, 0x84bb4189UL, 0x03235d46UL, 0x1a386c07UL, 0x31153fc4UL, 0x280e0e85UL,
+        0x674f9842UL, 0x7e54a903UL, 0x5579fac0UL, 0x4c62cb81UL, 0x8138c51fUL, 0x9823f45eUL,
+        0xb30ea79dUL, 0xaa1596dcUL, 0xe554001bUL, 0xfc4f315aUL, 0xd7626299UL, 0xce7953d8UL,
+        0x49e14f17UL, 0x50fa7e56UL, 0x7bd72d95UL, 0x62cc1cd4UL, 0x2d8d8a13UL, 0x3496bb52UL,
+        0x1fbbe891UL, 0x06a0d9d0UL, 0x5e7ef3ecUL, 0x4765c2adUL, 0x6c48916eUL, 0x7553a02fUL,
+        0x3a1236e8UL, 0x230907a9UL, 0x0824546aUL, 0x113f652bUL, 0x96a779e4UL, 0x8fbc48a5UL,
+        0xa4911b66UL, 0xbd8a2a27UL, 0xf2cbbce0UL, 0xebd08da1UL, 0xc0fdde62UL, 0xd9e6ef23UL,
+        0x14bce1bdUL, 0x0da7d0fcUL, 0x268a833fUL, 0x3f91b27eUL, 0x70d024b9UL, 0x69cb15f8UL,
+        0x42e6463bUL, 0x5bfd777aUL, 0xdc656bb5UL, 0xc57e5af4UL, 0xee530937UL, 0xf7483876UL,
+        0xb809aeb1UL, 0xa1129ff0UL, 0x8a3fcc33UL, 0x9324fd72UL},
+    {
+        0x00000000UL, 0x01c26a37UL, 0x0384d46eUL, 0x0246be59UL, 0x0709a8dcUL, 0x06cbc2ebUL,
+        0x048d7cb2UL, 0x054f1685UL, 0x0e1351b8UL, 0x0fd13b8fUL, 0x0d9785d6UL, 0x0c55efe1UL,
+        0x091af964UL, 0x08d89353UL, 0x0a9e2d0aUL, 0x0b5c473dUL, 0x1c26a370UL, 0x1de4c947UL,
+        0x1fa2771eUL, 0x1e601d29UL, 0x1b2f0bacUL, 0x1aed619bUL, 0x18abdfc2UL, 0x1969b5f5UL,
+        0x1235f2c8UL, 0x13f798ffUL, 0x11b126a6UL, 0x10734c91UL, 0x153c5a14UL, 0x14fe3023UL,
+        0x16b88e7aUL, 0x177ae44dUL, 0x384d46e0UL, 0x398f2cd7UL, 0x3bc9928eUL, 0x3a0bf8b9UL,
+        0x3f44ee3cUL, 0x3e86840bUL, 0x3cc03a52UL, 0x3d025065UL, 0x365e1758UL, 0x379c7d6fUL,
+        0x35dac336UL, 0x3418a901UL, 0x3157bf84UL, 0x3095d5b3UL, 0x32d36beaUL, 0x331101ddUL,
+        0x246be590UL, 0x25a98fa7UL, 0x27ef31feUL, 0x262d5bc9UL, 0x23624d4cUL, 0x22a0277bUL,
+        0x20e69922UL, 0x2124f315UL, 0x2a78b428UL, 0x2bbade1fUL, 0x29fc6046UL, 0x283e0a71UL,
+        0x2d711cf4UL, 0x2cb376c3UL, 0x2ef5c89aUL, 0x2f37a2adUL, 0x709a8dc0UL, 0x7158e7f7UL,
+        0x731e59aeUL, 0x72dc3399UL, 0x7793251cUL, 0x76514f2bUL, 0x7417f172UL, 0x75d59b45UL,
+        0x7e89dc78UL, 0x7f4bb64fUL, 0x7d0d0816UL, 0x7ccf6221UL, 0x798074a4UL, 0x78421e93UL,
+        0x7a04a0caUL, 0x7bc6cafdUL, 0x6cbc2eb0UL, 0x6d7e4487UL, 0x6f38fadeUL, 0x6efa90e9UL,
+        0x6bb5866cUL, 0x6a77ec5bUL, 0x68315202UL, 0x69f33835UL, 0x62af7f08UL, 0x636d153fUL,
+        0x612bab66UL, 0x60e9c151UL, 0x65a6d7d4UL, 0x6464bde3UL, 0x662203baUL, 0x67e0698dUL,
+        0x48d7cb20UL, 0x4915a117UL, 0x4b531f4eUL, 0x4a917579UL, 0x4fde63fcUL, 0x4e1c09cbUL,
+        0x4c5ab792UL, 0x4d98dda5UL, 0x46c49a98UL, 0x4706f0afUL, 0x45404ef6UL, 0x448224c1UL,
+        0x41cd3244UL, 0x400f5873UL, 0x4249e62aUL, 0x438b8c1dUL, 0x54f16850UL, 0x55330267UL,
+        0x5775bc3eUL, 0x56b7d609UL, 0x53f8c08cUL, 0x523aaabbUL, 0x507c14e2UL, 0x51be7ed5UL,
+        0x5ae239e8UL, 0x5b2053dfUL, 0x5966ed86UL, 0x58a487b1UL, 0x5deb9134UL, 0x5c29fb03UL,
+        0x5e6f455aUL, 0x5fad2f6dUL, 0xe1351b80UL, 0xe0f771b7UL, 0xe2b1cfeeUL, 0xe373a5d9UL,
+        0xe63cb35cUL, 0xe7fed96bUL, 0xe5b86732UL, 0xe47a0d05UL, 0xef264a38UL, 0xeee4200fUL,
+        0xeca29e56UL, 0xed60f461UL, 0xe82fe2e4UL, 0xe9ed88d3UL, 0xebab368aUL, 0xea695cbdUL,
+        0xfd13b8f0UL, 0xfcd1d2c7UL, 0xfe976c9eUL, 0xff5506a9UL, 0xfa1a102cUL, 0xfbd87a1bUL,
+        0xf99ec442UL, 0xf85cae75UL, 0xf300e948UL, 0xf2c2837fUL, 0xf0843d26UL, 0xf1465711UL,
+        0xf4094194UL, 0xf5cb2ba3UL, 0xf78d95faUL, 0xf64fffcdUL, 0xd9785d60UL, 0xd8ba3757UL,
+        0xdafc890eUL, 0xdb3ee339UL, 0xde71f5bcUL, 0xdfb39f8bUL, 0xddf521d2UL, 0xdc374be5UL,
+        0xd76b0cd8UL, 0xd6a966efUL, 0xd4efd8b6UL, 0xd52db281UL, 0xd062a404UL, 0xd1a0ce33UL,
+        0xd3e6706aUL, 0xd2241a5dUL, 0xc55efe10UL, 0xc49c9427UL, 0xc6da2a7eUL, 0xc7184049UL,
+        0xc25756ccUL, 0xc3953cfbUL, 0xc1d382a2UL, 0xc011e895UL, 0xcb4dafa8UL, 0xca8fc59fUL,
+        0xc8c97bc6UL, 0xc90b11f1UL, 0xcc440774UL, 0xcd866d43UL, 0xcfc0d31aUL, 0xce02b92dUL,
+        0x91af9640UL, 0x906dfc77UL, 0x922b422eUL, 0x93e92819UL, 0x96a63e9cUL, 0x976454abUL,
+        0x9522eaf2UL, 0x94e080c5UL, 0x9fbcc7f8UL, 0x9e7eadcfUL, 0x9c381396UL, 0x9dfa79a1UL,
+        0x98b56f24UL, 0x99770513UL, 0x9b31bb4aUL, 0x9af3d17dUL, 0x8d893530UL, 0x8c4b5f07UL,
+        0x8e0de15eUL, 0x8fcf8b69UL, 0x8a809decUL, 0x8b42f7dbUL, 0x89044982UL, 0x88c623b5UL,
+        0x839a6488UL, 0x82580ebfUL, 0x801eb0e6UL, 0x81dcdad1UL, 0x8493cc54UL, 0x8551a663UL,
+        0x8717183aUL, 0x86d5720dUL, 0xa9e2d0a0UL, 0xa820ba97UL, 0xaa6604ceUL, 0xaba46ef9UL,
+        0xaeeb787cUL, 0xaf29124bUL, 0xad6fac12UL, 0xacadc625UL, 0xa7f18118UL, 0xa633eb2fUL,
+        0xa4755576UL, 0xa5b73f41UL, 0xa0f829c4UL, 0xa13a43f3UL, 0xa37cfdaaUL, 0xa2be979dUL,
+        0xb5c473d0UL, 0xb40619e7UL, 0xb640a7beUL, 0xb782cd89UL, 0xb2cddb0cUL, 0xb30fb13bUL,
+        0xb1490f62UL, 0xb08b6555UL, 0xbbd72268UL, 0xba15485fUL, 0xb853f606UL, 0xb9919c31UL,
+        0xbcde8ab4UL, 0xbd1ce083UL, 0xbf5a5edaUL, 0xbe9834edUL},
+    {
+        0x00000000UL, 0xb8bc6765UL, 0xaa09c88bUL, 0x12b5afeeUL, 0x8f629757UL, 0x37def032UL,
+        0x256b5fdcUL, 0x9dd738b9UL, 0xc5b428efUL, 0x7d084f8aUL, 0x6fbde064UL, 0xd7018701UL,
+        0x4ad6bfb8UL, 0xf26ad8ddUL, 0xe0df7733UL, 0x58631056UL, 0x5019579fUL, 0xe8a530faUL,
+        0xfa109f14UL, 0x42acf871UL, 0xdf7bc0c8UL, 0x67c7a7adUL, 0x75720843UL, 0xcdce6f26UL,
+        0x95ad7f70UL, 0x2d111815UL, 0x3fa4b7fbUL, 0x8718d09eUL, 0x1acfe827UL, 0xa2738f42UL,
+        0xb0c620acUL, 0x087a47c9UL, 0xa032af3eUL, 0x188ec85bUL, 0x0a3b67b5UL, 0xb28700d0UL,
+        0x2f503869UL, 0x97ec5f0cUL, 0x8559f0e2UL, 0x3de59787UL, 0x658687d1UL, 0xdd3ae0b4UL,
+        0xcf8f4f5aUL, 0x7733283fUL, 0xeae41086UL, 0x525877e3UL, 0x40edd80dUL, 0xf851bf68UL,
+        0xf02bf8a1UL, 0x48979fc4UL, 0x5a22302aUL, 0xe29e574fUL, 0x7f496ff6UL, 0xc7f50893UL,
+        0xd540a77dUL, 0x6dfcc018UL, 0x359fd04eUL, 0x8d23b72bUL, 0x9f9618c5UL, 0x272a7fa0UL,
+        0xbafd4719UL, 0x0241207cUL, 0x10f48f92UL, 0xa848e8f7UL, 0x9b14583dUL, 0x23a83f58UL,
+        0x311d90b6UL, 0x89a1f7d3UL, 0x1476cf6aUL, 0xaccaa80fUL, 0xbe7f07e1UL, 0x06c36084UL,
+        0x5ea070d2UL, 0xe61c17b7UL, 0xf4a9b859UL, 0x4c15df3cUL, 0xd1c2e785UL, 0x697e80e0UL,
+        0x7bcb2f0eUL, 0xc377486bUL, 0xcb0d0fa2UL, 0x73b168c7UL, 0x6104c729UL, 0xd9b8a04cUL,
+        0x446f98f5UL, 0xfcd3ff90UL, 0xee66507eUL, 0x56da371bUL, 0x0eb9274dUL, 0xb6054028UL,
+        0xa4b0efc6UL, 0x1c0c88a3UL, 0x81dbb01aUL, 0x3967d77fUL, 0x2bd27891UL, 0x936e1ff4UL,
+        0x3b26f703UL, 0x839a9066UL, 0x912f3f88UL, 0x299358edUL, 0xb4446054UL, 0x0cf80731UL,
+        0x1e4da8dfUL, 0xa6f1cfbaUL, 0xfe92dfecUL, 0x462eb889UL, 0x549b1767UL, 0xec277002UL,
+        0x71f048bbUL, 0xc94c2fdeUL, 0xdbf98030UL, 0x6345e755UL, 0x6b3fa09cUL, 0xd383c7f9UL,
+        0xc1366817UL, 0x798a0f72UL, 0xe45d37cbUL, 0x5ce150aeUL, 0x4e54ff40UL, 0xf6e89825UL,
+        0xae8b8873UL, 0x1637ef16UL, 0x048240f8UL, 0xbc3e279dUL, 0x21e91f24UL, 0x99557841UL,
+        0x8be0d7afUL, 0x335cb0caUL, 0xed59b63bUL, 0x55e5d15eUL, 0x47507eb0UL, 0xffec19d5UL,
+        0x623b216cUL, 0xda874609UL, 0xc832e9e7UL, 0x708e8e82UL, 0x28ed9ed4UL, 0x9051f9b1UL,
+        0x82e4565fUL, 0x3a58313aUL, 0xa78f0983UL, 0x1f336ee6UL, 0x0d86c108UL, 0xb53aa66dUL,
+        0xbd40e1a4UL, 0x05fc86c1UL, 0x1749292fUL, 0xaff54e4aUL, 0x322276f3UL, 0x8a9e1196UL,
+        0x982bbe78UL, 0x2097d91dUL, 0x78f4c94bUL, 0xc048ae2eUL, 0xd2fd01c0UL, 0x6a4166a5UL,
+        0xf7965e1cUL, 0x4f2a3979UL, 0x5d9f9697UL, 0xe523f1f2UL, 0x4d6b1905UL, 0xf5d77e60UL,
+        0xe762d18eUL, 0x5fdeb6ebUL, 0xc2098e52UL, 0x7ab5e937UL, 0x680046d9UL, 0xd0bc21bcUL,
+        0x88df31eaUL, 0x3063568fUL, 0x22d6f961UL, 0x9a6a9e04UL, 0x07bda6bdUL, 0xbf01c1d8UL,
+        0xadb46e36UL, 0x15080953UL, 0x1d724e9aUL, 0xa5ce29ffUL, 0xb77b8611UL, 0x0fc7e174UL,
+        0x9210d9cdUL, 0x2aacbea8UL, 0x38191146UL, 0x80a57623UL, 0xd8c66675UL, 0x607a0110UL,
+        0x72cfaefeUL, 0xca73c99bUL, 0x57a4f122UL, 0xef189647UL, 0xfdad39a9UL, 0x45115eccUL,
+        0x764dee06UL, 0xcef18963UL, 0xdc44268dUL, 0x64f841e8UL, 0xf92f7951UL, 0x41931e34UL,
+        0x5326b1daUL, 0xeb9ad6bfUL, 0xb3f9c6e9UL, 0x0b45a18cUL, 0x19f00e62UL, 0xa14c6907UL,
+        0x3c9b51beUL, 0x842736dbUL, 0x96929935UL, 0x2e2efe50UL, 0x2654b999UL, 0x9ee8defcUL,
+        0x8c5d7112UL, 0x34e11677UL, 0xa9362eceUL, 0x118a49abUL, 0x033fe645UL, 0xbb838120UL,
+        0xe3e09176UL, 0x5b5cf613UL, 0x49e959fdUL, 0xf1553e98UL, 0x6c820621UL, 0xd43e6144UL,
+        0xc68bceaaUL, 0x7e37a9cfUL, 0xd67f4138UL, 0x6ec3265dUL, 0x7c7689b3UL, 0xc4caeed6UL,
+        0x591dd66fUL, 0xe1a1b10aUL, 0xf3141ee4UL, 0x4ba87981UL, 0x13cb69d7UL, 0xab770eb2UL,
+        0xb9c2a15cUL, 0x017ec639UL, 0x9ca9fe80UL, 0x241599e5UL, 0x36a0360bUL, 0x8e1c516eUL,
+        0x866616a7UL, 0x3eda71c2UL, 0x2c6fde2cUL, 0x94d3b949UL, 0x090481f0UL, 0xb1b8e695UL,
+        0xa30d497bUL, 0x1bb12e1eUL, 0x43d23e48UL, 0xfb6e592dUL, 0xe9dbf6c3UL, 0x516791a6UL,
+        0xccb0a91fUL, 0x740cce7aUL, 0x66b96194UL, 0xde0506f1UL},
+    {
+        0x00000000UL, 0x3d6029b0UL, 0x7ac05360UL, 0x47a07ad0UL, 0xf580a6c0UL, 0xc8e08f70UL,
+        0x8f40f5a0UL, 0xb220dc10UL, 0x30704bc1UL, 0x0d106271UL, 0x4ab018a1UL, 0x77d03111UL,
+        0xc5f0ed01UL, 0xf890c4b1UL, 0xbf30be61UL, 0x825097d1UL, 0x60e09782UL, 0x5d80be32UL,
+        0x1a20c4e2UL, 0x2740ed52UL, 0x95603142UL, 0xa80018f2UL, 0xefa06222UL, 0xd2c04b92UL,
+        0x5090dc43UL, 0x6df0f5f3UL, 0x2a508f23UL, 0x1730a693UL, 0xa5107a83UL, 0x98705333UL,
+        0xdfd029e3UL, 0xe2b00053UL, 0xc1c12f04UL, 0xfca106b4UL, 0xbb017c64UL, 0x866155d4UL,
+        0x344189c4UL, 0x0921a074UL, 0x4e81daa4UL, 0x73e1f314UL, 0xf1b164c5UL, 0xccd14d75UL,
+        0x8b7137a5UL, 0xb6111e15UL, 0x0431c205UL, 0x3951ebb5UL, 0x7ef19165UL, 0x4391b8d5UL,
+        0xa121b886UL, 0x9c419136UL, 0xdbe1ebe6UL, 0xe681c256UL, 0x54a11e46UL, 0x69c137f6UL,
+        0x2e614d26UL, 0x13016496UL, 0x9151f347UL, 0xac31daf7UL, 0xeb91a027UL, 0xd6f18997UL,
+        0x64d15587UL, 0x59b17c37UL, 0x1e1106e7UL, 0x23712f57UL, 0x58f35849UL, 0x659371f9UL,
+        0x22330b29UL, 0x1f532299UL, 0xad73fe89UL, 0x9013d739UL, 0xd7b3ade9UL, 0xead38459UL,
+        0x68831388UL, 0x55e33a38UL, 0x124340e8UL, 0x2f236958UL, 0x9d03b548UL, 0xa0639cf8UL,
+        0xe7c3e628UL, 0xdaa3cf98UL, 0x3813cfcbUL, 0x0573e67bUL, 0x42d39cabUL, 0x7fb3b51bUL,
+        0xcd93690bUL, 0xf0f340bbUL, 0xb7533a6bUL, 0x8a3313dbUL, 0x0863840aUL, 0x3503adbaUL,
+        0x72a3d76aUL, 0x4fc3fedaUL, 0xfde322caUL, 0xc0830b7aUL, 0x872371aaUL, 0xba43581aUL,
+        0x9932774dUL, 0xa4525efdUL, 0xe3f2242dUL, 0xde920d9dUL, 0x6cb2d18dUL, 0x51d2f83dUL,
+        0x167282edUL, 0x2b12ab5dUL, 0xa9423c8cUL, 0x9422153cUL, 0xd3826fecUL, 0xeee2465cUL,
+        0x5cc29a4cUL, 0x61a2b3fcUL, 0x2602c92cUL, 0x1b62e09cUL, 0xf9d2e0cfUL, 0xc4b2c97fUL,
+        0x8312b3afUL, 0xbe729a1fUL, 0x0c52460fUL, 0x31326fbfUL, 0x7692156fUL, 0x4bf23cdfUL,
+        0xc9a2ab0eUL, 0xf4c282beUL, 0xb362f86eUL, 0x8e02d1deUL, 0x3c220dceUL, 0x0142247eUL,
+        0x46e25eaeUL, 0x7b82771eUL, 0xb1e6b092UL, 0x8c869922UL, 0xcb26e3f2UL, 0xf646ca42UL,
+        0x44661652UL, 0x79063fe2UL, 0x3ea64532UL, 0x03c66c82UL, 0x8196fb53UL, 0xbcf6d2e3UL,
+        0xfb56a833UL, 0xc6368183UL, 0x74165d93UL, 0x49767423UL, 0x0ed60ef3UL, 0x33b62743UL,
+        0xd1062710UL, 0xec660ea0UL, 0xabc67470UL, 0x96a65dc0UL, 0x248681d0UL, 0x19e6a860UL,
+        0x5e46d2b0UL, 0x6326fb00UL, 0xe1766cd1UL, 0xdc164561UL, 0x9bb63fb1UL, 0xa6d61601UL,
+        0x14f6ca11UL, 0x2996e3a1UL, 0x6e369971UL, 0x5356b0c1UL, 0x70279f96UL, 0x4d47b626UL,
+        0x0ae7ccf6UL, 0x3787e546UL, 0x85a73956UL, 0xb8c710e6UL, 0xff676a36UL, 0xc2074386UL,
+        0x4057d457UL, 0x7d37fde7UL, 0x3a978737UL, 0x07f7ae87UL, 0xb5d77297UL, 0x88b75b27UL,
+        0xcf1721f7UL, 0xf2770847UL, 0x10c70814UL, 0x2da721a4UL, 0x6a075b74UL, 0x576772c4UL,
+        0xe547aed4UL, 0xd8278764UL, 0x9f87fdb4UL, 0xa2e7d404UL, 0x20b743d5UL, 0x1dd76a65UL,
+        0x5a7710b5UL, 0x67173905UL, 0xd537e515UL, 0xe857cca5UL, 0xaff7b675UL, 0x92979fc5UL,
+        0xe915e8dbUL, 0xd475c16bUL, 0x93d5bbbbUL, 0xaeb5920bUL, 0x1c954e1bUL, 0x21f567abUL,
+        0x66551d7bUL, 0x5b3534cbUL, 0xd965a31aUL, 0xe4058aaaUL, 0xa3a5f07aUL, 0x9ec5d9caUL,
+        0x2ce505daUL, 0x11852c6aUL, 0x562556baUL, 0x6b457f0aUL, 0x89f57f59UL, 0xb49556e9UL,
+        0xf3352c39UL, 0xce550589UL, 0x7c75d999UL, 0x4115f029UL, 0x06b58af9UL, 0x3bd5a349UL,
+        0xb9853498UL, 0x84e51d28UL, 0xc34567f8UL, 0xfe254e48UL, 0x4c059258UL, 0x7165bbe8UL,
+        0x36c5c138UL, 0x0ba5e888UL, 0x28d4c7dfUL, 0x15b4ee6fUL, 0x521494bfUL, 0x6f74bd0fUL,
+        0xdd54611fUL, 0xe03448afUL, 0xa794327fUL, 0x9af41bcfUL, 0x18a48c1eUL, 0x25c4a5aeUL,
+        0x6264df7eUL, 0x5f04f6ceUL, 0xed242adeUL, 0xd044036eUL, 0x97e479beUL, 0xaa84500eUL,
+        0x4834505dUL, 0x755479edUL, 0x32f4033dUL, 0x0f942a8dUL, 0xbdb4f69dUL, 0x80d4df2dUL,
+        0xc774a5fdUL, 0xfa148c4dUL, 0x78441b9cUL, 0x4524322cUL, 0x028448fcUL, 0x3fe4614cUL,
+        0x8dc4bd5cUL, 0xb0a494ecUL, 0xf704ee3cUL, 0xca64c78cUL},
+    {
+        0x00000000UL, 0xcb5cd3a5UL, 0x4dc8a10bUL, 0x869472aeUL, 0x9b914216UL, 0x50cd91b3UL,
+        0xd659e31dUL, 0x1d0530b8UL, 0xec53826dUL, 0x270f51c8UL, 0xa19b2366UL, 0x6ac7f0c3UL,
+        0x77c2c07bUL, 0xbc9e13deUL, 0x3a0a6170UL, 0xf156b2d5UL, 0x03d6029bUL, 0xc88ad13eUL,
+        0x4e1ea390UL, 0x85427035UL, 0x9847408dUL, 0x531b9328UL, 0xd58fe186UL, 0x1ed33223UL,
+        0xef8580f6UL, 0x24d95353UL, 0xa24d21fdUL, 0x6911f258UL, 0x7414c2e0UL, 0xbf481145UL,
+        0x39dc63ebUL, 0xf280b04eUL, 0x07ac0536UL, 0xccf0d693UL, 0x4a64a43dUL, 0x81387798UL,
+        0x9c3d4720UL, 0x57619485UL, 0xd1f5e62bUL, 0x1aa9358eUL, 0xebff875bUL, 0x20a354feUL,
+        0xa6372650UL, 0x6d6bf5f5UL, 0x706ec54dUL, 0xbb3216e8UL, 0x3da66446UL, 0xf6fab7e3UL,
+        0x047a07adUL, 0xcf26d408UL, 0x49b2a6a6UL, 0x82ee7503UL, 0x9feb45bbUL, 0x54b7961eUL,
+        0xd223e4b0UL, 0x197f3715UL, 0xe82985c0UL, 0x23755665UL, 0xa5e124cbUL, 0x6ebdf76eUL,
+        0x73b8c7d6UL, 0xb8e41473UL, 0x3e7066ddUL, 0xf52cb578UL, 0x0f580a6cUL, 0xc404d9c9UL,
+        0x4290ab67UL, 0x89cc78c2UL, 0x94c9487aUL, 0x5f959bdfUL, 0xd901e971UL, 0x125d3ad4UL,
+        0xe30b8801UL, 0x28575ba4UL, 0xaec3290aUL, 0x659ffaafUL, 0x789aca17UL, 0xb3c619b2UL,
+        0x35526b1cUL, 0xfe0eb8b9UL, 0x0c8e08f7UL, 0xc7d2db52UL, 0x4146a9fcUL, 0x8a1a7a59UL,
+        0x971f4ae1UL, 0x5c439944UL, 0xdad7ebeaUL, 0x118b384fUL, 0xe0dd8a9aUL, 0x2b81593fUL,
+        0xad152b91UL, 0x6649f834UL, 0x7b4cc88cUL, 0xb0101b29UL, 0x36846987UL, 0xfdd8ba22UL,
+        0x08f40f5aUL, 0xc3a8dcffUL, 0x453cae51UL, 0x8e607df4UL, 0x93654d4cUL, 0x58399ee9UL,
+        0xdeadec47UL, 0x15f13fe2UL, 0xe4a78d37UL, 0x2ffb5e92UL, 0xa96f2c3cUL, 0x6233ff99UL,
+        0x7f36cf21UL, 0xb46a1c84UL, 0x32fe6e2aUL, 0xf9a2bd8fUL, 0x0b220dc1UL, 0xc07ede64UL,
+        0x46eaaccaUL, 0x8db67f6fUL, 0x90b34fd7UL, 0x5bef9c72UL, 0xdd7beedcUL, 0x16273d79UL,
+        0xe7718facUL, 0x2c2d5c09UL, 0xaab92ea7UL, 0x61e5fd02UL, 0x7ce0cdbaUL, 0xb7bc1e1fUL,
+        0x31286cb1UL, 0xfa74bf14UL, 0x1eb014d8UL, 0xd5ecc77dUL, 0x5378b5d3UL, 0x98246676UL,
+        0x852156ceUL, 0x4e7d856bUL, 0xc8e9f7c5UL, 0x03b52460UL, 0xf2e396b5UL, 0x39bf4510UL,
+        0xbf2b37beUL, 0x7477e41bUL, 0x6972d4a3UL, 0xa22e0706UL, 0x24ba75a8UL, 0xefe6a60dUL,
+        0x1d661643UL, 0xd63ac5e6UL, 0x50aeb748UL, 0x9bf264edUL, 0x86f75455UL, 0x4dab87f0UL,
+        0xcb3ff55eUL, 0x006326fbUL, 0xf135942eUL, 0x3a69478bUL, 0xbcfd3525UL, 0x77a1e680UL,
+        0x6aa4d638UL, 0xa1f8059dUL, 0x276c7733UL, 0xec30a496UL, 0x191c11eeUL, 0xd240c24bUL,
+        0x54d4b0e5UL, 0x9f886340UL, 0x828d53f8UL, 0x49d1805dUL, 0xcf45f2f3UL, 0x04192156UL,
+        0xf54f9383UL, 0x3e134026UL, 0xb8873288UL, 0x73dbe12dUL, 0x6eded195UL, 0xa5820230UL,
+        0x2316709eUL, 0xe84aa33bUL, 0x1aca1375UL, 0xd196c0d0UL, 0x5702b27eUL, 0x9c5e61dbUL,
+        0x815b5163UL, 0x4a0782c6UL, 0xcc93f068UL, 0x07cf23cdUL, 0xf6999118UL, 0x3dc542bdUL,
+        0xbb513013UL, 0x700de3b6UL, 0x6d08d30eUL, 0xa65400abUL, 0x20c07205UL, 0xeb9ca1a0UL,
+        0x11e81eb4UL, 0xdab4cd11UL, 0x5c20bfbfUL, 0x977c6c1aUL, 0x8a795ca2UL, 0x41258f07UL,
+        0xc7b1fda9UL, 0x0ced2e0cUL, 0xfdbb9cd9UL, 0x36e74f7cUL, 0xb0733dd2UL, 0x7b2fee77UL,
+        0x662adecfUL, 0xad760d6aUL, 0x2be27fc4UL, 0xe0beac61UL, 0x123e1c2fUL, 0xd962cf8aUL,
+        0x5ff6bd24UL, 0x94aa6e81UL, 0x89af5e39UL, 0x42f38d9cUL, 0xc467ff32UL, 0x0f3b2c97UL,
+        0xfe6d9e42UL, 0x35314de7UL, 0xb3a53f49UL, 0x78f9ececUL, 0x65fcdc54UL, 0xaea00ff1UL,
+        0x28347d5fUL, 0xe368aefaUL, 0x16441b82UL, 0xdd18c827UL, 0x5b8cba89UL, 0x90d0692cUL,
+        0x8dd55994UL, 0x46898a31UL, 0xc01df89fUL, 0x0b412b3aUL, 0xfa1799efUL, 0x314b4a4aUL,
+        0xb7df38e4UL, 0x7c83eb41UL, 0x6186dbf9UL, 0xaada085cUL, 0x2c4e7af2UL, 0xe712a957UL,
+        0x15921919UL, 0xdececabcUL, 0x585ab812UL, 0x93066bb7UL, 0x8e035b0fUL, 0x455f88aaUL,
+        0xc3cbfa04UL, 0x089729a1UL, 0xf9c19b74UL, 0x329d48d1UL, 0xb4093a7fUL, 0x7f55e9daUL,
+        0x6250d962UL, 0xa90c0ac7UL, 0x2f987869UL, 0xe4c4abccUL},
+    {
+        0x00000000UL, 0xa6770bb4UL, 0x979f1129UL, 0x31e81a9dUL, 0xf44f2413UL, 0x52382fa7UL,
+        0x63d0353aUL, 0xc5a73e8eUL, 0x33ef4e67UL, 0x959845d3UL, 0xa4705f4eUL, 0x020754faUL,
+        0xc7a06a74UL, 0x61d761c0UL, 0x503f7b5dUL, 0xf64870e9UL, 0x67de9cceUL, 0xc1a9977aUL,
+        0xf0418de7UL, 0x56368653UL, 0x9391b8ddUL, 0x35e6b369UL, 0x040ea9f4UL, 0xa279a240UL,
+        0x5431d2a9UL, 0xf246d91dUL, 0xc3aec380UL, 0x65d9c834UL, 0xa07ef6baUL, 0x0609fd0eUL,
+        0x37e1e793UL, 0x9196ec27UL, 0xcfbd399cUL, 0x69ca3228UL, 0x582228b5UL, 0xfe552301UL,
+        0x3bf21d8fUL, 0x9d85163bUL, 0xac6d0ca6UL, 0x0a1a0712UL, 0xfc5277fbUL, 0x5a257c4fUL,
+        0x6bcd66d2UL, 0xcdba6d66UL, 0x081d53e8UL, 0xae6a585cUL, 0x9f8242c1UL, 0x39f54975UL,
+        0xa863a552UL, 0x0e14aee6UL, 0x3ffcb47bUL, 0x998bbfcfUL, 0x5c2c8141UL, 0xfa5b8af5UL,
+        0xcbb39068UL, 0x6dc49bdcUL, 0x9b8ceb35UL, 0x3dfbe081UL, 0x0c13fa1cUL, 0xaa64f1a8UL,
+        0x6fc3cf26UL, 0xc9b4c492UL, 0xf85cde0fUL, 0x5e2bd5bbUL, 0x440b7579UL, 0xe27c7ecdUL,
+        0xd3946450UL, 0x75e36fe4UL, 0xb044516aUL, 0x16335adeUL, 0x27db4043UL, 0x81ac4bf7UL,
+        0x77e43b1eUL, 0xd19330aaUL, 0xe07b2a37UL, 0x460c2183UL, 0x83ab1f0dUL, 0x25dc14b9UL,
+        0x14340e24UL, 0xb2430590UL, 0x23d5e9b7UL, 0x85a2e203UL, 0xb44af89eUL, 0x123df32aUL,
+        0xd79acda4UL, 0x71edc610UL, 0x4005dc8dUL, 0xe672d739UL, 0x103aa7d0UL, 0xb64dac64UL,
+        0x87a5b6f9UL, 0x21d2bd4dUL, 0xe47583c3UL, 0x42028877UL, 0x73ea92eaUL, 0xd59d995eUL,
+        0x8bb64ce5UL, 0x2dc14751UL, 0x1c295dccUL, 0xba5e5678UL, 0x7ff968f6UL, 0xd98e6342UL,
+        0xe86679dfUL, 0x4e11726bUL, 0xb8590282UL, 0x1e2e0936UL, 0x2fc613abUL, 0x89b1181fUL,
+        0x4c162691UL, 0xea612d25UL, 0xdb8937b8UL, 0x7dfe3c0cUL, 0xec68d02bUL, 0x4a1fdb9fUL,
+        0x7bf7c102UL, 0xdd80cab6UL, 0x1827f438UL, 0xbe50ff8cUL, 0x8fb8e511UL, 0x29cfeea5UL,
+        0xdf879e4cUL, 0x79f095f8UL, 0x48188f65UL, 0xee6f84d1UL, 0x2bc8ba5fUL, 0x8dbfb1ebUL,
+        0xbc57ab76UL, 0x1a20a0c2UL, 0x8816eaf2UL, 0x2e61e146UL, 0x1f89fbdbUL, 0xb9fef06fUL,
+        0x7c59cee1UL, 0xda2ec555UL, 0xebc6dfc8UL, 0x4db1d47cUL, 0xbbf9a495UL, 0x1d8eaf21UL,
+        0x2c66b5bcUL, 0x8a11be08UL, 0x4fb68086UL, 0xe9c18b32UL, 0xd82991afUL, 0x7e5e9a1bUL,
+        0xefc8763cUL, 0x49bf7d88UL, 0x78576715UL, 0xde206ca1UL, 0x1b87522fUL, 0xbdf0599bUL,
+        0x8c184306UL, 0x2a6f48b2UL, 0xdc27385bUL, 0x7a5033efUL, 0x4bb82972UL, 0xedcf22c6UL,
+        0x28681c48UL, 0x8e1f17fcUL, 0xbff70d61UL, 0x198006d5UL, 0x47abd36eUL, 0xe1dcd8daUL,
+        0xd034c247UL, 0x7643c9f3UL, 0xb3e4f77dUL, 0x1593fcc9UL, 0x247be654UL, 0x820cede0UL,
+        0x74449d09UL, 0xd23396bdUL, 0xe3db8c20UL, 0x45ac8794UL, 0x800bb91aUL, 0x267cb2aeUL,
+        0x1794a833UL, 0xb1e3a387UL, 0x20754fa0UL, 0x86024414UL, 0xb7ea5e89UL, 0x119d553dUL,
+        0xd43a6bb3UL, 0x724d6007UL, 0x43a57a9aUL, 0xe5d2712eUL, 0x139a01c7UL, 0xb5ed0a73UL,
+        0x840510eeUL, 0x22721b5aUL, 0xe7d525d4UL, 0x41a22e60UL, 0x704a34fdUL, 0xd63d3f49UL,
+        0xcc1d9f8bUL, 0x6a6a943fUL, 0x5b828ea2UL, 0xfdf58516UL, 0x3852bb98UL, 0x9e25b02cUL,
+        0xafcdaab1UL, 0x09baa105UL, 0xfff2d1ecUL, 0x5985da58UL, 0x686dc0c5UL, 0xce1acb71UL,
+        0x0bbdf5ffUL, 0xadcafe4bUL, 0x9c22e4d6UL, 0x3a55ef62UL, 0xabc30345UL, 0x0db408f1UL,
+        0x3c5c126cUL, 0x9a2b19d8UL, 0x5f8c2756UL, 0xf9fb2ce2UL, 0xc813367fUL, 0x6e643dcbUL,
+        0x982c4d22UL, 0x3e5b4696UL, 0x0fb35c0bUL, 0xa9c457bfUL, 0x6c636931UL, 0xca146285UL,
+        0xfbfc7818UL, 0x5d8b73acUL, 0x03a0a617UL, 0xa5d7ada3UL, 0x943fb73eUL, 0x3248bc8aUL,
+        0xf7ef8204UL, 0x519889b0UL, 0x6070932dUL, 0xc6079899UL, 0x304fe870UL, 0x9638e3c4UL,
+        0xa7d0f959UL, 0x01a7f2edUL, 0xc400cc63UL, 0x6277c7d7UL, 0x539fdd4aUL, 0xf5e8d6feUL,
+        0x647e3ad9UL, 0xc209316dUL, 0xf3e12bf0UL, 0x55962044UL, 0x90311ecaUL, 0x3646157eUL,
+        0x07ae0fe3UL, 0xa1d90457UL, 0x579174beUL, 0xf1e67f0aUL, 0xc00e6597UL, 0x66796e23UL,
+        0xa3de50adUL, 0x05a95b19UL, 0x34414184UL, 0x92364a30UL},
+    {
+        0x00000000UL, 0xccaa009eUL, 0x4225077dUL, 0x8e8f07e3UL, 0x844a0efaUL, 0x48e00e64UL,
+        0xc66f0987UL, 0x0ac50919UL, 0xd3e51bb5UL, 0x1f4f1b2bUL, 0x91c01cc8UL, 0x5d6a1c56UL,
+        0x57af154fUL, 0x9b0515d1UL, 0x158a1232UL, 0xd92012acUL, 0x7cbb312bUL, 0xb01131b5UL,
+        0x3e9e3656UL, 0xf23436c8UL, 0xf8f13fd1UL, 0x345b3f4fUL, 0xbad438acUL, 0x767e3832UL,
+        0xaf5e2a9eUL, 0x63f42a00UL, 0xed7b2de3UL, 0x21d12d7dUL, 0x2b142464UL, 0xe7be24faUL,
+        0x69312319UL, 0xa59b2387UL, 0xf9766256UL, 0x35dc62c8UL, 0xbb53652bUL, 0x77f965b5UL,
+        0x7d3c6cacUL, 0xb1966c32UL, 0x3f196bd1UL, 0xf3b36b4fUL, 0x2a9379e3UL, 0xe639797dUL,
+        0x68b67e9eUL, 0xa41c7e00UL, 0xaed97719UL, 0x62737787UL, 0xecfc7064UL, 0x205670faUL,
+        0x85cd537dUL, 0x496753e3UL, 0xc7e85400UL, 0x0b42549eUL, 0x01875d87UL, 0xcd2d5d19UL,
+        0x43a25afaUL, 0x8f085a64UL, 0x562848c8UL, 0x9a824856UL, 0x140d4fb5UL, 0xd8a74f2bUL,
+        0xd2624632UL, 0x1ec846acUL, 0x9047414fUL, 0x5ced41d1UL, 0x299dc2edUL, 0xe537c273UL,
+        0x6bb8c590UL, 0xa712c50eUL, 0xadd7cc17UL, 0x617dcc89UL, 0xeff2cb6aUL, 0x2358cbf4UL,
+        0xfa78d958UL, 0x36d2d9c6UL, 0xb85dde25UL, 0x74f7debbUL, 0x7e32d7a2UL, 0xb298d73cUL,
+        0x3c17d0dfUL, 0xf0bdd041UL, 0x5526f3c6UL, 0x998cf358UL, 0x1703f4bbUL, 0xdba9f425UL,
+        0xd16cfd3cUL, 0x1dc6fda2UL, 0x9349fa41UL, 0x5fe3fadfUL, 0x86c3e873UL, 0x4a69e8edUL,
+        0xc4e6ef0eUL, 0x084cef90UL, 0x0289e689UL, 0xce23e617UL, 0x40ace1f4UL, 0x8c06e16aUL,
+        0xd0eba0bbUL, 0x1c41a025UL, 0x92cea7c6UL, 0x5e64a758UL, 0x54a1ae41UL, 0x980baedfUL,
+        0x1684a93cUL, 0xda2ea9a2UL, 0x030ebb0eUL, 0xcfa4bb90UL, 0x412bbc73UL, 0x8d81bcedUL,
+        0x8744b5f4UL, 0x4beeb56aUL, 0xc561b289UL, 0x09cbb217UL, 0xac509190UL, 0x60fa910eUL,
+        0xee7596edUL, 0x22df9673UL, 0x281a9f6aUL, 0xe4b09ff4UL, 0x6a3f9817UL, 0xa6959889UL,
+        0x7fb58a25UL, 0xb31f8abbUL, 0x3d908d58UL, 0xf13a8dc6UL, 0xfbff84dfUL, 0x37558441UL,
+        0xb9da83a2UL, 0x7570833cUL, 0x533b85daUL, 0x9f918544UL, 0x111e82a7UL, 0xddb48239UL,
+        0xd7718b20UL, 0x1bdb8bbeUL, 0x95548c5dUL, 0x59fe8cc3UL, 0x80de9e6fUL, 0x4c749ef1UL,
+        0xc2fb9912UL, 0x0e51998cUL, 0x04949095UL, 0xc83e900bUL, 0x46b197e8UL, 0x8a1b9776UL,
+        0x2f80b4f1UL, 0xe32ab46fUL, 0x6da5b38cUL, 0xa10fb312UL, 0xabcaba0bUL, 0x6760ba95UL,
+        0xe9efbd76UL, 0x2545bde8UL, 0xfc65af44UL, 0x30cfafdaUL, 0xbe40a839UL, 0x72eaa8a7UL,
+        0x782fa1beUL, 0xb485a120UL, 0x3a0aa6c3UL, 0xf6a0a65dUL, 0xaa4de78cUL, 0x66e7e712UL,
+        0xe868e0f1UL, 0x24c2e06fUL, 0x2e07e976UL, 0xe2ade9e8UL, 0x6c22ee0bUL, 0xa088ee95UL,
+        0x79a8fc39UL, 0xb502fca7UL, 0x3b8dfb44UL, 0xf727fbdaUL, 0xfde2f2c3UL, 0x3148f25dUL,
+        0xbfc7f5beUL, 0x736df520UL, 0xd6f6d6a7UL, 0x1a5cd639UL, 0x94d3d1daUL, 0x5879d144UL,
+        0x52bcd85dUL, 0x9e16d8c3UL, 0x1099df20UL, 0xdc33dfbeUL, 0x0513cd12UL, 0xc9b9cd8cUL,
+        0x4736ca6fUL, 0x8b9ccaf1UL, 0x8159c3e8UL, 0x4df3c376UL, 0xc37cc495UL, 0x0fd6c40bUL,
+        0x7aa64737UL, 0xb60c47a9UL, 0x3883404aUL, 0xf42940d4UL, 0xfeec49cdUL, 0x32464953UL,
+        0xbcc94eb0UL, 0x70634e2eUL, 0xa9435c82UL, 0x65e95c1cUL, 0xeb665bffUL, 0x27cc5b61UL,
+        0x2d095278UL, 0xe1a352e6UL, 0x6f2c5505UL, 0xa386559bUL, 0x061d761cUL, 0xcab77682UL,
+        0x44387161UL, 0x889271ffUL, 0x825778e6UL, 0x4efd7878UL, 0xc0727f9bUL, 0x0cd87f05UL,
+        0xd5f86da9UL, 0x19526d37UL, 0x97dd6ad4UL, 0x5b776a4aUL, 0x51b26353UL, 0x9d1863cdUL,
+        0x1397642eUL, 0xdf3d64b0UL, 0x83d02561UL, 0x4f7a25ffUL, 0xc1f5221cUL, 0x0d5f2282UL,
+        0x079a2b9bUL, 0xcb302b05UL, 0x45bf2ce6UL, 0x89152c78UL, 0x50353ed4UL, 0x9c9f3e4aUL,
+        0x121039a9UL, 0xdeba3937UL, 0xd47f302eUL, 0x18d530b0UL, 0x965a3753UL, 0x5af037cdUL,
+        0xff6b144aUL, 0x33c114d4UL, 0xbd4e1337UL, 0x71e413a9UL, 0x7b211ab0UL, 0xb78b1a2eUL,
+        0x39041dcdUL, 0xf5ae1d53UL, 0x2c8e0fffUL, 0xe0240f61UL, 0x6eab0882UL, 0xa201081cUL,
+        0xa8c40105UL, 0x646e019bUL, 0xeae10678UL, 0x264b06e6UL},
+};
+
+static const crc32_hal_ops_t *crc32_ops;
+
+static inline uint32_t load_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+void crc32_set_hal(const crc32_hal_ops_t *ops) {
+    DEV_ASSERT(ops == NULL || ops->calc != NULL);
+
+    crc32_ops = ops;
+}
+
+uint32_t crc32_update(uint32_t crc, const void *data, size_t len) {
+    DEV_ASSERT(data != NULL || len == 0);
+
+    const crc32_hal_ops_t *ops = crc32_ops;
+
+    /* 짧은 구간은 주변장치 설정 비용이 더 큼, 주변장치 사용 중이면 소프트웨어로 */
+    if (ops != NULL && len >= CRC32_HW_MIN_LEN && ops->calc(&crc, data, len)) {
+        return crc;
+    }
+    return crc32_update_sw(crc, data, len);
+}
+
+uint32_t crc32_update_sw(uint32_t crc, const void *data, size_t len) {
+    DEV_ASSERT(data != NULL || len == 0);
+
+    const uint8_t *p = data;
+
+    for (; len >= 8; len -= 8, p += 8) {
+        uint32_t one = crc ^ load_le32(p);
+        uint32_t two = load_le32(p + 4);
+
+        crc = crc32_table[7][one & 0xFF] ^ crc32_table[6][(one >> 8) & 0xFF] ^
+              crc32_table[5][(one >> 16) & 0xFF] ^ crc32_table[4][one >> 24] ^
+              crc32_table[3][two & 0xFF] ^ crc32_table[2][(two >> 8) & 0xFF] ^
+              crc32_table[1][(two >> 16) & 0xFF] ^ crc32_table[0][two >> 24];
+    }
+    for (; len > 0; len--, p++) {
+        crc = crc32_table[0][(crc ^ *p) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
@@ -0,0 +1,158 @@
+#include <string.h>
+#include "record_ring.h"
+#include "dev_assert.h"
+
+#ifndef TAG
+#define TAG "record_ring"
+#endif
+
+#include "log.h"
+
+/* acquire/release 규칙은 ringbuffer.c와 동일 */
+#define RR_LOAD_RELAXED(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+#define RR_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define RR_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/*
+ * 레코드 배치 단위 = 헤더 크기
+ * 모든 레코드가 이 단위로 정렬되므로 버퍼 끝에 남는 공간은 0 또는 헤더 이상이고,
+ * 랩 마커(헤더 하나)는 항상 들어감
+ */
+#define RR_UNIT      sizeof(record_ring_hdr_t)
+#define RR_WRAP_MARK 0xFFFFu
+
+STATIC_ASSERT(sizeof(record_ring_hdr_t) == 8, "record_ring_hdr_t must stay 8 bytes");
+
+static inline size_t rr_idx(const record_ring_t *rr, size_t pos) {
+    return pos & rr->mask;
+}
+
+/* 헤더 + 페이로드를 배치 단위로 올림한 크기 */
+static inline size_t rr_footprint(size_t len) {
+    return (sizeof(record_ring_hdr_t) + len + RR_UNIT - 1) & ~(RR_UNIT - 1);
+}
+
+static inline record_ring_hdr_t *rr_hdr_at(const record_ring_t *rr, size_t pos) {
+    return (record_ring_hdr_t *)&rr->buffer[rr_idx(rr, pos)];
+}
+
+void record_ring_init(record_ring_t *rr, void *buffer, size_t size) {
+    DEV_ASSERT(rr != NULL);
+    DEV_ASSERT(buffer != NULL);
+    DEV_ASSERT_MSG(((uintptr_t)buffer & 3) == 0, "record ring buffer must be 4-byte aligned");
+    DEV_ASSERT_MSG(RINGBUFFER_IS_POW2(size) && size >= 2 * RR_UNIT,
+                   "record ring size must be a power of two");
+
+    rr->buffer = buffer;
+    rr->size = size;
+    rr->mask = size - 1;
+    record_ring_reset(rr);
+}
+
+void record_ring_reset(record_ring_t *rr) {
+    DEV_ASSERT(rr != NULL);
+
+    rr->head = 0;
+    rr->tail = 0;
+    rr->reserved = 0;
+    rr->drop_cnt = 0;
+}
+
+uint8_t *record_ring_reserve(record_ring_t *rr, size_t len) {
+    DEV_ASSERT(rr != NULL);
+    DEV_ASSERT(len < RR_WRAP_MARK);
+
+    size_t head = RR_LOAD_RELAXED(&rr->head);
+    size_t tail = RR_LOAD_ACQUIRE(&rr->tail);
+    size_t free_space = rr->size - (head - tail);
+    size_t footprint = rr_footprint(len);
+    size_t to_end = rr->size - rr_idx(rr, head);
+    size_t skip = (footprint > to_end) ? to_end : 0;
+
+    if (footprint > rr->size || skip + footprint > free_space) {
+        rr->drop_cnt++;
+        return NULL;
+    }
+
+    if (skip) {
+        /* 남은 끝 공간은 건너뛰도록 표시 (head 공개 전이라 소비자에게 아직 안 보임) */
+        rr_hdr_at(rr, head)->len = RR_WRAP_MARK;
+    }
+
+    rr->reserved = head + skip;
+    return (uint8_t *)(rr_hdr_at(rr, rr->reserved) + 1);
+}
+
+void record_ring_commit(record_ring_t *rr, size_t len, uint16_t type, uint32_t timestamp) {
+    DEV_ASSERT(rr != NULL);
+
+    record_ring_hdr_t *hdr = rr_hdr_at(rr, rr->reserved);
+
+    DEV_ASSERT(rr->reserved - RR_LOAD_ACQUIRE(&rr->tail) + rr_footprint(len) <= rr->size);
+
+    hdr->len = (uint16_t)len;
+    hdr->type = type;
+    hdr->timestamp = timestamp;
+
+    RR_STORE_RELEASE(&rr->head, rr->reserved + rr_footprint(len));
+}
+
+bool record_ring_push(record_ring_t *rr, const void *data, size_t len, uint16_t type,
+                      uint32_t timestamp) {
+    DEV_ASSERT(data != NULL || len == 0);
+
+    uint8_t *dst = record_ring_reserve(rr, len);
+    if (dst == NULL) {
+        return false;
+    }
+
+    memcpy(dst, data, len);
+    record_ring_commit(rr, len, type, timestamp);
+    return true;
+}
+
+const record_ring_hdr_t *record_ring_peek(record_ring_t *rr) {
+    DEV_ASSERT(rr != NULL);
+
+    size_t head = RR_LOAD_ACQUIRE(&rr->head);
+    size_t tail = RR_LOAD_RELAXED(&rr->tail);
+
+    if (head == tail) {
+        return NULL;
+    }
+
+    record_ring_hdr_t *hdr = rr_hdr_at(rr, tail);
+
+    if (hdr->len == RR_WRAP_MARK) {
+        /* 랩 마커 뒤에는 항상 실제 레코드가 있음 (마커와 레코드는 함께 공개됨) */
+        tail += rr->size - rr_idx(rr, tail);
+        RR_STORE_RELEASE(&rr->tail, tail);
+        hdr = rr_hdr_at(rr, tail);
+    }
+
+    return hdr;
+}
+
+bool record_ring_pop(record_ring_t *rr) {
+    const record_ring_hdr_t *hdr = record_ring_peek(rr);
+
+    if (hdr == NULL) {
+        return false;
+    }
+
+    size_t tail = RR_LOAD_RELAXED(&rr->tail);
+    RR_STORE_RELEASE(&rr->tail, tail + rr_footprint(hdr->len));
+    return true;
+}
+
+bool record_ring_is_empty(record_ring_t *rr) {
+    DEV_ASSERT(rr != NULL);
+
+    return RR_LOAD_ACQUIRE(&rr->head) == RR_LOAD_ACQUIRE(&rr->tail);
+}
+
+size_t record_ring_get_drop_count(record_ring_t *rr) {
+    DEV_ASSERT(rr != NULL);
+
+    return rr->drop_cnt;
+}
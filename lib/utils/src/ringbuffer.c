@@ -8,19 +8,94 @@
 
 #include "log.h"
 
+/*
+ * 인덱스 접근 순서 (Cortex-M33: acquire/release → ldr/str + dmb)
+ * - 상대방 인덱스는 acquire로 읽어 그 이전의 데이터 쓰기/읽기가 보이도록 함
+ * - 내 인덱스는 release로 공개하여 그 이전의 memcpy가 먼저 완료되도록 함
+ * - 내 인덱스를 내가 다시 읽을 때는 relaxed로 충분
+ */
+#define RB_LOAD_RELAXED(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+#define RB_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define RB_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/*
+ * head/tail은 free-running 인덱스 (size_t 오버플로우까지 계속 증가)
+ * - 사용량 = head - tail (부호 없는 뺄셈이라 랩어라운드되어도 정확)
+ * - 실제 메모리 위치 = 인덱스 & mask (size는 2의 거듭제곱)
+ */
+static inline size_t rb_used(size_t head, size_t tail) {
+    return head - tail;
+}
+
+static inline size_t rb_idx(const ringbuffer_t *rb, size_t pos) {
+    return pos & rb->mask;
+}
+
+/*
+ * 소비자 측 tail 읽기
+ * DMA 모드에서 소비자가 한 바퀴 이상 밀렸으면 이미 덮어쓰인 구간을 건너뜀
+ * (다른 모드에서는 head - tail <= mask가 항상 성립하므로 tail을 그대로 반환)
+ */
+static inline size_t rb_consumer_tail(ringbuffer_t *rb, size_t head) {
+    size_t tail = RB_LOAD_RELAXED(&rb->tail);
+
+    if (rb_used(head, tail) > rb->mask) {
+        tail = head - rb->mask;
+        RB_STORE_RELEASE(&rb->tail, tail);
+    }
+
+    return tail;
+}
+
 void ringbuffer_init(ringbuffer_t *rb, char *buffer, size_t size) {
     DEV_ASSERT(rb != NULL);
     DEV_ASSERT(buffer != NULL);
-    DEV_ASSERT(size > 0);
+    DEV_ASSERT_MSG(RINGBUFFER_IS_POW2(size), "ringbuffer size must be a power of two");
 
     rb->buffer = buffer;
     rb->size = size;
+    rb->mask = size - 1;
     rb->head = 0;
     rb->tail = 0;
+    rb->mode = RINGBUFFER_MODE_OVERWRITE;
     rb->is_overflow = false;
     rb->overflow_cnt = 0;
 }
 
+void ringbuffer_set_mode(ringbuffer_t *rb, ringbuffer_mode_t mode) {
+    DEV_ASSERT(rb != NULL);
+
+    rb->mode = mode;
+}
+
+size_t ringbuffer_dma_update(ringbuffer_t *rb, size_t dma_pos) {
+    DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(rb->mode == RINGBUFFER_MODE_DMA);
+    DEV_ASSERT(dma_pos <= rb->size);
+
+    size_t head = RB_LOAD_RELAXED(&rb->head);
+
+    /* dma_pos == size (카운트 리로드 직전)는 & mask로 0이 됨 */
+    size_t received = (dma_pos - rb_idx(rb, head)) & rb->mask;
+
+    if (received == 0) {
+        return 0;
+    }
+
+    head += received;
+
+    size_t used = head - RB_LOAD_ACQUIRE(&rb->tail);
+    if (used > rb->mask) {
+        /* 소비자가 읽기 전에 DMA가 덮어씀 */
+        rb->is_overflow = true;
+        rb->overflow_cnt += used - rb->mask;
+    }
+
+    RB_STORE_RELEASE(&rb->head, head);
+
+    return received;
+}
+
 void ringbuffer_deinit(ringbuffer_t *rb) {
     DEV_ASSERT(rb != NULL);
 
@@ -39,13 +114,16 @@ void ringbuffer_reset(ringbuffer_t *rb) {
 bool ringbuffer_is_empty(ringbuffer_t *rb) {
     DEV_ASSERT(rb != NULL);
 
-    return ((rb->head == rb->tail));
+    return RB_LOAD_ACQUIRE(&rb->head) == RB_LOAD_ACQUIRE(&rb->tail);
 }
 
 bool ringbuffer_is_full(ringbuffer_t *rb) {
     DEV_ASSERT(rb != NULL);
 
-    return ((rb->head + 1) % rb->size) == rb->tail;
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = RB_LOAD_ACQUIRE(&rb->tail);
+
+    return rb_used(head, tail) == rb->mask;
 }
 
 bool ringbuffer_is_overflow(ringbuffer_t *rb) {
@@ -69,64 +147,90 @@ size_t ringbuffer_capacity(ringbuffer_t *rb) {
 size_t ringbuffer_size(ringbuffer_t *rb) {
     DEV_ASSERT(rb != NULL);
 
-    size_t size = rb->size - 1;
-
-    if (!ringbuffer_is_full(rb)) {
-        if (rb->head >= rb->tail) {
-            size = rb->head - rb->tail;
-        }
-        else {
-            size = rb->size + rb->head - rb->tail;
-        }
-    }
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
 
-    return size;
+    return rb_used(head, tail);
 }
 
 size_t ringbuffer_free_size(ringbuffer_t *rb) {
     DEV_ASSERT(rb != NULL);
 
-    return rb->size - ringbuffer_size(rb) - 1;
+    return rb->mask - ringbuffer_size(rb);
 }
 
-void ringbuffer_write(ringbuffer_t *rb, const char *data, size_t len) {
+size_t ringbuffer_write(ringbuffer_t *rb, const char *data, size_t len) {
     DEV_ASSERT(rb != NULL);
     DEV_ASSERT(data != NULL);
     DEV_ASSERT(len != 0 && len < ringbuffer_capacity(rb));
+    DEV_ASSERT(rb->mode != RINGBUFFER_MODE_DMA);
 
-    size_t free_space = ringbuffer_free_size(rb);
+    size_t head = RB_LOAD_RELAXED(&rb->head);
+    size_t tail = RB_LOAD_ACQUIRE(&rb->tail);
+    size_t free_space = rb->mask - rb_used(head, tail);
 
     if (len > free_space) {
         size_t overflow_len = len - free_space;
-        rb->tail = (rb->tail + overflow_len) % rb->size;
+
+        if (rb->mode == RINGBUFFER_MODE_SPSC) {
+            /* 소비자 인덱스는 건드리지 않고 넘치는 데이터를 버림 */
+            len = free_space;
+        }
+        else {
+            rb->tail = tail + overflow_len;
+        }
         rb->is_overflow = true;
         rb->overflow_cnt += overflow_len;
+
+        if (len == 0) {
+            return 0;
+        }
     }
 
-    size_t first_chunk = rb->size - rb->head;
+    size_t start = rb_idx(rb, head);
+    size_t first_chunk = rb->size - start;
 
     if (first_chunk >= len) {
-        memcpy(&rb->buffer[rb->head], data, len);
+        memcpy(&rb->buffer[start], data, len);
     }
     else {
-        memcpy(&rb->buffer[rb->head], data, first_chunk);
+        memcpy(&rb->buffer[start], data, first_chunk);
         memcpy(&rb->buffer[0], data + first_chunk, len - first_chunk);
     }
 
-    rb->head = (rb->head + len) % rb->size;
+    RB_STORE_RELEASE(&rb->head, head + len);
+
+    return len;
 }
 
-void ringbuffer_write_byte(ringbuffer_t *rb, char data) {
+bool ringbuffer_write_byte(ringbuffer_t *rb, char data) {
     DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(rb->mode != RINGBUFFER_MODE_DMA);
+
+    size_t head = RB_LOAD_RELAXED(&rb->head);
+
+    if (rb->mode == RINGBUFFER_MODE_SPSC) {
+        if (rb_used(head, RB_LOAD_ACQUIRE(&rb->tail)) == rb->mask) {
+            rb->is_overflow = true;
+            rb->overflow_cnt++;
+            return false;
+        }
 
-    rb->buffer[rb->head] = data;
-    rb->head = (rb->head + 1) % rb->size;
+        rb->buffer[rb_idx(rb, head)] = data;
+        RB_STORE_RELEASE(&rb->head, head + 1);
+        return true;
+    }
+
+    rb->buffer[rb_idx(rb, head)] = data;
+    rb->head = head + 1;
 
-    if (rb->head == rb->tail) {
-        rb->tail = (rb->tail + 1) % rb->size;
+    if (rb_used(rb->head, rb->tail) > rb->mask) {
+        rb->tail++;
         rb->is_overflow = true;
         rb->overflow_cnt++;
     }
+
+    return true;
 }
 
 size_t ringbuffer_read(ringbuffer_t *rb, char *data, size_t len) {
@@ -134,24 +238,27 @@ size_t ringbuffer_read(ringbuffer_t *rb, char *data, size_t len) {
     DEV_ASSERT(data != NULL);
     DEV_ASSERT(len != 0 && len < ringbuffer_capacity(rb));
 
-    size_t available = ringbuffer_size(rb);
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+    size_t available = rb_used(head, tail);
     size_t read_len = (len <= available) ? len : available;
 
     if (read_len == 0) {
         return 0;
     }
 
-    size_t first_chunk = rb->size - rb->tail;
+    size_t start = rb_idx(rb, tail);
+    size_t first_chunk = rb->size - start;
 
     if (first_chunk >= read_len) {
-        memcpy(data, &rb->buffer[rb->tail], read_len);
+        memcpy(data, &rb->buffer[start], read_len);
     }
     else {
-        memcpy(data, &rb->buffer[rb->tail], first_chunk);
+        memcpy(data, &rb->buffer[start], first_chunk);
         memcpy(data + first_chunk, &rb->buffer[0], read_len - first_chunk);
     }
 
-    rb->tail = (rb->tail + read_len) % rb->size;
+    RB_STORE_RELEASE(&rb->tail, tail + read_len);
 
     return read_len;
 }
@@ -160,12 +267,15 @@ bool ringbuffer_read_byte(ringbuffer_t *rb, char *data) {
     DEV_ASSERT(rb != NULL);
     DEV_ASSERT(data != NULL);
 
-    if (ringbuffer_is_empty(rb)) {
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+
+    if (head == tail) {
         return false;
     }
 
-    *data = rb->buffer[rb->tail];
-    rb->tail = (rb->tail + 1) % rb->size;
+    *data = rb->buffer[rb_idx(rb, tail)];
+    RB_STORE_RELEASE(&rb->tail, tail + 1);
 
     return true;
 }
@@ -179,14 +289,16 @@ bool ringbuffer_peek(ringbuffer_t *rb, char *data, size_t len, size_t offset) {
         return true;
     }
 
-    size_t current_size = ringbuffer_size(rb);
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+    size_t current_size = rb_used(head, tail);
 
     // 데이터 부족하면 false 리턴 (assert로 죽이지 않음)
     if (offset >= current_size || len > (current_size - offset)) {
         return false;
     }
 
-    size_t peek_start_idx = (rb->tail + offset) % rb->size;
+    size_t peek_start_idx = rb_idx(rb, tail + offset);
     size_t need_wrap = rb->size - peek_start_idx < len;
 
     if (!need_wrap) {
@@ -206,25 +318,252 @@ bool ringbuffer_peek_byte(ringbuffer_t *rb, char *data) {
     DEV_ASSERT(rb != NULL);
     DEV_ASSERT(data != NULL);
 
-    if (ringbuffer_is_empty(rb)) {
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+
+    if (head == tail) {
         return false;
     }
 
-    *data = rb->buffer[rb->tail];
+    *data = rb->buffer[rb_idx(rb, tail)];
     return true;
 }
 
+size_t ringbuffer_peek_spans(ringbuffer_t *rb, size_t offset, size_t len,
+                             ringbuffer_span_t spans[2]) {
+    DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(spans != NULL);
+
+    if (len == 0) {
+        return 0;
+    }
+
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+    size_t current_size = rb_used(head, tail);
+
+    if (offset >= current_size || len > (current_size - offset)) {
+        return 0;
+    }
+
+    size_t start = rb_idx(rb, tail + offset);
+    size_t first_chunk = rb->size - start;
+
+    spans[0].data = &rb->buffer[start];
+
+    if (first_chunk >= len) {
+        spans[0].len = len;
+        return 1;
+    }
+
+    spans[0].len = first_chunk;
+    spans[1].data = &rb->buffer[0];
+    spans[1].len = len - first_chunk;
+    return 2;
+}
+
+bool ringbuffer_consume(ringbuffer_t *rb, size_t len) {
+    DEV_ASSERT(rb != NULL);
+
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+
+    if (len > rb_used(head, tail)) {
+        return false;
+    }
+
+    RB_STORE_RELEASE(&rb->tail, tail + len);
+    return true;
+}
+
+size_t ringbuffer_reserve(ringbuffer_t *rb, char **ptr) {
+    DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(ptr != NULL);
+    DEV_ASSERT(rb->mode != RINGBUFFER_MODE_DMA);
+
+    size_t head = RB_LOAD_RELAXED(&rb->head);
+    size_t tail = RB_LOAD_ACQUIRE(&rb->tail);
+    size_t free_space = rb->mask - rb_used(head, tail);
+    size_t contiguous = rb->size - rb_idx(rb, head);
+
+    *ptr = &rb->buffer[rb_idx(rb, head)];
+
+    return (free_space < contiguous) ? free_space : contiguous;
+}
+
+void ringbuffer_commit(ringbuffer_t *rb, size_t len) {
+    DEV_ASSERT(rb != NULL);
+
+    size_t head = RB_LOAD_RELAXED(&rb->head);
+
+    DEV_ASSERT(len <= rb->size - rb_idx(rb, head));
+
+    RB_STORE_RELEASE(&rb->head, head + len);
+}
+
+/*===========================================================================
+ * 검색
+ *===========================================================================*/
+
+/* [offset, offset + len) 구간에서 ch 검색, 구간별 memchr */
+static bool rb_find_char_in(ringbuffer_t *rb, char ch, size_t offset, size_t len, size_t *pos) {
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, offset, len, spans);
+
+    for (size_t i = 0; i < span_cnt; i++) {
+        const char *hit = memchr(spans[i].data, ch, spans[i].len);
+        if (hit) {
+            *pos = offset + (size_t)(hit - spans[i].data);
+            return true;
+        }
+        offset += spans[i].len;
+    }
+
+    return false;
+}
+
+/* offset 위치의 데이터가 seq와 같은지 비교 */
+static bool rb_match_at(ringbuffer_t *rb, size_t offset, const char *seq, size_t seq_len) {
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, offset, seq_len, spans);
+
+    if (span_cnt == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < span_cnt; i++) {
+        if (memcmp(spans[i].data, seq, spans[i].len) != 0) {
+            return false;
+        }
+        seq += spans[i].len;
+    }
+
+    return true;
+}
+
+/* find_any_of: 이 개수 이하의 문자 집합은 문자별 memchr, 초과하면 256비트 맵 */
+#define RB_FIND_ANY_MEMCHR_MAX 4
+
+static inline size_t rb_search_limit(ringbuffer_t *rb, size_t max_search) {
+    size_t available = ringbuffer_size(rb);
+    return (max_search < available) ? max_search : available;
+}
+
+bool ringbuffer_find_char(ringbuffer_t *rb, char ch, size_t max_search, size_t *pos) {
+    DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(pos != NULL);
+
+    return rb_find_char_in(rb, ch, 0, rb_search_limit(rb, max_search), pos);
+}
+
+bool ringbuffer_find_any_of(ringbuffer_t *rb, const char *set, size_t max_search, size_t *pos) {
+    DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(set != NULL);
+    DEV_ASSERT(pos != NULL);
+
+    if (set[0] == '\0') {
+        return false;
+    }
+    if (set[1] == '\0') {
+        return ringbuffer_find_char(rb, set[0], max_search, pos);
+    }
+
+    size_t set_len = strlen(set);
+    size_t limit = rb_search_limit(rb, max_search);
+
+    if (set_len <= RB_FIND_ANY_MEMCHR_MAX) {
+        /*
+         * 작은 집합: 문자별 memchr (word 단위 비교) 반복
+         * 찾을 때마다 검색 범위를 그 위치까지 줄이므로 전체 비용은 문자 수만큼의 memchr 이하
+         */
+        bool found = false;
+
+        for (size_t i = 0; i < set_len; i++) {
+            size_t hit;
+            if (rb_find_char_in(rb, set[i], 0, limit, &hit)) {
+                limit = hit;
+                *pos = hit;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    /* 256비트 문자 집합 맵 */
+    uint32_t map[8] = {0};
+    for (const unsigned char *p = (const unsigned char *)set; *p; p++) {
+        map[*p >> 5] |= 1UL << (*p & 31);
+    }
+
+    ringbuffer_span_t spans[2];
+    size_t span_cnt = ringbuffer_peek_spans(rb, 0, limit, spans);
+    size_t base = 0;
+
+    for (size_t i = 0; i < span_cnt; i++) {
+        const unsigned char *data = (const unsigned char *)spans[i].data;
+        for (size_t j = 0; j < spans[i].len; j++) {
+            if (map[data[j] >> 5] & (1UL << (data[j] & 31))) {
+                *pos = base + j;
+                return true;
+            }
+        }
+        base += spans[i].len;
+    }
+
+    return false;
+}
+
+bool ringbuffer_find_seq(ringbuffer_t *rb, const char *seq, size_t seq_len, size_t max_search,
+                         size_t *pos) {
+    DEV_ASSERT(rb != NULL);
+    DEV_ASSERT(seq != NULL);
+    DEV_ASSERT(seq_len > 0);
+    DEV_ASSERT(pos != NULL);
+
+    size_t limit = rb_search_limit(rb, max_search);
+
+    if (limit < seq_len) {
+        return false;
+    }
+
+    /* 첫 바이트는 memchr로 건너뛰고, 후보 위치에서만 전체 비교 */
+    size_t last_start = limit - seq_len;
+    size_t start = 0;
+
+    while (start <= last_start) {
+        size_t cand;
+        if (!rb_find_char_in(rb, seq[0], start, last_start - start + 1, &cand)) {
+            return false;
+        }
+        if (rb_match_at(rb, cand, seq, seq_len)) {
+            *pos = cand;
+            return true;
+        }
+        start = cand + 1;
+    }
+
+    return false;
+}
+
 bool ringbuffer_advance(ringbuffer_t *rb, size_t len) {
     DEV_ASSERT(rb != NULL);
     DEV_ASSERT(len < ringbuffer_capacity(rb));
 
-    size_t available = ringbuffer_size(rb);
+    size_t head = RB_LOAD_ACQUIRE(&rb->head);
+    size_t tail = rb_consumer_tail(rb, head);
+    size_t available = rb_used(head, tail);
 
     if (len > available) {
-        ringbuffer_reset(rb);
+        if (rb->mode != RINGBUFFER_MODE_OVERWRITE) {
+            /* 생산자 인덱스는 건드리지 않고 현재 데이터만 버림 */
+            RB_STORE_RELEASE(&rb->tail, head);
+        }
+        else {
+            ringbuffer_reset(rb);
+        }
         return false;
     }
 
-    rb->tail = (rb->tail + len) % rb->size;
+    RB_STORE_RELEASE(&rb->tail, tail + len);
     return true;
 }
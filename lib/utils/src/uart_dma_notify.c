@@ -0,0 +1,39 @@
+#include "uart_dma_notify.h"
+
+void uart_dma_notify_from_isr(TaskHandle_t task, uint32_t events) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    if (task == NULL || events == 0) {
+        return;
+    }
+
+    xTaskNotifyFromISR(task, events, eSetBits, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+void uart_dma_notify_cb(uart_dma_port_t *port, uint32_t events, void *arg) {
+    TaskHandle_t *task = arg;
+
+    (void)port;
+    if (task != NULL) {
+        uart_dma_notify_from_isr(*task, events);
+    }
+}
+
+void uart_dma_notify_stop(TaskHandle_t task) {
+    if (task != NULL) {
+        xTaskNotify(task, UART_DMA_NOTIFY_STOP, eSetBits);
+    }
+}
+
+uint32_t uart_dma_notify_wait(uint32_t timeout_ms) {
+    uint32_t bits = 0;
+    TickType_t ticks = (timeout_ms == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+
+    /* 진입 시에는 지우지 않고 (대기 전 도착한 비트 유지), 나갈 때 전부 지움 */
+    if (xTaskNotifyWait(0, UART_DMA_NOTIFY_ALL, &bits, ticks) != pdTRUE) {
+        return 0;
+    }
+
+    return bits;
+}
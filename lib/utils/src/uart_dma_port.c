@@ -0,0 +1,276 @@
+#include "uart_dma_port.h"
+#include "dev_assert.h"
+
+#ifndef TAG
+#define TAG "uart_dma"
+#endif
+
+#include "log.h"
+
+/*===========================================================================
+ * uart_tx → 주변장치/RTOS 연결
+ *===========================================================================*/
+
+static bool port_tx_start(void *ctx, const uint8_t *data, size_t len) {
+    uart_dma_port_t *port = ctx;
+
+    return port->desc->hw->tx_start(port, data, len);
+}
+
+static void port_tx_lock(void *ctx) {
+    uart_dma_port_t *port = ctx;
+
+    port->desc->os->lock(port);
+}
+
+static void port_tx_unlock(void *ctx) {
+    uart_dma_port_t *port = ctx;
+
+    port->desc->os->unlock(port);
+}
+
+static bool port_tx_wait(void *ctx, uint32_t timeout_ms) {
+    uart_dma_port_t *port = ctx;
+
+    return port->desc->os->wait(port, timeout_ms);
+}
+
+static void port_tx_notify(void *ctx) {
+    uart_dma_port_t *port = ctx;
+
+    port->desc->os->notify(port);
+}
+
+static uint32_t port_tx_now_ms(void *ctx) {
+    uart_dma_port_t *port = ctx;
+
+    return port->desc->os->now_ms(port);
+}
+
+/* os 연산 중 제공된 것만 연결 */
+static void port_tx_ops_init(uart_dma_port_t *port) {
+    const uart_dma_os_ops_t *os = port->desc->os;
+
+    port->tx_ops = (uart_tx_ops_t){.start = port_tx_start};
+    if (!os) {
+        return;
+    }
+    if (os->lock && os->unlock) {
+        port->tx_ops.lock = port_tx_lock;
+        port->tx_ops.unlock = port_tx_unlock;
+    }
+    if (os->wait && os->now_ms) {
+        port->tx_ops.wait = port_tx_wait;
+    }
+    if (os->notify) {
+        port->tx_ops.notify = port_tx_notify;
+    }
+    if (os->now_ms) {
+        port->tx_ops.now_ms = port_tx_now_ms;
+    }
+}
+
+/*===========================================================================
+ * 초기화 / 시작 / 정지
+ *===========================================================================*/
+
+void uart_dma_port_init(uart_dma_port_t *port, const uart_dma_desc_t *desc) {
+    DEV_ASSERT(port != NULL);
+    DEV_ASSERT(desc != NULL && desc->hw != NULL);
+    DEV_ASSERT(desc->rx_buf != NULL && RINGBUFFER_IS_POW2(desc->rx_size));
+    DEV_ASSERT(desc->hw->rx_start != NULL && desc->hw->rx_remaining != NULL);
+    DEV_ASSERT(desc->tx_buf == NULL || desc->hw->tx_start != NULL);
+
+    port->desc = desc;
+    port->on_event = NULL;
+    port->event_arg = NULL;
+    port->rx_events = 0;
+    port->overruns = 0;
+    port->errors = 0;
+    port->running = false;
+
+    uart_dma_port_bind_rx(port, &port->rx_ring);
+
+    port_tx_ops_init(port);
+    if (desc->tx_buf) {
+        uart_tx_init(&port->tx, desc->tx_buf, desc->tx_size, &port->tx_ops, port);
+    }
+}
+
+void uart_dma_port_bind_rx(uart_dma_port_t *port, ringbuffer_t *rb) {
+    DEV_ASSERT(port != NULL && rb != NULL);
+    DEV_ASSERT(!port->running);
+
+    ringbuffer_init(rb, port->desc->rx_buf, port->desc->rx_size);
+    ringbuffer_set_mode(rb, RINGBUFFER_MODE_DMA);
+    port->rx = rb;
+    port->rx_overflow_seen = 0;
+}
+
+void uart_dma_port_set_event_cb(uart_dma_port_t *port, uart_dma_event_cb_t cb, void *arg) {
+    DEV_ASSERT(port != NULL);
+    DEV_ASSERT(!port->running || cb == NULL);
+
+    /* 콜백을 먼저 바꿈: ISR은 콜백을 읽은 뒤 인자를 읽음 */
+    port->on_event = cb;
+    port->event_arg = arg;
+}
+
+void uart_dma_port_start(uart_dma_port_t *port) {
+    DEV_ASSERT(port != NULL);
+
+    const uart_dma_hw_ops_t *hw = port->desc->hw;
+
+    /* 링 위치에서 이어서 받음 (stop 후에는 0) */
+    hw->rx_start(port, port->rx->head & port->rx->mask);
+    if (hw->start) {
+        hw->start(port);
+    }
+    port->running = true;
+}
+
+void uart_dma_port_stop(uart_dma_port_t *port) {
+    DEV_ASSERT(port != NULL);
+
+    if (port->desc->hw->stop) {
+        port->desc->hw->stop(port);
+    }
+    port->running = false;
+
+    if (port->desc->tx_buf) {
+        uart_tx_reset(&port->tx);
+    }
+    ringbuffer_reset(port->rx);
+    port->rx_overflow_seen = 0;
+}
+
+/*===========================================================================
+ * RX
+ *===========================================================================*/
+
+ringbuffer_t *uart_dma_port_rx(uart_dma_port_t *port) {
+    DEV_ASSERT(port != NULL);
+
+    return port->rx;
+}
+
+size_t uart_dma_port_rx_pos(uart_dma_port_t *port) {
+    DEV_ASSERT(port != NULL);
+
+    return port->desc->rx_size - port->desc->hw->rx_remaining(port);
+}
+
+/* DMA 쓰기 위치 공개, 발생한 이벤트 비트 반환 */
+static uint32_t rx_publish(uart_dma_port_t *port) {
+    uint32_t events = 0;
+
+    if (ringbuffer_dma_update(port->rx, uart_dma_port_rx_pos(port)) > 0) {
+        port->rx_events++;
+        events |= UART_DMA_EVT_RX;
+    }
+
+    size_t lost = port->rx->overflow_cnt;
+
+    if (lost != port->rx_overflow_seen) {
+        port->rx_overflow_seen = lost;
+        events |= UART_DMA_EVT_OVERFLOW;
+    }
+
+    return events;
+}
+
+static void port_signal(uart_dma_port_t *port, uint32_t events) {
+    uart_dma_event_cb_t cb = port->on_event;
+
+    if (events && cb) {
+        cb(port, events, port->event_arg);
+    }
+}
+
+void uart_dma_port_rx_isr(uart_dma_port_t *port) {
+    DEV_ASSERT(port != NULL);
+
+    port_signal(port, rx_publish(port));
+}
+
+void uart_dma_port_error_isr(uart_dma_port_t *port, uint32_t errors) {
+    DEV_ASSERT(port != NULL);
+
+    /* 오류 전까지 DMA가 쓴 데이터는 유효 */
+    uint32_t events = rx_publish(port);
+
+    if (errors & UART_DMA_ERR_OVERRUN) {
+        port->overruns++;
+        events |= UART_DMA_EVT_OVERFLOW;
+    }
+    if (errors & ~UART_DMA_ERR_OVERRUN) {
+        port->errors++;
+        events |= UART_DMA_EVT_ERROR;
+    }
+
+    /* 멈춘 채널은 공개한 위치 다음부터 다시 받음 (링 위치 유지) */
+    if ((errors & UART_DMA_ERR_RX_DMA) && port->running) {
+        port->desc->hw->rx_start(port, port->rx->head & port->rx->mask);
+    }
+
+    port_signal(port, events);
+}
+
+/*===========================================================================
+ * TX
+ *===========================================================================*/
+
+size_t uart_dma_port_write(uart_dma_port_t *port, const void *data, size_t len,
+                           uint32_t timeout_ms) {
+    DEV_ASSERT(port != NULL);
+
+    if (!port->desc->tx_buf) {
+        return 0;
+    }
+
+    return uart_tx_write(&port->tx, data, len, timeout_ms);
+}
+
+bool uart_dma_port_write_sync(uart_dma_port_t *port, const void *data, size_t len,
+                              uint32_t timeout_ms) {
+    DEV_ASSERT(port != NULL);
+
+    if (!port->desc->tx_buf) {
+        return false;
+    }
+
+    return uart_tx_write_sync(&port->tx, data, len, timeout_ms);
+}
+
+bool uart_dma_port_flush(uart_dma_port_t *port, uint32_t timeout_ms) {
+    DEV_ASSERT(port != NULL);
+
+    if (!port->desc->tx_buf) {
+        return true;
+    }
+
+    return uart_tx_flush(&port->tx, timeout_ms);
+}
+
+bool uart_dma_port_set_baudrate(uart_dma_port_t *port, uint32_t baudrate, uint32_t timeout_ms) {
+    DEV_ASSERT(port != NULL);
+
+    if (!port->desc->hw->set_baudrate) {
+        return false;
+    }
+
+    if (!uart_dma_port_flush(port, timeout_ms)) {
+        LOG_WARN("%s: TX busy, baudrate %lu not applied", port->desc->name,
+                 (unsigned long)baudrate);
+        return false;
+    }
+
+    port->desc->hw->set_baudrate(port, baudrate);
+    return true;
+}
+
+void uart_dma_port_tx_isr(uart_dma_port_t *port) {
+    DEV_ASSERT(port != NULL);
+
+    uart_tx_dma_done(&port->tx);
+}
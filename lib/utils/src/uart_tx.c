@@ -0,0 +1,259 @@
+#include <string.h>
+#include "uart_tx.h"
+#include "dev_assert.h"
+
+#ifndef TAG
+#define TAG "uart_tx"
+#endif
+
+#include "log.h"
+
+/*
+ * 여러 대기자(write 공간 대기, write_sync 완료 대기)가 같은 통지를 나눠 쓰므로
+ * 통지를 놓친 대기자도 이 주기마다 조건을 다시 확인함
+ */
+#define UART_TX_WAIT_SLICE_MS 10
+
+/* busy는 태스크와 ISR이 모두 잡으려 하므로 순서를 강하게 보장 */
+#define TX_EXCHANGE(p, v)      __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+#define TX_STORE_SEQ(p, v)     __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define TX_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define TX_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* 누적 카운터 비교 (wrap 허용): a가 b 이상 */
+static inline bool seq_reached(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) >= 0;
+}
+
+void uart_tx_init(uart_tx_t *tx, void *mem, size_t size, const uart_tx_ops_t *ops, void *ctx) {
+    DEV_ASSERT(tx != NULL);
+    DEV_ASSERT(mem != NULL);
+    DEV_ASSERT(size >= 2);
+    DEV_ASSERT(ops != NULL && ops->start != NULL);
+    DEV_ASSERT(ops->wait == NULL || ops->now_ms != NULL);
+
+    bipbuffer_init(&tx->q, mem, size);
+    tx->ops = ops;
+    tx->ctx = ctx;
+    tx->max_chunk = size / 2;
+    tx->queued = 0;
+    tx->sent = 0;
+    tx->in_flight = 0;
+    tx->busy = 0;
+    tx->lost_end = 0;
+    tx->dropped = 0;
+    tx->start_errors = 0;
+}
+
+void uart_tx_reset(uart_tx_t *tx) {
+    DEV_ASSERT(tx != NULL);
+
+    bipbuffer_reset(&tx->q);
+    tx->in_flight = 0;
+    tx->lost_end = tx->queued;
+    TX_STORE_RELEASE(&tx->sent, tx->queued);
+    TX_STORE_SEQ(&tx->busy, 0);
+}
+
+/*===========================================================================
+ * 소비자 (전송 시작)
+ *===========================================================================*/
+
+/*
+ * busy를 먼저 잡은 쪽만 다음 블록을 시작함.
+ * 빈 큐를 확인하고 busy를 놓은 직후 생산자가 commit하면, 생산자의 kick이
+ * 아직 busy를 보고 포기했을 수 있으므로 놓은 뒤 한 번 더 확인
+ */
+static void tx_kick(uart_tx_t *tx) {
+    for (;;) {
+        if (TX_EXCHANGE(&tx->busy, 1)) {
+            return;
+        }
+
+        size_t len;
+        const uint8_t *blk = bipbuffer_read_acquire(&tx->q, &len);
+
+        if (blk) {
+            tx->in_flight = len;
+            if (tx->ops->start(tx->ctx, blk, len)) {
+                return;
+            }
+
+            /* 시작 실패: 블록은 버리고 완료로 처리 (대기자가 무한 대기하지 않도록) */
+            tx->start_errors++;
+            tx->in_flight = 0;
+            bipbuffer_read_release(&tx->q, len);
+            tx->lost_end = tx->sent + (uint32_t)len;
+            TX_STORE_RELEASE(&tx->sent, tx->lost_end);
+        }
+
+        TX_STORE_SEQ(&tx->busy, 0);
+
+        if (bipbuffer_is_empty(&tx->q)) {
+            return;
+        }
+    }
+}
+
+void uart_tx_dma_done(uart_tx_t *tx) {
+    DEV_ASSERT(tx != NULL);
+
+    size_t len = tx->in_flight;
+
+    tx->in_flight = 0;
+    bipbuffer_read_release(&tx->q, len);
+    TX_STORE_RELEASE(&tx->sent, tx->sent + (uint32_t)len);
+    TX_STORE_SEQ(&tx->busy, 0);
+
+    /* 다음 블록을 먼저 시작한 뒤 통지 (UART 유휴 시간 최소화) */
+    tx_kick(tx);
+
+    if (tx->ops->notify) {
+        tx->ops->notify(tx->ctx);
+    }
+}
+
+bool uart_tx_is_busy(uart_tx_t *tx) {
+    DEV_ASSERT(tx != NULL);
+
+    return !seq_reached(TX_LOAD_ACQUIRE(&tx->sent), TX_LOAD_ACQUIRE(&tx->queued));
+}
+
+/*===========================================================================
+ * 생산자
+ *===========================================================================*/
+
+/* 남은 시간 동안 완료 통지를 한 조각 기다림. 시간이 다 됐으면 false */
+static bool tx_wait_slice(uart_tx_t *tx, uint32_t start_ms, uint32_t timeout_ms) {
+    if (!tx->ops->wait || timeout_ms == 0) {
+        return false;
+    }
+
+    uint32_t elapsed = tx->ops->now_ms(tx->ctx) - start_ms;
+
+    if (elapsed >= timeout_ms) {
+        return false;
+    }
+
+    uint32_t slice = timeout_ms - elapsed;
+
+    if (slice > UART_TX_WAIT_SLICE_MS) {
+        slice = UART_TX_WAIT_SLICE_MS;
+    }
+
+    tx->ops->wait(tx->ctx, slice);
+    return true;
+}
+
+/* 연속 공간이 len보다 작으면 반씩 줄여가며 들어가는 만큼 예약 */
+static uint8_t *tx_reserve(uart_tx_t *tx, size_t len, size_t *got) {
+    for (size_t n = len; n > 0; n /= 2) {
+        uint8_t *dst = bipbuffer_reserve(&tx->q, n);
+
+        if (dst) {
+            *got = n;
+            return dst;
+        }
+    }
+
+    return NULL;
+}
+
+/* lock 안에서 큐에 넣고, 넣은 데이터의 위치(누적) [begin_seq, end_seq)를 돌려줌 */
+static size_t tx_enqueue(uart_tx_t *tx, const uint8_t *data, size_t len, uint32_t start_ms,
+                         uint32_t timeout_ms, uint32_t *begin_seq, uint32_t *end_seq) {
+    size_t done = 0;
+
+    if (tx->ops->lock) {
+        tx->ops->lock(tx->ctx);
+    }
+
+    *begin_seq = tx->queued;
+
+    while (done < len) {
+        size_t want = len - done;
+        size_t got = 0;
+
+        if (want > tx->max_chunk) {
+            want = tx->max_chunk;
+        }
+
+        uint8_t *dst = tx_reserve(tx, want, &got);
+
+        if (!dst) {
+            /* 공간 부족: 전송이 멈춰 있지 않게 한 번 더 시작 시도 후 대기 */
+            tx_kick(tx);
+            if (!tx_wait_slice(tx, start_ms, timeout_ms)) {
+                break;
+            }
+            continue;
+        }
+
+        memcpy(dst, &data[done], got);
+        bipbuffer_commit(&tx->q, got);
+        TX_STORE_RELEASE(&tx->queued, tx->queued + (uint32_t)got);
+        done += got;
+
+        tx_kick(tx);
+    }
+
+    tx->dropped += (uint32_t)(len - done);
+    *end_seq = tx->queued;
+
+    if (tx->ops->unlock) {
+        tx->ops->unlock(tx->ctx);
+    }
+
+    return done;
+}
+
+/* sent가 target에 도달할 때까지 대기 */
+static bool tx_wait_sent(uart_tx_t *tx, uint32_t target, uint32_t start_ms, uint32_t timeout_ms) {
+    while (!seq_reached(TX_LOAD_ACQUIRE(&tx->sent), target)) {
+        if (!tx_wait_slice(tx, start_ms, timeout_ms)) {
+            return seq_reached(TX_LOAD_ACQUIRE(&tx->sent), target);
+        }
+    }
+
+    return true;
+}
+
+static uint32_t tx_now(uart_tx_t *tx) {
+    return tx->ops->now_ms ? tx->ops->now_ms(tx->ctx) : 0;
+}
+
+size_t uart_tx_write(uart_tx_t *tx, const void *data, size_t len, uint32_t timeout_ms) {
+    DEV_ASSERT(tx != NULL);
+    DEV_ASSERT(data != NULL || len == 0);
+
+    uint32_t begin_seq, end_seq;
+
+    return tx_enqueue(tx, data, len, tx_now(tx), timeout_ms, &begin_seq, &end_seq);
+}
+
+bool uart_tx_write_sync(uart_tx_t *tx, const void *data, size_t len, uint32_t timeout_ms) {
+    DEV_ASSERT(tx != NULL);
+    DEV_ASSERT(data != NULL || len == 0);
+
+    uint32_t start_ms = tx_now(tx);
+    uint32_t begin_seq, end_seq;
+
+    if (tx_enqueue(tx, data, len, start_ms, timeout_ms, &begin_seq, &end_seq) < len) {
+        return false;
+    }
+
+    if (!tx_wait_sent(tx, end_seq, start_ms, timeout_ms)) {
+        return false;
+    }
+
+    /* 이 데이터 구간에서 버려진 블록이 있었으면 실패 (끝이 구간 안에 있는 경우만 확인) */
+    uint32_t lost_end = TX_LOAD_ACQUIRE(&tx->lost_end);
+
+    return !(seq_reached(lost_end, begin_seq + 1) && seq_reached(end_seq, lost_end));
+}
+
+bool uart_tx_flush(uart_tx_t *tx, uint32_t timeout_ms) {
+    DEV_ASSERT(tx != NULL);
+
+    return tx_wait_sent(tx, TX_LOAD_ACQUIRE(&tx->queued), tx_now(tx), timeout_ms);
+}
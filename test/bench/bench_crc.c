@@ -0,0 +1,152 @@
+/**
+ * @file bench_crc.c
+ * @brief Host benchmark for lib/utils/src/crc.c
+ *
+ * Not a test: built alongside the tests but not registered with ctest.
+ * Built once per CRC24Q_SLICE option: ./build/bench_crc_slice{1,4,8}
+ *
+ * CRC24Q over RTCM-sized frames:
+ *   bitwise  - previous rtcm.c loop (8 shift/XOR steps per byte)
+ *   slice-N  - crc24q_update() as configured by CRC24Q_SLICE
+ *
+ * Frame sizes: 25 B (1005), 180 B (typical MSM4), 1029 B (max length).
+ *
+ * CRC32 over Unicore-sized frames (software path only, no peripheral on host):
+ *   table-1  - previous gps_unicore.c loop (one 256-entry table lookup per byte)
+ *   slice-8  - crc32_update_sw()
+ *
+ * Frame sizes: 76 B (HEADING2), 148 B (BESTNAV), 1029 B.
+ */
+
+#include "crc.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#define BENCH_BYTES (64u * 1024u * 1024u) /* per measurement */
+
+static uint8_t data[1029];
+static volatile uint32_t sink;
+
+/*===========================================================================
+ * Previous bitwise CRC24Q, kept here as the baseline
+ *===========================================================================*/
+
+static uint32_t ref_crc24q_update(uint32_t crc, const void *buf, size_t len) {
+    const uint8_t *p = buf;
+
+    for (size_t i = 0; i < len; i++) {
+        crc ^= ((uint32_t)p[i]) << 16;
+        for (int j = 0; j < 8; j++) {
+            crc <<= 1;
+            if (crc & 0x1000000) {
+                crc ^= 0x1864CFB;
+            }
+        }
+    }
+    return crc & 0xFFFFFF;
+}
+
+/*===========================================================================
+ * Previous byte-table CRC32 (gps_unicore.c), kept here as the baseline
+ *===========================================================================*/
+
+static uint32_t ref_crc32_table[256];
+
+static void ref_crc32_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int j = 0; j < 8; j++) {
+            c = (c & 1) ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+        }
+        ref_crc32_table[i] = c;
+    }
+}
+
+static uint32_t ref_crc32_update(uint32_t crc, const void *buf, size_t len) {
+    const uint8_t *p = buf;
+
+    for (size_t i = 0; i < len; i++) {
+        crc = ref_crc32_table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t now_ticks(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void run(const char *name, uint32_t (*update)(uint32_t, const void *, size_t),
+                size_t frame_len) {
+    size_t frames = BENCH_BYTES / frame_len;
+    uint32_t crc = 0;
+
+    double t0 = now_sec();
+    uint64_t c0 = now_ticks();
+
+    for (size_t i = 0; i < frames; i++) {
+        crc ^= update(0, data, frame_len);
+    }
+
+    uint64_t ticks = now_ticks() - c0;
+    double sec = now_sec() - t0;
+    double bytes = (double)frames * (double)frame_len;
+
+    sink += crc;
+    printf("  %-10s %5zuB frames %8.2f ms  %8.1f MB/s", name, frame_len, sec * 1e3,
+           bytes / sec / 1e6);
+#ifdef BENCH_HAVE_TSC
+    printf("  %6.2f ticks/B", (double)ticks / bytes);
+#else
+    (void)ticks;
+#endif
+    printf("\n");
+}
+
+int main(void) {
+    static const size_t sizes[] = {25, 180, 1029};
+    static const size_t sizes32[] = {76, 148, 1029};
+    char name[16];
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 131 + 7);
+    }
+    snprintf(name, sizeof(name), "slice-%d", CRC24Q_SLICE);
+
+    printf("crc benchmark: CRC24Q, %u MB per run, CRC24Q_SLICE=%d\n", BENCH_BYTES >> 20,
+           CRC24Q_SLICE);
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        run("bitwise", ref_crc24q_update, sizes[i]);
+        run(name, crc24q_update, sizes[i]);
+    }
+
+    ref_crc32_init();
+    printf("\ncrc benchmark: CRC32 (software), %u MB per run\n", BENCH_BYTES >> 20);
+
+    for (size_t i = 0; i < sizeof(sizes32) / sizeof(sizes32[0]); i++) {
+        run("table-1", ref_crc32_update, sizes32[i]);
+        run("slice-8", crc32_update_sw, sizes32[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,334 @@
+/**
+ * @file bench_gps_nmea.c
+ * @brief Host benchmark for lib/gps/gps_nmea.c sentence parsing
+ *
+ * Not a test: built alongside the tests but not registered with ctest.
+ * Run manually: ./build/bench_gps_nmea
+ *
+ * Replays the sentences in test/fixture/nmea through:
+ *   multi-pass - previous nmea_try_parse (find '\r', copy, count fields,
+ *                XOR, then get_field() rescanning from '$' per field,
+ *                atof/double field decoding)
+ *   streaming  - nmea_try_parse() tokenizer (one pass, resumes where the
+ *                previous wakeup stopped, O(1) field access, fixed-point
+ *                field decoding)
+ *
+ * Each replay is fed in chunks of 1, 16 and 256 bytes to model byte-wise,
+ * DMA half-transfer and idle-line wakeups.
+ *
+ * A second section times only the GGA numeric field decoding (lat, lon,
+ * HDOP, altitude, geoid separation) per sentence: atof/double vs
+ * gps_fixed.c. The host has a double FPU, so the gap on Cortex-M33
+ * (soft-float double) is larger than measured here.
+ */
+
+#include "gps.h"
+#include "gps_fixed.h"
+#include "gps_parser.h"
+#include "nmea/nmea_fixture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#define BENCH_ITERATIONS        2000
+#define BENCH_DECODE_ITERATIONS 200000
+
+static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
+static char replay[1024];
+static size_t replay_len;
+static volatile double sink;
+
+/* Previous double-based GGA/THS layout */
+static struct {
+    double lat, lon, hdop, alt, geo_sep, heading;
+    gps_fix_t fix;
+    uint8_t sat_num;
+} ref_data;
+
+/*===========================================================================
+ * Previous multi-pass parser, kept here as the baseline
+ *===========================================================================*/
+
+static const char *ref_get_field(const char *buf, size_t len, int field_num) {
+    int current = 0;
+    const char *p = buf;
+    const char *end = buf + len;
+
+    while (p < end && current < field_num) {
+        if (*p == ',')
+            current++;
+        p++;
+    }
+    return (current == field_num) ? p : NULL;
+}
+
+static double ref_field_double(const char *field) {
+    if (!field || *field == ',' || *field == '*')
+        return 0.0;
+    return atof(field);
+}
+
+static double ref_lat_lon(const char *field) {
+    double val = ref_field_double(field);
+    double deg = (double)((int)(val / 100));
+    return deg + (val - deg * 100) / 60.0;
+}
+
+static char ref_field_char(const char *field) {
+    if (!field || *field == ',' || *field == '*')
+        return '\0';
+    return *field;
+}
+
+static void ref_parse_gga(gps_t *g, const char *buf, size_t len) {
+    const char *t = ref_get_field(buf, len, 1);
+    if (t && *t != ',') {
+        g->nmea_data.gga.hour = (t[0] - '0') * 10 + (t[1] - '0');
+        g->nmea_data.gga.min = (t[2] - '0') * 10 + (t[3] - '0');
+        g->nmea_data.gga.sec = (t[4] - '0') * 10 + (t[5] - '0');
+    }
+    g->nmea_data.gga.ns = ref_field_char(ref_get_field(buf, len, 3));
+    g->nmea_data.gga.ew = ref_field_char(ref_get_field(buf, len, 5));
+    ref_data.lat = ref_lat_lon(ref_get_field(buf, len, 2));
+    ref_data.lon = ref_lat_lon(ref_get_field(buf, len, 4));
+    ref_data.fix = (gps_fix_t)(int)ref_field_double(ref_get_field(buf, len, 6));
+    ref_data.sat_num = (uint8_t)ref_field_double(ref_get_field(buf, len, 7));
+    ref_data.hdop = ref_field_double(ref_get_field(buf, len, 8));
+    ref_data.alt = ref_field_double(ref_get_field(buf, len, 9));
+    ref_data.geo_sep = ref_field_double(ref_get_field(buf, len, 11));
+}
+
+static void ref_parse_ths(gps_t *g, const char *buf, size_t len) {
+    ref_data.heading = ref_field_double(ref_get_field(buf, len, 1));
+    g->nmea_data.ths.mode = (gps_ths_mode_t)ref_field_char(ref_get_field(buf, len, 2));
+}
+
+static parse_result_t ref_nmea_try_parse(gps_t *g, ringbuffer_t *rb) {
+    char prefix[6];
+    if (!ringbuffer_peek(rb, prefix, 1, 0)) {
+        return PARSE_NEED_MORE;
+    }
+    if (prefix[0] != '$') {
+        return PARSE_NOT_MINE;
+    }
+    if (!ringbuffer_peek(rb, prefix, 6, 0)) {
+        return PARSE_NEED_MORE;
+    }
+
+    bool is_gga = strncmp(&prefix[3], "GGA", 3) == 0;
+    if (!is_gga && strncmp(&prefix[3], "THS", 3) != 0) {
+        return PARSE_NOT_MINE;
+    }
+
+    /* Pass 1: terminator search, repeated on every wakeup until '\r' arrives */
+    size_t cr_pos;
+    if (!ringbuffer_find_char(rb, '\r', GPS_NMEA_MAX_LEN, &cr_pos)) {
+        return (ringbuffer_size(rb) >= GPS_NMEA_MAX_LEN) ? PARSE_INVALID : PARSE_NEED_MORE;
+    }
+    size_t pkt_len = cr_pos + 2;
+
+    /* Pass 2: copy out */
+    char buf[GPS_NMEA_MAX_LEN + 1];
+    ringbuffer_peek(rb, buf, cr_pos, 0);
+    buf[cr_pos] = '\0';
+
+    /* Pass 3: field count */
+    size_t fields = 1;
+    for (size_t i = 0; i < cr_pos && buf[i] != '*'; i++) {
+        fields += (buf[i] == ',');
+    }
+
+    /* Pass 4: checksum */
+    const char *star = memchr(buf, '*', cr_pos);
+    uint8_t crc = 0;
+    for (const char *p = buf + 1; star && p < star; p++) {
+        crc ^= (uint8_t)*p;
+    }
+    if (!star || fields < 2 || crc != hex_to_byte(star + 1)) {
+        ringbuffer_advance(rb, pkt_len);
+        return PARSE_INVALID;
+    }
+
+    /* Pass 5: per-field rescans */
+    if (is_gga) {
+        ref_parse_gga(g, buf, (size_t)(star - buf));
+    }
+    else {
+        ref_parse_ths(g, buf, (size_t)(star - buf));
+    }
+
+    ringbuffer_advance(rb, pkt_len);
+    return PARSE_OK;
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+static void append(const char *sentence) {
+    size_t len = strlen(sentence);
+    memcpy(&replay[replay_len], sentence, len);
+    replay_len += len;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t now_ticks(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void run(const char *name, parse_result_t (*try_parse)(gps_t *, ringbuffer_t *),
+                size_t chunk) {
+    size_t ok = 0;
+
+    memset(&gps, 0, sizeof(gps));
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
+
+    double t0 = now_sec();
+    uint64_t c0 = now_ticks();
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        for (size_t off = 0; off < replay_len; off += chunk) {
+            size_t n = (replay_len - off < chunk) ? replay_len - off : chunk;
+            ringbuffer_write(&gps.rx_buf, &replay[off], n);
+
+            for (;;) {
+                parse_result_t r = try_parse(&gps, &gps.rx_buf);
+                if (r == PARSE_NEED_MORE) {
+                    break;
+                }
+                if (r == PARSE_OK) {
+                    ok++;
+                }
+                else {
+                    ringbuffer_advance(&gps.rx_buf, 1);
+                }
+            }
+        }
+    }
+
+    uint64_t ticks = now_ticks() - c0;
+    double sec = now_sec() - t0;
+    double bytes = (double)replay_len * BENCH_ITERATIONS;
+
+    sink += ref_data.alt + gps.nmea_data.gga.alt_mm + gps.nmea_data.ths.heading_udeg;
+    printf("  %-12s %4zuB chunks %8.2f ms  %6.2f ns/B", name, chunk, sec * 1e3,
+           sec * 1e9 / bytes);
+#ifdef BENCH_HAVE_TSC
+    printf("  %7.1f ticks/sentence", ok ? (double)ticks / (double)ok : 0.0);
+#else
+    (void)ticks;
+#endif
+    printf("  ok=%zu\n", ok);
+}
+
+/*===========================================================================
+ * GGA field decoding only
+ *===========================================================================*/
+
+#define DECODE_SENTENCES 3
+
+/* Fields 2, 4, 8, 9, 11 of each GGA fixture */
+static const char *decode_fields[DECODE_SENTENCES][5];
+
+static void decode_setup(void) {
+    static const char *const sentences[DECODE_SENTENCES] = {GGA_BASIC, GGA_RTK_FIX,
+                                                            GGA_SOUTH_WEST};
+    static const int wanted[5] = {2, 4, 8, 9, 11};
+
+    for (int s = 0; s < DECODE_SENTENCES; s++) {
+        for (int f = 0; f < 5; f++) {
+            decode_fields[s][f] =
+                ref_get_field(sentences[s], strlen(sentences[s]), wanted[f]);
+        }
+    }
+}
+
+static void decode_double(const char *const *f) {
+    ref_data.lat = ref_lat_lon(f[0]);
+    ref_data.lon = ref_lat_lon(f[1]);
+    ref_data.hdop = ref_field_double(f[2]);
+    ref_data.alt = ref_field_double(f[3]);
+    ref_data.geo_sep = ref_field_double(f[4]);
+}
+
+static void decode_fixed(const char *const *f) {
+    gps_gga_t *gga = &gps.nmea_data.gga;
+    int32_t hdop;
+
+    gps_fixed_parse_ddmm(f[0], &gga->lat_ndeg);
+    gps_fixed_parse_ddmm(f[1], &gga->lon_ndeg);
+    gps_fixed_parse_decimal(f[2], 2, &hdop);
+    gga->hdop_x100 = (uint16_t)hdop;
+    gps_fixed_parse_decimal(f[3], 3, &gga->alt_mm);
+    gps_fixed_parse_decimal(f[4], 3, &gga->geo_sep_mm);
+}
+
+static void run_decode(const char *name, void (*decode)(const char *const *)) {
+    double t0 = now_sec();
+    uint64_t c0 = now_ticks();
+
+    for (int i = 0; i < BENCH_DECODE_ITERATIONS; i++) {
+        for (int s = 0; s < DECODE_SENTENCES; s++) {
+            decode(decode_fields[s]);
+        }
+        sink += ref_data.lat + (double)gps.nmea_data.gga.lat_ndeg;
+    }
+
+    uint64_t ticks = now_ticks() - c0;
+    double sec = now_sec() - t0;
+    double sentences = (double)BENCH_DECODE_ITERATIONS * DECODE_SENTENCES;
+
+    printf("  %-12s %8.2f ms  %6.1f ns/sentence", name, sec * 1e3, sec * 1e9 / sentences);
+#ifdef BENCH_HAVE_TSC
+    printf("  %7.1f ticks/sentence", (double)ticks / sentences);
+#else
+    (void)ticks;
+#endif
+    printf("\n");
+}
+
+int main(void) {
+    static const size_t chunks[] = {1, 16, 256};
+
+    append(GGA_BASIC);
+    append(GGA_RTK_FIX);
+    append(THS_VALID);
+    append(GGA_RTK_FLOAT);
+    append(GGA_NO_FIX);
+    append(THS_INVALID_MODE);
+    append(GGA_SOUTH_WEST);
+
+    printf("gps_nmea benchmark: %zu-byte fixture replay x %d iterations\n", replay_len,
+           BENCH_ITERATIONS);
+
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        run("multi-pass", ref_nmea_try_parse, chunks[i]);
+        run("streaming", nmea_try_parse, chunks[i]);
+    }
+
+    decode_setup();
+
+    printf("GGA field decoding: %d sentences x %d iterations\n", DECODE_SENTENCES,
+           BENCH_DECODE_ITERATIONS);
+
+    run_decode("atof/double", decode_double);
+    run_decode("fixed-point", decode_fixed);
+
+    return 0;
+}
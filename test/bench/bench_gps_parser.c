@@ -0,0 +1,249 @@
+/**
+ * @file bench_gps_parser.c
+ * @brief Host benchmark for lib/gps/gps_parser.c frame dispatch
+ *
+ * Not a test: built alongside the tests but not registered with ctest.
+ * Run manually: ./build/bench_gps_parser
+ *
+ * Feeds a mixed UM982-style capture (NMEA GGA/THS/GSV, Unicore ASCII
+ * response, Unicore binary HEADING2, RTCM 1074, line noise) through:
+ *   chain    - previous 4-stage try chain (every parser peeks the first byte,
+ *              unknown bytes skipped one at a time)
+ *   dispatch - gps_parser_process() first-byte dispatch table, unknown runs
+ *              dropped up to the next sync byte in one step
+ *
+ * rtcm.c pulls in the LoRa app and does not build on the host, so a
+ * framing-only rtcm_try_parse stands in for it (same peeks, no CRC).
+ */
+
+#include "gps.h"
+#include "gps_parser.h"
+#include "nmea/nmea_fixture.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#define BENCH_ITERATIONS 2000
+#define BENCH_CHUNK      256 /* bytes per simulated DMA callback */
+#define BENCH_RTCM_LEN   180 /* RTCM payload bytes per frame */
+#define BENCH_BIN_LEN    44  /* Unicore binary payload bytes per frame */
+
+static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
+static uint8_t capture[2048];
+static size_t capture_len;
+static volatile size_t sink;
+
+/*===========================================================================
+ * RTCM stand-in (framing only)
+ *===========================================================================*/
+
+parse_result_t rtcm_try_parse(gps_t *g, ringbuffer_t *rb) {
+    uint8_t header[3];
+
+    if (!ringbuffer_peek(rb, (char *)header, 1, 0)) {
+        return PARSE_NEED_MORE;
+    }
+    if (header[0] != GPS_RTCM_SYNC) {
+        return PARSE_NOT_MINE;
+    }
+    if (!ringbuffer_peek(rb, (char *)header, sizeof(header), 0)) {
+        return PARSE_NEED_MORE;
+    }
+
+    size_t total_len = 3 + (((header[1] & 0x03) << 8) | header[2]) + 3;
+    if (ringbuffer_size(rb) < total_len) {
+        return PARSE_NEED_MORE;
+    }
+
+    ringbuffer_advance(rb, total_len);
+    g->parser_ctx.stats.rtcm_packets++;
+    return PARSE_OK;
+}
+
+/*===========================================================================
+ * Previous try chain, kept here as the baseline
+ *===========================================================================*/
+
+static parse_result_t ref_process(gps_t *g) {
+    ringbuffer_t *rb = &g->rx_buf;
+    parse_result_t result;
+
+    while (ringbuffer_size(rb) > 0) {
+        result = nmea_try_parse(g, rb);
+        if (result == PARSE_NOT_MINE) {
+            result = unicore_ascii_try_parse(g, rb);
+        }
+        if (result == PARSE_NOT_MINE) {
+            result = unicore_bin_try_parse(g, rb);
+        }
+        if (result == PARSE_NOT_MINE) {
+            result = rtcm_try_parse(g, rb);
+        }
+
+        switch (result) {
+        case PARSE_OK:
+            g->parser_ctx.stats.rx_packets++;
+            continue;
+        case PARSE_NEED_MORE:
+            return result;
+        case PARSE_INVALID:
+            g->parser_ctx.stats.invalid_packets++;
+            ringbuffer_advance(rb, 1);
+            continue;
+        case PARSE_NOT_MINE:
+            g->parser_ctx.stats.unknown_packets++;
+            ringbuffer_advance(rb, 1);
+            continue;
+        }
+    }
+    return PARSE_NEED_MORE;
+}
+
+/*===========================================================================
+ * Capture
+ *===========================================================================*/
+
+/* Unicore binary CRC32 (reflected 0xEDB88320, init 0) */
+static uint32_t crc32_bitwise(const uint8_t *p, size_t len) {
+    uint32_t crc = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0);
+        }
+    }
+    return crc;
+}
+
+static void append(const void *data, size_t len) {
+    memcpy(&capture[capture_len], data, len);
+    capture_len += len;
+}
+
+/* "$command,<cmd>,response: OK*XX\r\n": XOR from after '$' through ':' */
+static void append_unicore_ascii(const char *body) {
+    char line[GPS_UNICORE_ASCII_MAX];
+    uint8_t cs = 0;
+    const char *colon = strchr(body, ':');
+
+    for (const char *p = body; p <= colon; p++) {
+        cs ^= (uint8_t)*p;
+    }
+    int n = snprintf(line, sizeof(line), "$%s*%02X\r\n", body, cs);
+    append(line, (size_t)n);
+}
+
+static void append_unicore_bin(void) {
+    uint8_t frame[GPS_UNICORE_BIN_HEADER_SIZE + BENCH_BIN_LEN + 4];
+
+    memset(frame, 0, sizeof(frame));
+    frame[0] = GPS_UNICORE_BIN_SYNC_1;
+    frame[1] = GPS_UNICORE_BIN_SYNC_2;
+    frame[2] = GPS_UNICORE_BIN_SYNC_3;
+    frame[4] = GPS_UNICORE_BIN_MSG_HEADING2 & 0xFF;
+    frame[5] = GPS_UNICORE_BIN_MSG_HEADING2 >> 8;
+    frame[6] = BENCH_BIN_LEN;
+    for (size_t i = 0; i < BENCH_BIN_LEN; i++) {
+        frame[GPS_UNICORE_BIN_HEADER_SIZE + i] = (uint8_t)(i * 7);
+    }
+
+    uint32_t crc = crc32_bitwise(frame, GPS_UNICORE_BIN_HEADER_SIZE + BENCH_BIN_LEN);
+    memcpy(&frame[GPS_UNICORE_BIN_HEADER_SIZE + BENCH_BIN_LEN], &crc, 4);
+    append(frame, sizeof(frame));
+}
+
+static void append_rtcm(void) {
+    uint8_t frame[3 + BENCH_RTCM_LEN + 3];
+
+    frame[0] = GPS_RTCM_SYNC;
+    frame[1] = (BENCH_RTCM_LEN >> 8) & 0x03;
+    frame[2] = BENCH_RTCM_LEN & 0xFF;
+    frame[3] = 1074 >> 4;
+    frame[4] = (1074 & 0x0F) << 4;
+    for (size_t i = 5; i < sizeof(frame); i++) {
+        frame[i] = (uint8_t)(i * 13);
+    }
+    append(frame, sizeof(frame));
+}
+
+static void build_capture(void) {
+    static const uint8_t noise[] = {0x00, 0xFF, 0x0A, 0x55, 0x31};
+
+    capture_len = 0;
+    append(GGA_BASIC, strlen(GGA_BASIC));
+    append(THS_VALID, strlen(THS_VALID));
+    append_rtcm();
+    append(GSV_UNREGISTERED, strlen(GSV_UNREGISTERED));
+    append_unicore_bin();
+    append_unicore_ascii("command,mode rover,response: OK");
+    append(noise, sizeof(noise));
+    append(GGA_RTK_FIX, strlen(GGA_RTK_FIX));
+    append_rtcm();
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t now_ticks(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void run(const char *name, parse_result_t (*process)(gps_t *)) {
+    memset(&gps, 0, sizeof(gps));
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
+
+    double t0 = now_sec();
+    uint64_t c0 = now_ticks();
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        for (size_t off = 0; off < capture_len; off += BENCH_CHUNK) {
+            size_t n = (capture_len - off < BENCH_CHUNK) ? capture_len - off : BENCH_CHUNK;
+            ringbuffer_write(&gps.rx_buf, (const char *)&capture[off], n);
+            sink += process(&gps);
+        }
+    }
+
+    uint64_t ticks = now_ticks() - c0;
+    double sec = now_sec() - t0;
+    double bytes = (double)capture_len * BENCH_ITERATIONS;
+    const gps_parser_stats_t *st = &gps.parser_ctx.stats;
+
+    printf("  %-10s %8.2f ms  %6.2f ns/B", name, sec * 1e3, sec * 1e9 / bytes);
+#ifdef BENCH_HAVE_TSC
+    printf("  %6.2f ticks/B", (double)ticks / bytes);
+#else
+    (void)ticks;
+#endif
+    printf("  ok=%u unknown=%u invalid=%u\n", (unsigned)st->rx_packets,
+           (unsigned)st->unknown_packets, (unsigned)st->invalid_packets);
+}
+
+int main(void) {
+    build_capture();
+
+    printf("gps_parser benchmark: %zu-byte capture x %d iterations\n", capture_len,
+           BENCH_ITERATIONS);
+
+    run("chain", ref_process);
+    run("dispatch", gps_parser_process);
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file bench_ringbuffer.c
+ * @brief Host throughput benchmark for lib/utils/src/ringbuffer.c
+ *
+ * Not a test: built alongside the tests but not registered with ctest.
+ * Run manually: ./build/bench_ringbuffer
+ *
+ * Scenarios:
+ *   write/read  - reference modulo ring vs. power-of-two mask ring
+ *   size query  - ringbuffer_size() in a parser-style loop
+ *   find_char   - reference per-byte peek loop vs. memchr over spans
+ *   find_any_of - '*' / '\r' terminator search
+ *   find_seq    - Unicore binary sync (0xAA 0x44 0xB5) search
+ */
+
+#include "ringbuffer.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_BUF_SIZE   2048
+#define BENCH_DATA_LEN   1500 /* data straddles the wrap point */
+#define BENCH_ITERATIONS 20000
+
+static char buf[BENCH_BUF_SIZE];
+static ringbuffer_t rb;
+static volatile size_t sink;
+
+/*
+ * Previous modulo-indexed implementation (bounded head/tail, % size on
+ * every update), kept here as the baseline
+ */
+typedef struct {
+    char *buffer;
+    size_t head;
+    size_t tail;
+    size_t size;
+} ref_rb_t;
+
+static size_t ref_size(ref_rb_t *r) {
+    if (((r->head + 1) % r->size) == r->tail) {
+        return r->size - 1;
+    }
+    return (r->head >= r->tail) ? (r->head - r->tail) : (r->size + r->head - r->tail);
+}
+
+static void ref_write(ref_rb_t *r, const char *data, size_t len) {
+    size_t first_chunk = r->size - r->head;
+
+    if (first_chunk >= len) {
+        memcpy(&r->buffer[r->head], data, len);
+    }
+    else {
+        memcpy(&r->buffer[r->head], data, first_chunk);
+        memcpy(&r->buffer[0], data + first_chunk, len - first_chunk);
+    }
+    r->head = (r->head + len) % r->size;
+}
+
+static size_t ref_read(ref_rb_t *r, char *data, size_t len) {
+    size_t available = ref_size(r);
+    size_t read_len = (len <= available) ? len : available;
+    size_t first_chunk = r->size - r->tail;
+
+    if (first_chunk >= read_len) {
+        memcpy(data, &r->buffer[r->tail], read_len);
+    }
+    else {
+        memcpy(data, &r->buffer[r->tail], first_chunk);
+        memcpy(data + first_chunk, &r->buffer[0], read_len - first_chunk);
+    }
+    r->tail = (r->tail + read_len) % r->size;
+    return read_len;
+}
+
+static bool ref_read_byte(ref_rb_t *r, char *c) {
+    if (r->head == r->tail) {
+        return false;
+    }
+    *c = r->buffer[r->tail];
+    r->tail = (r->tail + 1) % r->size;
+    return true;
+}
+
+/* Previous gps_parser.c find_char, kept here as the baseline */
+static bool ref_find_char(ringbuffer_t *r, char ch, size_t max_search, size_t *pos) {
+    size_t available = ringbuffer_size(r);
+    size_t search_len = (max_search < available) ? max_search : available;
+
+    for (size_t i = 0; i < search_len; i++) {
+        char c;
+        if (!ringbuffer_peek(r, &c, 1, i)) {
+            return false;
+        }
+        if (c == ch) {
+            *pos = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, double sec, size_t bytes_per_iter) {
+    double mb = (double)bytes_per_iter * BENCH_ITERATIONS / (1024.0 * 1024.0);
+    printf("  %-28s %8.2f ms  %9.1f MB/s\n", name, sec * 1e3, mb / sec);
+}
+
+/* NMEA-like filler with the target placed at the very end */
+static void prepare(const char *tail, size_t tail_len) {
+    char data[BENCH_DATA_LEN];
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = "GNGGA,0123456.00,3724.0,N,12700.0,E,"[i % 36];
+    }
+    memcpy(&data[sizeof(data) - tail_len], tail, tail_len);
+
+    ringbuffer_init(&rb, buf, sizeof(buf));
+
+    /* Move indices so the data wraps around the end of memory */
+    char skip[1000];
+    memset(skip, 0, sizeof(skip));
+    ringbuffer_write(&rb, skip, sizeof(skip));
+    ringbuffer_advance(&rb, sizeof(skip));
+
+    ringbuffer_write(&rb, data, sizeof(data));
+}
+
+/* 37-byte chunks (not a divisor of the size) so writes wrap at varying offsets */
+#define BENCH_CHUNK 37
+
+static void bench_index_math(void) {
+    char chunk[BENCH_CHUNK];
+    char out[BENCH_CHUNK];
+    char c;
+    double t0;
+
+    memset(chunk, 'r', sizeof(chunk));
+
+    ref_rb_t ref = {.buffer = buf, .size = sizeof(buf)};
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS * 10; i++) {
+        ref_write(&ref, chunk, sizeof(chunk));
+        sink += ref_read(&ref, out, sizeof(out));
+    }
+    report("write/read 37B (modulo)", now_sec() - t0, BENCH_CHUNK * 10);
+
+    ringbuffer_init(&rb, buf, sizeof(buf));
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS * 10; i++) {
+        ringbuffer_write(&rb, chunk, sizeof(chunk));
+        sink += ringbuffer_read(&rb, out, sizeof(out));
+    }
+    report("write/read 37B (mask)", now_sec() - t0, BENCH_CHUNK * 10);
+
+    /* gps_parser_process style: while (size() > 0) { consume 1 byte } */
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        ref_write(&ref, chunk, sizeof(chunk));
+        while (ref_size(&ref) > 0) {
+            ref_read_byte(&ref, &c);
+            sink += (size_t)c;
+        }
+    }
+    report("size() + read_byte (modulo)", now_sec() - t0, BENCH_CHUNK);
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        ringbuffer_write(&rb, chunk, sizeof(chunk));
+        while (ringbuffer_size(&rb) > 0) {
+            ringbuffer_read_byte(&rb, &c);
+            sink += (size_t)c;
+        }
+    }
+    report("size() + read_byte (mask)", now_sec() - t0, BENCH_CHUNK);
+}
+
+int main(void) {
+    size_t pos = 0;
+    double t0;
+
+    printf("ringbuffer benchmark: %d iterations\n", BENCH_ITERATIONS);
+
+    bench_index_math();
+
+    prepare("*5A\r\n", 5);
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        ref_find_char(&rb, '\r', BENCH_DATA_LEN, &pos);
+        sink += pos;
+    }
+    report("find_char (per-byte peek)", now_sec() - t0, BENCH_DATA_LEN);
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        ringbuffer_find_char(&rb, '\r', BENCH_DATA_LEN, &pos);
+        sink += pos;
+    }
+    report("find_char (memchr spans)", now_sec() - t0, BENCH_DATA_LEN);
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        ringbuffer_find_any_of(&rb, "*\r", BENCH_DATA_LEN, &pos);
+        sink += pos;
+    }
+    report("find_any_of (\"*\\r\")", now_sec() - t0, BENCH_DATA_LEN);
+
+    const char sync[] = {(char)0xAA, 0x44, (char)0xB5};
+    prepare(sync, sizeof(sync));
+
+    t0 = now_sec();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        ringbuffer_find_seq(&rb, sync, sizeof(sync), BENCH_DATA_LEN, &pos);
+        sink += pos;
+    }
+    report("find_seq (AA 44 B5)", now_sec() - t0, BENCH_DATA_LEN);
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file bench_uart_dma_port.c
+ * @brief Host benchmark for lib/utils/src/uart_dma_port.c
+ *
+ * Not a test: built alongside the tests but not registered with ctest.
+ * Run manually: ./build/bench_uart_dma_port
+ *
+ * Runs once per transport (same table as test_uart_dma_port), on the
+ * fake peripheral:
+ *   rx copy      - previous port ISR: copy new DMA bytes into a separate
+ *                  SPSC ring (ringbuffer_write), then the task reads them
+ *   rx zero-copy - uart_dma_port_rx_isr publishes the DMA position, and
+ *                  the task consumes with peek_spans/consume
+ *   tx polled    - previous port send: one TDR store per byte after a TXE
+ *                  poll (a volatile flag stands in for the register)
+ *   tx queued    - uart_dma_port_write plus the TX DMA completion ISR
+ *
+ * RX frames are 64 B with IDLE after each one, so several HT/TC/IDLE
+ * interrupts happen per lap.
+ */
+
+#include "fake_uart_dma.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_BYTES (32u * 1024u * 1024u) /* per measurement */
+#define FRAME_LEN   64
+
+typedef struct {
+    const char *name;
+    size_t rx_size;
+    size_t tx_size;
+} transport_t;
+
+static const transport_t transports[] = {
+    {"gps", 2048, 2048}, {"lte", 2048, 1024}, {"lora", 1024, 512},
+    {"ble", 1024, 512},  {"rs485", 512, 512}, {"rs232", 512, 512},
+};
+
+static char rx_mem[2048];
+static char copy_mem[2048];
+static uint8_t tx_mem[2048];
+static uart_dma_desc_t desc;
+static uart_dma_port_t port;
+static fake_uart_t fake;
+static char frame[FRAME_LEN];
+static volatile size_t sink;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, double sec) {
+    double mb = (double)BENCH_BYTES / (1024.0 * 1024.0);
+    printf("    %-14s %8.2f ms  %9.1f MB/s  %6.2f ns/B\n", name, sec * 1e3, mb / sec,
+           sec * 1e9 / BENCH_BYTES);
+}
+
+static void open_port(const transport_t *t) {
+    desc = (uart_dma_desc_t){
+        .name = t->name,
+        .uart = &fake,
+        .baudrate = 115200,
+        .rx_buf = rx_mem,
+        .rx_size = t->rx_size,
+        .tx_buf = tx_mem,
+        .tx_size = t->tx_size,
+        .hw = &fake_uart_hw,
+        .os = &fake_uart_os,
+    };
+    uart_dma_port_init(&port, &desc);
+    fake_uart_attach(&fake, &port);
+    uart_dma_port_start(&port);
+}
+
+/*===========================================================================
+ * RX
+ *===========================================================================*/
+
+/* 이전 포트 방식: ISR에서 DMA 버퍼 → 별도 링 복사 */
+static ringbuffer_t copy_rb;
+static size_t copy_last_pos;
+
+static void copy_isr(const transport_t *t) {
+    size_t pos = uart_dma_port_rx_pos(&port) & (t->rx_size - 1);
+
+    if (pos > copy_last_pos) {
+        ringbuffer_write(&copy_rb, &rx_mem[copy_last_pos], pos - copy_last_pos);
+    }
+    else if (pos < copy_last_pos) {
+        ringbuffer_write(&copy_rb, &rx_mem[copy_last_pos], t->rx_size - copy_last_pos);
+        if (pos > 0) {
+            ringbuffer_write(&copy_rb, rx_mem, pos);
+        }
+    }
+    copy_last_pos = pos;
+}
+
+static double bench_rx_copy(const transport_t *t) {
+    char out[FRAME_LEN];
+
+    open_port(t);
+    /* 가짜 DMA는 HT/TC에서 포트 ISR도 호출하므로 그 비용은 두 방식에 공통 */
+    ringbuffer_init(&copy_rb, copy_mem, t->rx_size);
+    copy_last_pos = 0;
+
+    double t0 = now_sec();
+    for (size_t n = 0; n < BENCH_BYTES; n += FRAME_LEN) {
+        fake_uart_receive(&fake, frame, FRAME_LEN);
+        copy_isr(t);
+        sink += ringbuffer_read(&copy_rb, out, sizeof(out));
+    }
+    return now_sec() - t0;
+}
+
+static double bench_rx_zero_copy(const transport_t *t) {
+    ringbuffer_span_t spans[2];
+
+    open_port(t);
+
+    ringbuffer_t *rb = uart_dma_port_rx(&port);
+    double t0 = now_sec();
+    for (size_t n = 0; n < BENCH_BYTES; n += FRAME_LEN) {
+        fake_uart_receive(&fake, frame, FRAME_LEN);
+        fake_uart_idle(&fake);
+
+        size_t len = ringbuffer_size(rb);
+        size_t cnt = ringbuffer_peek_spans(rb, 0, len, spans);
+        for (size_t i = 0; i < cnt; i++) {
+            sink += (unsigned char)spans[i].data[0];
+        }
+        ringbuffer_consume(rb, len);
+    }
+    return now_sec() - t0;
+}
+
+/*===========================================================================
+ * TX
+ *===========================================================================*/
+
+static volatile uint32_t fake_isr_txe;
+static volatile uint32_t fake_tdr;
+
+/* 이전 포트 방식: TXE 폴링 후 바이트마다 TDR 기록 */
+static double bench_tx_polled(void) {
+    double t0 = now_sec();
+    for (size_t n = 0; n < BENCH_BYTES; n += FRAME_LEN) {
+        for (size_t i = 0; i < FRAME_LEN; i++) {
+            fake_isr_txe = 1;
+            while (!fake_isr_txe) {
+            }
+            fake_tdr = (uint8_t)frame[i];
+        }
+    }
+    return now_sec() - t0;
+}
+
+static double bench_tx_queued(const transport_t *t) {
+    open_port(t);
+
+    double t0 = now_sec();
+    for (size_t n = 0; n < BENCH_BYTES; n += FRAME_LEN) {
+        uart_dma_port_write(&port, frame, FRAME_LEN, 0);
+        /* TX DMA 완료 ISR (큐에 쌓인 다음 블록 시작 포함) */
+        fake.wire_len = 0;
+        fake_uart_tx_complete(&fake);
+    }
+    sink += port.tx.dropped;
+    return now_sec() - t0;
+}
+
+int main(void) {
+    for (size_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = "$GNGGA,0123456.00,3724.0,N,12700.0,E*"[i % 37];
+    }
+
+    printf("uart_dma_port: %u MB per measurement, %u B frames\n",
+           (unsigned)(BENCH_BYTES >> 20), FRAME_LEN);
+
+    for (size_t i = 0; i < sizeof(transports) / sizeof(transports[0]); i++) {
+        const transport_t *t = &transports[i];
+
+        printf("  %s (rx %zu, tx %zu)\n", t->name, t->rx_size, t->tx_size);
+        report("rx copy", bench_rx_copy(t));
+        report("rx zero-copy", bench_rx_zero_copy(t));
+        report("tx polled", bench_tx_polled());
+        report("tx queued", bench_tx_queued(t));
+    }
+
+    return 0;
+}
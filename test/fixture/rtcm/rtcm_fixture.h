@@ -0,0 +1,28 @@
+/**
+ * @file rtcm_fixture.h
+ * @brief RTCM3 test data (fixture)
+ *
+ * 모든 테스트 데이터는 static const로 정의.
+ * 사용하지 않는 데이터는 컴파일러가 자동 제거.
+ *
+ * 네이밍 규칙: RTCM_{MSG_TYPE}_{CASE_NAME}
+ */
+#ifndef RTCM_FIXTURE_H
+#define RTCM_FIXTURE_H
+
+#include <stdint.h>
+
+/*===========================================================================
+ * 1005 (Stationary RTK Reference Station ARP)
+ * D3 | 6bit reserved + 10bit length | payload | CRC24Q (3 bytes, big-endian)
+ *===========================================================================*/
+
+/* Reference station 2003, ECEF (1114104.5999, -4850729.7108, 3975521.4643) */
+static const uint8_t RTCM_1005_STATION[] = {
+    0xD3, 0x00, 0x13, 0x3E, 0xD7, 0xD3, 0x02, 0x02, 0x98, 0x0E, 0xDE, 0xEF, 0x34,
+    0xB4, 0xBD, 0x62, 0xAC, 0x09, 0x41, 0x98, 0x6F, 0x33, 0x36, 0x0B, 0x98,
+};
+
+#define RTCM_1005_STATION_CRC 0x360B98UL
+
+#endif /* RTCM_FIXTURE_H */
@@ -0,0 +1,50 @@
+/**
+ * @file unicore_fixture.h
+ * @brief Unicore binary test data (fixture)
+ *
+ * 모든 테스트 데이터는 static const로 정의.
+ * 사용하지 않는 데이터는 컴파일러가 자동 제거.
+ *
+ * UM982 출력 형식 그대로의 프레임: 헤더(24) + 페이로드 + CRC32(4, little-endian).
+ * CRC32는 reflected 0xEDB88320, 초기값 0, 최종 XOR 없음.
+ *
+ * 네이밍 규칙: UNICORE_{MSG_TYPE}_{CASE_NAME}
+ */
+#ifndef UNICORE_FIXTURE_H
+#define UNICORE_FIXTURE_H
+
+#include <stdint.h>
+
+/* BESTNAVB (2118): NARROW_INT (50), 37.3952N 126.9462E 52.31m, 32/30 SV */
+static const uint8_t UNICORE_BESTNAV_RTK_FIX[148] = {
+    0xAA, 0x44, 0xB5, 0x2A, 0x46, 0x08, 0x78, 0x00, 0x00, 0xB4, 0x29, 0x09,
+    0xE0, 0x16, 0x7A, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0xAB, 0x4C, 0x7F,
+    0x96, 0xB2, 0x42, 0x40, 0xE5, 0x41, 0xBC, 0xA6, 0x8E, 0xBC, 0x5F, 0x40,
+    0xD6, 0x56, 0xEC, 0x2F, 0xBB, 0x27, 0x4A, 0x40, 0x66, 0x66, 0x9E, 0x41,
+    0x3D, 0x00, 0x00, 0x00, 0x2B, 0x18, 0x15, 0x3C, 0x24, 0x97, 0xFF, 0x3B,
+    0xDD, 0xB5, 0x84, 0x3C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x77,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3F, 0xE4, 0x83, 0x9E, 0xCD, 0xAA, 0xCF, 0x95, 0x3F,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0xF6, 0x70, 0x40, 0x15, 0x8C, 0x4A, 0xEA,
+    0x04, 0x34, 0x71, 0xBF, 0xBC, 0x74, 0x13, 0x3C, 0xA6, 0x9B, 0xC4, 0x3B,
+    0xF6, 0x4A, 0xCB, 0x86,
+};
+
+#define UNICORE_BESTNAV_RTK_FIX_CRC 0x86CB4AF6UL
+
+/* HEADING2B (2120): NARROW_INT, baseline 1.204m, heading 271.38, pitch -0.41 */
+static const uint8_t UNICORE_HEADING2_FIXED[76] = {
+    0xAA, 0x44, 0xB5, 0x2A, 0x48, 0x08, 0x30, 0x00, 0x00, 0xB4, 0x29, 0x09,
+    0x12, 0x17, 0x7A, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x81, 0x26, 0x9A, 0x3F,
+    0xE9, 0xB0, 0x87, 0x43, 0x6A, 0x4D, 0xD3, 0xBE, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0xE0, 0x1C, 0x3E, 0x6C, 0x78, 0x9A, 0x3E, 0x30, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x1C, 0x18, 0x00, 0x20, 0x3F, 0x77,
+    0x33, 0x44, 0x82, 0x47,
+};
+
+#define UNICORE_HEADING2_FIXED_CRC 0x47824433UL
+
+#endif /* UNICORE_FIXTURE_H */
@@ -24,6 +24,15 @@ typedef void *TimerHandle_t;
 #define portMAX_DELAY 0xFFFFFFFFUL
 
 #define pdMS_TO_TICKS(xTimeInMs) ((TickType_t)(xTimeInMs))
+#define portTICK_PERIOD_MS       ((TickType_t)1)
+
+extern uint32_t mock_yield_count; /* portYIELD_FROM_ISR(pdTRUE) calls */
+#define portYIELD_FROM_ISR(xSwitchRequired)                                                 \
+    do {                                                                                    \
+        if (xSwitchRequired) {                                                              \
+            mock_yield_count++;                                                             \
+        }                                                                                   \
+    } while (0)
 
 #define configSTACK_DEPTH_TYPE uint16_t
 
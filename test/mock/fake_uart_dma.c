@@ -0,0 +1,179 @@
+/**
+ * @file fake_uart_dma.c
+ * @brief Host fake USART + DMA behind uart_dma_hw_ops_t (see fake_uart_dma.h)
+ */
+
+#include "fake_uart_dma.h"
+#include <string.h>
+
+uint32_t fake_uart_clock_ms;
+
+static fake_uart_t *fake_of(uart_dma_port_t *port) {
+    return (fake_uart_t *)port->desc->uart;
+}
+
+/*===========================================================================
+ * Hardware ops
+ *===========================================================================*/
+
+static void fake_start(uart_dma_port_t *port) {
+    fake_uart_t *f = fake_of(port);
+
+    f->enabled = true;
+}
+
+static void fake_stop(uart_dma_port_t *port) {
+    fake_uart_t *f = fake_of(port);
+
+    f->enabled = false;
+    f->rx_enabled = false;
+    f->tx_active = false;
+}
+
+static void fake_rx_start(uart_dma_port_t *port, size_t offset) {
+    fake_uart_t *f = fake_of(port);
+
+    f->rx_offset = offset;
+    f->rx_block = port->desc->rx_size - offset;
+    f->rx_remaining = f->rx_block;
+    f->rx_ht_done = false;
+    f->rx_enabled = true;
+    f->rx_starts++;
+}
+
+static size_t fake_rx_remaining(uart_dma_port_t *port) {
+    return fake_of(port)->rx_remaining;
+}
+
+static bool fake_tx_start(uart_dma_port_t *port, const uint8_t *data, size_t len) {
+    fake_uart_t *f = fake_of(port);
+
+    if (f->tx_fail || f->tx_active) {
+        return false;
+    }
+
+    f->tx_data = data;
+    f->tx_len = len;
+    f->tx_active = true;
+    f->tx_starts++;
+    return true;
+}
+
+static void fake_set_baudrate(uart_dma_port_t *port, uint32_t baudrate) {
+    fake_uart_t *f = fake_of(port);
+
+    f->baudrate = baudrate;
+    f->baud_changes++;
+}
+
+const uart_dma_hw_ops_t fake_uart_hw = {
+    .start = fake_start,
+    .stop = fake_stop,
+    .rx_start = fake_rx_start,
+    .rx_remaining = fake_rx_remaining,
+    .tx_start = fake_tx_start,
+    .set_baudrate = fake_set_baudrate,
+};
+
+/*===========================================================================
+ * RTOS ops
+ *===========================================================================*/
+
+static bool fake_wait(uart_dma_port_t *port, uint32_t timeout_ms) {
+    fake_uart_clock_ms += 1;
+    if (fake_uart_tx_complete(fake_of(port))) {
+        return true;
+    }
+    fake_uart_clock_ms += timeout_ms;
+    return false;
+}
+
+static uint32_t fake_now_ms(uart_dma_port_t *port) {
+    (void)port;
+    return fake_uart_clock_ms;
+}
+
+const uart_dma_os_ops_t fake_uart_os = {
+    .wait = fake_wait,
+    .now_ms = fake_now_ms,
+};
+
+/*===========================================================================
+ * Test drivers
+ *===========================================================================*/
+
+void fake_uart_attach(fake_uart_t *f, uart_dma_port_t *port) {
+    memset(f, 0, sizeof(*f));
+    f->port = port;
+    f->baudrate = port->desc->baudrate;
+}
+
+/* End of the circular block: TC, then the next block covers the whole buffer */
+static void rx_block_done(fake_uart_t *f) {
+    size_t size = f->port->desc->rx_size;
+
+    f->rx_offset = 0;
+    f->rx_block = size;
+    f->rx_remaining = size;
+    f->rx_ht_done = false;
+}
+
+size_t fake_uart_receive(fake_uart_t *f, const void *data, size_t len) {
+    const char *p = data;
+    size_t done = 0;
+
+    if (!f->enabled || !f->rx_enabled) {
+        f->rx_dropped += (uint32_t)len;
+        return 0;
+    }
+
+    while (done < len) {
+        f->port->desc->rx_buf[f->rx_offset++] = p[done++];
+        f->rx_remaining--;
+
+        if (!f->rx_ht_done && f->rx_remaining <= f->rx_block / 2) {
+            f->rx_ht_done = true;
+            uart_dma_port_rx_isr(f->port);
+        }
+        if (f->rx_remaining == 0) {
+            /* TC is raised while the count still reads 0, as on hardware before reload */
+            uart_dma_port_rx_isr(f->port);
+            rx_block_done(f);
+        }
+    }
+
+    return done;
+}
+
+void fake_uart_idle(fake_uart_t *f) {
+    if (f->enabled) {
+        uart_dma_port_rx_isr(f->port);
+    }
+}
+
+void fake_uart_error(fake_uart_t *f, uint32_t errors) {
+    if (errors & UART_DMA_ERR_RX_DMA) {
+        f->rx_enabled = false;
+    }
+    uart_dma_port_error_isr(f->port, errors);
+}
+
+bool fake_uart_tx_complete(fake_uart_t *f) {
+    if (!f->tx_active || f->tx_stalled) {
+        return false;
+    }
+
+    if (f->wire_len + f->tx_len <= sizeof(f->wire)) {
+        memcpy(&f->wire[f->wire_len], f->tx_data, f->tx_len);
+        f->wire_len += f->tx_len;
+    }
+    f->tx_active = false;
+
+    uart_dma_port_tx_isr(f->port);
+    return true;
+}
+
+void fake_uart_tx_drain(fake_uart_t *f) {
+    while (fake_uart_tx_complete(f)) {
+    }
+}
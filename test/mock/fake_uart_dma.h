@@ -0,0 +1,81 @@
+/**
+ * @file fake_uart_dma.h
+ * @brief Host fake USART + circular RX DMA + TX DMA for lib/utils/src/uart_dma_port.c
+ *
+ * One fake_uart_t per port, referenced from the descriptor's `uart` field.
+ * The fake behaves like the board backend (USART + GPDMA):
+ *   - RX: bytes land directly in desc->rx_buf at the DMA write offset. The
+ *     remaining count runs down per block. Half-transfer and
+ *     transfer-complete call uart_dma_port_rx_isr like the DMA interrupts,
+ *     and fake_uart_idle() does the same for the USART IDLE line.
+ *   - RX DMA error: the channel stops (later bytes are lost) until the
+ *     port restarts it.
+ *   - TX: one transfer in flight. fake_uart_tx_complete() moves it to the
+ *     wire and calls uart_dma_port_tx_isr.
+ *
+ * fake_uart_os is a single-threaded RTOS stand-in. Its clock is
+ * fake_uart_clock_ms. A wait completes the pending TX transfer of the
+ * port being waited on, otherwise the clock runs out.
+ */
+
+#ifndef FAKE_UART_DMA_H
+#define FAKE_UART_DMA_H
+
+#include "uart_dma_port.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define FAKE_UART_WIRE_SIZE 16384
+
+typedef struct {
+    uart_dma_port_t *port; /* set by fake_uart_attach */
+
+    /* RX DMA */
+    bool rx_enabled;      /* channel running */
+    size_t rx_offset;     /* next write offset in rx_buf */
+    size_t rx_block;      /* current block length */
+    size_t rx_remaining;  /* remaining count in current block */
+    bool rx_ht_done;      /* half-transfer raised for current block */
+    uint32_t rx_dropped;  /* bytes received while the channel was stopped */
+    uint32_t rx_starts;   /* rx_start calls */
+
+    /* USART */
+    bool enabled;
+    uint32_t baudrate;
+    uint32_t baud_changes;
+
+    /* TX DMA */
+    const uint8_t *tx_data;
+    size_t tx_len;
+    bool tx_active;
+    bool tx_stalled; /* transfer never completes */
+    bool tx_fail;    /* tx_start returns false */
+    uint32_t tx_starts;
+    uint8_t wire[FAKE_UART_WIRE_SIZE];
+    size_t wire_len;
+} fake_uart_t;
+
+extern const uart_dma_hw_ops_t fake_uart_hw;
+extern const uart_dma_os_ops_t fake_uart_os;
+extern uint32_t fake_uart_clock_ms;
+
+/** Reset the fake and bind it to its port (after uart_dma_port_init) */
+void fake_uart_attach(fake_uart_t *f, uart_dma_port_t *port);
+
+/** Bytes arriving on the wire: DMA writes them, raising HT/TC as it goes */
+size_t fake_uart_receive(fake_uart_t *f, const void *data, size_t len);
+
+/** USART IDLE line detected */
+void fake_uart_idle(fake_uart_t *f);
+
+/** USART/DMA error interrupt (UART_DMA_ERR_*); RX_DMA stops the channel first */
+void fake_uart_error(fake_uart_t *f, uint32_t errors);
+
+/** Complete the in-flight TX transfer; false when none or stalled */
+bool fake_uart_tx_complete(fake_uart_t *f);
+
+/** Complete TX transfers until the queue is empty */
+void fake_uart_tx_drain(fake_uart_t *f);
+
+#endif
@@ -0,0 +1,20 @@
+/**
+ * @file lora_app.h
+ * @brief LoRa app stub for host testing
+ *
+ * rtcm.c only needs the async raw P2P send. The test that links rtcm.c
+ * provides lora_send_p2p_raw_async() and records what was queued.
+ */
+#ifndef LORA_APP_H
+#define LORA_APP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*lora_cmd_callback_t)(bool success, void *user_data);
+
+bool lora_send_p2p_raw_async(const uint8_t *data, size_t len, uint32_t timeout_ms,
+                             lora_cmd_callback_t callback, void *user_data);
+
+#endif /* LORA_APP_H */
@@ -4,6 +4,7 @@
  *
  * Provides:
  * - mock_tick_count: configurable tick counter
+ * - task notifications (mock_task_t, see task.h)
  * - dev_assert_failed: test-friendly assert (abort instead of infinite loop)
  * - GPS parser stubs for unneeded parsers
  */
@@ -12,12 +13,77 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "task.h"
 
 /*===========================================================================
  * Mock tick counter (used by FreeRTOS and HAL stubs)
  *===========================================================================*/
 uint32_t mock_tick_count = 0;
 
+/*===========================================================================
+ * Task notifications (index 0 only)
+ *===========================================================================*/
+TaskHandle_t mock_current_task = NULL;
+uint32_t mock_yield_count = 0;
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction) {
+    mock_task_t *t = xTaskToNotify;
+
+    t->notify_count++;
+    switch (eAction) {
+    case eSetBits:
+        t->value |= ulValue;
+        break;
+    case eIncrement:
+        t->value++;
+        break;
+    case eSetValueWithoutOverwrite:
+        if (t->pending) {
+            return pdFAIL;
+        }
+        t->value = ulValue;
+        break;
+    case eSetValueWithOverwrite:
+        t->value = ulValue;
+        break;
+    case eNoAction:
+    default:
+        break;
+    }
+    t->pending = true;
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction,
+                              BaseType_t *pxHigherPriorityTaskWoken) {
+    BaseType_t ret = xTaskNotify(xTaskToNotify, ulValue, eAction);
+
+    /* The owning task is assumed to outrank whatever the ISR interrupted */
+    if (pxHigherPriorityTaskWoken) {
+        *pxHigherPriorityTaskWoken = pdTRUE;
+    }
+    return ret;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit,
+                           uint32_t *pulNotificationValue, TickType_t xTicksToWait) {
+    mock_task_t *t = mock_current_task;
+
+    (void)xTicksToWait;
+    if (!t->pending) {
+        t->value &= ~ulBitsToClearOnEntry;
+        return pdFALSE;
+    }
+
+    if (pulNotificationValue) {
+        *pulNotificationValue = t->value;
+    }
+    t->value &= ~ulBitsToClearOnExit;
+    t->pending = false;
+    t->wake_count++;
+    return pdTRUE;
+}
+
 /*===========================================================================
  * dev_assert replacement (abort instead of while(1))
  *===========================================================================*/
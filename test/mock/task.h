@@ -31,6 +31,49 @@ static inline BaseType_t xTaskCreate(void *pxTaskCode, const char *pcName,
     return pdPASS;
 }
 
+static inline TickType_t xTaskGetTickCountFromISR(void) {
+    return mock_tick_count;
+}
+
+/* Host tests are single-threaded: scheduler locking is a no-op */
+static inline void vTaskSuspendAll(void) {
+}
+static inline BaseType_t xTaskResumeAll(void) {
+    return pdFALSE;
+}
+
+/*
+ * Task notifications: a TaskHandle_t is a mock_task_t * in tests.
+ * xTaskNotifyWait acts on mock_current_task and never blocks; when no
+ * notification is pending it returns pdFALSE as if the wait timed out.
+ */
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+typedef struct {
+    uint32_t value;        /* notification value */
+    bool pending;          /* notified since the last wait */
+    uint32_t notify_count; /* xTaskNotify / xTaskNotifyFromISR calls */
+    uint32_t wake_count;   /* waits that returned pdTRUE */
+} mock_task_t;
+
+extern TaskHandle_t mock_current_task;
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction,
+                              BaseType_t *pxHigherPriorityTaskWoken);
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit,
+                           uint32_t *pulNotificationValue, TickType_t xTicksToWait);
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return mock_current_task;
+}
+
 static inline void vTaskDelete(TaskHandle_t xTask) {
     (void)xTask;
 }
@@ -0,0 +1,342 @@
+/**
+ * @file test_gps_filter.c
+ * @brief Module tests for lib/gps/gps_filter.c
+ *
+ * Target: gps_filter.c ingress filter, driven through gps_parser_process
+ * Dependencies: gps_parser.c, ringbuffer.c, mock FreeRTOS/HAL
+ *
+ * The four protocol parsers are replaced by recording stubs defined here,
+ * so the tests observe which frames still reach a parser.
+ *
+ * Tests: rule/default lookup, DROP/COUNT/RAW per protocol, frames skipped
+ *        whole by length or terminator, partial frames, wrapped RAW spans
+ */
+
+#include "unity.h"
+#include "gps.h"
+#include "gps_filter.h"
+#include "gps_parser.h"
+#include "nmea/nmea_fixture.h"
+#include "rtcm/rtcm_fixture.h"
+#include "unicore/unicore_fixture.h"
+#include <string.h>
+
+/*===========================================================================
+ * Recording parser stubs
+ *===========================================================================*/
+
+enum { P_NMEA, P_UC_ASCII, P_UC_BIN, P_RTCM, P_COUNT };
+
+static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
+static int calls[P_COUNT];
+
+/* Consume everything up to the end of the buffered data */
+static parse_result_t record(int which, ringbuffer_t *rb) {
+    calls[which]++;
+    ringbuffer_advance(rb, ringbuffer_size(rb));
+    return PARSE_OK;
+}
+
+parse_result_t nmea_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_NMEA, rb);
+}
+
+parse_result_t unicore_ascii_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_UC_ASCII, rb);
+}
+
+parse_result_t unicore_bin_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_UC_BIN, rb);
+}
+
+parse_result_t rtcm_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_RTCM, rb);
+}
+
+/*===========================================================================
+ * Raw frame handler
+ *===========================================================================*/
+
+static int raw_events;
+static gps_event_t last_raw;
+static uint8_t raw_copy[GPS_RX_BUF_SIZE];
+
+static void evt_handler(gps_t *g, const gps_event_t *event) {
+    (void)g;
+    if (event->type != GPS_EVENT_RAW_FRAME) {
+        return;
+    }
+
+    raw_events++;
+    last_raw = *event;
+
+    size_t off = 0;
+    for (uint8_t i = 0; i < event->data.raw.span_cnt; i++) {
+        memcpy(raw_copy + off, event->data.raw.spans[i].data, event->data.raw.spans[i].len);
+        off += event->data.raw.spans[i].len;
+    }
+}
+
+void setUp(void) {
+    memset(&gps, 0, sizeof(gps_t));
+    memset(calls, 0, sizeof(calls));
+    raw_events = 0;
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
+    gps.handler = evt_handler;
+}
+
+void tearDown(void) {
+}
+
+static parse_result_t feed(const void *data, size_t len) {
+    ringbuffer_write(&gps.rx_buf, data, len);
+    return gps_parser_process(&gps);
+}
+
+static int total_calls(void) {
+    int n = 0;
+    for (int i = 0; i < P_COUNT; i++) {
+        n += calls[i];
+    }
+    return n;
+}
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+void test_default_is_decode_and_inactive(void) {
+    TEST_ASSERT_FALSE(gps.parser_ctx.filter.active);
+    TEST_ASSERT_EQUAL(GPS_FILTER_DECODE,
+                      gps_filter_get(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V')));
+}
+
+void test_rule_overrides_default(void) {
+    TEST_ASSERT_TRUE(gps_filter_set_default(&gps, GPS_PROTOCOL_NMEA, GPS_FILTER_DROP));
+    TEST_ASSERT_TRUE(
+        gps_filter_set(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'G', 'A'), GPS_FILTER_DECODE));
+
+    TEST_ASSERT_TRUE(gps.parser_ctx.filter.active);
+    TEST_ASSERT_EQUAL(GPS_FILTER_DECODE,
+                      gps_filter_get(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'G', 'A')));
+    TEST_ASSERT_EQUAL(GPS_FILTER_DROP,
+                      gps_filter_get(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V')));
+}
+
+void test_same_id_on_other_protocol_is_separate(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1005, GPS_FILTER_DROP);
+
+    TEST_ASSERT_EQUAL(GPS_FILTER_DROP, gps_filter_get(&gps, GPS_PROTOCOL_RTCM, 1005));
+    TEST_ASSERT_EQUAL(GPS_FILTER_DECODE, gps_filter_get(&gps, GPS_PROTOCOL_UNICORE_BIN, 1005));
+}
+
+void test_updating_rule_reuses_slot(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1074, GPS_FILTER_DROP);
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1074, GPS_FILTER_COUNT);
+
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.filter.rule_cnt);
+    TEST_ASSERT_EQUAL(GPS_FILTER_COUNT, gps_filter_get(&gps, GPS_PROTOCOL_RTCM, 1074));
+}
+
+void test_back_to_decode_deactivates(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1074, GPS_FILTER_DROP);
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1074, GPS_FILTER_DECODE);
+
+    TEST_ASSERT_FALSE(gps.parser_ctx.filter.active);
+}
+
+void test_table_full_and_bad_protocol_rejected(void) {
+    for (uint32_t i = 0; i < GPS_FILTER_MAX_RULES; i++) {
+        TEST_ASSERT_TRUE(gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1000 + i, GPS_FILTER_DROP));
+    }
+    TEST_ASSERT_FALSE(gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 2000, GPS_FILTER_DROP));
+    TEST_ASSERT_FALSE(gps_filter_set(&gps, GPS_PROTOCOL_UNICORE_CMD, 0, GPS_FILTER_DROP));
+    TEST_ASSERT_FALSE(gps_filter_set_default(&gps, GPS_PROTOCOL_NONE, GPS_FILTER_DROP));
+}
+
+/*===========================================================================
+ * NMEA
+ *===========================================================================*/
+
+void test_nmea_drop_skips_sentence_without_parser(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V'), GPS_FILTER_DROP);
+
+    feed(STREAM_GSV_THEN_GGA, strlen(STREAM_GSV_THEN_GGA));
+
+    /* GSV skipped up to its '\n', GGA still decoded */
+    TEST_ASSERT_EQUAL(1, calls[P_NMEA]);
+    TEST_ASSERT_EQUAL(1, gps_parser_get_stats(&gps)->filtered_packets);
+    TEST_ASSERT_EQUAL(0, gps_parser_get_stats(&gps)->unknown_packets);
+    TEST_ASSERT_EQUAL(0, gps_filter_hits(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V')));
+}
+
+void test_nmea_count_tracks_hits(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V'), GPS_FILTER_COUNT);
+
+    feed(GSV_UNREGISTERED, strlen(GSV_UNREGISTERED));
+    feed(GSV_UNREGISTERED, strlen(GSV_UNREGISTERED));
+
+    TEST_ASSERT_EQUAL(0, total_calls());
+    TEST_ASSERT_EQUAL(2, gps_filter_hits(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'S', 'V')));
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_nmea_partial_sentence_waits_for_terminator(void) {
+    size_t len = strlen(GSV_UNREGISTERED);
+    gps_filter_set_default(&gps, GPS_PROTOCOL_NMEA, GPS_FILTER_DROP);
+
+    /* Everything but "\r\n" */
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed(GSV_UNREGISTERED, len - 2));
+    TEST_ASSERT_EQUAL(len - 2, ringbuffer_size(&gps.rx_buf));
+
+    feed(GSV_UNREGISTERED + len - 2, 2);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_EQUAL(0, total_calls());
+}
+
+void test_nmea_drop_byte_at_a_time_scans_each_byte_once(void) {
+    size_t len = strlen(GSV_UNREGISTERED);
+    gps_filter_set_default(&gps, GPS_PROTOCOL_NMEA, GPS_FILTER_DROP);
+
+    for (size_t i = 0; i < len; i++) {
+        feed(&GSV_UNREGISTERED[i], 1);
+    }
+
+    /* Terminator search resumes where it stopped: '$' .. '\r' once each */
+    TEST_ASSERT_EQUAL(len - 1, gps_parser_get_stats(&gps)->scanned_bytes);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_EQUAL(1, gps_parser_get_stats(&gps)->filtered_packets);
+    TEST_ASSERT_EQUAL(0, total_calls());
+}
+
+void test_nmea_decode_does_not_wait_for_terminator(void) {
+    /* A decoded sentence goes to the parser as soon as its type is known */
+    gps_filter_set_default(&gps, GPS_PROTOCOL_NMEA, GPS_FILTER_DROP);
+    gps_filter_set(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('G', 'G', 'A'), GPS_FILTER_DECODE);
+
+    feed(GGA_INCOMPLETE, strlen(GGA_INCOMPLETE));
+    TEST_ASSERT_EQUAL(1, calls[P_NMEA]);
+}
+
+void test_command_response_never_filtered(void) {
+    gps_filter_set_default(&gps, GPS_PROTOCOL_NMEA, GPS_FILTER_DROP);
+
+    feed("$command,mode,response: OK*00\r\n", 31);
+    TEST_ASSERT_EQUAL(1, calls[P_UC_ASCII]);
+}
+
+void test_nmea_raw_event_carries_sentence(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_NMEA, GPS_NMEA_KEY('T', 'H', 'S'), GPS_FILTER_RAW);
+
+    feed(THS_VALID, strlen(THS_VALID));
+
+    TEST_ASSERT_EQUAL(1, raw_events);
+    TEST_ASSERT_EQUAL(GPS_PROTOCOL_NMEA, last_raw.protocol);
+    TEST_ASSERT_EQUAL_HEX32(GPS_NMEA_KEY('T', 'H', 'S'), last_raw.data.raw.msg_id);
+    TEST_ASSERT_EQUAL(strlen(THS_VALID), last_raw.data.raw.length);
+    TEST_ASSERT_EQUAL_MEMORY(THS_VALID, raw_copy, strlen(THS_VALID));
+    TEST_ASSERT_EQUAL(0, total_calls());
+}
+
+/*===========================================================================
+ * Unicore binary / RTCM
+ *===========================================================================*/
+
+void test_unicore_bin_count_skips_by_length(void) {
+    gps_filter_set_default(&gps, GPS_PROTOCOL_UNICORE_BIN, GPS_FILTER_COUNT);
+    gps_filter_set(&gps, GPS_PROTOCOL_UNICORE_BIN, 2120, GPS_FILTER_DECODE);
+
+    feed(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX));
+    TEST_ASSERT_EQUAL(0, total_calls());
+    TEST_ASSERT_EQUAL(1, gps_filter_hits(&gps, GPS_PROTOCOL_UNICORE_BIN, 2118));
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+
+    feed(UNICORE_HEADING2_FIXED, sizeof(UNICORE_HEADING2_FIXED));
+    TEST_ASSERT_EQUAL(1, calls[P_UC_BIN]);
+}
+
+void test_unicore_bin_partial_frame_kept(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_UNICORE_BIN, 2118, GPS_FILTER_DROP);
+
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed(UNICORE_BESTNAV_RTK_FIX, 100));
+    TEST_ASSERT_EQUAL(100, ringbuffer_size(&gps.rx_buf));
+
+    feed(UNICORE_BESTNAV_RTK_FIX + 100, sizeof(UNICORE_BESTNAV_RTK_FIX) - 100);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_EQUAL(0, total_calls());
+}
+
+void test_rtcm_drop_by_type(void) {
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1005, GPS_FILTER_DROP);
+
+    feed(RTCM_1005_STATION, sizeof(RTCM_1005_STATION));
+    TEST_ASSERT_EQUAL(0, total_calls());
+    TEST_ASSERT_EQUAL(1, gps_parser_get_stats(&gps)->filtered_packets);
+}
+
+void test_rtcm_reserved_bits_not_framed(void) {
+    /* 0xD3 with reserved bits set is not RTCM: left to the parsers, not skipped by length */
+    static const uint8_t stray[] = {0xD3, 0x43, 0x10, 0x3E, 0xD0, 0x00};
+
+    gps_filter_set_default(&gps, GPS_PROTOCOL_RTCM, GPS_FILTER_DROP);
+
+    feed(stray, sizeof(stray));
+    TEST_ASSERT_EQUAL(1, calls[P_RTCM]);
+    TEST_ASSERT_EQUAL(0, gps_parser_get_stats(&gps)->filtered_packets);
+}
+
+void test_rtcm_raw_spans_across_wrap(void) {
+    char junk[GPS_RX_BUF_SIZE - 10];
+
+    /* Move indices so the frame wraps around the end of memory */
+    memset(junk, 'x', sizeof(junk));
+    feed(junk, sizeof(junk));
+
+    gps_filter_set(&gps, GPS_PROTOCOL_RTCM, 1005, GPS_FILTER_RAW);
+    feed(RTCM_1005_STATION, sizeof(RTCM_1005_STATION));
+
+    TEST_ASSERT_EQUAL(1, raw_events);
+    TEST_ASSERT_EQUAL(2, last_raw.data.raw.span_cnt);
+    TEST_ASSERT_EQUAL(1005, last_raw.data.raw.msg_id);
+    TEST_ASSERT_EQUAL_MEMORY(RTCM_1005_STATION, raw_copy, sizeof(RTCM_1005_STATION));
+    TEST_ASSERT_EQUAL(1, gps_filter_hits(&gps, GPS_PROTOCOL_RTCM, 1005));
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Configuration */
+    RUN_TEST(test_default_is_decode_and_inactive);
+    RUN_TEST(test_rule_overrides_default);
+    RUN_TEST(test_same_id_on_other_protocol_is_separate);
+    RUN_TEST(test_updating_rule_reuses_slot);
+    RUN_TEST(test_back_to_decode_deactivates);
+    RUN_TEST(test_table_full_and_bad_protocol_rejected);
+
+    /* NMEA */
+    RUN_TEST(test_nmea_drop_skips_sentence_without_parser);
+    RUN_TEST(test_nmea_count_tracks_hits);
+    RUN_TEST(test_nmea_partial_sentence_waits_for_terminator);
+    RUN_TEST(test_nmea_drop_byte_at_a_time_scans_each_byte_once);
+    RUN_TEST(test_nmea_decode_does_not_wait_for_terminator);
+    RUN_TEST(test_command_response_never_filtered);
+    RUN_TEST(test_nmea_raw_event_carries_sentence);
+
+    /* Unicore binary / RTCM */
+    RUN_TEST(test_unicore_bin_count_skips_by_length);
+    RUN_TEST(test_unicore_bin_partial_frame_kept);
+    RUN_TEST(test_rtcm_drop_by_type);
+    RUN_TEST(test_rtcm_reserved_bits_not_framed);
+    RUN_TEST(test_rtcm_raw_spans_across_wrap);
+
+    return UNITY_END();
+}
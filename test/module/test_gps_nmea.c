@@ -6,7 +6,8 @@
  * Dependencies: ringbuffer.c, gps_parser.c (utilities), mock FreeRTOS/HAL
  *
  * Tests: GGA parsing, THS parsing, CRC verification,
- *        unregistered NMEA handling, error cases
+ *        message type lookup (perfect hash), unregistered NMEA handling, error cases,
+ *        streaming tokenizer (split delivery, resume, ring wrap)
  */
 
 #include "unity.h"
@@ -20,6 +21,7 @@
  *===========================================================================*/
 
 static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
 
 /* Event capture for handler tests */
 static gps_event_t last_event;
@@ -36,8 +38,8 @@ void setUp(void) {
     memset(&last_event, 0, sizeof(gps_event_t));
     event_count = 0;
 
-    /* Initialize rx_buf ringbuffer */
-    ringbuffer_init(&gps.rx_buf, gps.rx_buf_mem, sizeof(gps.rx_buf_mem));
+    /* Initialize rx_buf ringbuffer (memory is owned by the port on target) */
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
 
     /* Set event handler */
     gps.handler = test_event_handler;
@@ -69,17 +71,18 @@ void test_gga_basic_parse(void) {
     TEST_ASSERT_EQUAL_UINT8(27, gps.nmea_data.gga.min);
     TEST_ASSERT_EQUAL_UINT8(25, gps.nmea_data.gga.sec);
 
-    /* Position: 47°17.11399'N → 47.28523... */
-    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 47.2852, gps.nmea_data.gga.lat);
+    /* Position: 47°17.11399'N → 47.285233166..., 8°33.91590'E → 8.565265 */
+    TEST_ASSERT_EQUAL_INT64(47285233167LL, gps.nmea_data.gga.lat_ndeg);
     TEST_ASSERT_EQUAL_CHAR('N', gps.nmea_data.gga.ns);
-    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 8.5653, gps.nmea_data.gga.lon);
+    TEST_ASSERT_EQUAL_INT64(8565265000LL, gps.nmea_data.gga.lon_ndeg);
     TEST_ASSERT_EQUAL_CHAR('E', gps.nmea_data.gga.ew);
 
-    /* Fix, satellites, HDOP, altitude */
+    /* Fix, satellites, HDOP, altitude, geoid separation */
     TEST_ASSERT_EQUAL(GPS_FIX_GPS, gps.nmea_data.gga.fix);
     TEST_ASSERT_EQUAL_UINT8(8, gps.nmea_data.gga.sat_num);
-    TEST_ASSERT_DOUBLE_WITHIN(0.01, 1.01, gps.nmea_data.gga.hdop);
-    TEST_ASSERT_DOUBLE_WITHIN(0.1, 499.6, gps.nmea_data.gga.alt);
+    TEST_ASSERT_EQUAL_UINT16(101, gps.nmea_data.gga.hdop_x100);
+    TEST_ASSERT_EQUAL_INT32(499600, gps.nmea_data.gga.alt_mm);
+    TEST_ASSERT_EQUAL_INT32(48000, gps.nmea_data.gga.geo_sep_mm);
 }
 
 void test_gga_rtk_fix(void) {
@@ -107,7 +110,11 @@ void test_gga_south_west(void) {
     TEST_ASSERT_EQUAL(PARSE_OK, r);
     TEST_ASSERT_EQUAL_CHAR('S', gps.nmea_data.gga.ns);
     TEST_ASSERT_EQUAL_CHAR('W', gps.nmea_data.gga.ew);
-    TEST_ASSERT_TRUE(gps.nmea_data.gga.lat > 0); /* lat value is positive, direction is S */
+    TEST_ASSERT_TRUE(gps.nmea_data.gga.lat_ndeg > 0); /* lat value is positive, direction is S */
+
+    /* Common data carries the sign */
+    TEST_ASSERT_EQUAL_INT64(-33809000000LL, gps.data.gga_position.lat_ndeg);
+    TEST_ASSERT_EQUAL_INT64(-70568666667LL, gps.data.gga_position.lon_ndeg);
 }
 
 void test_gga_updates_common_data(void) {
@@ -115,7 +122,11 @@ void test_gga_updates_common_data(void) {
     feed_and_parse(GGA_BASIC, strlen(GGA_BASIC));
     TEST_ASSERT_EQUAL(GPS_FIX_GPS, gps.data.status.fix_type);
     TEST_ASSERT_TRUE(gps.data.status.fix_changed);
+    TEST_ASSERT_EQUAL_UINT16(101, gps.data.status.hdop_x100);
     TEST_ASSERT_DOUBLE_WITHIN(0.01, 1.01, gps.data.status.hdop);
+    TEST_ASSERT_EQUAL_INT64(47285233167LL, gps.data.gga_position.lat_ndeg);
+    TEST_ASSERT_EQUAL_INT64(8565265000LL, gps.data.gga_position.lon_ndeg);
+    TEST_ASSERT_EQUAL_INT32(499600, gps.data.gga_position.alt_mm);
 
     /* Second parse with same fix → fix_changed = false */
     ringbuffer_reset(&gps.rx_buf);
@@ -136,7 +147,7 @@ void test_gga_ringbuffer_consumed(void) {
 void test_ths_parse(void) {
     parse_result_t r = feed_and_parse(THS_VALID, strlen(THS_VALID));
     TEST_ASSERT_EQUAL(PARSE_OK, r);
-    TEST_ASSERT_DOUBLE_WITHIN(0.1, 270.5, gps.nmea_data.ths.heading);
+    TEST_ASSERT_EQUAL_INT32(270500000, gps.nmea_data.ths.heading_udeg);
     TEST_ASSERT_EQUAL(GPS_THS_MODE_AUTO, gps.nmea_data.ths.mode);
 }
 
@@ -148,6 +159,7 @@ void test_ths_invalid_mode(void) {
 
 void test_ths_updates_common_data(void) {
     feed_and_parse(THS_VALID, strlen(THS_VALID));
+    TEST_ASSERT_EQUAL_INT32(270500000, gps.data.heading.heading_udeg);
     TEST_ASSERT_DOUBLE_WITHIN(0.1, 270.5, gps.data.heading.heading);
     TEST_ASSERT_EQUAL('A', gps.data.heading.mode);
 }
@@ -177,6 +189,57 @@ void test_unregistered_nmea_returns_not_mine(void) {
     TEST_ASSERT_EQUAL(PARSE_NOT_MINE, r);
 }
 
+void test_unknown_type_with_valid_talker_returns_not_mine(void) {
+    static const char xyz[] = "$GNXYZ,1,2,3*4F\r\n";
+
+    TEST_ASSERT_EQUAL(PARSE_NOT_MINE, feed_and_parse(xyz, strlen(xyz)));
+    TEST_ASSERT_EQUAL(strlen(xyz), ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.nmea.scan_pos);
+}
+
+/*===========================================================================
+ * Message type lookup (perfect hash over NMEA_MSG_TABLE)
+ *===========================================================================*/
+
+void test_lookup_every_table_entry(void) {
+#define X(name, str, key, handler, field_count, is_urc)                         \
+    TEST_ASSERT_EQUAL_HEX32(GPS_NMEA_KEY(str[0], str[1], str[2]), key);         \
+    TEST_ASSERT_EQUAL_MESSAGE(GPS_NMEA_MSG_##name, gps_nmea_msg_lookup(str), str);
+    NMEA_MSG_TABLE(X)
+#undef X
+}
+
+void test_lookup_rejects_other_standard_types(void) {
+    static const char *const others[] = {"GSV", "GSA", "RMC", "VTG", "GLL", "ZDA", "GST",
+                                         "HDT", "ROT", "GNS", "GRS", "TRA", "TXT", "ggA",
+                                         "GG\0", "\xFF\xFF\xFF"};
+
+    for (size_t i = 0; i < sizeof(others) / sizeof(others[0]); i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(GPS_NMEA_MSG_NONE, gps_nmea_msg_lookup(others[i]), others[i]);
+    }
+}
+
+void test_lookup_sweep_matches_table_only(void) {
+    size_t expected = 0;
+    size_t found = 0;
+    char type[3];
+
+#define X(name, str, key, handler, field_count, is_urc) expected++;
+    NMEA_MSG_TABLE(X)
+#undef X
+
+    for (type[0] = 'A'; type[0] <= 'Z'; type[0]++) {
+        for (type[1] = 'A'; type[1] <= 'Z'; type[1]++) {
+            for (type[2] = 'A'; type[2] <= 'Z'; type[2]++) {
+                if (gps_nmea_msg_lookup(type) != GPS_NMEA_MSG_NONE) {
+                    found++;
+                }
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(expected, found);
+}
+
 /*===========================================================================
  * Incomplete data
  *===========================================================================*/
@@ -260,11 +323,84 @@ void test_sequential_gga_then_ths(void) {
 
     parse_result_t r2 = nmea_try_parse(&gps, &gps.rx_buf);
     TEST_ASSERT_EQUAL(PARSE_OK, r2);
-    TEST_ASSERT_DOUBLE_WITHIN(0.1, 270.5, gps.nmea_data.ths.heading);
+    TEST_ASSERT_EQUAL_INT32(270500000, gps.nmea_data.ths.heading_udeg);
 
     TEST_ASSERT_TRUE(ringbuffer_is_empty(&gps.rx_buf));
 }
 
+/*===========================================================================
+ * Streaming tokenizer (sentence delivered in pieces)
+ *===========================================================================*/
+
+void test_split_sentence_resumes_scan(void) {
+    size_t len = strlen(GGA_RTK_FIX);
+
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed_and_parse(GGA_RTK_FIX, 40));
+
+    /* Tokenizer remembers how far it got instead of rescanning from '$' */
+    TEST_ASSERT_EQUAL(40, gps.parser_ctx.nmea.scan_pos);
+    TEST_ASSERT_EQUAL(5, gps.parser_ctx.nmea.field_cnt);
+
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(GGA_RTK_FIX + 40, len - 40));
+    TEST_ASSERT_EQUAL(GPS_FIX_RTK_FIX, gps.nmea_data.gga.fix);
+    TEST_ASSERT_EQUAL_UINT8(12, gps.nmea_data.gga.sat_num);
+    TEST_ASSERT_EQUAL_INT32(52300, gps.nmea_data.gga.alt_mm);
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&gps.rx_buf));
+
+    /* State cleared for the next sentence */
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.nmea.scan_pos);
+}
+
+void test_byte_at_a_time_delivery(void) {
+    size_t len = strlen(GGA_BASIC);
+    parse_result_t r = PARSE_NEED_MORE;
+
+    for (size_t i = 0; i < len && r == PARSE_NEED_MORE; i++) {
+        r = feed_and_parse(&GGA_BASIC[i], 1);
+    }
+
+    TEST_ASSERT_EQUAL(PARSE_OK, r);
+    TEST_ASSERT_EQUAL_INT64(47285233167LL, gps.nmea_data.gga.lat_ndeg);
+    TEST_ASSERT_EQUAL_INT32(48000, gps.nmea_data.gga.geo_sep_mm);
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&gps.rx_buf));
+
+    /* Every byte after '$' up to and including '\r' tokenized exactly once */
+    TEST_ASSERT_EQUAL(len - 2, gps.parser_ctx.stats.scanned_bytes);
+}
+
+void test_split_bad_crc_detected(void) {
+    size_t len = strlen(GGA_BAD_CRC);
+
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed_and_parse(GGA_BAD_CRC, len - 4));
+    TEST_ASSERT_EQUAL(PARSE_INVALID, feed_and_parse(GGA_BAD_CRC + len - 4, 4));
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.stats.crc_errors);
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.nmea.scan_pos);
+}
+
+void test_sentence_across_ring_wrap(void) {
+    char fill[GPS_RX_BUF_SIZE - 30];
+
+    /* Move indices so the sentence straddles the end of ring memory */
+    memset(fill, 0, sizeof(fill));
+    ringbuffer_write(&gps.rx_buf, fill, sizeof(fill));
+    ringbuffer_advance(&gps.rx_buf, sizeof(fill));
+
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(GGA_SOUTH_WEST, strlen(GGA_SOUTH_WEST)));
+    TEST_ASSERT_EQUAL_CHAR('S', gps.nmea_data.gga.ns);
+    TEST_ASSERT_EQUAL_CHAR('W', gps.nmea_data.gga.ew);
+    TEST_ASSERT_EQUAL_INT32(100000, gps.nmea_data.gga.alt_mm);
+}
+
+void test_too_long_without_cr_returns_invalid(void) {
+    char data[GPS_NMEA_MAX_LEN + 8];
+
+    memset(data, '1', sizeof(data));
+    memcpy(data, "$GPGGA,", 7);
+
+    TEST_ASSERT_EQUAL(PARSE_INVALID, feed_and_parse(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.nmea.scan_pos);
+}
+
 /*===========================================================================
  * Runner
  *===========================================================================*/
@@ -292,6 +428,12 @@ int main(void) {
 
     /* Unregistered NMEA */
     RUN_TEST(test_unregistered_nmea_returns_not_mine);
+    RUN_TEST(test_unknown_type_with_valid_talker_returns_not_mine);
+
+    /* Message type lookup */
+    RUN_TEST(test_lookup_every_table_entry);
+    RUN_TEST(test_lookup_rejects_other_standard_types);
+    RUN_TEST(test_lookup_sweep_matches_table_only);
 
     /* Incomplete data */
     RUN_TEST(test_incomplete_returns_need_more);
@@ -310,5 +452,12 @@ int main(void) {
     /* Sequential */
     RUN_TEST(test_sequential_gga_then_ths);
 
+    /* Streaming tokenizer */
+    RUN_TEST(test_split_sentence_resumes_scan);
+    RUN_TEST(test_byte_at_a_time_delivery);
+    RUN_TEST(test_split_bad_crc_detected);
+    RUN_TEST(test_sentence_across_ring_wrap);
+    RUN_TEST(test_too_long_without_cr_returns_invalid);
+
     return UNITY_END();
 }
@@ -0,0 +1,238 @@
+/**
+ * @file test_gps_parser.c
+ * @brief Module tests for lib/gps/gps_parser.c
+ *
+ * Target: gps_parser.c main loop (MOCKABLE module)
+ * Dependencies: ringbuffer.c, mock FreeRTOS/HAL
+ *
+ * The four protocol parsers are replaced by recording stubs defined here,
+ * so the tests observe which parser each frame is routed to.
+ *
+ * Tests: first-byte dispatch, '$' prefix classification,
+ *        resync to the next sync byte (full 0xAA 0x44 0xB5 for binary),
+ *        NEED_MORE / INVALID handling
+ */
+
+#include "unity.h"
+#include "gps.h"
+#include "gps_parser.h"
+#include <string.h>
+
+/*===========================================================================
+ * Recording parser stubs
+ *===========================================================================*/
+
+enum { P_NMEA, P_UC_ASCII, P_UC_BIN, P_RTCM, P_COUNT };
+
+static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
+static int calls[P_COUNT];
+static parse_result_t stub_result;
+
+/* Consume the whole buffered frame on PARSE_OK */
+static parse_result_t record(int which, ringbuffer_t *rb) {
+    calls[which]++;
+    if (stub_result == PARSE_OK) {
+        ringbuffer_advance(rb, ringbuffer_size(rb));
+    }
+    return stub_result;
+}
+
+parse_result_t nmea_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_NMEA, rb);
+}
+
+parse_result_t unicore_ascii_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_UC_ASCII, rb);
+}
+
+parse_result_t unicore_bin_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_UC_BIN, rb);
+}
+
+parse_result_t rtcm_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    return record(P_RTCM, rb);
+}
+
+void setUp(void) {
+    memset(&gps, 0, sizeof(gps_t));
+    memset(calls, 0, sizeof(calls));
+    stub_result = PARSE_OK;
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
+}
+
+void tearDown(void) {
+}
+
+static parse_result_t feed(const char *data, size_t len) {
+    ringbuffer_write(&gps.rx_buf, data, len);
+    return gps_parser_process(&gps);
+}
+
+static void assert_only(int which) {
+    for (int i = 0; i < P_COUNT; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(i == which ? 1 : 0, calls[i], "parser call count");
+    }
+}
+
+/*===========================================================================
+ * Dispatch
+ *===========================================================================*/
+
+void test_nmea_routed_to_nmea_only(void) {
+    feed("$GNGGA,1*00\r\n", 13);
+    assert_only(P_NMEA);
+    TEST_ASSERT_EQUAL(1, gps_parser_get_stats(&gps)->rx_packets);
+}
+
+void test_unicore_ascii_routed_to_unicore_ascii_only(void) {
+    feed("$command,mode,response: OK*00\r\n", 31);
+    assert_only(P_UC_ASCII);
+}
+
+void test_unicore_bin_routed_by_sync_byte(void) {
+    feed("\xAA\x44\xB5\x00", 4);
+    assert_only(P_UC_BIN);
+}
+
+void test_rtcm_routed_by_preamble(void) {
+    feed("\xD3\x00\x00", 3);
+    assert_only(P_RTCM);
+}
+
+void test_unknown_bytes_skipped_without_parser_calls(void) {
+    feed("xyz\r\n", 5);
+
+    for (int i = 0; i < P_COUNT; i++) {
+        TEST_ASSERT_EQUAL(0, calls[i]);
+    }
+    TEST_ASSERT_EQUAL(5, gps_parser_get_stats(&gps)->unknown_packets);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_dollar_with_unknown_prefix_skipped(void) {
+    /* '$' followed by neither a talker nor "command," reaches no parser */
+    feed("$PQTM", 5);
+
+    for (int i = 0; i < P_COUNT; i++) {
+        TEST_ASSERT_EQUAL(0, calls[i]);
+    }
+    TEST_ASSERT_EQUAL(5, gps_parser_get_stats(&gps)->unknown_packets);
+}
+
+/*===========================================================================
+ * Resync
+ *===========================================================================*/
+
+void test_junk_skipped_up_to_next_sync_byte(void) {
+    stub_result = PARSE_NEED_MORE;
+
+    feed("\x00\xFFnoise\r\n$GNGGA", 15);
+
+    /* One parser call for the '$' frame, none for the 9 junk bytes */
+    assert_only(P_NMEA);
+    TEST_ASSERT_EQUAL(9, gps_parser_get_stats(&gps)->unknown_packets);
+    TEST_ASSERT_EQUAL(6, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_rejected_frame_skipped_as_a_whole(void) {
+    /* Rejected '$' sentence: everything up to the next candidate goes at once */
+    stub_result = PARSE_NOT_MINE;
+    feed("$GPGSV,3,1*7C\r\n\xD3", 16);
+
+    TEST_ASSERT_EQUAL(1, calls[P_NMEA]);
+    TEST_ASSERT_EQUAL(1, calls[P_RTCM]);
+    TEST_ASSERT_EQUAL(16, gps_parser_get_stats(&gps)->unknown_packets);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_resync_across_wrap(void) {
+    char junk[GPS_RX_BUF_SIZE - 4];
+
+    /* Move indices so the junk run wraps around the end of memory */
+    memset(junk, 'x', sizeof(junk));
+    feed(junk, sizeof(junk));
+    TEST_ASSERT_EQUAL(sizeof(junk), gps_parser_get_stats(&gps)->unknown_packets);
+
+    stub_result = PARSE_NEED_MORE;
+    feed("abcdefgh\xAA\x44", 10);
+
+    assert_only(P_UC_BIN);
+    TEST_ASSERT_EQUAL(sizeof(junk) + 8, gps_parser_get_stats(&gps)->unknown_packets);
+    TEST_ASSERT_EQUAL(2, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_lone_aa_in_junk_skipped(void) {
+    stub_result = PARSE_NEED_MORE;
+
+    /* 0xAA not followed by 0x44 0xB5 is payload, not a binary sync */
+    feed("zz\xAA\x01\x02zz\xAA\x44\x00\xAA\x44\xB5", 13);
+
+    assert_only(P_UC_BIN);
+    TEST_ASSERT_EQUAL(10, gps_parser_get_stats(&gps)->unknown_packets);
+    TEST_ASSERT_EQUAL(3, ringbuffer_size(&gps.rx_buf));
+}
+
+/*===========================================================================
+ * Result handling
+ *===========================================================================*/
+
+void test_lone_dollar_waits_for_prefix(void) {
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed("$", 1));
+
+    for (int i = 0; i < P_COUNT; i++) {
+        TEST_ASSERT_EQUAL(0, calls[i]);
+    }
+    TEST_ASSERT_EQUAL(1, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_need_more_keeps_data(void) {
+    stub_result = PARSE_NEED_MORE;
+
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed("\xD3\x00", 2));
+    TEST_ASSERT_EQUAL(2, ringbuffer_size(&gps.rx_buf));
+    assert_only(P_RTCM);
+}
+
+void test_invalid_skips_one_byte(void) {
+    stub_result = PARSE_INVALID;
+
+    /* 0xAA rejected -> skip, then "zz" unknown */
+    feed("\xAAzz", 3);
+    assert_only(P_UC_BIN);
+    TEST_ASSERT_EQUAL(1, gps_parser_get_stats(&gps)->invalid_packets);
+    TEST_ASSERT_EQUAL(2, gps_parser_get_stats(&gps)->unknown_packets);
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Dispatch */
+    RUN_TEST(test_nmea_routed_to_nmea_only);
+    RUN_TEST(test_unicore_ascii_routed_to_unicore_ascii_only);
+    RUN_TEST(test_unicore_bin_routed_by_sync_byte);
+    RUN_TEST(test_rtcm_routed_by_preamble);
+    RUN_TEST(test_unknown_bytes_skipped_without_parser_calls);
+    RUN_TEST(test_dollar_with_unknown_prefix_skipped);
+
+    /* Resync */
+    RUN_TEST(test_junk_skipped_up_to_next_sync_byte);
+    RUN_TEST(test_rejected_frame_skipped_as_a_whole);
+    RUN_TEST(test_resync_across_wrap);
+    RUN_TEST(test_lone_aa_in_junk_skipped);
+
+    /* Result handling */
+    RUN_TEST(test_lone_dollar_waits_for_prefix);
+    RUN_TEST(test_need_more_keeps_data);
+    RUN_TEST(test_invalid_skips_one_byte);
+
+    return UNITY_END();
+}
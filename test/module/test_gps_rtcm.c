@@ -0,0 +1,271 @@
+/**
+ * @file test_gps_rtcm.c
+ * @brief Module tests for lib/gps/rtcm.c
+ *
+ * Target: rtcm.c framing + LoRa fragmenting (MOCKABLE module)
+ * Dependencies: ringbuffer.c, record_ring.c, crc.c, mock FreeRTOS/LoRa
+ *
+ * Tests: recorded 1005 frame, stray 0xD3 with reserved bits set, full
+ *        1029-byte MSM frames split across the ring wrap, partial delivery,
+ *        byte-at-a-time delivery (each byte scanned once), CRC rejection,
+ *        LoRa fragments of a max-length record
+ */
+
+#include "unity.h"
+#include "gps.h"
+#include "gps_parser.h"
+#include "rtcm.h"
+#include "crc.h"
+#include "lora_app.h"
+#include "rtcm/rtcm_fixture.h"
+#include <string.h>
+
+#define MSM7_GPS 1077
+
+/*===========================================================================
+ * Test fixtures
+ *===========================================================================*/
+
+static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
+static uint8_t frame[RTCM_MAX_FRAME];
+
+static gps_event_t last_event;
+static int event_count;
+
+static void test_event_handler(gps_t *g, const gps_event_t *event) {
+    (void)g;
+    memcpy(&last_event, event, sizeof(gps_event_t));
+    event_count++;
+}
+
+/* LoRa stub: reassemble queued fragments */
+static uint8_t lora_sent[RTCM_MAX_FRAME];
+static size_t lora_sent_len;
+static int lora_calls;
+static bool lora_last_has_callback;
+
+bool lora_send_p2p_raw_async(const uint8_t *data, size_t len, uint32_t timeout_ms,
+                             lora_cmd_callback_t callback, void *user_data) {
+    (void)timeout_ms;
+    (void)user_data;
+    TEST_ASSERT_TRUE(lora_sent_len + len <= sizeof(lora_sent));
+    memcpy(lora_sent + lora_sent_len, data, len);
+    lora_sent_len += len;
+    lora_calls++;
+    lora_last_has_callback = (callback != NULL);
+    return true;
+}
+
+/* Max-length MSM7 frame: message number 1077, pseudo-random body, CRC24Q */
+static void build_msm7_frame(void) {
+    uint32_t seed = 0x1077;
+
+    frame[0] = 0xD3;
+    frame[1] = 0x03;
+    frame[2] = 0xFF;
+    frame[3] = (uint8_t)(MSM7_GPS >> 4);
+    frame[4] = (uint8_t)((MSM7_GPS & 0x0F) << 4);
+    for (size_t i = 5; i < RTCM_MAX_FRAME - 3; i++) {
+        seed = seed * 1103515245u + 12345u;
+        frame[i] = (uint8_t)(seed >> 16);
+    }
+
+    uint32_t crc = crc24q_update(0, frame, RTCM_MAX_FRAME - 3);
+    frame[RTCM_MAX_FRAME - 3] = (uint8_t)(crc >> 16);
+    frame[RTCM_MAX_FRAME - 2] = (uint8_t)(crc >> 8);
+    frame[RTCM_MAX_FRAME - 1] = (uint8_t)crc;
+}
+
+void setUp(void) {
+    memset(&gps, 0, sizeof(gps_t));
+    memset(&last_event, 0, sizeof(gps_event_t));
+    event_count = 0;
+    lora_sent_len = 0;
+    lora_calls = 0;
+    lora_last_has_callback = false;
+
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
+    record_ring_init(&gps.rtcm_data.ring, gps.rtcm_data.ring_mem, sizeof(gps.rtcm_data.ring_mem));
+    gps.handler = test_event_handler;
+
+    build_msm7_frame();
+}
+
+void tearDown(void) {
+}
+
+static parse_result_t feed_and_parse(const void *data, size_t len) {
+    ringbuffer_write(&gps.rx_buf, data, len);
+    return rtcm_try_parse(&gps, &gps.rx_buf);
+}
+
+/* Move the ring indices so the next write starts `lead` bytes in */
+static void move_ring_to(size_t lead) {
+    static const char fill[GPS_RX_BUF_SIZE];
+
+    ringbuffer_write(&gps.rx_buf, fill, lead);
+    ringbuffer_advance(&gps.rx_buf, lead);
+}
+
+static void assert_stored(const uint8_t *expect, size_t len, uint16_t type) {
+    const record_ring_hdr_t *rec = record_ring_peek(&gps.rtcm_data.ring);
+
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL(len, rec->len);
+    TEST_ASSERT_EQUAL(type, rec->type);
+    TEST_ASSERT_EQUAL_MEMORY(expect, record_ring_payload(rec), len);
+}
+
+/*===========================================================================
+ * Framing
+ *===========================================================================*/
+
+void test_rtcm_1005_frame(void) {
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(RTCM_1005_STATION, sizeof(RTCM_1005_STATION)));
+
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    assert_stored(RTCM_1005_STATION, sizeof(RTCM_1005_STATION), 1005);
+    TEST_ASSERT_EQUAL(1005, gps.rtcm_data.last_msg_type);
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.stats.rtcm_packets);
+
+    TEST_ASSERT_EQUAL(1, event_count);
+    TEST_ASSERT_EQUAL(GPS_EVENT_RTCM_RECEIVED, last_event.type);
+    TEST_ASSERT_EQUAL(1005, last_event.data.rtcm.msg_type);
+}
+
+void test_rtcm_not_mine(void) {
+    TEST_ASSERT_EQUAL(PARSE_NOT_MINE, feed_and_parse("$GNGGA", 6));
+    TEST_ASSERT_EQUAL(6, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_rtcm_reserved_bits_not_mine(void) {
+    /* 0xD3 inside other data: reserved bits set, must not start a frame */
+    static const uint8_t stray[] = {0xD3, 0x43, 0xFF};
+
+    TEST_ASSERT_EQUAL(PARSE_NOT_MINE, feed_and_parse(stray, sizeof(stray)));
+    TEST_ASSERT_EQUAL(sizeof(stray), ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.rtcm.total_len);
+}
+
+void test_rtcm_max_length_frame(void) {
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(frame, RTCM_MAX_FRAME));
+
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    assert_stored(frame, RTCM_MAX_FRAME, MSM7_GPS);
+    TEST_ASSERT_EQUAL(RTCM_MAX_FRAME, last_event.data.rtcm.length);
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.stats.crc_errors);
+}
+
+void test_rtcm_max_length_frame_across_wrap(void) {
+    /* Wrap point lands in the header, CRC field and everywhere in between */
+    static const size_t leads[] = {1020, 1021, 1022, 1023, 1500, 2040, 2043, 2044, 2045, 2046};
+
+    for (size_t i = 0; i < sizeof(leads) / sizeof(leads[0]); i++) {
+        setUp();
+        move_ring_to(leads[i]);
+
+        TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(frame, RTCM_MAX_FRAME));
+        TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+        assert_stored(frame, RTCM_MAX_FRAME, MSM7_GPS);
+    }
+}
+
+void test_rtcm_partial_frame_needs_more(void) {
+    move_ring_to(1800);
+
+    /* Delivered in DMA-sized chunks, parse after each */
+    for (size_t off = 0; off < RTCM_MAX_FRAME; off += 256) {
+        size_t n = (RTCM_MAX_FRAME - off < 256) ? RTCM_MAX_FRAME - off : 256;
+        parse_result_t res = feed_and_parse(frame + off, n);
+
+        TEST_ASSERT_EQUAL(off + n == RTCM_MAX_FRAME ? PARSE_OK : PARSE_NEED_MORE, res);
+    }
+    assert_stored(frame, RTCM_MAX_FRAME, MSM7_GPS);
+}
+
+void test_rtcm_byte_at_a_time_scans_each_byte_once(void) {
+    parse_result_t res = PARSE_NEED_MORE;
+    size_t fed = 0;
+
+    move_ring_to(1500);
+
+    while (res == PARSE_NEED_MORE && fed < RTCM_MAX_FRAME) {
+        res = feed_and_parse(frame + fed, 1);
+        fed++;
+
+        if (res == PARSE_NEED_MORE && fed >= 3) {
+            /* Once the header is in, CRC covers exactly what has arrived */
+            size_t body = (fed < RTCM_MAX_FRAME - 3) ? fed : RTCM_MAX_FRAME - 3;
+            TEST_ASSERT_EQUAL(body, gps.parser_ctx.rtcm.scan_pos);
+            TEST_ASSERT_EQUAL(body, gps.parser_ctx.stats.scanned_bytes);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(PARSE_OK, res);
+    TEST_ASSERT_EQUAL(RTCM_MAX_FRAME, fed);
+    TEST_ASSERT_EQUAL(RTCM_MAX_FRAME - 3, gps.parser_ctx.stats.scanned_bytes);
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.rtcm.total_len);
+    assert_stored(frame, RTCM_MAX_FRAME, MSM7_GPS);
+}
+
+void test_rtcm_crc_error_drops_frame(void) {
+    frame[600] ^= 0x01;
+    move_ring_to(2000);
+
+    TEST_ASSERT_EQUAL(PARSE_INVALID, feed_and_parse(frame, RTCM_MAX_FRAME));
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.stats.crc_errors);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_NULL(record_ring_peek(&gps.rtcm_data.ring));
+    TEST_ASSERT_EQUAL(0, event_count);
+}
+
+void test_rtcm_back_to_back_max_frames(void) {
+    /* Two full frames in a row: the second wraps the 2048-byte ring */
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(frame, RTCM_MAX_FRAME));
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(frame, RTCM_MAX_FRAME));
+    TEST_ASSERT_EQUAL(2, gps.parser_ctx.stats.rtcm_packets);
+
+    assert_stored(frame, RTCM_MAX_FRAME, MSM7_GPS);
+    record_ring_pop(&gps.rtcm_data.ring);
+    assert_stored(frame, RTCM_MAX_FRAME, MSM7_GPS);
+}
+
+/*===========================================================================
+ * LoRa forwarding
+ *===========================================================================*/
+
+void test_rtcm_send_max_frame_to_lora(void) {
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(frame, RTCM_MAX_FRAME));
+
+    TEST_ASSERT_TRUE(rtcm_send_to_lora(&gps));
+    TEST_ASSERT_EQUAL(9, lora_calls); /* ceil(1029 / 118) */
+    TEST_ASSERT_TRUE(lora_last_has_callback);
+    TEST_ASSERT_EQUAL(RTCM_MAX_FRAME, lora_sent_len);
+    TEST_ASSERT_EQUAL_MEMORY(frame, lora_sent, RTCM_MAX_FRAME);
+    TEST_ASSERT_NULL(record_ring_peek(&gps.rtcm_data.ring));
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Framing */
+    RUN_TEST(test_rtcm_1005_frame);
+    RUN_TEST(test_rtcm_not_mine);
+    RUN_TEST(test_rtcm_reserved_bits_not_mine);
+    RUN_TEST(test_rtcm_max_length_frame);
+    RUN_TEST(test_rtcm_max_length_frame_across_wrap);
+    RUN_TEST(test_rtcm_partial_frame_needs_more);
+    RUN_TEST(test_rtcm_byte_at_a_time_scans_each_byte_once);
+    RUN_TEST(test_rtcm_crc_error_drops_frame);
+    RUN_TEST(test_rtcm_back_to_back_max_frames);
+
+    /* LoRa forwarding */
+    RUN_TEST(test_rtcm_send_max_frame_to_lora);
+
+    return UNITY_END();
+}
@@ -0,0 +1,310 @@
+/**
+ * @file test_gps_tap.c
+ * @brief Module tests for lib/gps/gps_tap.c
+ *
+ * Target: gps_tap.c raw RX stream tap and its capture / stream sinks
+ * Dependencies: ringbuffer.c (DMA mode, as on the GPS port), bipbuffer.c
+ *
+ * The RX ring is fed the way the GPS port does it: bytes are written into the
+ * DMA memory and published with ringbuffer_dma_update. A parser is simulated
+ * by advancing part of the ring between wakeups.
+ *
+ * Tests: disabled tap, only new bytes mirrored per wakeup, wrapped spans,
+ *        full sinks counted as dropped, resync after re-enable / ring reset,
+ *        stream sink transfer chaining and start failure
+ */
+
+#include "unity.h"
+#include "gps_tap.h"
+#include "ringbuffer.h"
+#include <string.h>
+
+#define RX_SIZE 64
+
+static ringbuffer_t rb;
+static char rx_mem[RX_SIZE];
+static size_t dma_pos;
+static gps_tap_t tap;
+
+static gps_tap_capture_t cap;
+static char cap_mem[256];
+
+void setUp(void) {
+    memset(rx_mem, 0, sizeof(rx_mem));
+    ringbuffer_init(&rb, rx_mem, sizeof(rx_mem));
+    ringbuffer_set_mode(&rb, RINGBUFFER_MODE_DMA);
+    dma_pos = 0;
+    memset(&tap, 0, sizeof(tap));
+    memset(cap_mem, 0, sizeof(cap_mem));
+}
+
+void tearDown(void) {
+}
+
+/* DMA writes len bytes and the ISR publishes the new position */
+static void dma_put(const char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        rx_mem[dma_pos] = data[i];
+        dma_pos = (dma_pos + 1) % RX_SIZE;
+    }
+    ringbuffer_dma_update(&rb, dma_pos);
+}
+
+/*===========================================================================
+ * Tap
+ *===========================================================================*/
+
+static int write_calls;
+
+static size_t counting_write(void *ctx, const char *data, size_t len) {
+    (void)ctx;
+    (void)data;
+    write_calls++;
+    return len;
+}
+
+void test_disabled_tap_does_not_touch_sink(void) {
+    write_calls = 0;
+    dma_put("$GPGGA", 6);
+
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(0, write_calls);
+    TEST_ASSERT_EQUAL(0, tap.tapped_bytes);
+    TEST_ASSERT_EQUAL(6, ringbuffer_size(&rb));
+}
+
+void test_only_new_bytes_are_mirrored_per_wakeup(void) {
+    gps_tap_set_sink(&tap, gps_tap_capture_init(&cap, cap_mem, sizeof(cap_mem)));
+
+    /* 첫 wakeup: 부분 프레임, 파서는 아무것도 소비하지 않음 */
+    dma_put("$GPGGA,1", 8);
+    gps_tap_feed(&tap, &rb);
+
+    /* 두 번째 wakeup: 프레임 완성, 파서가 앞 프레임만 소비 */
+    dma_put("23\r\n$GP", 7);
+    gps_tap_feed(&tap, &rb);
+    ringbuffer_advance(&rb, 12);
+
+    /* 세 번째 wakeup: 남은 3바이트는 다시 미러링하지 않음 */
+    dma_put("THS", 3);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(18, cap.len);
+    TEST_ASSERT_EQUAL_MEMORY("$GPGGA,123\r\n$GPTHS", cap_mem, 18);
+    TEST_ASSERT_EQUAL(18, tap.tapped_bytes);
+    TEST_ASSERT_EQUAL(0, tap.dropped_bytes);
+}
+
+void test_wrapped_data_is_mirrored_in_order(void) {
+    char data[RX_SIZE];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)('A' + (i % 26));
+    }
+
+    /* 링 끝 근처로 이동 */
+    dma_put(data, 50);
+    ringbuffer_advance(&rb, 50);
+
+    write_calls = 0;
+    gps_tap_set_sink(&tap, gps_tap_capture_init(&cap, cap_mem, sizeof(cap_mem)));
+    dma_put(data, 30);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(30, cap.len);
+    TEST_ASSERT_EQUAL_MEMORY(data, cap_mem, 30);
+}
+
+void test_wrapped_data_is_passed_as_two_spans(void) {
+    static const gps_tap_sink_t sink = {counting_write, NULL};
+    char data[40] = {0};
+
+    dma_put(data, 40);
+    ringbuffer_advance(&rb, 40);
+
+    gps_tap_set_sink(&tap, &sink);
+    write_calls = 0;
+    dma_put(data, 40);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(2, write_calls);
+    TEST_ASSERT_EQUAL(40, tap.tapped_bytes);
+}
+
+void test_full_capture_counts_dropped_bytes(void) {
+    gps_tap_set_sink(&tap, gps_tap_capture_init(&cap, cap_mem, 10));
+
+    dma_put("0123456789abcdef", 16);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(10, cap.len);
+    TEST_ASSERT_EQUAL_MEMORY("0123456789", cap_mem, 10);
+    TEST_ASSERT_EQUAL(10, tap.tapped_bytes);
+    TEST_ASSERT_EQUAL(6, tap.dropped_bytes);
+
+    gps_tap_capture_clear(&cap);
+    dma_put("XY", 2);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(2, cap.len);
+    TEST_ASSERT_EQUAL_MEMORY("XY", cap_mem, 2);
+}
+
+void test_reenable_resyncs_to_buffered_data(void) {
+    gps_tap_set_sink(&tap, gps_tap_capture_init(&cap, cap_mem, sizeof(cap_mem)));
+    dma_put("abcd", 4);
+    gps_tap_feed(&tap, &rb);
+    ringbuffer_advance(&rb, 4);
+
+    /* 끈 동안 들어와 소비된 데이터는 미러링 대상 아님 */
+    gps_tap_set_sink(&tap, NULL);
+    dma_put("efgh", 4);
+    gps_tap_feed(&tap, &rb);
+    ringbuffer_advance(&rb, 4);
+    dma_put("ij", 2);
+    gps_tap_feed(&tap, &rb);
+
+    gps_tap_set_sink(&tap, &cap.sink);
+    dma_put("kl", 2);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(8, cap.len);
+    TEST_ASSERT_EQUAL_MEMORY("abcdijkl", cap_mem, 8);
+}
+
+void test_ring_reset_resyncs(void) {
+    gps_tap_set_sink(&tap, gps_tap_capture_init(&cap, cap_mem, sizeof(cap_mem)));
+
+    char data[48];
+    memset(data, '.', sizeof(data));
+    dma_put(data, sizeof(data));
+    gps_tap_feed(&tap, &rb);
+    ringbuffer_advance(&rb, sizeof(data));
+
+    /* 포트 정지/재시작 (gps_port_stop → ringbuffer_reset) */
+    ringbuffer_reset(&rb);
+    dma_pos = 0;
+    dma_put("new", 3);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(sizeof(data) + 3, cap.len);
+    TEST_ASSERT_EQUAL_MEMORY("new", &cap_mem[sizeof(data)], 3);
+}
+
+/*===========================================================================
+ * Stream sink
+ *===========================================================================*/
+
+static gps_tap_stream_t st;
+static uint8_t st_mem[32];
+static char wire[256];
+static size_t wire_len;
+static int start_calls;
+static bool start_ok;
+static size_t last_start_len;
+
+/* 전송 시작만 기록 (완료는 테스트가 gps_tap_stream_tx_done으로 통지) */
+static bool fake_start(void *ctx, const uint8_t *data, size_t len) {
+    (void)ctx;
+    start_calls++;
+    last_start_len = len;
+    if (!start_ok) {
+        return false;
+    }
+    memcpy(&wire[wire_len], data, len);
+    wire_len += len;
+    return true;
+}
+
+static void stream_setup(void) {
+    start_calls = 0;
+    start_ok = true;
+    wire_len = 0;
+    gps_tap_set_sink(&tap, gps_tap_stream_init(&st, st_mem, sizeof(st_mem), fake_start, NULL));
+}
+
+void test_stream_starts_transfer_on_first_write(void) {
+    stream_setup();
+
+    dma_put("$GPGGA", 6);
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(1, start_calls);
+    TEST_ASSERT_EQUAL(6, last_start_len);
+    TEST_ASSERT_EQUAL_MEMORY("$GPGGA", wire, 6);
+}
+
+void test_stream_queues_while_busy_and_chains_on_done(void) {
+    stream_setup();
+
+    dma_put("abc", 3);
+    gps_tap_feed(&tap, &rb);
+    dma_put("def", 3);
+    gps_tap_feed(&tap, &rb);
+    TEST_ASSERT_EQUAL(1, start_calls);
+
+    /* 완료 ISR: 대기 중인 블록을 바로 이어서 전송 */
+    gps_tap_stream_tx_done(&st);
+    TEST_ASSERT_EQUAL(2, start_calls);
+    TEST_ASSERT_EQUAL(3, last_start_len);
+
+    gps_tap_stream_tx_done(&st);
+    TEST_ASSERT_EQUAL(2, start_calls);
+    TEST_ASSERT_EQUAL(6, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY("abcdef", wire, 6);
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&st.bb));
+}
+
+void test_stream_full_drops_without_blocking(void) {
+    stream_setup();
+    char data[24];
+    memset(data, 'x', sizeof(data));
+
+    dma_put(data, sizeof(data));
+    gps_tap_feed(&tap, &rb);
+    ringbuffer_advance(&rb, sizeof(data));
+
+    /* 전송 중 (tx_done 없음) 대기 버퍼 공간 부족 */
+    dma_put(data, sizeof(data));
+    gps_tap_feed(&tap, &rb);
+
+    TEST_ASSERT_EQUAL(24, tap.tapped_bytes);
+    TEST_ASSERT_EQUAL(24, tap.dropped_bytes);
+    TEST_ASSERT_EQUAL(1, start_calls);
+}
+
+void test_stream_start_failure_releases_block(void) {
+    stream_setup();
+    start_ok = false;
+
+    dma_put("abc", 3);
+    gps_tap_feed(&tap, &rb);
+    TEST_ASSERT_EQUAL(1, start_calls);
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&st.bb));
+
+    /* 다음 write에서 다시 시작 */
+    start_ok = true;
+    dma_put("de", 2);
+    gps_tap_feed(&tap, &rb);
+    TEST_ASSERT_EQUAL(2, start_calls);
+    TEST_ASSERT_EQUAL_MEMORY("de", wire, 2);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_disabled_tap_does_not_touch_sink);
+    RUN_TEST(test_only_new_bytes_are_mirrored_per_wakeup);
+    RUN_TEST(test_wrapped_data_is_mirrored_in_order);
+    RUN_TEST(test_wrapped_data_is_passed_as_two_spans);
+    RUN_TEST(test_full_capture_counts_dropped_bytes);
+    RUN_TEST(test_reenable_resyncs_to_buffered_data);
+    RUN_TEST(test_ring_reset_resyncs);
+
+    RUN_TEST(test_stream_starts_transfer_on_first_write);
+    RUN_TEST(test_stream_queues_while_busy_and_chains_on_done);
+    RUN_TEST(test_stream_full_drops_without_blocking);
+    RUN_TEST(test_stream_start_failure_releases_block);
+
+    return UNITY_END();
+}
@@ -0,0 +1,327 @@
+/**
+ * @file test_gps_unicore.c
+ * @brief Module tests for lib/gps/gps_unicore.c (binary path)
+ *
+ * Target: unicore_bin_try_parse (MOCKABLE module)
+ * Dependencies: gps_unicore_bin.c, crc.c, gps_parser.c (utilities), ringbuffer.c,
+ *               mock FreeRTOS/HAL
+ *
+ * Tests: BESTNAVB/HEADING2B frames into unicore_bin_data and common data,
+ *        frames across the ring wrap, partial delivery, byte-at-a-time
+ *        delivery (each byte scanned once), CRC rejection, parser flush
+ *        after the DMA laps a half-scanned frame,
+ *        command response lookup (UNICORE_RESP_TABLE key switch),
+ *        command responses routed to a pipelined batch by their echo
+ */
+
+#include "unity.h"
+#include "gps.h"
+#include "gps_parser.h"
+#include "unicore/unicore_fixture.h"
+#include <stdio.h>
+#include <string.h>
+
+/*===========================================================================
+ * Parsers gps_parser.c dispatches to that are not under test
+ *===========================================================================*/
+
+parse_result_t nmea_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    (void)rb;
+    return PARSE_NOT_MINE;
+}
+
+parse_result_t rtcm_try_parse(gps_t *g, ringbuffer_t *rb) {
+    (void)g;
+    (void)rb;
+    return PARSE_NOT_MINE;
+}
+
+/*===========================================================================
+ * Test fixtures
+ *===========================================================================*/
+
+static gps_t gps;
+static char rx_mem[GPS_RX_BUF_SIZE];
+
+static gps_event_t last_event;
+static int event_count;
+
+static void test_event_handler(gps_t *g, const gps_event_t *event) {
+    (void)g;
+    memcpy(&last_event, event, sizeof(gps_event_t));
+    event_count++;
+}
+
+void setUp(void) {
+    memset(&gps, 0, sizeof(gps_t));
+    memset(&last_event, 0, sizeof(gps_event_t));
+    event_count = 0;
+
+    ringbuffer_init(&gps.rx_buf, rx_mem, sizeof(rx_mem));
+    gps.handler = test_event_handler;
+}
+
+void tearDown(void) {
+}
+
+static parse_result_t feed_and_parse(const void *data, size_t len) {
+    ringbuffer_write(&gps.rx_buf, data, len);
+    return unicore_bin_try_parse(&gps, &gps.rx_buf);
+}
+
+static void move_ring_to(size_t lead) {
+    static const char fill[GPS_RX_BUF_SIZE];
+
+    ringbuffer_write(&gps.rx_buf, fill, lead);
+    ringbuffer_advance(&gps.rx_buf, lead);
+}
+
+static void assert_bestnav_applied(void) {
+    TEST_ASSERT_EQUAL_UINT16(2118, gps.unicore_bin_data.last_msg_id);
+    TEST_ASSERT_EQUAL_UINT32(2345, gps.unicore_bin_data.gps_week);
+    TEST_ASSERT_EQUAL_UINT32(377100000, gps.unicore_bin_data.gps_ms);
+
+    TEST_ASSERT_TRUE(gps.unicore_bin_data.position.valid);
+    TEST_ASSERT_EQUAL_UINT8(50, gps.unicore_bin_data.position.pos_type);
+    TEST_ASSERT_EQUAL_DOUBLE(37.395217812, gps.data.position.latitude);
+    TEST_ASSERT_EQUAL_DOUBLE(126.946206745, gps.data.position.longitude);
+    TEST_ASSERT_EQUAL_DOUBLE(52.3104, gps.data.position.altitude);
+    TEST_ASSERT_EQUAL_FLOAT(0.0162f, gps.data.position.alt_std);
+    TEST_ASSERT_EQUAL_DOUBLE(271.4, gps.data.velocity.track);
+    TEST_ASSERT_EQUAL_UINT8(32, gps.data.status.sat_count);
+    TEST_ASSERT_EQUAL_UINT8(30, gps.data.status.used_sat_count);
+}
+
+/*===========================================================================
+ * Binary frames
+ *===========================================================================*/
+
+void test_bestnav_frame(void) {
+    TEST_ASSERT_EQUAL(PARSE_OK,
+                      feed_and_parse(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX)));
+
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.stats.unicore_bin_packets);
+    assert_bestnav_applied();
+
+    /* Position + velocity events */
+    TEST_ASSERT_EQUAL(2, event_count);
+    TEST_ASSERT_EQUAL(GPS_EVENT_VELOCITY_UPDATED, last_event.type);
+}
+
+void test_heading2_frame(void) {
+    TEST_ASSERT_EQUAL(PARSE_OK,
+                      feed_and_parse(UNICORE_HEADING2_FIXED, sizeof(UNICORE_HEADING2_FIXED)));
+
+    TEST_ASSERT_TRUE(gps.unicore_bin_data.heading.valid);
+    TEST_ASSERT_EQUAL_DOUBLE((double)271.38211f, gps.unicore_bin_data.heading.heading);
+    TEST_ASSERT_EQUAL_DOUBLE((double)-0.4127f, gps.unicore_bin_data.heading.pitch);
+    TEST_ASSERT_EQUAL_FLOAT(0.1532f, gps.unicore_bin_data.heading.heading_std);
+    TEST_ASSERT_EQUAL_UINT16(2120, gps.unicore_bin_data.heading.source_msg);
+}
+
+void test_bestnav_across_ring_wrap(void) {
+    for (size_t lead = GPS_RX_BUF_SIZE - sizeof(UNICORE_BESTNAV_RTK_FIX) + 1;
+         lead < GPS_RX_BUF_SIZE; lead++) {
+        setUp();
+        move_ring_to(lead);
+
+        TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(UNICORE_BESTNAV_RTK_FIX,
+                                                   sizeof(UNICORE_BESTNAV_RTK_FIX)));
+        assert_bestnav_applied();
+    }
+}
+
+void test_partial_frame_needs_more(void) {
+    size_t half = sizeof(UNICORE_BESTNAV_RTK_FIX) / 2;
+
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed_and_parse(UNICORE_BESTNAV_RTK_FIX, 10));
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, feed_and_parse(UNICORE_BESTNAV_RTK_FIX + 10, half - 10));
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_and_parse(UNICORE_BESTNAV_RTK_FIX + half,
+                                               sizeof(UNICORE_BESTNAV_RTK_FIX) - half));
+    assert_bestnav_applied();
+}
+
+void test_byte_at_a_time_scans_each_byte_once(void) {
+    size_t len = sizeof(UNICORE_BESTNAV_RTK_FIX);
+    parse_result_t res = PARSE_NEED_MORE;
+    size_t fed = 0;
+
+    move_ring_to(GPS_RX_BUF_SIZE - 60);
+
+    while (res == PARSE_NEED_MORE && fed < len) {
+        res = feed_and_parse(UNICORE_BESTNAV_RTK_FIX + fed, 1);
+        fed++;
+    }
+
+    TEST_ASSERT_EQUAL(PARSE_OK, res);
+    TEST_ASSERT_EQUAL(len, fed);
+
+    /* Header + payload went through CRC32 once, the CRC field is only compared */
+    TEST_ASSERT_EQUAL(len - 4, gps.parser_ctx.stats.scanned_bytes);
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.unicore_bin.total_len);
+    assert_bestnav_applied();
+}
+
+void test_crc_error_drops_frame(void) {
+    uint8_t buf[sizeof(UNICORE_BESTNAV_RTK_FIX)];
+
+    memcpy(buf, UNICORE_BESTNAV_RTK_FIX, sizeof(buf));
+    buf[40] ^= 0x01;
+
+    TEST_ASSERT_EQUAL(PARSE_INVALID, feed_and_parse(buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.stats.crc_errors);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+    TEST_ASSERT_FALSE(gps.unicore_bin_data.position.valid);
+    TEST_ASSERT_EQUAL(0, event_count);
+}
+
+/* Circular DMA writing into rx_mem, then the ISR publishing its position */
+static size_t dma_pos;
+
+static void dma_receive(const void *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        rx_mem[dma_pos] = ((const char *)data)[i];
+        dma_pos = (dma_pos + 1) % GPS_RX_BUF_SIZE;
+    }
+    ringbuffer_dma_update(&gps.rx_buf, dma_pos);
+}
+
+void test_dma_lap_mid_frame_flushes_scan(void) {
+    static const char filler[GPS_RX_BUF_SIZE / 2];
+    size_t half = sizeof(UNICORE_BESTNAV_RTK_FIX) / 2;
+
+    ringbuffer_set_mode(&gps.rx_buf, RINGBUFFER_MODE_DMA);
+    dma_pos = 0;
+
+    dma_receive(UNICORE_BESTNAV_RTK_FIX, half);
+    TEST_ASSERT_EQUAL(PARSE_NEED_MORE, gps_parser_process(&gps));
+    TEST_ASSERT_EQUAL(half, gps.parser_ctx.unicore_bin.scan_pos);
+
+    /* Parser falls a lap behind: the half-scanned frame is overwritten */
+    dma_receive(UNICORE_BESTNAV_RTK_FIX + half, sizeof(UNICORE_BESTNAV_RTK_FIX) - half);
+    dma_receive(filler, sizeof(filler));
+    dma_receive(filler, sizeof(filler) - sizeof(UNICORE_HEADING2_FIXED));
+    dma_receive(UNICORE_HEADING2_FIXED, sizeof(UNICORE_HEADING2_FIXED));
+    TEST_ASSERT_TRUE(ringbuffer_get_overflow_count(&gps.rx_buf) > 0);
+
+    /* gps_process_task on UART_DMA_NOTIFY_OVERFLOW */
+    gps_parser_flush(&gps);
+    gps_parser_process(&gps);
+
+    TEST_ASSERT_EQUAL(0, gps.parser_ctx.stats.crc_errors);
+    TEST_ASSERT_EQUAL(1, gps.parser_ctx.stats.unicore_bin_packets);
+    TEST_ASSERT_TRUE(gps.unicore_bin_data.heading.valid);
+    TEST_ASSERT_FALSE(gps.unicore_bin_data.position.valid);
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(&gps.rx_buf));
+}
+
+void test_not_mine(void) {
+    static const uint8_t not_unicore[] = {0xAA, 0x55, 0x00};
+
+    TEST_ASSERT_EQUAL(PARSE_NOT_MINE, feed_and_parse(not_unicore, sizeof(not_unicore)));
+}
+
+/*===========================================================================
+ * Command response lookup
+ *===========================================================================*/
+
+void test_resp_lookup_every_table_entry(void) {
+#define X(name, str, key) \
+    TEST_ASSERT_EQUAL_MESSAGE(GPS_UNICORE_RESP_##name, gps_unicore_resp_lookup(str), #name);
+    UNICORE_RESP_TABLE(X)
+#undef X
+}
+
+void test_resp_lookup_with_trailing_text(void) {
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_OK, gps_unicore_resp_lookup("OK*7D"));
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_ERROR, gps_unicore_resp_lookup("ERROR,PARAM*12"));
+}
+
+void test_resp_lookup_rejects_unknown(void) {
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_UNKNOWN, gps_unicore_resp_lookup("ok"));
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_UNKNOWN, gps_unicore_resp_lookup("O"));
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_UNKNOWN, gps_unicore_resp_lookup("OKAY"));
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_UNKNOWN, gps_unicore_resp_lookup("ERR"));
+    TEST_ASSERT_EQUAL(GPS_UNICORE_RESP_UNKNOWN, gps_unicore_resp_lookup("WARNING"));
+}
+
+/*===========================================================================
+ * Command responses
+ *===========================================================================*/
+
+/* "$command,<cmd>,response: <resp>*XX\r\n" (XOR over '$'..':' exclusive of '$') */
+static parse_result_t feed_cmd_response(const char *cmd, const char *resp) {
+    char line[128];
+    int n = snprintf(line, sizeof(line), "$command,%s,response:", cmd);
+    uint8_t crc = 0;
+
+    for (int i = 1; i < n; i++) {
+        crc ^= (uint8_t)line[i];
+    }
+    n += snprintf(line + n, sizeof(line) - n, " %s*%02X\r\n", resp, crc);
+
+    ringbuffer_write(&gps.rx_buf, line, (size_t)n);
+    return unicore_ascii_try_parse(&gps, &gps.rx_buf);
+}
+
+void test_cmd_response_routed_to_batch_by_echo(void) {
+    static const char *const cmds[] = {"unmask GPS\r\n", "gpgga com1 1\r\n", "BESTNAVB 1\r\n"};
+    const gps_cmd_batch_cfg_t cfg = {.window = 3, .max_attempts = 1, .timeout_ms = 1000};
+    gps_cmd_batch_t batch;
+
+    gps_cmd_batch_init(&batch, cmds, 3, &cfg, 0);
+    while (gps_cmd_batch_next(&batch, 0)) {
+    }
+    gps.parser_ctx.cmd_ctx.batch = &batch;
+
+    /* out of order, receiver echoes in its own case */
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_cmd_response("BESTNAVB 1", "OK"));
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_cmd_response("UNMASK GPS", "OK"));
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_cmd_response("gpgga com1 1", "ERROR,PARAM"));
+
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_OK, batch.entries[0].state);
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_FAILED, batch.entries[1].state);
+    TEST_ASSERT_TRUE(batch.entries[1].error);
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_OK, batch.entries[2].state);
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_EQUAL(3, event_count);
+}
+
+void test_cmd_response_without_batch_keeps_single_wait(void) {
+    gps.parser_ctx.cmd_ctx.waiting = true;
+
+    TEST_ASSERT_EQUAL(PARSE_OK, feed_cmd_response("VERSIONA", "OK"));
+    TEST_ASSERT_TRUE(gps.parser_ctx.cmd_ctx.result_ok);
+    TEST_ASSERT_TRUE(last_event.data.cmd_response.success);
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Binary frames */
+    RUN_TEST(test_bestnav_frame);
+    RUN_TEST(test_heading2_frame);
+    RUN_TEST(test_bestnav_across_ring_wrap);
+    RUN_TEST(test_partial_frame_needs_more);
+    RUN_TEST(test_byte_at_a_time_scans_each_byte_once);
+    RUN_TEST(test_crc_error_drops_frame);
+    RUN_TEST(test_dma_lap_mid_frame_flushes_scan);
+    RUN_TEST(test_not_mine);
+
+    /* Command response lookup */
+    RUN_TEST(test_resp_lookup_every_table_entry);
+    RUN_TEST(test_resp_lookup_with_trailing_text);
+    RUN_TEST(test_resp_lookup_rejects_unknown);
+
+    /* Command responses */
+    RUN_TEST(test_cmd_response_routed_to_batch_by_echo);
+    RUN_TEST(test_cmd_response_without_batch_keeps_single_wait);
+
+    return UNITY_END();
+}
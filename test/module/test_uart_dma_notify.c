@@ -0,0 +1,285 @@
+/**
+ * @file test_uart_dma_notify.c
+ * @brief Unit tests for lib/utils/src/uart_dma_notify.c
+ *
+ * Target: lib/utils/src/uart_dma_notify.c (MOCKABLE: FreeRTOS task notifications),
+ *         driven by uart_dma_port on the fake USART + DMA
+ *         (test/mock/fake_uart_dma.c) and the task notification mock in
+ *         test/mock/mock_common.c
+ *
+ * The task side mirrors the RX loops in app/: wait once, then drain the
+ * whole ring with peek_spans + consume.
+ *
+ * Tests: interrupt bursts coalesce into one wake, cause bits (RX,
+ *        overflow, error), bits cleared on wake, notifications before the
+ *        task waits, handle not created yet, stop request, yield from ISR,
+ *        single-pass drain across the ring wrap
+ */
+
+#include "unity.h"
+#include "fake_uart_dma.h"
+#include "uart_dma_notify.h"
+#include <string.h>
+
+#define RX_SIZE 512
+#define TX_SIZE 512
+
+static char rx_mem[RX_SIZE];
+static uint8_t tx_mem[TX_SIZE];
+static uart_dma_desc_t desc;
+static uart_dma_port_t port;
+static fake_uart_t fake;
+
+static mock_task_t rx_task_mock;
+static TaskHandle_t rx_task; /* 포트 콜백은 이 변수의 주소를 가짐 */
+
+/* 앱 RX 루프와 같은 처리: 쌓인 데이터를 한 번에 꺼냄 */
+static char drained[RX_SIZE * 4];
+static size_t drained_len;
+
+static size_t task_drain(void) {
+    ringbuffer_t *rb = uart_dma_port_rx(&port);
+    ringbuffer_span_t spans[2];
+    size_t len = ringbuffer_size(rb);
+    size_t cnt = ringbuffer_peek_spans(rb, 0, len, spans);
+
+    for (size_t i = 0; i < cnt; i++) {
+        TEST_ASSERT_TRUE(drained_len + spans[i].len <= sizeof(drained));
+        memcpy(&drained[drained_len], spans[i].data, spans[i].len);
+        drained_len += spans[i].len;
+    }
+    ringbuffer_consume(rb, len);
+    return len;
+}
+
+static void receive_frame(const char *frame) {
+    fake_uart_receive(&fake, frame, strlen(frame));
+    fake_uart_idle(&fake);
+}
+
+void setUp(void) {
+    memset(rx_mem, 0, sizeof(rx_mem));
+    memset(&rx_task_mock, 0, sizeof(rx_task_mock));
+    memset(&fake, 0, sizeof(fake));
+    drained_len = 0;
+    mock_yield_count = 0;
+
+    desc = (uart_dma_desc_t){
+        .name = "notify",
+        .uart = &fake,
+        .baudrate = 115200,
+        .rx_buf = rx_mem,
+        .rx_size = RX_SIZE,
+        .tx_buf = tx_mem,
+        .tx_size = TX_SIZE,
+        .hw = &fake_uart_hw,
+        .os = &fake_uart_os,
+    };
+
+    uart_dma_port_init(&port, &desc);
+    fake_uart_attach(&fake, &port);
+
+    rx_task = &rx_task_mock;
+    mock_current_task = rx_task;
+    uart_dma_port_set_event_cb(&port, uart_dma_notify_cb, &rx_task);
+    uart_dma_port_start(&port);
+}
+
+void tearDown(void) {
+    mock_current_task = NULL;
+}
+
+/*===========================================================================
+ * 합치기
+ *===========================================================================*/
+
+void test_interrupt_burst_wakes_task_once(void) {
+    /* 태스크가 깨어나기 전에 IDLE 다섯 번 */
+    for (int i = 0; i < 5; i++) {
+        receive_frame("$GNGGA,1*00\r\n");
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(5, rx_task_mock.notify_count);
+
+    uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, bits);
+    TEST_ASSERT_EQUAL_UINT32(1, rx_task_mock.wake_count);
+
+    /* 한 번의 처리로 다섯 프레임 전부 */
+    TEST_ASSERT_EQUAL(5 * 13, task_drain());
+    TEST_ASSERT_EQUAL(0, ringbuffer_size(uart_dma_port_rx(&port)));
+
+    /* 남은 알림 없음 */
+    TEST_ASSERT_EQUAL_UINT32(0, uart_dma_notify_wait(0));
+    TEST_ASSERT_EQUAL_UINT32(1, rx_task_mock.wake_count);
+}
+
+void test_half_and_full_transfer_share_the_pending_notification(void) {
+    char data[RX_SIZE];
+    memset(data, 'x', sizeof(data));
+
+    /* HT, TC가 IDLE 없이 연달아 */
+    fake_uart_receive(&fake, data, RX_SIZE / 2);
+    fake_uart_receive(&fake, data, RX_SIZE / 2 - 1);
+
+    TEST_ASSERT_TRUE(rx_task_mock.notify_count >= 1);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(RX_SIZE / 2, task_drain());
+}
+
+void test_wake_clears_bits(void) {
+    receive_frame("abc");
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+
+    TEST_ASSERT_EQUAL_UINT32(0, rx_task_mock.value);
+    TEST_ASSERT_FALSE(rx_task_mock.pending);
+}
+
+/*===========================================================================
+ * 원인 비트
+ *===========================================================================*/
+
+void test_overflow_bit_when_consumer_lags(void) {
+    char data[RX_SIZE];
+    memset(data, 'o', sizeof(data));
+
+    /* 소비 없이 한 바퀴 반 */
+    fake_uart_receive(&fake, data, RX_SIZE);
+    fake_uart_receive(&fake, data, RX_SIZE / 2);
+
+    uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX | UART_DMA_NOTIFY_OVERFLOW, bits);
+}
+
+void test_usart_overrun_and_line_error_bits_are_distinct(void) {
+    fake_uart_receive(&fake, "abc", 3);
+    fake_uart_error(&fake, UART_DMA_ERR_OVERRUN);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX | UART_DMA_NOTIFY_OVERFLOW,
+                             uart_dma_notify_wait(portMAX_DELAY));
+    task_drain();
+
+    fake_uart_error(&fake, UART_DMA_ERR_FRAMING);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_ERROR, uart_dma_notify_wait(portMAX_DELAY));
+
+    /* 두 원인이 쌓이면 한 번에 둘 다 */
+    fake_uart_error(&fake, UART_DMA_ERR_NOISE);
+    receive_frame("def");
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX | UART_DMA_NOTIFY_ERROR,
+                             uart_dma_notify_wait(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(3, task_drain());
+    TEST_ASSERT_EQUAL_MEMORY("abcdef", drained, 6);
+}
+
+void test_rx_dma_error_bit(void) {
+    fake_uart_receive(&fake, "ab", 2);
+    fake_uart_error(&fake, UART_DMA_ERR_RX_DMA);
+
+    uint32_t bits = uart_dma_notify_wait(portMAX_DELAY);
+    TEST_ASSERT_TRUE(bits & UART_DMA_NOTIFY_ERROR);
+    TEST_ASSERT_FALSE(bits & UART_DMA_NOTIFY_STOP);
+}
+
+/*===========================================================================
+ * 태스크 수명
+ *===========================================================================*/
+
+void test_task_not_created_yet_skips_notification(void) {
+    rx_task = NULL;
+    receive_frame("early");
+    TEST_ASSERT_EQUAL_UINT32(0, rx_task_mock.notify_count);
+    TEST_ASSERT_EQUAL_UINT32(0, mock_yield_count);
+
+    /* 핸들이 생기면 그 전 수신까지 한 번에 처리 */
+    rx_task = &rx_task_mock;
+    receive_frame("late");
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(9, task_drain());
+    TEST_ASSERT_EQUAL_MEMORY("earlylate", drained, 9);
+}
+
+void test_notification_before_wait_is_kept(void) {
+    /* 태스크가 처리 중일 때 도착한 알림은 다음 대기에서 바로 반환 */
+    receive_frame("one");
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+    receive_frame("two");
+    task_drain();
+
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(0, task_drain());
+    TEST_ASSERT_EQUAL_MEMORY("onetwo", drained, 6);
+}
+
+void test_stop_request_is_separate_from_rx(void) {
+    uart_dma_notify_stop(rx_task);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_STOP, uart_dma_notify_wait(portMAX_DELAY));
+
+    receive_frame("bye");
+    uart_dma_notify_stop(rx_task);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX | UART_DMA_NOTIFY_STOP,
+                             uart_dma_notify_wait(portMAX_DELAY));
+
+    /* NULL 핸들은 무시 */
+    uart_dma_notify_stop(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, uart_dma_notify_wait(0));
+}
+
+void test_isr_requests_yield_and_ignores_empty_events(void) {
+    receive_frame("x");
+    TEST_ASSERT_EQUAL_UINT32(1, mock_yield_count);
+
+    uart_dma_notify_from_isr(rx_task, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, rx_task_mock.notify_count);
+    TEST_ASSERT_EQUAL_UINT32(1, mock_yield_count);
+}
+
+/*===========================================================================
+ * 한 번에 처리
+ *===========================================================================*/
+
+void test_single_pass_drains_across_wrap(void) {
+    char data[RX_SIZE];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)('a' + i % 26);
+    }
+
+    /* 링 끝 가까이까지 채우고 처리 */
+    fake_uart_receive(&fake, data, RX_SIZE - 100);
+    fake_uart_idle(&fake);
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(RX_SIZE - 100, task_drain());
+    drained_len = 0;
+
+    /* 경계를 넘는 세 프레임 (IDLE 세 번), 깨어남은 한 번 */
+    fake_uart_receive(&fake, data, 80);
+    fake_uart_idle(&fake);
+    fake_uart_receive(&fake, &data[80], 80);
+    fake_uart_idle(&fake);
+    fake_uart_receive(&fake, &data[160], 80);
+    fake_uart_idle(&fake);
+
+    TEST_ASSERT_EQUAL_UINT32(UART_DMA_NOTIFY_RX, uart_dma_notify_wait(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(240, task_drain());
+    TEST_ASSERT_EQUAL_MEMORY(data, drained, 240);
+    TEST_ASSERT_EQUAL_UINT32(2, rx_task_mock.wake_count);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_interrupt_burst_wakes_task_once);
+    RUN_TEST(test_half_and_full_transfer_share_the_pending_notification);
+    RUN_TEST(test_wake_clears_bits);
+
+    RUN_TEST(test_overflow_bit_when_consumer_lags);
+    RUN_TEST(test_usart_overrun_and_line_error_bits_are_distinct);
+    RUN_TEST(test_rx_dma_error_bit);
+
+    RUN_TEST(test_task_not_created_yet_skips_notification);
+    RUN_TEST(test_notification_before_wait_is_kept);
+    RUN_TEST(test_stop_request_is_separate_from_rx);
+    RUN_TEST(test_isr_requests_yield_and_ignores_empty_events);
+
+    RUN_TEST(test_single_pass_drains_across_wrap);
+
+    return UNITY_END();
+}
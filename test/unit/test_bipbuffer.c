@@ -0,0 +1,276 @@
+/**
+ * @file test_bipbuffer.c
+ * @brief Unit tests for lib/utils/src/bipbuffer.c
+ *
+ * Target: lib/utils/src/bipbuffer.c (PURE module)
+ * Tests: reserve/commit/read, partial commit, wrap (watermark),
+ *        reserve failure, producer/consumer threads
+ */
+
+#include "unity.h"
+#include "bipbuffer.h"
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define TEST_BUF_SIZE 64
+
+static bipbuffer_t bb;
+static uint8_t buf[TEST_BUF_SIZE];
+
+void setUp(void) {
+    memset(buf, 0, sizeof(buf));
+    bipbuffer_init(&bb, buf, sizeof(buf));
+}
+
+void tearDown(void) {
+}
+
+/* Reserve, fill with a byte pattern and commit */
+static void put(size_t len, uint8_t fill) {
+    uint8_t *p = bipbuffer_reserve(&bb, len);
+    TEST_ASSERT_NOT_NULL(p);
+    memset(p, fill, len);
+    bipbuffer_commit(&bb, len);
+}
+
+/*===========================================================================
+ * Basic
+ *===========================================================================*/
+
+void test_init_empty(void) {
+    size_t len = 99;
+
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&bb));
+    TEST_ASSERT_NULL(bipbuffer_read_acquire(&bb, &len));
+    TEST_ASSERT_EQUAL(0, len);
+}
+
+void test_reserve_commit_read(void) {
+    uint8_t *p = bipbuffer_reserve(&bb, 10);
+    TEST_ASSERT_EQUAL_PTR(buf, p);
+    memcpy(p, "AT+CMD\r\n", 8);
+
+    /* Not visible before commit */
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&bb));
+    bipbuffer_commit(&bb, 8);
+
+    size_t len;
+    const uint8_t *r = bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL_PTR(buf, r);
+    TEST_ASSERT_EQUAL(8, len);
+    TEST_ASSERT_EQUAL_MEMORY("AT+CMD\r\n", r, 8);
+
+    bipbuffer_read_release(&bb, len);
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&bb));
+}
+
+void test_partial_commit_returns_rest(void) {
+    bipbuffer_reserve(&bb, 32);
+    bipbuffer_commit(&bb, 5);
+
+    /* Next reservation starts right after the committed bytes */
+    uint8_t *p = bipbuffer_reserve(&bb, 4);
+    TEST_ASSERT_EQUAL_PTR(buf + 5, p);
+    bipbuffer_commit(&bb, 0);
+
+    size_t len;
+    bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL(5, len);
+}
+
+void test_consumer_releases_in_pieces(void) {
+    put(20, 0xAA);
+
+    size_t len;
+    bipbuffer_read_acquire(&bb, &len);
+    bipbuffer_read_release(&bb, 8);
+
+    const uint8_t *r = bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL_PTR(buf + 8, r);
+    TEST_ASSERT_EQUAL(12, len);
+}
+
+/*===========================================================================
+ * Wrap
+ *===========================================================================*/
+
+void test_wrap_reservation_is_contiguous(void) {
+    size_t len;
+
+    put(50, 'a');
+    bipbuffer_read_acquire(&bb, &len);
+    bipbuffer_read_release(&bb, 40);
+
+    /* 14 bytes left at the end: a 20-byte reservation goes to buf[0] instead */
+    uint8_t *p = bipbuffer_reserve(&bb, 20);
+    TEST_ASSERT_EQUAL_PTR(buf, p);
+    memset(p, 'b', 20);
+    bipbuffer_commit(&bb, 20);
+
+    /* Consumer drains the upper region up to the watermark, then the lower one */
+    const uint8_t *r = bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL_PTR(buf + 40, r);
+    TEST_ASSERT_EQUAL(10, len);
+    bipbuffer_read_release(&bb, len);
+
+    r = bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL_PTR(buf, r);
+    TEST_ASSERT_EQUAL(20, len);
+    TEST_ASSERT_EACH_EQUAL_UINT8('b', r, 20);
+    bipbuffer_read_release(&bb, len);
+
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&bb));
+}
+
+void test_exact_fit_at_end(void) {
+    size_t len;
+
+    put(40, 'a');
+    bipbuffer_read_acquire(&bb, &len);
+    bipbuffer_read_release(&bb, 40);
+
+    /* Exactly the 24 remaining bytes: no wrap */
+    TEST_ASSERT_EQUAL_PTR(buf + 40, bipbuffer_reserve(&bb, 24));
+    bipbuffer_commit(&bb, 24);
+
+    const uint8_t *r = bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL_PTR(buf + 40, r);
+    TEST_ASSERT_EQUAL(24, len);
+}
+
+/*===========================================================================
+ * Reserve failure
+ *===========================================================================*/
+
+void test_reserve_larger_than_buffer_fails(void) {
+    TEST_ASSERT_NULL(bipbuffer_reserve(&bb, TEST_BUF_SIZE + 1));
+    TEST_ASSERT_NULL(bipbuffer_reserve(&bb, 0));
+}
+
+void test_reserve_fails_when_neither_region_fits(void) {
+    size_t len;
+
+    put(50, 'a');
+    bipbuffer_read_acquire(&bb, &len);
+    bipbuffer_read_release(&bb, 10);
+
+    /* 14 free at the end, 10 free at the start: 15 fits nowhere */
+    TEST_ASSERT_NULL(bipbuffer_reserve(&bb, 15));
+
+    /* 20 free at the start: a wrapped reservation must stay below read */
+    bipbuffer_read_release(&bb, 10);
+    TEST_ASSERT_NULL(bipbuffer_reserve(&bb, 20));
+    TEST_ASSERT_EQUAL_PTR(buf, bipbuffer_reserve(&bb, 19));
+    bipbuffer_commit(&bb, 19);
+
+    /* Inverted: write (19) may not reach read (20) */
+    TEST_ASSERT_NULL(bipbuffer_reserve(&bb, 1));
+}
+
+void test_full_buffer(void) {
+    put(TEST_BUF_SIZE, 'x');
+    TEST_ASSERT_NULL(bipbuffer_reserve(&bb, 1));
+
+    size_t len;
+    bipbuffer_read_acquire(&bb, &len);
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE, len);
+    bipbuffer_read_release(&bb, len);
+
+    /* Fully drained: next reservation wraps to the start */
+    TEST_ASSERT_EQUAL_PTR(buf, bipbuffer_reserve(&bb, 8));
+    bipbuffer_commit(&bb, 8);
+    TEST_ASSERT_EQUAL_PTR(buf, bipbuffer_read_acquire(&bb, &len));
+    TEST_ASSERT_EQUAL(8, len);
+}
+
+/*===========================================================================
+ * Concurrency
+ *===========================================================================*/
+
+#define STREAM_BYTES 200000
+
+static void *producer_thread(void *arg) {
+    (void)arg;
+    size_t sent = 0;
+    size_t chunk = 1;
+
+    while (sent < STREAM_BYTES) {
+        size_t n = (STREAM_BYTES - sent < chunk) ? STREAM_BYTES - sent : chunk;
+        uint8_t *p = bipbuffer_reserve(&bb, n);
+        if (p == NULL) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            p[i] = (uint8_t)((sent + i) & 0xFF);
+        }
+        bipbuffer_commit(&bb, n);
+        sent += n;
+        chunk = (chunk % 23) + 1;
+    }
+    return NULL;
+}
+
+static void *consumer_thread(void *arg) {
+    (void)arg;
+    size_t received = 0;
+
+    while (received < STREAM_BYTES) {
+        size_t len;
+        const uint8_t *r = bipbuffer_read_acquire(&bb, &len);
+        if (r == NULL) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < len; i++) {
+            if (r[i] != (uint8_t)((received + i) & 0xFF)) {
+                return (void *)1;
+            }
+        }
+        bipbuffer_read_release(&bb, len);
+        received += len;
+    }
+    return NULL;
+}
+
+void test_concurrent_commit_stream_in_order(void) {
+    pthread_t prod, cons;
+    void *result;
+
+    pthread_create(&cons, NULL, consumer_thread, NULL);
+    pthread_create(&prod, NULL, producer_thread, NULL);
+    pthread_join(prod, NULL);
+    pthread_join(cons, &result);
+
+    TEST_ASSERT_NULL(result);
+    TEST_ASSERT_TRUE(bipbuffer_is_empty(&bb));
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Basic */
+    RUN_TEST(test_init_empty);
+    RUN_TEST(test_reserve_commit_read);
+    RUN_TEST(test_partial_commit_returns_rest);
+    RUN_TEST(test_consumer_releases_in_pieces);
+
+    /* Wrap */
+    RUN_TEST(test_wrap_reservation_is_contiguous);
+    RUN_TEST(test_exact_fit_at_end);
+
+    /* Reserve failure */
+    RUN_TEST(test_reserve_larger_than_buffer_fails);
+    RUN_TEST(test_reserve_fails_when_neither_region_fits);
+    RUN_TEST(test_full_buffer);
+
+    /* Concurrency */
+    RUN_TEST(test_concurrent_commit_stream_in_order);
+
+    return UNITY_END();
+}
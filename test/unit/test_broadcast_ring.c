@@ -0,0 +1,341 @@
+/**
+ * @file test_broadcast_ring.c
+ * @brief Unit tests for lib/utils/src/broadcast_ring.c
+ *
+ * Target: lib/utils/src/broadcast_ring.c (PURE module)
+ * Tests: attach/detach, independent reader cursors, zero-copy spans,
+ *        OVERWRITE policy (per-reader drop accounting, lap detection),
+ *        SLOWEST policy (writer drop, writer/reader threads)
+ */
+
+#include "unity.h"
+#include "broadcast_ring.h"
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define TEST_BUF_SIZE 64
+
+static broadcast_ring_t ring;
+static char buf[TEST_BUF_SIZE];
+static broadcast_reader_t reader_a;
+static broadcast_reader_t reader_b;
+
+void setUp(void) {
+    memset(buf, 0, sizeof(buf));
+    memset(&reader_a, 0, sizeof(reader_a));
+    memset(&reader_b, 0, sizeof(reader_b));
+    broadcast_ring_init(&ring, buf, sizeof(buf));
+}
+
+void tearDown(void) {
+}
+
+/*===========================================================================
+ * Attach / Detach
+ *===========================================================================*/
+
+void test_attach_starts_at_current_head(void) {
+    broadcast_ring_write(&ring, "OLD", 3);
+
+    TEST_ASSERT_TRUE(broadcast_ring_attach(&ring, &reader_a));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_size(&reader_a));
+
+    broadcast_ring_write(&ring, "NEW", 3);
+
+    char out[3];
+    TEST_ASSERT_EQUAL(3, broadcast_reader_read(&reader_a, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_MEMORY("NEW", out, 3);
+}
+
+void test_attach_limit(void) {
+    broadcast_reader_t readers[BROADCAST_RING_MAX_READERS + 1];
+    memset(readers, 0, sizeof(readers));
+
+    for (size_t i = 0; i < BROADCAST_RING_MAX_READERS; i++) {
+        TEST_ASSERT_TRUE(broadcast_ring_attach(&ring, &readers[i]));
+    }
+    TEST_ASSERT_FALSE(broadcast_ring_attach(&ring, &readers[BROADCAST_RING_MAX_READERS]));
+
+    /* Detaching frees a slot */
+    broadcast_ring_detach(&readers[0]);
+    TEST_ASSERT_NULL(readers[0].ring);
+    TEST_ASSERT_TRUE(broadcast_ring_attach(&ring, &readers[BROADCAST_RING_MAX_READERS]));
+}
+
+/*===========================================================================
+ * Independent cursors
+ *===========================================================================*/
+
+void test_each_reader_sees_every_byte(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    broadcast_ring_write(&ring, "$GPGGA", 6);
+
+    char out_a[6], out_b[6];
+    TEST_ASSERT_EQUAL(6, broadcast_reader_read(&reader_a, out_a, sizeof(out_a)));
+    TEST_ASSERT_EQUAL_MEMORY("$GPGGA", out_a, 6);
+
+    /* reader_a consuming does not move reader_b */
+    TEST_ASSERT_EQUAL(6, broadcast_reader_size(&reader_b));
+    TEST_ASSERT_EQUAL(6, broadcast_reader_read(&reader_b, out_b, sizeof(out_b)));
+    TEST_ASSERT_EQUAL_MEMORY("$GPGGA", out_b, 6);
+
+    TEST_ASSERT_EQUAL(0, broadcast_reader_size(&reader_a));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_size(&reader_b));
+}
+
+void test_readers_progress_independently(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    broadcast_ring_write(&ring, "ABCDEF", 6);
+
+    char out[4];
+    TEST_ASSERT_EQUAL(2, broadcast_reader_read(&reader_a, out, 2));
+    TEST_ASSERT_EQUAL_MEMORY("AB", out, 2);
+    TEST_ASSERT_EQUAL(4, broadcast_reader_read(&reader_b, out, 4));
+    TEST_ASSERT_EQUAL_MEMORY("ABCD", out, 4);
+
+    TEST_ASSERT_EQUAL(4, broadcast_reader_size(&reader_a));
+    TEST_ASSERT_EQUAL(2, broadcast_reader_size(&reader_b));
+}
+
+void test_read_across_wrap(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+
+    char fill[60];
+    char out[60];
+    memset(fill, 'x', sizeof(fill));
+    broadcast_ring_write(&ring, fill, sizeof(fill));
+    broadcast_reader_read(&reader_a, out, sizeof(out));
+
+    /* Straddles buf[63] / buf[0] */
+    broadcast_ring_write(&ring, "0123456789", 10);
+    TEST_ASSERT_EQUAL(10, broadcast_reader_read(&reader_a, out, 10));
+    TEST_ASSERT_EQUAL_MEMORY("0123456789", out, 10);
+}
+
+/*===========================================================================
+ * Zero-copy spans
+ *===========================================================================*/
+
+void test_spans_point_into_shared_memory(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    broadcast_ring_write(&ring, "HELLO", 5);
+
+    ringbuffer_span_t spans_a[2], spans_b[2];
+    TEST_ASSERT_EQUAL(1, broadcast_reader_peek_spans(&reader_a, 0, 5, spans_a));
+    TEST_ASSERT_EQUAL(1, broadcast_reader_peek_spans(&reader_b, 0, 5, spans_b));
+
+    /* Both readers see the single written copy */
+    TEST_ASSERT_EQUAL_PTR(buf, spans_a[0].data);
+    TEST_ASSERT_EQUAL_PTR(spans_a[0].data, spans_b[0].data);
+
+    TEST_ASSERT_TRUE(broadcast_reader_consume(&reader_a, 5));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_size(&reader_a));
+    TEST_ASSERT_EQUAL(5, broadcast_reader_size(&reader_b));
+}
+
+void test_peek_spans_insufficient_and_consume_too_much(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_write(&ring, "ABC", 3);
+
+    ringbuffer_span_t spans[2];
+    TEST_ASSERT_EQUAL(0, broadcast_reader_peek_spans(&reader_a, 0, 4, spans));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_peek_spans(&reader_a, 3, 1, spans));
+    TEST_ASSERT_FALSE(broadcast_reader_consume(&reader_a, 4));
+    TEST_ASSERT_EQUAL(3, broadcast_reader_size(&reader_a));
+}
+
+/*===========================================================================
+ * OVERWRITE policy
+ *===========================================================================*/
+
+void test_overwrite_lagging_reader_drops_oldest(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    char data[100];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)i;
+    }
+
+    /* reader_a keeps up, reader_b never reads */
+    char out[TEST_BUF_SIZE];
+    for (size_t i = 0; i < sizeof(data); i += 20) {
+        TEST_ASSERT_TRUE(broadcast_ring_write(&ring, data + i, 20));
+        TEST_ASSERT_EQUAL(20, broadcast_reader_read(&reader_a, out, 20));
+        TEST_ASSERT_EQUAL_MEMORY(data + i, out, 20);
+    }
+
+    TEST_ASSERT_EQUAL(0, broadcast_reader_get_drop_count(&reader_a));
+
+    /* reader_b lost everything older than the newest size-1 bytes */
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1, broadcast_reader_size(&reader_b));
+    TEST_ASSERT_EQUAL(sizeof(data) - (TEST_BUF_SIZE - 1),
+                      broadcast_reader_get_drop_count(&reader_b));
+
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1, broadcast_reader_read(&reader_b, out, TEST_BUF_SIZE - 1));
+    TEST_ASSERT_EQUAL_MEMORY(data + sizeof(data) - (TEST_BUF_SIZE - 1), out, TEST_BUF_SIZE - 1);
+}
+
+void test_overwrite_consume_fails_if_lapped_after_peek(void) {
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_write(&ring, "ABCD", 4);
+
+    ringbuffer_span_t spans[2];
+    TEST_ASSERT_EQUAL(1, broadcast_reader_peek_spans(&reader_a, 0, 4, spans));
+
+    /* Writer laps the reader while it is still processing the spans */
+    char fill[TEST_BUF_SIZE - 2];
+    memset(fill, 'z', sizeof(fill));
+    broadcast_ring_write(&ring, fill, sizeof(fill));
+
+    TEST_ASSERT_FALSE(broadcast_reader_consume(&reader_a, 4));
+    TEST_ASSERT_TRUE(broadcast_reader_get_drop_count(&reader_a) > 0);
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1, broadcast_reader_size(&reader_a));
+}
+
+/*===========================================================================
+ * SLOWEST policy
+ *===========================================================================*/
+
+void test_slowest_writer_drops_whole_write(void) {
+    broadcast_ring_set_policy(&ring, BROADCAST_RING_POLICY_SLOWEST);
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    char fill[50];
+    char out[50];
+    memset(fill, 'x', sizeof(fill));
+    TEST_ASSERT_TRUE(broadcast_ring_write(&ring, fill, sizeof(fill)));
+    broadcast_reader_read(&reader_a, out, sizeof(out));
+
+    /* reader_b still holds 50 bytes: 13 free, a 20-byte write is dropped entirely */
+    TEST_ASSERT_FALSE(broadcast_ring_write(&ring, fill, 20));
+    TEST_ASSERT_EQUAL(20, broadcast_ring_get_drop_count(&ring));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_size(&reader_a));
+    TEST_ASSERT_EQUAL(50, broadcast_reader_size(&reader_b));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_get_drop_count(&reader_b));
+
+    /* Once the slowest reader catches up the writer proceeds */
+    broadcast_reader_read(&reader_b, out, sizeof(out));
+    TEST_ASSERT_TRUE(broadcast_ring_write(&ring, fill, 20));
+}
+
+void test_slowest_ignores_detached_reader(void) {
+    broadcast_ring_set_policy(&ring, BROADCAST_RING_POLICY_SLOWEST);
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    char fill[50];
+    memset(fill, 'x', sizeof(fill));
+    broadcast_ring_write(&ring, fill, sizeof(fill));
+    TEST_ASSERT_FALSE(broadcast_ring_write(&ring, fill, 20));
+
+    broadcast_ring_detach(&reader_a);
+    broadcast_ring_detach(&reader_b);
+    TEST_ASSERT_TRUE(broadcast_ring_write(&ring, fill, 20));
+}
+
+/* Writer thread streams a counter, two reader threads check order */
+#define STREAM_BYTES 50000
+
+static void *slowest_writer_thread(void *arg) {
+    (void)arg;
+    size_t sent = 0;
+    char chunk[7];
+
+    while (sent < STREAM_BYTES) {
+        size_t n = (STREAM_BYTES - sent < sizeof(chunk)) ? STREAM_BYTES - sent : sizeof(chunk);
+        for (size_t i = 0; i < n; i++) {
+            chunk[i] = (char)((sent + i) & 0xFF);
+        }
+        if (broadcast_ring_write(&ring, chunk, n)) {
+            sent += n;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *stream_reader_thread(void *arg) {
+    broadcast_reader_t *reader = (broadcast_reader_t *)arg;
+    size_t received = 0;
+    char chunk[11];
+
+    while (received < STREAM_BYTES) {
+        size_t n = broadcast_reader_read(reader, chunk, sizeof(chunk));
+        if (n == 0) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (chunk[i] != (char)((received + i) & 0xFF)) {
+                return (void *)1;
+            }
+        }
+        received += n;
+    }
+    return NULL;
+}
+
+void test_slowest_concurrent_stream_in_order(void) {
+    broadcast_ring_set_policy(&ring, BROADCAST_RING_POLICY_SLOWEST);
+    broadcast_ring_attach(&ring, &reader_a);
+    broadcast_ring_attach(&ring, &reader_b);
+
+    pthread_t writer, ra, rb;
+    void *res_a, *res_b;
+
+    pthread_create(&ra, NULL, stream_reader_thread, &reader_a);
+    pthread_create(&rb, NULL, stream_reader_thread, &reader_b);
+    pthread_create(&writer, NULL, slowest_writer_thread, NULL);
+
+    pthread_join(writer, NULL);
+    pthread_join(ra, &res_a);
+    pthread_join(rb, &res_b);
+
+    TEST_ASSERT_NULL(res_a);
+    TEST_ASSERT_NULL(res_b);
+    TEST_ASSERT_EQUAL(0, broadcast_reader_get_drop_count(&reader_a));
+    TEST_ASSERT_EQUAL(0, broadcast_reader_get_drop_count(&reader_b));
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Attach / Detach */
+    RUN_TEST(test_attach_starts_at_current_head);
+    RUN_TEST(test_attach_limit);
+
+    /* Independent cursors */
+    RUN_TEST(test_each_reader_sees_every_byte);
+    RUN_TEST(test_readers_progress_independently);
+    RUN_TEST(test_read_across_wrap);
+
+    /* Zero-copy spans */
+    RUN_TEST(test_spans_point_into_shared_memory);
+    RUN_TEST(test_peek_spans_insufficient_and_consume_too_much);
+
+    /* OVERWRITE policy */
+    RUN_TEST(test_overwrite_lagging_reader_drops_oldest);
+    RUN_TEST(test_overwrite_consume_fails_if_lapped_after_peek);
+
+    /* SLOWEST policy */
+    RUN_TEST(test_slowest_writer_drops_whole_write);
+    RUN_TEST(test_slowest_ignores_detached_reader);
+    RUN_TEST(test_slowest_concurrent_stream_in_order);
+
+    return UNITY_END();
+}
@@ -0,0 +1,364 @@
+/**
+ * @file test_crc.c
+ * @brief Unit tests for lib/utils/src/crc.c
+ *
+ * Target: lib/utils/src/crc.c (PURE module)
+ * Built once per CRC24Q_SLICE option (0, 1, 4, 8), every variant must pass
+ * the same vectors.
+ *
+ * Tests: CRC24Q check value, recorded RTCM frames, bitwise reference on
+ *        MSM-sized buffers, every alignment/length, incremental update
+ *        across ringbuffer spans
+ *        CRC32 Unicore frames, slicing-by-8 vs the previous byte table,
+ *        hardware ops through a register model of the STM32H5 CRC unit,
+ *        fallback when the peripheral is busy or the span is short
+ */
+
+#include "unity.h"
+#include "crc.h"
+#include "ringbuffer.h"
+#include "rtcm/rtcm_fixture.h"
+#include "unicore/unicore_fixture.h"
+#include <string.h>
+
+#define RTCM_MAX_FRAME 1029 /* header(3) + 1023 payload + CRC(3) */
+
+static uint8_t frame[RTCM_MAX_FRAME];
+
+/* Previous rtcm.c implementation (bit by bit) */
+static uint32_t ref_crc24q(uint32_t crc, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= ((uint32_t)buf[i]) << 16;
+        for (int j = 0; j < 8; j++) {
+            crc <<= 1;
+            if (crc & 0x1000000) {
+                crc ^= 0x1864CFB;
+            }
+        }
+    }
+    return crc & 0xFFFFFF;
+}
+
+/* Max-length MSM-style frame: D3, length 1023, pseudo-random payload, CRC */
+static void build_max_frame(void) {
+    uint32_t seed = 0x1077;
+
+    frame[0] = 0xD3;
+    frame[1] = 0x03;
+    frame[2] = 0xFF;
+    for (size_t i = 3; i < RTCM_MAX_FRAME - 3; i++) {
+        seed = seed * 1103515245u + 12345u;
+        frame[i] = (uint8_t)(seed >> 16);
+    }
+
+    uint32_t crc = ref_crc24q(0, frame, RTCM_MAX_FRAME - 3);
+    frame[RTCM_MAX_FRAME - 3] = (uint8_t)(crc >> 16);
+    frame[RTCM_MAX_FRAME - 2] = (uint8_t)(crc >> 8);
+    frame[RTCM_MAX_FRAME - 1] = (uint8_t)crc;
+}
+
+/* Previous gps_unicore.c implementation (byte table, built here bitwise) */
+static uint32_t ref_crc32(uint32_t crc, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+/*===========================================================================
+ * STM32H5 CRC unit model (app/core/crc_port.c register sequence)
+ *===========================================================================*/
+
+static uint32_t rbit32(uint32_t v) {
+    uint32_t r = 0;
+    for (int i = 0; i < 32; i++) {
+        r = (r << 1) | ((v >> i) & 1);
+    }
+    return r;
+}
+
+static uint32_t rbit8(uint8_t v) {
+    return rbit32(v) >> 24;
+}
+
+/* MSB-first shift register, POL = 0x04C11DB7 */
+static uint32_t model_shift(uint32_t state, uint32_t in, int bits) {
+    state ^= in;
+    for (int i = 0; i < bits; i++) {
+        state = (state & 0x80000000u) ? (state << 1) ^ 0x04C11DB7u : state << 1;
+    }
+    return state;
+}
+
+/* INIT = rbit(crc), 32-bit DR writes packed big-endian, 8-bit tail writes,
+ * REV_IN per byte, REV_OUT on read */
+static uint32_t model_crc32(uint32_t crc, const uint8_t *p, size_t len) {
+    uint32_t state = rbit32(crc);
+
+    for (; len >= 4; len -= 4, p += 4) {
+        uint32_t w = (rbit8(p[0]) << 24) | (rbit8(p[1]) << 16) | (rbit8(p[2]) << 8) | rbit8(p[3]);
+        state = model_shift(state, w, 32);
+    }
+    for (; len > 0; len--, p++) {
+        state = model_shift(state, rbit8(*p) << 24, 8);
+    }
+    return rbit32(state);
+}
+
+static bool hw_busy;
+static int hw_calls;
+
+static bool model_calc(uint32_t *crc, const void *data, size_t len) {
+    hw_calls++;
+    if (hw_busy) {
+        return false;
+    }
+    *crc = model_crc32(*crc, data, len);
+    return true;
+}
+
+static const crc32_hal_ops_t model_ops = {
+    .calc = model_calc,
+};
+
+void setUp(void) {
+    build_max_frame();
+    crc32_set_hal(NULL);
+    hw_busy = false;
+    hw_calls = 0;
+}
+
+void tearDown(void) {
+}
+
+/*===========================================================================
+ * Golden vectors
+ *===========================================================================*/
+
+void test_crc24q_check_value(void) {
+    /* CRC-24/LTE-A catalogue check value (same parameters as RTCM3 CRC24Q) */
+    TEST_ASSERT_EQUAL_HEX32(0xCDE703, crc24q_update(0, "123456789", 9));
+}
+
+void test_crc24q_empty_is_identity(void) {
+    TEST_ASSERT_EQUAL_HEX32(0, crc24q_update(0, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x123456, crc24q_update(0x123456, "", 0));
+}
+
+void test_crc24q_rtcm_1005_frame(void) {
+    size_t body = sizeof(RTCM_1005_STATION) - 3;
+
+    TEST_ASSERT_EQUAL_HEX32(RTCM_1005_STATION_CRC, crc24q_update(0, RTCM_1005_STATION, body));
+
+    /* Running the CRC over the transmitted CRC bytes too leaves zero */
+    TEST_ASSERT_EQUAL_HEX32(0, crc24q_update(0, RTCM_1005_STATION, sizeof(RTCM_1005_STATION)));
+}
+
+void test_crc24q_max_length_frame(void) {
+    TEST_ASSERT_EQUAL_HEX32(ref_crc24q(0, frame, RTCM_MAX_FRAME - 3),
+                            crc24q_update(0, frame, RTCM_MAX_FRAME - 3));
+    TEST_ASSERT_EQUAL_HEX32(0, crc24q_update(0, frame, RTCM_MAX_FRAME));
+}
+
+/*===========================================================================
+ * Alignment / length
+ *===========================================================================*/
+
+void test_crc24q_every_alignment_and_length(void) {
+    /* Covers the 8-byte, 4-byte and byte tails from every start offset */
+    for (size_t off = 0; off < 8; off++) {
+        for (size_t len = 0; len <= 40; len++) {
+            TEST_ASSERT_EQUAL_HEX32(ref_crc24q(0, frame + off, len),
+                                    crc24q_update(0, frame + off, len));
+        }
+    }
+}
+
+void test_crc24q_high_bits_of_seed_ignored(void) {
+    /* Only the low 24 bits of the running value are CRC state */
+    TEST_ASSERT_EQUAL_HEX32(crc24q_update(0x00ABCDEF, frame, 17),
+                            crc24q_update(0xFFABCDEF, frame, 17));
+}
+
+/*===========================================================================
+ * Incremental
+ *===========================================================================*/
+
+void test_crc24q_split_at_every_offset(void) {
+    uint32_t whole = crc24q_update(0, frame, RTCM_MAX_FRAME - 3);
+
+    for (size_t split = 0; split <= RTCM_MAX_FRAME - 3; split++) {
+        uint32_t crc = crc24q_update(0, frame, split);
+        crc = crc24q_update(crc, frame + split, RTCM_MAX_FRAME - 3 - split);
+        TEST_ASSERT_EQUAL_HEX32(whole, crc);
+    }
+}
+
+void test_crc24q_across_ringbuffer_spans(void) {
+    static char mem[2048];
+    static const char fill[2048];
+    ringbuffer_t rb;
+    ringbuffer_span_t spans[2];
+    uint32_t whole = crc24q_update(0, frame, RTCM_MAX_FRAME - 3);
+
+    /* Frame wraps around the end of ring memory at different points */
+    for (size_t lead = 1500; lead < 2048; lead += 61) {
+        ringbuffer_init(&rb, mem, sizeof(mem));
+        ringbuffer_write(&rb, fill, lead);
+        ringbuffer_advance(&rb, lead);
+        ringbuffer_write(&rb, (const char *)frame, RTCM_MAX_FRAME);
+
+        size_t cnt = ringbuffer_peek_spans(&rb, 0, RTCM_MAX_FRAME - 3, spans);
+        TEST_ASSERT_EQUAL(2, cnt);
+
+        uint32_t crc = 0;
+        for (size_t i = 0; i < cnt; i++) {
+            crc = crc24q_update(crc, spans[i].data, spans[i].len);
+        }
+        TEST_ASSERT_EQUAL_HEX32(whole, crc);
+    }
+}
+
+/*===========================================================================
+ * CRC32 software
+ *===========================================================================*/
+
+void test_crc32_unicore_frames(void) {
+    size_t bn = sizeof(UNICORE_BESTNAV_RTK_FIX) - 4;
+    size_t hd = sizeof(UNICORE_HEADING2_FIXED) - 4;
+
+    TEST_ASSERT_EQUAL_HEX32(UNICORE_BESTNAV_RTK_FIX_CRC,
+                            crc32_update_sw(0, UNICORE_BESTNAV_RTK_FIX, bn));
+    TEST_ASSERT_EQUAL_HEX32(UNICORE_HEADING2_FIXED_CRC,
+                            crc32_update_sw(0, UNICORE_HEADING2_FIXED, hd));
+
+    /* Little-endian CRC appended, no final XOR: the full frame leaves zero */
+    TEST_ASSERT_EQUAL_HEX32(0, crc32_update_sw(0, UNICORE_BESTNAV_RTK_FIX,
+                                               sizeof(UNICORE_BESTNAV_RTK_FIX)));
+
+    /* Without a registered peripheral crc32_update is the software path */
+    TEST_ASSERT_EQUAL_HEX32(UNICORE_BESTNAV_RTK_FIX_CRC,
+                            crc32_update(0, UNICORE_BESTNAV_RTK_FIX, bn));
+}
+
+void test_crc32_every_alignment_and_length(void) {
+    for (size_t off = 0; off < 8; off++) {
+        for (size_t len = 0; len <= 40; len++) {
+            TEST_ASSERT_EQUAL_HEX32(ref_crc32(0, frame + off, len),
+                                    crc32_update_sw(0, frame + off, len));
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX32(ref_crc32(0, frame, RTCM_MAX_FRAME),
+                            crc32_update_sw(0, frame, RTCM_MAX_FRAME));
+}
+
+void test_crc32_split_at_every_offset(void) {
+    uint32_t whole = ref_crc32(0, frame, RTCM_MAX_FRAME);
+
+    for (size_t split = 0; split <= RTCM_MAX_FRAME; split++) {
+        uint32_t crc = crc32_update_sw(0, frame, split);
+        crc = crc32_update_sw(crc, frame + split, RTCM_MAX_FRAME - split);
+        TEST_ASSERT_EQUAL_HEX32(whole, crc);
+    }
+}
+
+/*===========================================================================
+ * CRC32 hardware ops
+ *===========================================================================*/
+
+void test_crc32_hw_model_matches_software(void) {
+    /* Check the register model itself before trusting it below */
+    TEST_ASSERT_EQUAL_HEX32(ref_crc32(0, frame, RTCM_MAX_FRAME),
+                            model_crc32(0, frame, RTCM_MAX_FRAME));
+
+    crc32_set_hal(&model_ops);
+
+    size_t bn = sizeof(UNICORE_BESTNAV_RTK_FIX) - 4;
+    size_t hd = sizeof(UNICORE_HEADING2_FIXED) - 4;
+
+    TEST_ASSERT_EQUAL_HEX32(UNICORE_BESTNAV_RTK_FIX_CRC,
+                            crc32_update(0, UNICORE_BESTNAV_RTK_FIX, bn));
+    TEST_ASSERT_EQUAL_HEX32(UNICORE_HEADING2_FIXED_CRC,
+                            crc32_update(0, UNICORE_HEADING2_FIXED, hd));
+    TEST_ASSERT_EQUAL(2, hw_calls);
+
+    for (size_t off = 0; off < 4; off++) {
+        for (size_t len = CRC32_HW_MIN_LEN; len <= CRC32_HW_MIN_LEN + 8; len++) {
+            TEST_ASSERT_EQUAL_HEX32(crc32_update_sw(0x12345678, frame + off, len),
+                                    crc32_update(0x12345678, frame + off, len));
+        }
+    }
+}
+
+void test_crc32_hw_split_continues_crc(void) {
+    uint32_t whole = crc32_update_sw(0, frame, RTCM_MAX_FRAME);
+
+    crc32_set_hal(&model_ops);
+
+    /* Spans on either side of the hardware threshold mix both paths */
+    for (size_t split = 0; split <= RTCM_MAX_FRAME; split += 7) {
+        uint32_t crc = crc32_update(0, frame, split);
+        crc = crc32_update(crc, frame + split, RTCM_MAX_FRAME - split);
+        TEST_ASSERT_EQUAL_HEX32(whole, crc);
+    }
+}
+
+void test_crc32_busy_falls_back_to_software(void) {
+    size_t bn = sizeof(UNICORE_BESTNAV_RTK_FIX) - 4;
+
+    crc32_set_hal(&model_ops);
+    hw_busy = true;
+
+    TEST_ASSERT_EQUAL_HEX32(UNICORE_BESTNAV_RTK_FIX_CRC,
+                            crc32_update(0, UNICORE_BESTNAV_RTK_FIX, bn));
+    TEST_ASSERT_EQUAL(1, hw_calls);
+}
+
+void test_crc32_short_span_skips_hardware(void) {
+    crc32_set_hal(&model_ops);
+
+    TEST_ASSERT_EQUAL_HEX32(ref_crc32(0, frame, CRC32_HW_MIN_LEN - 1),
+                            crc32_update(0, frame, CRC32_HW_MIN_LEN - 1));
+    TEST_ASSERT_EQUAL(0, hw_calls);
+
+    crc32_update(0, frame, CRC32_HW_MIN_LEN);
+    TEST_ASSERT_EQUAL(1, hw_calls);
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Golden vectors */
+    RUN_TEST(test_crc24q_check_value);
+    RUN_TEST(test_crc24q_empty_is_identity);
+    RUN_TEST(test_crc24q_rtcm_1005_frame);
+    RUN_TEST(test_crc24q_max_length_frame);
+
+    /* Alignment / length */
+    RUN_TEST(test_crc24q_every_alignment_and_length);
+    RUN_TEST(test_crc24q_high_bits_of_seed_ignored);
+
+    /* Incremental */
+    RUN_TEST(test_crc24q_split_at_every_offset);
+    RUN_TEST(test_crc24q_across_ringbuffer_spans);
+
+    /* CRC32 software */
+    RUN_TEST(test_crc32_unicore_frames);
+    RUN_TEST(test_crc32_every_alignment_and_length);
+    RUN_TEST(test_crc32_split_at_every_offset);
+
+    /* CRC32 hardware ops */
+    RUN_TEST(test_crc32_hw_model_matches_software);
+    RUN_TEST(test_crc32_hw_split_continues_crc);
+    RUN_TEST(test_crc32_busy_falls_back_to_software);
+    RUN_TEST(test_crc32_short_span_skips_hardware);
+
+    return UNITY_END();
+}
@@ -0,0 +1,302 @@
+/**
+ * @file test_gps_baud.c
+ * @brief Unit tests for lib/gps/gps_baud.c
+ *
+ * Target: lib/gps/gps_baud.c (PURE module)
+ * Tests: measured rate snapping, CONFIG command formatting,
+ *        negotiation against a simulated UM982 (auto-baud hit/miss, table scan,
+ *        rejected rate fallback, lost link recovery by reset, no receiver)
+ */
+
+#include "unity.h"
+#include "gps_baud.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*===========================================================================
+ * Simulated receiver
+ *===========================================================================*/
+
+typedef struct {
+    bool present;          /* receiver powered and wired */
+    uint32_t local;        /* host USART rate */
+    uint32_t rx_rate;      /* receiver COM1 rate */
+    uint32_t saved_rate;   /* rate restored by a reset */
+    uint32_t max_accept;   /* CONFIG above this is answered with ERROR */
+    uint32_t link_limit;   /* above this the wiring corrupts every frame */
+    uint32_t autobaud_fixed; /* nonzero: auto-baud reports this instead */
+    uint32_t configs;      /* CONFIG commands understood by the receiver */
+    uint32_t probes;
+    uint32_t delay_total;
+} sim_t;
+
+static sim_t sim;
+
+static bool sim_link_ok(void) {
+    return sim.present && sim.local == sim.rx_rate && sim.rx_rate <= sim.link_limit;
+}
+
+static bool sim_send_sync(void *ctx, const char *cmd) {
+    unsigned long rate;
+
+    (void)ctx;
+    if (!sim_link_ok()) {
+        return true; /* bytes left the wire, receiver did not understand */
+    }
+    if (sscanf(cmd, "CONFIG COM1 %lu", &rate) == 1 && rate <= sim.max_accept) {
+        sim.rx_rate = (uint32_t)rate;
+        sim.configs++;
+    }
+    return true;
+}
+
+static bool sim_set_local(void *ctx, uint32_t baudrate) {
+    (void)ctx;
+    sim.local = baudrate;
+    return true;
+}
+
+static bool sim_probe(void *ctx) {
+    (void)ctx;
+    sim.probes++;
+    return sim_link_ok();
+}
+
+static uint32_t sim_autobaud(void *ctx) {
+    (void)ctx;
+    if (!sim.present) {
+        return 0;
+    }
+    if (sim.autobaud_fixed) {
+        return sim.autobaud_fixed;
+    }
+    return sim.rx_rate + sim.rx_rate / 100; /* 1% measurement error */
+}
+
+static bool sim_reset(void *ctx) {
+    (void)ctx;
+    sim.rx_rate = sim.saved_rate;
+    return true;
+}
+
+static void sim_delay(void *ctx, uint32_t ms) {
+    (void)ctx;
+    sim.delay_total += ms;
+}
+
+static gps_baud_ops_t ops;
+
+static const gps_baud_cfg_t cfg = {
+    .port = "COM1",
+    .target = 921600,
+    .probe_retries = 2,
+    .settle_ms = 50,
+    .boot_ms = 1000,
+};
+
+void setUp(void) {
+    memset(&sim, 0, sizeof(sim));
+    sim.present = true;
+    sim.local = GPS_BAUD_DEFAULT;
+    sim.rx_rate = GPS_BAUD_DEFAULT;
+    sim.saved_rate = GPS_BAUD_DEFAULT;
+    sim.max_accept = 921600;
+    sim.link_limit = 921600;
+
+    ops = (gps_baud_ops_t){
+        .send_sync = sim_send_sync,
+        .set_local = sim_set_local,
+        .probe = sim_probe,
+        .autobaud = sim_autobaud,
+        .reset = sim_reset,
+        .delay_ms = sim_delay,
+        .ctx = NULL,
+    };
+}
+
+void tearDown(void) {
+}
+
+/*===========================================================================
+ * Snap / format
+ *===========================================================================*/
+
+void test_snap_within_tolerance(void) {
+    TEST_ASSERT_EQUAL_UINT32(921600, gps_baud_snap(921600));
+    TEST_ASSERT_EQUAL_UINT32(921600, gps_baud_snap(903168)); /* -2% */
+    TEST_ASSERT_EQUAL_UINT32(115200, gps_baud_snap(117000));
+    TEST_ASSERT_EQUAL_UINT32(9600, gps_baud_snap(9700));
+}
+
+void test_snap_rejects_off_table(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, gps_baud_snap(0));
+    TEST_ASSERT_EQUAL_UINT32(0, gps_baud_snap(100000));
+    TEST_ASSERT_EQUAL_UINT32(0, gps_baud_snap(2000000));
+    TEST_ASSERT_EQUAL_UINT32(0, gps_baud_snap(38400 / 3)); /* '$' measured as 3 bits */
+}
+
+void test_format_cmd(void) {
+    char buf[32];
+
+    TEST_ASSERT_EQUAL_size_t(20, gps_baud_format_cmd(buf, sizeof(buf), "COM1", 921600));
+    TEST_ASSERT_EQUAL_STRING("CONFIG COM1 921600\r\n", buf);
+}
+
+void test_format_cmd_too_small(void) {
+    char buf[20];
+
+    TEST_ASSERT_EQUAL_size_t(0, gps_baud_format_cmd(buf, sizeof(buf), "COM1", 921600));
+    TEST_ASSERT_EQUAL_size_t(18, gps_baud_format_cmd(buf, sizeof(buf), "COM1", 9600));
+}
+
+/*===========================================================================
+ * Negotiation
+ *===========================================================================*/
+
+void test_already_at_target(void) {
+    gps_baud_result_t res;
+
+    sim.rx_rate = 921600;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL(GPS_BAUD_ST_DONE, res.state);
+    TEST_ASSERT_EQUAL_UINT32(921600, res.initial);
+    TEST_ASSERT_EQUAL_UINT32(921600, res.baudrate);
+    TEST_ASSERT_TRUE(res.autobaud_hit);
+    TEST_ASSERT_EQUAL_UINT8(0, res.switches);
+    TEST_ASSERT_EQUAL_UINT32(921600, sim.local);
+}
+
+void test_default_to_target_via_autobaud(void) {
+    gps_baud_result_t res;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL_UINT32(115200, res.initial);
+    TEST_ASSERT_EQUAL_UINT32(921600, res.baudrate);
+    TEST_ASSERT_TRUE(res.autobaud_hit);
+    TEST_ASSERT_EQUAL_UINT8(1, res.switches);
+    TEST_ASSERT_EQUAL_UINT8(0, res.fallbacks);
+    TEST_ASSERT_EQUAL_UINT32(921600, sim.local);
+    TEST_ASSERT_EQUAL_UINT32(921600, sim.rx_rate);
+    TEST_ASSERT_EQUAL_UINT32(2, sim.probes); /* detect + verify */
+    TEST_ASSERT_EQUAL_UINT32(cfg.settle_ms, sim.delay_total);
+}
+
+void test_scan_without_autobaud(void) {
+    gps_baud_result_t res;
+
+    ops.autobaud = NULL;
+    sim.rx_rate = 460800;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL_UINT32(460800, res.initial);
+    TEST_ASSERT_EQUAL_UINT32(921600, res.baudrate);
+    TEST_ASSERT_FALSE(res.autobaud_hit);
+    TEST_ASSERT_EQUAL_UINT32(921600, sim.rx_rate);
+}
+
+void test_wrong_autobaud_falls_back_to_scan(void) {
+    gps_baud_result_t res;
+
+    sim.rx_rate = 57600;
+    sim.autobaud_fixed = 230400 + 1000;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL_UINT32(57600, res.initial);
+    TEST_ASSERT_FALSE(res.autobaud_hit);
+    TEST_ASSERT_EQUAL_UINT32(921600, res.baudrate);
+}
+
+void test_rejected_rate_steps_down(void) {
+    gps_baud_result_t res;
+
+    sim.max_accept = 460800;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL_UINT32(460800, res.baudrate);
+    TEST_ASSERT_EQUAL_UINT8(2, res.switches);
+    TEST_ASSERT_EQUAL_UINT8(1, res.fallbacks);
+    TEST_ASSERT_EQUAL_UINT8(0, res.resets);
+    TEST_ASSERT_EQUAL_UINT32(460800, sim.local);
+    TEST_ASSERT_EQUAL_UINT32(460800, sim.rx_rate);
+}
+
+void test_lost_link_recovers_by_reset(void) {
+    gps_baud_result_t res;
+
+    /* receiver switches to 921600 but the wiring cannot carry it */
+    sim.link_limit = 460800;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL_UINT32(115200, res.initial);
+    TEST_ASSERT_EQUAL_UINT32(460800, res.baudrate);
+    TEST_ASSERT_EQUAL_UINT8(1, res.resets);
+    TEST_ASSERT_EQUAL_UINT8(1, res.fallbacks);
+    TEST_ASSERT_EQUAL_UINT32(460800, sim.local);
+    TEST_ASSERT_EQUAL_UINT32(460800, sim.rx_rate);
+}
+
+void test_lost_link_without_reset_fails(void) {
+    gps_baud_result_t res;
+
+    ops.reset = NULL;
+    sim.link_limit = 460800;
+
+    TEST_ASSERT_FALSE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL(GPS_BAUD_ST_FAILED, res.state);
+    TEST_ASSERT_EQUAL_UINT32(GPS_BAUD_DEFAULT, sim.local);
+}
+
+void test_no_receiver_fails_at_default(void) {
+    gps_baud_result_t res;
+
+    sim.present = false;
+
+    TEST_ASSERT_FALSE(gps_baud_negotiate(&ops, &cfg, &res));
+    TEST_ASSERT_EQUAL(GPS_BAUD_ST_FAILED, res.state);
+    TEST_ASSERT_EQUAL_UINT32(0, res.initial);
+    TEST_ASSERT_EQUAL_UINT32(GPS_BAUD_DEFAULT, res.baudrate);
+    TEST_ASSERT_EQUAL_UINT8(2, res.resets);
+    TEST_ASSERT_EQUAL_UINT32(GPS_BAUD_DEFAULT, sim.local);
+}
+
+void test_lower_target_steps_down(void) {
+    gps_baud_result_t res;
+    gps_baud_cfg_t low = cfg;
+
+    low.target = 230400;
+    sim.rx_rate = 921600;
+
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &low, &res));
+    TEST_ASSERT_EQUAL_UINT32(921600, res.initial);
+    TEST_ASSERT_EQUAL_UINT32(230400, res.baudrate);
+    TEST_ASSERT_EQUAL_UINT32(230400, sim.rx_rate);
+}
+
+void test_null_result_allowed(void) {
+    TEST_ASSERT_TRUE(gps_baud_negotiate(&ops, &cfg, NULL));
+    TEST_ASSERT_EQUAL_UINT32(921600, sim.local);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_snap_within_tolerance);
+    RUN_TEST(test_snap_rejects_off_table);
+    RUN_TEST(test_format_cmd);
+    RUN_TEST(test_format_cmd_too_small);
+
+    RUN_TEST(test_already_at_target);
+    RUN_TEST(test_default_to_target_via_autobaud);
+    RUN_TEST(test_scan_without_autobaud);
+    RUN_TEST(test_wrong_autobaud_falls_back_to_scan);
+    RUN_TEST(test_rejected_rate_steps_down);
+    RUN_TEST(test_lost_link_recovers_by_reset);
+    RUN_TEST(test_lost_link_without_reset_fails);
+    RUN_TEST(test_no_receiver_fails_at_default);
+    RUN_TEST(test_lower_target_steps_down);
+    RUN_TEST(test_null_result_allowed);
+
+    return UNITY_END();
+}
@@ -0,0 +1,539 @@
+/**
+ * @file test_gps_cmd_batch.c
+ * @brief Unit tests for lib/gps/gps_cmd_batch.c
+ *
+ * Target: lib/gps/gps_cmd_batch.c (PURE module)
+ * Tests: window limit, echo matching (case, CR/LF, duplicates, late responses),
+ *        retry of failed commands only, immediate retry on send failure,
+ *        overall deadline, wait time,
+ *        UM982 init time against a simulated receiver: previous one-at-a-time
+ *        sequence (gps_app.c before pipelining) vs. the pipelined batch
+ */
+
+#include "unity.h"
+#include "gps_cmd_batch.h"
+#include <stdio.h>
+#include <string.h>
+
+static const gps_cmd_batch_cfg_t cfg = {
+    .window = 4,
+    .max_attempts = 3,
+    .timeout_ms = 1000,
+    .deadline_ms = 5000,
+};
+
+static gps_cmd_batch_t batch;
+
+/* gps_app.c um982_base_cmds */
+static const char *const base_cmds[] = {
+    "unmask BDS\r\n",       "unmask GPS\r\n",      "unmask GLO\r\n",      "unmask GAL\r\n",
+    "unmask QZSS\r\n",      "rtcm1033 com1 10\r\n", "rtcm1006 com1 10\r\n", "rtcm1074 com1 1\r\n",
+    "rtcm1124 com1 1\r\n",  "rtcm1084 com1 1\r\n",  "rtcm1094 com1 1\r\n",  "gpgga com1 1\r\n",
+    "BESTNAVB 1\r\n",
+};
+
+#define BASE_COUNT (sizeof(base_cmds) / sizeof(base_cmds[0]))
+
+void setUp(void) {
+    memset(&batch, 0, sizeof(batch));
+}
+
+void tearDown(void) {
+}
+
+static bool respond(const char *echo, bool ok) {
+    return gps_cmd_batch_on_response(&batch, echo, strlen(echo), ok);
+}
+
+/*===========================================================================
+ * Batch state machine
+ *===========================================================================*/
+
+void test_init_rejects_too_many(void) {
+    static const char *cmds[GPS_CMD_BATCH_MAX + 1];
+
+    TEST_ASSERT_FALSE(gps_cmd_batch_init(&batch, cmds, GPS_CMD_BATCH_MAX + 1, &cfg, 0));
+}
+
+void test_empty_batch_is_done(void) {
+    TEST_ASSERT_TRUE(gps_cmd_batch_init(&batch, NULL, 0, &cfg, 0));
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_NULL(gps_cmd_batch_next(&batch, 0));
+}
+
+void test_window_limits_outstanding(void) {
+    gps_cmd_batch_init(&batch, base_cmds, BASE_COUNT, &cfg, 0);
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_PTR(base_cmds[i], gps_cmd_batch_next(&batch, 0));
+    }
+    TEST_ASSERT_NULL(gps_cmd_batch_next(&batch, 0));
+    TEST_ASSERT_EQUAL_UINT32(1000, gps_cmd_batch_wait_ms(&batch, 0));
+
+    TEST_ASSERT_TRUE(respond("unmask GLO", true));
+    TEST_ASSERT_EQUAL_UINT32(0, gps_cmd_batch_wait_ms(&batch, 10));
+    TEST_ASSERT_EQUAL_PTR(base_cmds[4], gps_cmd_batch_next(&batch, 10));
+    TEST_ASSERT_NULL(gps_cmd_batch_next(&batch, 10));
+}
+
+void test_echo_ignores_case_and_line_end(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 1, &cfg, 0);
+    gps_cmd_batch_next(&batch, 0);
+
+    TEST_ASSERT_FALSE(respond("unmask BD", true));
+    TEST_ASSERT_FALSE(respond("unmask BDS2", true));
+    TEST_ASSERT_EQUAL_UINT32(2, batch.unmatched);
+
+    TEST_ASSERT_TRUE(respond(" UNMASK bds\r\n", true));
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_EQUAL_size_t(0, gps_cmd_batch_failed(&batch));
+}
+
+void test_duplicate_command_matches_oldest(void) {
+    static const char *const cmds[] = {"gpgga com1 1", "gpgga com1 1"};
+
+    gps_cmd_batch_init(&batch, cmds, 2, &cfg, 0);
+    gps_cmd_batch_next(&batch, 0);
+    gps_cmd_batch_next(&batch, 5);
+
+    TEST_ASSERT_TRUE(respond("gpgga com1 1", true));
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_OK, batch.entries[0].state);
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_INFLIGHT, batch.entries[1].state);
+}
+
+void test_error_retries_only_that_command(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 3, &cfg, 0);
+    while (gps_cmd_batch_next(&batch, 0)) {
+    }
+
+    respond("unmask BDS", true);
+    respond("unmask GPS", false);
+    respond("unmask GLO", true);
+
+    TEST_ASSERT_EQUAL_PTR(base_cmds[1], gps_cmd_batch_next(&batch, 20));
+    TEST_ASSERT_NULL(gps_cmd_batch_next(&batch, 20));
+    TEST_ASSERT_EQUAL_UINT32(4, batch.sent);
+    TEST_ASSERT_EQUAL_UINT32(1, batch.retries);
+
+    respond("unmask GPS", true);
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_FALSE(batch.entries[1].error);
+}
+
+void test_attempts_exhausted_fails(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 1, &cfg, 0);
+
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_NOT_NULL(gps_cmd_batch_next(&batch, (uint32_t)i));
+        respond("unmask BDS", false);
+    }
+
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_EQUAL_size_t(1, gps_cmd_batch_failed(&batch));
+    TEST_ASSERT_TRUE(batch.entries[0].error);
+    TEST_ASSERT_EQUAL_UINT8(3, batch.entries[0].attempts);
+}
+
+void test_send_error_retries_without_waiting(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 2, &cfg, 0);
+
+    TEST_ASSERT_EQUAL_PTR(base_cmds[0], gps_cmd_batch_next(&batch, 0));
+    TEST_ASSERT_TRUE(gps_cmd_batch_on_send_error(&batch, base_cmds[0]));
+    TEST_ASSERT_FALSE(gps_cmd_batch_on_send_error(&batch, base_cmds[0]));
+    TEST_ASSERT_EQUAL_size_t(0, batch.inflight);
+
+    /* Resent at once, not after timeout_ms */
+    TEST_ASSERT_EQUAL_UINT32(0, gps_cmd_batch_wait_ms(&batch, 0));
+    TEST_ASSERT_EQUAL_PTR(base_cmds[0], gps_cmd_batch_next(&batch, 0));
+    TEST_ASSERT_EQUAL_UINT8(2, batch.entries[0].attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, batch.retries);
+}
+
+void test_send_error_exhausts_attempts(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 1, &cfg, 0);
+
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_PTR(base_cmds[0], gps_cmd_batch_next(&batch, 0));
+        gps_cmd_batch_on_send_error(&batch, base_cmds[0]);
+    }
+
+    TEST_ASSERT_NULL(gps_cmd_batch_next(&batch, 0));
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_EQUAL_size_t(1, gps_cmd_batch_failed(&batch));
+    TEST_ASSERT_FALSE(batch.entries[0].error);
+}
+
+void test_timeout_requeues_and_late_response_accepted(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 1, &cfg, 0);
+    gps_cmd_batch_next(&batch, 0);
+
+    /* expired at 1000 ms: next() re-sends right away */
+    TEST_ASSERT_EQUAL_PTR(base_cmds[0], gps_cmd_batch_next(&batch, 1000));
+    TEST_ASSERT_EQUAL_UINT8(2, batch.entries[0].attempts);
+
+    TEST_ASSERT_TRUE(respond("unmask BDS", true));
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+}
+
+void test_late_ok_after_error_accepted(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 1, &cfg, 0);
+    gps_cmd_batch_next(&batch, 0);
+
+    /* ERROR queues a retry; an OK for the same text before the resend settles it */
+    respond("unmask BDS", false);
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_PENDING, batch.entries[0].state);
+    TEST_ASSERT_TRUE(respond("unmask BDS", true));
+
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_EQUAL_UINT32(1, batch.sent);
+}
+
+void test_deadline_fails_remaining(void) {
+    gps_cmd_batch_init(&batch, base_cmds, BASE_COUNT, &cfg, 100);
+    while (gps_cmd_batch_next(&batch, 100)) {
+    }
+    respond("unmask BDS", true);
+    TEST_ASSERT_NOT_NULL(gps_cmd_batch_next(&batch, 100));
+
+    TEST_ASSERT_EQUAL_UINT32(1000, gps_cmd_batch_wait_ms(&batch, 100));
+    TEST_ASSERT_EQUAL_UINT32(50, gps_cmd_batch_wait_ms(&batch, 1050));
+
+    TEST_ASSERT_NULL(gps_cmd_batch_next(&batch, 5100));
+    TEST_ASSERT_TRUE(gps_cmd_batch_done(&batch));
+    TEST_ASSERT_EQUAL_size_t(BASE_COUNT - 1, gps_cmd_batch_failed(&batch));
+    TEST_ASSERT_EQUAL_size_t(0, batch.inflight);
+    TEST_ASSERT_EQUAL_UINT32(0, gps_cmd_batch_wait_ms(&batch, 5100));
+}
+
+void test_wait_clamped_to_deadline(void) {
+    gps_cmd_batch_init(&batch, base_cmds, 1, &cfg, 0);
+    gps_cmd_batch_next(&batch, 4500);
+
+    TEST_ASSERT_EQUAL_UINT32(500, gps_cmd_batch_wait_ms(&batch, 4500));
+}
+
+/*===========================================================================
+ * Simulated UM982 (µs timeline)
+ *
+ * Commands cross the link, queue in the receiver (at most rx_queue_max
+ * waiting, more are dropped), are executed one at a time in proc_us each and
+ * answered with "$command,<cmd>,response: OK|ERROR*XX\r\n".
+ *===========================================================================*/
+
+#define SIM_MAX_RESP 128
+
+typedef struct {
+    uint32_t baudrate;
+    uint32_t proc_us;
+    uint32_t rx_queue_max;
+    bool dead;
+    const char *lose_first;  /* first response to this command never arrives */
+    const char *error_first; /* first attempt of this command answers ERROR */
+    const char *error_always;
+} sim_cfg_t;
+
+typedef struct {
+    uint64_t at_us;
+    const char *cmd;
+    bool ok;
+} sim_resp_t;
+
+static struct {
+    sim_cfg_t cfg;
+    uint64_t tx_free_us;   /* host UART idle from */
+    uint64_t busy_until;   /* receiver idle from */
+    uint64_t starts[SIM_MAX_RESP];
+    size_t accepted;
+    sim_resp_t resp[SIM_MAX_RESP];
+    size_t resp_head;
+    size_t resp_count;
+    bool lost_done;
+    bool error_done;
+    uint32_t dropped;
+} sim;
+
+static uint64_t wire_us(size_t bytes) {
+    return ((uint64_t)bytes * 10u * 1000000u + sim.cfg.baudrate - 1) / sim.cfg.baudrate;
+}
+
+static size_t cmd_text_len(const char *cmd) {
+    size_t len = strlen(cmd);
+
+    while (len && (cmd[len - 1] == '\r' || cmd[len - 1] == '\n')) {
+        len--;
+    }
+    return len;
+}
+
+static void sim_reset(const sim_cfg_t *c) {
+    memset(&sim, 0, sizeof(sim));
+    sim.cfg = *c;
+}
+
+static void sim_send(uint64_t now_us, const char *cmd) {
+    size_t text = cmd_text_len(cmd);
+    uint64_t arrive;
+    size_t queued = 0;
+    bool ok;
+
+    sim.tx_free_us = ((sim.tx_free_us > now_us) ? sim.tx_free_us : now_us) + wire_us(text + 2);
+    arrive = sim.tx_free_us;
+
+    if (sim.cfg.dead) {
+        return;
+    }
+
+    for (size_t i = 0; i < sim.accepted; i++) {
+        if (sim.starts[i] > arrive) {
+            queued++;
+        }
+    }
+    if (queued >= sim.cfg.rx_queue_max || sim.accepted >= SIM_MAX_RESP) {
+        sim.dropped++;
+        return;
+    }
+
+    uint64_t start = (sim.busy_until > arrive) ? sim.busy_until : arrive;
+    sim.busy_until = start + sim.cfg.proc_us;
+    sim.starts[sim.accepted++] = start;
+
+    ok = true;
+    if (sim.cfg.error_always && strcmp(cmd, sim.cfg.error_always) == 0) {
+        ok = false;
+    }
+    if (sim.cfg.error_first && !sim.error_done && strcmp(cmd, sim.cfg.error_first) == 0) {
+        sim.error_done = true;
+        ok = false;
+    }
+    if (sim.cfg.lose_first && !sim.lost_done && strcmp(cmd, sim.cfg.lose_first) == 0) {
+        sim.lost_done = true;
+        return;
+    }
+
+    /* "$command," + echo + ",response: " + OK|ERROR + "*XX\r\n" */
+    sim.resp[sim.resp_count++] = (sim_resp_t){
+        .at_us = sim.busy_until + wire_us(9 + text + 11 + (ok ? 2 : 5) + 5),
+        .cmd = cmd,
+        .ok = ok,
+    };
+}
+
+static const sim_resp_t *sim_peek(void) {
+    return (sim.resp_head < sim.resp_count) ? &sim.resp[sim.resp_head] : NULL;
+}
+
+/*===========================================================================
+ * Init drivers
+ *===========================================================================*/
+
+/* gps_app.c before pipelining: 3 tries, 2000 ms timeout, 200 ms retry gap,
+ * 100 ms between commands. The parser accepted any response while waiting
+ * and dropped the rest. */
+static uint64_t run_sequential(const char *const *cmds, size_t count, size_t *failed) {
+    uint64_t now = 0;
+
+    *failed = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool done = false;
+
+        for (int retry = 0; retry < 3 && !done; retry++) {
+            uint64_t deadline;
+
+            if (retry > 0) {
+                now += 200000;
+            }
+
+            /* responses that arrived while not waiting are lost */
+            while (sim_peek() && sim_peek()->at_us <= now) {
+                sim.resp_head++;
+            }
+
+            sim_send(now, cmds[i]);
+            deadline = now + 2000000;
+
+            const sim_resp_t *r = sim_peek();
+            if (r && r->at_us <= deadline) {
+                now = r->at_us;
+                sim.resp_head++;
+                done = r->ok;
+            }
+            else {
+                now = deadline;
+            }
+        }
+
+        if (!done) {
+            (*failed)++;
+        }
+        now += 100000;
+    }
+
+    return now;
+}
+
+/* gps_send_cmds() loop */
+static uint64_t run_pipelined(const char *const *cmds, size_t count, size_t *max_inflight) {
+    uint64_t now = 0;
+
+    *max_inflight = 0;
+    gps_cmd_batch_init(&batch, cmds, count, &cfg, 0);
+
+    for (;;) {
+        const char *cmd = gps_cmd_batch_next(&batch, (uint32_t)(now / 1000));
+
+        if (batch.inflight > *max_inflight) {
+            *max_inflight = batch.inflight;
+        }
+        if (cmd) {
+            sim_send(now, cmd);
+            continue;
+        }
+        if (gps_cmd_batch_done(&batch)) {
+            break;
+        }
+
+        uint32_t wait_ms = gps_cmd_batch_wait_ms(&batch, (uint32_t)(now / 1000));
+        uint64_t wake = now + (uint64_t)(wait_ms ? wait_ms : 1) * 1000;
+        const sim_resp_t *r = sim_peek();
+
+        if (r && r->at_us <= wake) {
+            size_t text = cmd_text_len(r->cmd);
+
+            now = (r->at_us > now) ? r->at_us : now;
+            gps_cmd_batch_on_response(&batch, r->cmd, text, r->ok);
+            sim.resp_head++;
+        }
+        else {
+            now = wake;
+        }
+    }
+
+    return now;
+}
+
+typedef struct {
+    uint32_t seq_ms;
+    uint32_t pipe_ms;
+    size_t seq_failed;
+    size_t pipe_failed;
+    size_t max_inflight;
+} init_time_t;
+
+static init_time_t measure(const sim_cfg_t *c, const char *name) {
+    init_time_t t;
+    char msg[128];
+
+    sim_reset(c);
+    t.seq_ms = (uint32_t)(run_sequential(base_cmds, BASE_COUNT, &t.seq_failed) / 1000);
+
+    sim_reset(c);
+    t.pipe_ms = (uint32_t)(run_pipelined(base_cmds, BASE_COUNT, &t.max_inflight) / 1000);
+    t.pipe_failed = gps_cmd_batch_failed(&batch);
+
+    snprintf(msg, sizeof(msg), "%s: sequential %u ms, pipelined %u ms (%u sent)", name,
+             (unsigned)t.seq_ms, (unsigned)t.pipe_ms, (unsigned)batch.sent);
+    TEST_MESSAGE(msg);
+
+    return t;
+}
+
+static const sim_cfg_t clean = {
+    .baudrate = 115200,
+    .proc_us = 10000,
+    .rx_queue_max = 8,
+};
+
+/*===========================================================================
+ * Init time
+ *===========================================================================*/
+
+void test_init_time_clean(void) {
+    init_time_t t = measure(&clean, "clean");
+
+    TEST_ASSERT_EQUAL_size_t(0, t.seq_failed);
+    TEST_ASSERT_EQUAL_size_t(0, t.pipe_failed);
+    TEST_ASSERT_EQUAL_UINT32(BASE_COUNT, batch.sent);
+    TEST_ASSERT_LESS_OR_EQUAL_size_t(cfg.window, t.max_inflight);
+    TEST_ASSERT_LESS_THAN_UINT32(t.seq_ms / 5, t.pipe_ms);
+}
+
+void test_init_time_lost_and_transient_error(void) {
+    sim_cfg_t c = clean;
+
+    c.lose_first = base_cmds[3];
+    c.error_first = base_cmds[8];
+
+    init_time_t t = measure(&c, "lost + transient error");
+
+    TEST_ASSERT_EQUAL_size_t(0, t.seq_failed);
+    TEST_ASSERT_EQUAL_size_t(0, t.pipe_failed);
+    TEST_ASSERT_EQUAL_UINT32(BASE_COUNT + 2, batch.sent); /* only the two failed ones again */
+    TEST_ASSERT_LESS_THAN_UINT32(cfg.timeout_ms + 500, t.pipe_ms);
+    TEST_ASSERT_LESS_THAN_UINT32(t.seq_ms, t.pipe_ms);
+}
+
+void test_init_time_rejected_command(void) {
+    sim_cfg_t c = clean;
+
+    c.error_always = base_cmds[5];
+
+    init_time_t t = measure(&c, "rejected command");
+
+    TEST_ASSERT_EQUAL_size_t(1, t.seq_failed);
+    TEST_ASSERT_EQUAL_size_t(1, t.pipe_failed);
+    TEST_ASSERT_EQUAL(GPS_CMD_ST_FAILED, batch.entries[5].state);
+    TEST_ASSERT_TRUE(batch.entries[5].error);
+    TEST_ASSERT_EQUAL_UINT32(BASE_COUNT + 2, batch.sent);
+    TEST_ASSERT_LESS_THAN_UINT32(t.seq_ms, t.pipe_ms);
+}
+
+void test_init_time_small_receiver_queue(void) {
+    sim_cfg_t c = clean;
+
+    c.rx_queue_max = 2; /* smaller than the window: overflow drops are retried */
+
+    init_time_t t = measure(&c, "receiver queue 2");
+
+    TEST_ASSERT_EQUAL_size_t(0, t.pipe_failed);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(cfg.deadline_ms, t.pipe_ms);
+    TEST_ASSERT_LESS_THAN_UINT32(t.seq_ms, t.pipe_ms);
+}
+
+void test_init_time_bounded_without_receiver(void) {
+    sim_cfg_t c = clean;
+
+    c.dead = true;
+
+    init_time_t t = measure(&c, "no receiver");
+
+    TEST_ASSERT_EQUAL_size_t(BASE_COUNT, t.seq_failed);
+    TEST_ASSERT_EQUAL_size_t(BASE_COUNT, t.pipe_failed);
+    TEST_ASSERT_EQUAL_UINT32(BASE_COUNT * (3 * 2000 + 2 * 200 + 100), t.seq_ms);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(cfg.deadline_ms, t.pipe_ms);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_init_rejects_too_many);
+    RUN_TEST(test_empty_batch_is_done);
+    RUN_TEST(test_window_limits_outstanding);
+    RUN_TEST(test_echo_ignores_case_and_line_end);
+    RUN_TEST(test_duplicate_command_matches_oldest);
+    RUN_TEST(test_error_retries_only_that_command);
+    RUN_TEST(test_attempts_exhausted_fails);
+    RUN_TEST(test_send_error_retries_without_waiting);
+    RUN_TEST(test_send_error_exhausts_attempts);
+    RUN_TEST(test_timeout_requeues_and_late_response_accepted);
+    RUN_TEST(test_late_ok_after_error_accepted);
+    RUN_TEST(test_deadline_fails_remaining);
+    RUN_TEST(test_wait_clamped_to_deadline);
+
+    RUN_TEST(test_init_time_clean);
+    RUN_TEST(test_init_time_lost_and_transient_error);
+    RUN_TEST(test_init_time_rejected_command);
+    RUN_TEST(test_init_time_small_receiver_queue);
+    RUN_TEST(test_init_time_bounded_without_receiver);
+
+    return UNITY_END();
+}
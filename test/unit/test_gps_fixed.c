@@ -0,0 +1,225 @@
+/**
+ * @file test_gps_fixed.c
+ * @brief Unit tests for lib/gps/gps_fixed.c
+ *
+ * Target: lib/gps/gps_fixed.c (PURE module)
+ * Tests: DDMM.MMMM -> nanodegree, decimal -> scaled int32,
+ *        bit-exact agreement with the previous atof/double decoding,
+ *        empty / malformed / out-of-range fields
+ */
+
+#include "unity.h"
+#include "gps_fixed.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SWEEP_COUNT 200000
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*===========================================================================
+ * Reference: previous double decoding in gps_nmea.c
+ *===========================================================================*/
+
+static double ref_lat_lon(const char *str) {
+    double val = atof(str);
+    double deg = (double)((int)(val / 100));
+    double min = val - (deg * 100);
+    return deg + (min / 60.0);
+}
+
+static uint32_t lcg_state;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state >> 8;
+}
+
+/*===========================================================================
+ * Lat/lon
+ *===========================================================================*/
+
+void test_ddmm_fixture_values(void) {
+    int64_t ndeg;
+
+    /* 47 + 17.11399/60 = 47.28523316666... */
+    TEST_ASSERT_TRUE(gps_fixed_parse_ddmm("4717.11399,N", &ndeg));
+    TEST_ASSERT_EQUAL_INT64(47285233167LL, ndeg);
+
+    /* 8 + 33.91590/60 = 8.565265 */
+    TEST_ASSERT_TRUE(gps_fixed_parse_ddmm("00833.91590,E", &ndeg));
+    TEST_ASSERT_EQUAL_INT64(8565265000LL, ndeg);
+}
+
+void test_ddmm_full_receiver_precision(void) {
+    int64_t ndeg;
+
+    /* UM982 high-precision output: 7 fractional minute digits */
+    TEST_ASSERT_TRUE(gps_fixed_parse_ddmm("3723.4655123*", &ndeg));
+    TEST_ASSERT_EQUAL_INT64(37391091872LL, ndeg);
+
+    /* Longitude with three degree digits */
+    TEST_ASSERT_TRUE(gps_fixed_parse_ddmm("12658.1234567,", &ndeg));
+    TEST_ASSERT_EQUAL_INT64(126968724278LL, ndeg);
+}
+
+void test_ddmm_extra_digits_ignored(void) {
+    int64_t a, b;
+
+    /* Digits past 1e-9 minute do not change the nanodegree result */
+    TEST_ASSERT_TRUE(gps_fixed_parse_ddmm("4717.123456789", &a));
+    TEST_ASSERT_TRUE(gps_fixed_parse_ddmm("4717.12345678912345", &b));
+    TEST_ASSERT_EQUAL_INT64(a, b);
+}
+
+void test_ddmm_matches_double_bit_exact(void) {
+    char str[32];
+    int64_t ndeg;
+
+    lcg_state = 12345;
+
+    for (int i = 0; i < SWEEP_COUNT; i++) {
+        unsigned deg = lcg_next() % 180;
+        unsigned min = lcg_next() % 60;
+        unsigned digits = 1 + lcg_next() % 7; /* 8+ digits can land exactly on .5 */
+        unsigned frac = lcg_next() % (unsigned)pow(10, digits);
+
+        snprintf(str, sizeof(str), "%03u%02u.%0*u,", deg, min, (int)digits, frac);
+
+        TEST_ASSERT_TRUE(gps_fixed_parse_ddmm(str, &ndeg));
+        if (llround(ref_lat_lon(str) * 1e9) != ndeg) {
+            TEST_FAIL_MESSAGE(str);
+        }
+    }
+}
+
+/*===========================================================================
+ * Decimal
+ *===========================================================================*/
+
+void test_decimal_fixture_values(void) {
+    int32_t v;
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("499.6,M", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(499600, v);
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("1.01,", 2, &v));
+    TEST_ASSERT_EQUAL_INT32(101, v);
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("270.50,A", 6, &v));
+    TEST_ASSERT_EQUAL_INT32(270500000, v);
+}
+
+void test_decimal_negative_and_integer(void) {
+    int32_t v;
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("-12.345,M", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(-12345, v);
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("48,M", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(48000, v);
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal(".5*", 1, &v));
+    TEST_ASSERT_EQUAL_INT32(5, v);
+}
+
+void test_decimal_rounds_half_away_from_zero(void) {
+    int32_t v;
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("1.2345", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(1235, v);
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("1.23449", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(1234, v);
+
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("-1.2345", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(-1235, v);
+}
+
+void test_decimal_matches_double_bit_exact(void) {
+    char str[32];
+    int32_t v;
+
+    lcg_state = 777;
+
+    for (int i = 0; i < SWEEP_COUNT; i++) {
+        int ip = (int)(lcg_next() % 100000) - 10000;
+        unsigned digits = lcg_next() % 4;
+        unsigned frac = lcg_next() % (unsigned)pow(10, digits);
+
+        if (digits == 0) {
+            snprintf(str, sizeof(str), "%d,", ip);
+        }
+        else {
+            snprintf(str, sizeof(str), "%d.%0*u,", ip, (int)digits, frac);
+        }
+
+        TEST_ASSERT_TRUE(gps_fixed_parse_decimal(str, 3, &v));
+        if (llround(atof(str) * 1000.0) != v) {
+            TEST_FAIL_MESSAGE(str);
+        }
+    }
+}
+
+/*===========================================================================
+ * Rejection
+ *===========================================================================*/
+
+void test_empty_fields_rejected(void) {
+    int64_t ndeg = 1;
+    int32_t v = 1;
+
+    TEST_ASSERT_FALSE(gps_fixed_parse_ddmm(",N", &ndeg));
+    TEST_ASSERT_EQUAL_INT64(0, ndeg);
+    TEST_ASSERT_FALSE(gps_fixed_parse_ddmm("*5B", &ndeg));
+    TEST_ASSERT_FALSE(gps_fixed_parse_ddmm(".", &ndeg));
+
+    TEST_ASSERT_FALSE(gps_fixed_parse_decimal(",M", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(0, v);
+    TEST_ASSERT_FALSE(gps_fixed_parse_decimal("-,", 3, &v));
+}
+
+void test_out_of_range_rejected(void) {
+    int64_t ndeg;
+    int32_t v;
+
+    /* More than DDDMM integer digits */
+    TEST_ASSERT_FALSE(gps_fixed_parse_ddmm("123456.0", &ndeg));
+
+    /* 2147483.648 m does not fit in int32 mm */
+    TEST_ASSERT_FALSE(gps_fixed_parse_decimal("2147483.648", 3, &v));
+    TEST_ASSERT_TRUE(gps_fixed_parse_decimal("2147483.647", 3, &v));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, v);
+    TEST_ASSERT_FALSE(gps_fixed_parse_decimal("99999999999", 0, &v));
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Lat/lon */
+    RUN_TEST(test_ddmm_fixture_values);
+    RUN_TEST(test_ddmm_full_receiver_precision);
+    RUN_TEST(test_ddmm_extra_digits_ignored);
+    RUN_TEST(test_ddmm_matches_double_bit_exact);
+
+    /* Decimal */
+    RUN_TEST(test_decimal_fixture_values);
+    RUN_TEST(test_decimal_negative_and_integer);
+    RUN_TEST(test_decimal_rounds_half_away_from_zero);
+    RUN_TEST(test_decimal_matches_double_bit_exact);
+
+    /* Rejection */
+    RUN_TEST(test_empty_fields_rejected);
+    RUN_TEST(test_out_of_range_rejected);
+
+    return UNITY_END();
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test_gps_unicore_bin.c
+ * @brief Unit tests for lib/gps/gps_unicore_bin.c
+ *
+ * Target: lib/gps/gps_unicore_bin.c (PURE module)
+ * Dependencies: crc.c, ringbuffer.c, gps_frame_scan_crc (gps_parser.h)
+ *
+ * Tests: header/BESTNAV/HEADING2 accessors on UM982 frames, bit-exact
+ *        agreement with the previous memcpy-into-struct decoding, frames
+ *        split at every offset (ring wrap), CRC32 through the resumable
+ *        scan the parser uses (chunked delivery, corrupted bytes)
+ */
+
+#include "unity.h"
+#include "gps_unicore_bin.h"
+#include "gps_parser.h"
+#include "crc.h"
+#include "unicore/unicore_fixture.h"
+#include <string.h>
+
+static gps_unicore_bin_frame_t frame;
+
+void setUp(void) {
+    memset(&frame, 0, sizeof(frame));
+}
+
+void tearDown(void) {
+}
+
+/* Frame view over one contiguous buffer, or split in two at `split` */
+static void view(const uint8_t *buf, size_t len, size_t split) {
+    ringbuffer_span_t spans[2] = {
+        {(const char *)buf, split ? split : len},
+        {(const char *)buf + split, len - split},
+    };
+
+    gps_unicore_bin_frame_init(&frame, spans, split ? 2 : 1);
+}
+
+/* Deliver `buf` into a ring that wraps `split` bytes in (0: no wrap), `step` bytes at a
+ * time, running the resumable CRC32 scan after each chunk like unicore_bin_try_parse */
+static char ring_mem[256];
+static ringbuffer_t rb;
+static gps_frame_scan_t scan;
+
+static void ring_feed(const uint8_t *buf, size_t len, size_t split, size_t step) {
+    static const char fill[sizeof(ring_mem)];
+    size_t lead = split ? sizeof(ring_mem) - split : 0;
+    size_t body_len = len - GPS_UNICORE_BIN_CRC_SIZE;
+    ringbuffer_span_t spans[2];
+
+    ringbuffer_init(&rb, ring_mem, sizeof(ring_mem));
+    if (lead) {
+        ringbuffer_write(&rb, fill, lead);
+        ringbuffer_advance(&rb, lead);
+    }
+    memset(&scan, 0, sizeof(scan));
+
+    for (size_t off = 0; off < len; off += step) {
+        size_t n = (len - off < step) ? len - off : step;
+
+        ringbuffer_write(&rb, (const char *)buf + off, n);
+        gps_frame_scan_crc(&scan, &rb, body_len, crc32_update);
+    }
+
+    gps_unicore_bin_frame_init(&frame, spans, ringbuffer_peek_spans(&rb, 0, len, spans));
+}
+
+static bool scan_crc_ok(void) {
+    return scan.crc == gps_unicore_bin_u32(&frame, frame.len - GPS_UNICORE_BIN_CRC_SIZE);
+}
+
+/*===========================================================================
+ * Reference: previous decoding (memcpy payload into the packed struct)
+ *===========================================================================*/
+
+static hpd_unicore_bestnavb_t ref_bestnav(void) {
+    hpd_unicore_bestnavb_t nav;
+    memcpy(&nav, UNICORE_BESTNAV_RTK_FIX + GPS_UNICORE_BIN_HEADER_SIZE, sizeof(nav));
+    return nav;
+}
+
+static hpd_unicore_heading2b_t ref_heading2(void) {
+    hpd_unicore_heading2b_t hd;
+    memcpy(&hd, UNICORE_HEADING2_FIXED + GPS_UNICORE_BIN_HEADER_SIZE, sizeof(hd));
+    return hd;
+}
+
+static void assert_bestnav_matches_ref(void) {
+    hpd_unicore_bestnavb_t nav = ref_bestnav();
+
+    TEST_ASSERT_EQUAL_UINT32(nav.pos_type, gps_unicore_bestnav_pos_type(&frame));
+    TEST_ASSERT_EQUAL_MEMORY(&nav.lat, &(double){gps_unicore_bestnav_lat(&frame)}, 8);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.lon, &(double){gps_unicore_bestnav_lon(&frame)}, 8);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.height, &(double){gps_unicore_bestnav_height(&frame)}, 8);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.lat_dev, &(float){gps_unicore_bestnav_lat_dev(&frame)}, 4);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.lon_dev, &(float){gps_unicore_bestnav_lon_dev(&frame)}, 4);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.height_dev, &(float){gps_unicore_bestnav_height_dev(&frame)},
+                             4);
+    TEST_ASSERT_EQUAL_UINT8(nav.sv, gps_unicore_bestnav_sv(&frame));
+    TEST_ASSERT_EQUAL_UINT8(nav.used_sv, gps_unicore_bestnav_used_sv(&frame));
+    TEST_ASSERT_EQUAL_MEMORY(&nav.hor_speed, &(double){gps_unicore_bestnav_hor_speed(&frame)}, 8);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.trk_gnd, &(double){gps_unicore_bestnav_trk_gnd(&frame)}, 8);
+    TEST_ASSERT_EQUAL_MEMORY(&nav.vert_speed, &(double){gps_unicore_bestnav_vert_speed(&frame)},
+                             8);
+}
+
+static void assert_heading2_matches_ref(void) {
+    hpd_unicore_heading2b_t hd = ref_heading2();
+
+    TEST_ASSERT_EQUAL_UINT32(hd.sol_status, gps_unicore_heading2_sol_status(&frame));
+    TEST_ASSERT_EQUAL_UINT32(hd.pos_type, gps_unicore_heading2_pos_type(&frame));
+    TEST_ASSERT_EQUAL_MEMORY(&hd.length, &(float){gps_unicore_heading2_length(&frame)}, 4);
+    TEST_ASSERT_EQUAL_MEMORY(&hd.heading, &(float){gps_unicore_heading2_heading(&frame)}, 4);
+    TEST_ASSERT_EQUAL_MEMORY(&hd.pitch, &(float){gps_unicore_heading2_pitch(&frame)}, 4);
+    TEST_ASSERT_EQUAL_MEMORY(&hd.heading_dev, &(float){gps_unicore_heading2_heading_dev(&frame)},
+                             4);
+    TEST_ASSERT_EQUAL_MEMORY(&hd.pitch_dev, &(float){gps_unicore_heading2_pitch_dev(&frame)}, 4);
+    TEST_ASSERT_EQUAL_UINT8(hd.sv, gps_unicore_heading2_sv(&frame));
+    TEST_ASSERT_EQUAL_UINT8(hd.used_sv, gps_unicore_heading2_used_sv(&frame));
+}
+
+/*===========================================================================
+ * Accessors
+ *===========================================================================*/
+
+void test_header_fields(void) {
+    view(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX), 0);
+
+    TEST_ASSERT_EQUAL(sizeof(UNICORE_BESTNAV_RTK_FIX), frame.len);
+    TEST_ASSERT_EQUAL_UINT16(2118, gps_unicore_bin_msg_id(&frame));
+    TEST_ASSERT_EQUAL_UINT16(120, gps_unicore_bin_msg_len(&frame));
+    TEST_ASSERT_EQUAL_UINT16(2345, gps_unicore_bin_week(&frame));
+    TEST_ASSERT_EQUAL_UINT32(377100000, gps_unicore_bin_tow_ms(&frame));
+}
+
+void test_bestnav_fields(void) {
+    view(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX), 0);
+
+    TEST_ASSERT_EQUAL_UINT32(50, gps_unicore_bestnav_pos_type(&frame)); /* NARROW_INT */
+    TEST_ASSERT_EQUAL_DOUBLE(37.395217812, gps_unicore_bestnav_lat(&frame));
+    TEST_ASSERT_EQUAL_DOUBLE(126.946206745, gps_unicore_bestnav_lon(&frame));
+    TEST_ASSERT_EQUAL_DOUBLE(52.3104, gps_unicore_bestnav_height(&frame));
+    TEST_ASSERT_EQUAL_FLOAT(0.0091f, gps_unicore_bestnav_lat_dev(&frame));
+    TEST_ASSERT_EQUAL_UINT8(32, gps_unicore_bestnav_sv(&frame));
+    TEST_ASSERT_EQUAL_UINT8(30, gps_unicore_bestnav_used_sv(&frame));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0213, gps_unicore_bestnav_hor_speed(&frame));
+    TEST_ASSERT_EQUAL_DOUBLE(271.4, gps_unicore_bestnav_trk_gnd(&frame));
+    TEST_ASSERT_EQUAL_DOUBLE(-0.0042, gps_unicore_bestnav_vert_speed(&frame));
+
+    assert_bestnav_matches_ref();
+}
+
+void test_heading2_fields(void) {
+    view(UNICORE_HEADING2_FIXED, sizeof(UNICORE_HEADING2_FIXED), 0);
+
+    TEST_ASSERT_EQUAL_UINT16(2120, gps_unicore_bin_msg_id(&frame));
+    TEST_ASSERT_EQUAL_UINT32(50, gps_unicore_heading2_pos_type(&frame));
+    TEST_ASSERT_EQUAL_FLOAT(1.2043f, gps_unicore_heading2_length(&frame));
+    TEST_ASSERT_EQUAL_FLOAT(271.38211f, gps_unicore_heading2_heading(&frame));
+    TEST_ASSERT_EQUAL_FLOAT(-0.4127f, gps_unicore_heading2_pitch(&frame));
+    TEST_ASSERT_EQUAL_UINT8(32, gps_unicore_heading2_sv(&frame));
+    TEST_ASSERT_EQUAL_UINT8(28, gps_unicore_heading2_used_sv(&frame));
+
+    assert_heading2_matches_ref();
+}
+
+/*===========================================================================
+ * Ring wrap
+ *===========================================================================*/
+
+void test_bestnav_split_at_every_offset(void) {
+    for (size_t split = 1; split < sizeof(UNICORE_BESTNAV_RTK_FIX); split++) {
+        view(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX), split);
+
+        TEST_ASSERT_EQUAL_UINT16(2118, gps_unicore_bin_msg_id(&frame));
+        assert_bestnav_matches_ref();
+    }
+}
+
+void test_heading2_split_at_every_offset(void) {
+    for (size_t split = 1; split < sizeof(UNICORE_HEADING2_FIXED); split++) {
+        view(UNICORE_HEADING2_FIXED, sizeof(UNICORE_HEADING2_FIXED), split);
+
+        assert_heading2_matches_ref();
+    }
+}
+
+void test_frame_from_ringbuffer_spans(void) {
+    ring_feed(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX), 56,
+              sizeof(UNICORE_BESTNAV_RTK_FIX));
+
+    TEST_ASSERT_EQUAL(56, frame.spans[0].len);
+    TEST_ASSERT_EQUAL(sizeof(UNICORE_BESTNAV_RTK_FIX) - 56, frame.spans[1].len);
+    TEST_ASSERT_TRUE(scan_crc_ok());
+    assert_bestnav_matches_ref();
+}
+
+/*===========================================================================
+ * CRC (resumable scan)
+ *===========================================================================*/
+
+void test_crc_ok_on_recorded_frames(void) {
+    ring_feed(UNICORE_BESTNAV_RTK_FIX, sizeof(UNICORE_BESTNAV_RTK_FIX), 0,
+              sizeof(UNICORE_BESTNAV_RTK_FIX));
+    TEST_ASSERT_TRUE(scan_crc_ok());
+
+    ring_feed(UNICORE_HEADING2_FIXED, sizeof(UNICORE_HEADING2_FIXED), 0,
+              sizeof(UNICORE_HEADING2_FIXED));
+    TEST_ASSERT_TRUE(scan_crc_ok());
+}
+
+void test_crc_ok_split_and_chunked(void) {
+    size_t len = sizeof(UNICORE_BESTNAV_RTK_FIX);
+
+    for (size_t split = 1; split < len; split += 7) {
+        for (size_t step = 1; step <= 64; step *= 4) {
+            ring_feed(UNICORE_BESTNAV_RTK_FIX, len, split, step);
+
+            TEST_ASSERT_TRUE(scan_crc_ok());
+            TEST_ASSERT_EQUAL(len - GPS_UNICORE_BIN_CRC_SIZE, scan.scan_pos);
+            assert_bestnav_matches_ref();
+        }
+    }
+}
+
+void test_crc_rejects_corrupted_byte(void) {
+    uint8_t buf[sizeof(UNICORE_HEADING2_FIXED)];
+
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        memcpy(buf, UNICORE_HEADING2_FIXED, sizeof(buf));
+        buf[i] ^= 0x10;
+        ring_feed(buf, sizeof(buf), sizeof(buf) / 2, 16);
+        TEST_ASSERT_FALSE(scan_crc_ok());
+    }
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Accessors */
+    RUN_TEST(test_header_fields);
+    RUN_TEST(test_bestnav_fields);
+    RUN_TEST(test_heading2_fields);
+
+    /* Ring wrap */
+    RUN_TEST(test_bestnav_split_at_every_offset);
+    RUN_TEST(test_heading2_split_at_every_offset);
+    RUN_TEST(test_frame_from_ringbuffer_spans);
+
+    /* CRC (resumable scan) */
+    RUN_TEST(test_crc_ok_on_recorded_frames);
+    RUN_TEST(test_crc_ok_split_and_chunked);
+    RUN_TEST(test_crc_rejects_corrupted_byte);
+
+    return UNITY_END();
+}
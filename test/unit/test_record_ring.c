@@ -0,0 +1,275 @@
+/**
+ * @file test_record_ring.c
+ * @brief Unit tests for lib/utils/src/record_ring.c
+ *
+ * Target: lib/utils/src/record_ring.c (PURE module)
+ * Tests: push/peek/pop, header fields, reserve/commit in place,
+ *        wrap marker (records never split), whole-record drop on full,
+ *        producer/consumer threads
+ */
+
+#include "unity.h"
+#include "record_ring.h"
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define TEST_BUF_SIZE 128
+
+static record_ring_t rr;
+static uint32_t buf[TEST_BUF_SIZE / sizeof(uint32_t)];
+
+void setUp(void) {
+    memset(buf, 0, sizeof(buf));
+    record_ring_init(&rr, buf, sizeof(buf));
+}
+
+void tearDown(void) {
+}
+
+/* Payload pointer must lie inside ring memory and the record must not wrap */
+static void assert_in_place(const record_ring_hdr_t *hdr) {
+    const uint8_t *start = (const uint8_t *)buf;
+    const uint8_t *payload = record_ring_payload(hdr);
+
+    TEST_ASSERT_TRUE(payload >= start);
+    TEST_ASSERT_TRUE(payload + hdr->len <= start + sizeof(buf));
+}
+
+/*===========================================================================
+ * Basic
+ *===========================================================================*/
+
+void test_init_empty(void) {
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+    TEST_ASSERT_NULL(record_ring_peek(&rr));
+    TEST_ASSERT_FALSE(record_ring_pop(&rr));
+}
+
+void test_push_peek_pop(void) {
+    TEST_ASSERT_TRUE(record_ring_push(&rr, "\xD3\x00\x13", 3, 1005, 1234));
+
+    const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL(3, hdr->len);
+    TEST_ASSERT_EQUAL(1005, hdr->type);
+    TEST_ASSERT_EQUAL(1234, hdr->timestamp);
+    TEST_ASSERT_EQUAL_MEMORY("\xD3\x00\x13", record_ring_payload(hdr), 3);
+
+    /* Peek does not consume */
+    TEST_ASSERT_EQUAL_PTR(hdr, record_ring_peek(&rr));
+
+    TEST_ASSERT_TRUE(record_ring_pop(&rr));
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+}
+
+void test_records_keep_fifo_order(void) {
+    record_ring_push(&rr, "AAAA", 4, 1, 0);
+    record_ring_push(&rr, "BB", 2, 2, 0);
+    record_ring_push(&rr, "C", 1, 3, 0);
+
+    for (uint16_t type = 1; type <= 3; type++) {
+        const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+        TEST_ASSERT_NOT_NULL(hdr);
+        TEST_ASSERT_EQUAL(type, hdr->type);
+        record_ring_pop(&rr);
+    }
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+}
+
+void test_reserve_commit_in_place(void) {
+    uint8_t *dst = record_ring_reserve(&rr, 16);
+    TEST_ASSERT_NOT_NULL(dst);
+
+    /* Not visible before commit */
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+
+    memcpy(dst, "0123456789", 10);
+    record_ring_commit(&rr, 10, 7, 99);
+
+    const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL(10, hdr->len);
+    TEST_ASSERT_EQUAL_PTR(dst, record_ring_payload(hdr));
+    TEST_ASSERT_EQUAL_MEMORY("0123456789", record_ring_payload(hdr), 10);
+}
+
+/*===========================================================================
+ * Wrap / Full
+ *===========================================================================*/
+
+void test_record_never_split_across_wrap(void) {
+    uint8_t data[40];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)i;
+    }
+
+    /* 2 x (8 + 40) = 96 bytes used, 32 bytes left before the end */
+    record_ring_push(&rr, data, sizeof(data), 1, 0);
+    record_ring_push(&rr, data, sizeof(data), 2, 0);
+    record_ring_pop(&rr);
+    record_ring_pop(&rr);
+
+    /* 48-byte footprint does not fit in the last 32 bytes: goes to buf[0] */
+    TEST_ASSERT_TRUE(record_ring_push(&rr, data, sizeof(data), 3, 0));
+
+    const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL(3, hdr->type);
+    TEST_ASSERT_EQUAL_PTR(buf, hdr);
+    assert_in_place(hdr);
+    TEST_ASSERT_EQUAL_MEMORY(data, record_ring_payload(hdr), sizeof(data));
+
+    TEST_ASSERT_TRUE(record_ring_pop(&rr));
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+}
+
+void test_full_drops_whole_record(void) {
+    uint8_t data[56];
+    memset(data, 0x5A, sizeof(data));
+
+    /* Each record takes 64 bytes: two fill the 128-byte ring */
+    TEST_ASSERT_TRUE(record_ring_push(&rr, data, sizeof(data), 1, 0));
+    TEST_ASSERT_TRUE(record_ring_push(&rr, data, sizeof(data), 2, 0));
+    TEST_ASSERT_FALSE(record_ring_push(&rr, data, 1, 3, 0));
+    TEST_ASSERT_EQUAL(1, record_ring_get_drop_count(&rr));
+
+    /* Existing records untouched */
+    const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+    TEST_ASSERT_EQUAL(1, hdr->type);
+    TEST_ASSERT_EQUAL(sizeof(data), hdr->len);
+}
+
+void test_wrap_needs_room_for_skipped_tail(void) {
+    uint8_t data[40];
+    memset(data, 0x11, sizeof(data));
+
+    /* head at 96, tail at 48: 80 bytes free but only 32 before the end */
+    record_ring_push(&rr, data, sizeof(data), 1, 0);
+    record_ring_push(&rr, data, sizeof(data), 2, 0);
+    record_ring_pop(&rr);
+
+    /* 32 skipped + 48 footprint = 80: fits exactly */
+    TEST_ASSERT_TRUE(record_ring_push(&rr, data, sizeof(data), 3, 0));
+    TEST_ASSERT_NULL(record_ring_reserve(&rr, 1));
+
+    TEST_ASSERT_EQUAL(2, record_ring_peek(&rr)->type);
+    record_ring_pop(&rr);
+    TEST_ASSERT_EQUAL(3, record_ring_peek(&rr)->type);
+    record_ring_pop(&rr);
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+}
+
+void test_oversized_record_dropped(void) {
+    TEST_ASSERT_NULL(record_ring_reserve(&rr, TEST_BUF_SIZE));
+    TEST_ASSERT_EQUAL(1, record_ring_get_drop_count(&rr));
+}
+
+void test_many_cycles_with_varying_sizes(void) {
+    uint8_t data[50];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 3);
+    }
+
+    for (uint32_t n = 0; n < 1000; n++) {
+        size_t len = (n * 7) % sizeof(data);
+        TEST_ASSERT_TRUE(record_ring_push(&rr, data, len, (uint16_t)n, n));
+
+        const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+        TEST_ASSERT_NOT_NULL(hdr);
+        TEST_ASSERT_EQUAL(len, hdr->len);
+        TEST_ASSERT_EQUAL(n, hdr->timestamp);
+        assert_in_place(hdr);
+        if (len > 0) {
+            TEST_ASSERT_EQUAL_MEMORY(data, record_ring_payload(hdr), len);
+        }
+        record_ring_pop(&rr);
+    }
+    TEST_ASSERT_EQUAL(0, record_ring_get_drop_count(&rr));
+}
+
+/*===========================================================================
+ * Concurrency
+ *===========================================================================*/
+
+#define STREAM_RECORDS 20000
+
+static void *producer_thread(void *arg) {
+    (void)arg;
+    uint8_t payload[37];
+
+    for (uint32_t n = 0; n < STREAM_RECORDS;) {
+        size_t len = n % sizeof(payload);
+        memset(payload, (int)(n & 0xFF), len);
+        if (record_ring_push(&rr, payload, len, (uint16_t)n, n)) {
+            n++;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *consumer_thread(void *arg) {
+    (void)arg;
+
+    for (uint32_t n = 0; n < STREAM_RECORDS;) {
+        const record_ring_hdr_t *hdr = record_ring_peek(&rr);
+        if (hdr == NULL) {
+            sched_yield();
+            continue;
+        }
+        if (hdr->timestamp != n || hdr->len != n % 37) {
+            return (void *)1;
+        }
+        const uint8_t *p = record_ring_payload(hdr);
+        for (size_t i = 0; i < hdr->len; i++) {
+            if (p[i] != (uint8_t)(n & 0xFF)) {
+                return (void *)2;
+            }
+        }
+        record_ring_pop(&rr);
+        n++;
+    }
+    return NULL;
+}
+
+void test_spsc_concurrent_records_intact(void) {
+    pthread_t prod, cons;
+    void *result;
+
+    pthread_create(&cons, NULL, consumer_thread, NULL);
+    pthread_create(&prod, NULL, producer_thread, NULL);
+    pthread_join(prod, NULL);
+    pthread_join(cons, &result);
+
+    TEST_ASSERT_NULL(result);
+    TEST_ASSERT_TRUE(record_ring_is_empty(&rr));
+}
+
+/*===========================================================================
+ * Runner
+ *===========================================================================*/
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Basic */
+    RUN_TEST(test_init_empty);
+    RUN_TEST(test_push_peek_pop);
+    RUN_TEST(test_records_keep_fifo_order);
+    RUN_TEST(test_reserve_commit_in_place);
+
+    /* Wrap / Full */
+    RUN_TEST(test_record_never_split_across_wrap);
+    RUN_TEST(test_full_drops_whole_record);
+    RUN_TEST(test_wrap_needs_room_for_skipped_tail);
+    RUN_TEST(test_oversized_record_dropped);
+    RUN_TEST(test_many_cycles_with_varying_sizes);
+
+    /* Concurrency */
+    RUN_TEST(test_spsc_concurrent_records_intact);
+
+    return UNITY_END();
+}
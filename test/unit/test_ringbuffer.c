@@ -4,13 +4,18 @@
  *
  * Target: lib/utils/src/ringbuffer.c (PURE module)
  * Tests: init, write, read, peek, advance, wrap-around, overflow,
- *        ringbuffer_find_char (defined in gps_parser.c)
+ *        free-running index wrap,
+ *        SPSC mode (drop-on-full, producer/consumer threads),
+ *        DMA mode (position publish, wrap, consumer overrun resync),
+ *        zero-copy spans (peek_spans / consume / reserve / commit),
+ *        search (find_char / find_any_of / find_seq)
  */
 
 #include "unity.h"
 #include "ringbuffer.h"
-#include "gps_parser.h" /* ringbuffer_find_char */
 #include <string.h>
+#include <pthread.h>
+#include <sched.h>
 
 #define TEST_BUF_SIZE 64
 
@@ -220,7 +225,371 @@ void test_advance_beyond_available_resets(void) {
 }
 
 /*===========================================================================
- * ringbuffer_find_char (from gps_parser.c)
+ * Free-running indices
+ *===========================================================================*/
+
+void test_index_counter_wraps_size_max(void) {
+    /* Start both indices just below SIZE_MAX so head overflows past zero */
+    rb.head = (size_t)-3;
+    rb.tail = (size_t)-3;
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+
+    ringbuffer_write(&rb, "ABCDEF", 6);
+    TEST_ASSERT_EQUAL(6, ringbuffer_size(&rb));
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1 - 6, ringbuffer_free_size(&rb));
+
+    char out[8] = {0};
+    TEST_ASSERT_TRUE(ringbuffer_peek(&rb, out, 6, 0));
+    TEST_ASSERT_EQUAL_MEMORY("ABCDEF", out, 6);
+
+    TEST_ASSERT_EQUAL(6, ringbuffer_read(&rb, out, 6));
+    TEST_ASSERT_EQUAL_MEMORY("ABCDEF", out, 6);
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+}
+
+void test_full_after_many_cycles(void) {
+    char chunk[40];
+    memset(chunk, 'c', sizeof(chunk));
+
+    /* Run the indices far past the buffer size */
+    for (int i = 0; i < 100; i++) {
+        ringbuffer_write(&rb, chunk, sizeof(chunk));
+        ringbuffer_advance(&rb, sizeof(chunk));
+    }
+
+    char big[63];
+    memset(big, 'F', sizeof(big));
+    ringbuffer_write(&rb, big, 63);
+    TEST_ASSERT_TRUE(ringbuffer_is_full(&rb));
+    TEST_ASSERT_FALSE(ringbuffer_is_overflow(&rb));
+    TEST_ASSERT_EQUAL(63, ringbuffer_size(&rb));
+}
+
+/*===========================================================================
+ * Zero-copy spans
+ *===========================================================================*/
+
+void test_peek_spans_contiguous(void) {
+    ringbuffer_write(&rb, "HELLO", 5);
+
+    ringbuffer_span_t spans[2];
+    TEST_ASSERT_EQUAL(1, ringbuffer_peek_spans(&rb, 1, 3, spans));
+    TEST_ASSERT_EQUAL(3, spans[0].len);
+    TEST_ASSERT_EQUAL_MEMORY("ELL", spans[0].data, 3);
+    /* Points into ring memory, not a copy */
+    TEST_ASSERT_EQUAL_PTR(&buf[1], spans[0].data);
+}
+
+void test_peek_spans_wrap_around(void) {
+    char fill[60];
+    memset(fill, 'x', sizeof(fill));
+    ringbuffer_write(&rb, fill, 60);
+    ringbuffer_advance(&rb, 60);
+
+    ringbuffer_write(&rb, "ABCDEFGH", 8);
+
+    ringbuffer_span_t spans[2];
+    TEST_ASSERT_EQUAL(2, ringbuffer_peek_spans(&rb, 0, 8, spans));
+    TEST_ASSERT_EQUAL(4, spans[0].len);
+    TEST_ASSERT_EQUAL_MEMORY("ABCD", spans[0].data, 4);
+    TEST_ASSERT_EQUAL(4, spans[1].len);
+    TEST_ASSERT_EQUAL_MEMORY("EFGH", spans[1].data, 4);
+    TEST_ASSERT_EQUAL_PTR(&buf[0], spans[1].data);
+}
+
+void test_peek_spans_insufficient(void) {
+    ringbuffer_write(&rb, "AB", 2);
+
+    ringbuffer_span_t spans[2];
+    TEST_ASSERT_EQUAL(0, ringbuffer_peek_spans(&rb, 0, 3, spans));
+    TEST_ASSERT_EQUAL(0, ringbuffer_peek_spans(&rb, 2, 1, spans));
+    TEST_ASSERT_EQUAL(0, ringbuffer_peek_spans(&rb, 0, 0, spans));
+}
+
+void test_consume_basic_and_insufficient(void) {
+    ringbuffer_write(&rb, "ABCDE", 5);
+
+    TEST_ASSERT_TRUE(ringbuffer_consume(&rb, 2));
+    TEST_ASSERT_EQUAL(3, ringbuffer_size(&rb));
+
+    /* Unlike advance, consume leaves the buffer untouched on failure */
+    TEST_ASSERT_FALSE(ringbuffer_consume(&rb, 4));
+    TEST_ASSERT_EQUAL(3, ringbuffer_size(&rb));
+
+    char c;
+    ringbuffer_peek_byte(&rb, &c);
+    TEST_ASSERT_EQUAL_CHAR('C', c);
+}
+
+void test_reserve_commit(void) {
+    char *p;
+    size_t n = ringbuffer_reserve(&rb, &p);
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1, n);
+    TEST_ASSERT_EQUAL_PTR(&buf[0], p);
+
+    memcpy(p, "XYZ", 3);
+    ringbuffer_commit(&rb, 3);
+    TEST_ASSERT_EQUAL(3, ringbuffer_size(&rb));
+
+    char out[4] = {0};
+    ringbuffer_read(&rb, out, 3);
+    TEST_ASSERT_EQUAL_MEMORY("XYZ", out, 3);
+}
+
+void test_reserve_stops_at_wrap(void) {
+    char fill[60];
+    memset(fill, 'x', sizeof(fill));
+    ringbuffer_write(&rb, fill, 60);
+    ringbuffer_advance(&rb, 58);
+
+    /* head = 60: only 4 contiguous bytes before the end of memory */
+    char *p;
+    TEST_ASSERT_EQUAL(4, ringbuffer_reserve(&rb, &p));
+    TEST_ASSERT_EQUAL_PTR(&buf[60], p);
+    memcpy(p, "ABCD", 4);
+    ringbuffer_commit(&rb, 4);
+
+    /* Wrapped: remaining free space starts at buf[0] */
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1 - 6, ringbuffer_reserve(&rb, &p));
+    TEST_ASSERT_EQUAL_PTR(&buf[0], p);
+
+    char out[6] = {0};
+    ringbuffer_read(&rb, out, 6);
+    TEST_ASSERT_EQUAL_MEMORY("xxABCD", out, 6);
+}
+
+void test_reserve_full_returns_zero(void) {
+    char big[63];
+    memset(big, 'F', sizeof(big));
+    ringbuffer_write(&rb, big, 63);
+
+    char *p;
+    TEST_ASSERT_EQUAL(0, ringbuffer_reserve(&rb, &p));
+}
+
+/*===========================================================================
+ * SPSC mode
+ *===========================================================================*/
+
+void test_spsc_write_drops_excess(void) {
+    ringbuffer_set_mode(&rb, RINGBUFFER_MODE_SPSC);
+
+    char big[40];
+    memset(big, 'A', sizeof(big));
+    TEST_ASSERT_EQUAL(40, ringbuffer_write(&rb, big, 40));
+
+    /* 23 bytes free: 17 bytes dropped, tail must not move */
+    memset(big, 'B', sizeof(big));
+    TEST_ASSERT_EQUAL(23, ringbuffer_write(&rb, big, 40));
+    TEST_ASSERT_TRUE(ringbuffer_is_full(&rb));
+    TEST_ASSERT_TRUE(ringbuffer_is_overflow(&rb));
+    TEST_ASSERT_EQUAL(17, ringbuffer_get_overflow_count(&rb));
+
+    /* Oldest data is preserved */
+    char c;
+    TEST_ASSERT_TRUE(ringbuffer_read_byte(&rb, &c));
+    TEST_ASSERT_EQUAL_CHAR('A', c);
+}
+
+void test_spsc_write_when_full_returns_zero(void) {
+    ringbuffer_set_mode(&rb, RINGBUFFER_MODE_SPSC);
+
+    char big[63];
+    memset(big, 'F', sizeof(big));
+    TEST_ASSERT_EQUAL(63, ringbuffer_write(&rb, big, 63));
+    TEST_ASSERT_FALSE(ringbuffer_is_overflow(&rb));
+
+    TEST_ASSERT_EQUAL(0, ringbuffer_write(&rb, "XY", 2));
+    TEST_ASSERT_FALSE(ringbuffer_write_byte(&rb, 'Z'));
+    TEST_ASSERT_EQUAL(3, ringbuffer_get_overflow_count(&rb));
+    TEST_ASSERT_EQUAL(63, ringbuffer_size(&rb));
+}
+
+void test_spsc_advance_beyond_available_keeps_head(void) {
+    ringbuffer_set_mode(&rb, RINGBUFFER_MODE_SPSC);
+
+    ringbuffer_write(&rb, "ABCDE", 5);
+    TEST_ASSERT_FALSE(ringbuffer_advance(&rb, 10));
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+
+    /* Producer position survives: next write continues after old data */
+    ringbuffer_write(&rb, "XY", 2);
+    char out[4] = {0};
+    TEST_ASSERT_EQUAL(2, ringbuffer_read(&rb, out, 2));
+    TEST_ASSERT_EQUAL_MEMORY("XY", out, 2);
+    TEST_ASSERT_EQUAL_PTR(&buf[5], &rb.buffer[rb.head - 2]);
+}
+
+#define SPSC_STRESS_BYTES 100000
+
+static void *spsc_producer(void *arg) {
+    (void)arg;
+    uint32_t seq = 0;
+    char chunk[16];
+
+    while (seq < SPSC_STRESS_BYTES) {
+        size_t n = (seq % 13) + 1;
+        if (n > SPSC_STRESS_BYTES - seq) {
+            n = SPSC_STRESS_BYTES - seq;
+        }
+        if (ringbuffer_free_size(&rb) < n) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            chunk[i] = (char)((seq + i) & 0xFF);
+        }
+        ringbuffer_write(&rb, chunk, n);
+        seq += n;
+    }
+
+    return NULL;
+}
+
+void test_spsc_concurrent_stream_in_order(void) {
+    ringbuffer_set_mode(&rb, RINGBUFFER_MODE_SPSC);
+
+    pthread_t producer;
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, spsc_producer, NULL));
+
+    uint32_t expected = 0;
+    uint32_t mismatches = 0;
+    char out[32];
+
+    while (expected < SPSC_STRESS_BYTES) {
+        size_t n = ringbuffer_read(&rb, out, sizeof(out));
+        if (n == 0) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if ((unsigned char)out[i] != ((expected + i) & 0xFF)) {
+                mismatches++;
+            }
+        }
+        expected += n;
+    }
+
+    pthread_join(producer, NULL);
+
+    TEST_ASSERT_EQUAL(0, mismatches);
+    TEST_ASSERT_FALSE(ringbuffer_is_overflow(&rb));
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+}
+
+/*===========================================================================
+ * DMA mode
+ *===========================================================================*/
+
+/* Fake DMA engine: writes straight into ring memory, returns the write position */
+static size_t dma_pos;
+
+static size_t dma_fill(const char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        buf[dma_pos] = data[i];
+        dma_pos = (dma_pos + 1) % TEST_BUF_SIZE;
+    }
+    return dma_pos;
+}
+
+static void dma_setup(void) {
+    dma_pos = 0;
+    ringbuffer_set_mode(&rb, RINGBUFFER_MODE_DMA);
+}
+
+void test_dma_update_publishes_in_place(void) {
+    dma_setup();
+
+    TEST_ASSERT_EQUAL(0, ringbuffer_dma_update(&rb, dma_pos));
+    TEST_ASSERT_EQUAL(5, ringbuffer_dma_update(&rb, dma_fill("HELLO", 5)));
+    TEST_ASSERT_EQUAL(5, ringbuffer_size(&rb));
+
+    /* Data is read in place from DMA memory, not copied */
+    ringbuffer_span_t spans[2];
+    TEST_ASSERT_EQUAL(1, ringbuffer_peek_spans(&rb, 0, 5, spans));
+    TEST_ASSERT_EQUAL_PTR(buf, spans[0].data);
+
+    char out[5];
+    TEST_ASSERT_EQUAL(5, ringbuffer_read(&rb, out, 5));
+    TEST_ASSERT_EQUAL_MEMORY("HELLO", out, 5);
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+}
+
+void test_dma_update_wrap_around(void) {
+    dma_setup();
+
+    char fill[60];
+    memset(fill, 'x', sizeof(fill));
+    ringbuffer_dma_update(&rb, dma_fill(fill, sizeof(fill)));
+    ringbuffer_advance(&rb, sizeof(fill));
+
+    /* Position goes 60 -> 6 across the counter reload: length must still be 10 */
+    TEST_ASSERT_EQUAL(10, ringbuffer_dma_update(&rb, dma_fill("0123456789", 10)));
+
+    char out[10];
+    TEST_ASSERT_EQUAL(10, ringbuffer_read(&rb, out, 10));
+    TEST_ASSERT_EQUAL_MEMORY("0123456789", out, 10);
+}
+
+void test_dma_update_pos_equals_size(void) {
+    dma_setup();
+
+    char fill[TEST_BUF_SIZE - 4];
+    memset(fill, 'y', sizeof(fill));
+    ringbuffer_dma_update(&rb, dma_fill(fill, sizeof(fill)));
+    ringbuffer_advance(&rb, sizeof(fill));
+
+    /* Remaining count 0 just before reload gives dma_pos == size */
+    dma_fill("ABCD", 4);
+    TEST_ASSERT_EQUAL(4, ringbuffer_dma_update(&rb, TEST_BUF_SIZE));
+    TEST_ASSERT_EQUAL(0, ringbuffer_dma_update(&rb, 0));
+
+    char out[4];
+    TEST_ASSERT_EQUAL(4, ringbuffer_read(&rb, out, 4));
+    TEST_ASSERT_EQUAL_MEMORY("ABCD", out, 4);
+}
+
+void test_dma_overrun_resyncs_consumer(void) {
+    dma_setup();
+
+    char data[TEST_BUF_SIZE + 10];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)i;
+    }
+
+    /* Two publishes, each less than one lap, with no reads in between */
+    ringbuffer_dma_update(&rb, dma_fill(data, 40));
+    ringbuffer_dma_update(&rb, dma_fill(data + 40, sizeof(data) - 40));
+
+    TEST_ASSERT_TRUE(ringbuffer_is_overflow(&rb));
+    TEST_ASSERT_EQUAL(sizeof(data) - (TEST_BUF_SIZE - 1), ringbuffer_get_overflow_count(&rb));
+
+    /* Consumer skips overwritten data and sees the newest size-1 bytes */
+    TEST_ASSERT_EQUAL(TEST_BUF_SIZE - 1, ringbuffer_size(&rb));
+
+    char out[TEST_BUF_SIZE - 1];
+    TEST_ASSERT_EQUAL(sizeof(out), ringbuffer_read(&rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_MEMORY(data + sizeof(data) - sizeof(out), out, sizeof(out));
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+}
+
+void test_dma_advance_beyond_available_keeps_head(void) {
+    dma_setup();
+
+    ringbuffer_dma_update(&rb, dma_fill("ABC", 3));
+    TEST_ASSERT_FALSE(ringbuffer_advance(&rb, 10));
+    TEST_ASSERT_TRUE(ringbuffer_is_empty(&rb));
+
+    /* head still tracks the DMA position, so the next publish continues */
+    TEST_ASSERT_EQUAL(2, ringbuffer_dma_update(&rb, dma_fill("DE", 2)));
+
+    char out[2];
+    TEST_ASSERT_EQUAL(2, ringbuffer_read(&rb, out, 2));
+    TEST_ASSERT_EQUAL_MEMORY("DE", out, 2);
+}
+
+/*===========================================================================
+ * Search (find_char / find_any_of / find_seq)
  *===========================================================================*/
 
 void test_find_char_basic(void) {
@@ -273,6 +642,90 @@ void test_find_char_wrap_around(void) {
     TEST_ASSERT_EQUAL(3, pos);
 }
 
+/* Write 'X' * 60, consume it, then write data so it straddles buf[63]/buf[0] */
+static void write_across_wrap(const char *data, size_t len) {
+    char fill[60];
+    memset(fill, 'X', sizeof(fill));
+    ringbuffer_write(&rb, fill, sizeof(fill));
+    ringbuffer_read(&rb, fill, sizeof(fill));
+    ringbuffer_write(&rb, data, len);
+}
+
+void test_find_char_in_second_segment(void) {
+    write_across_wrap("$GPGGA\r\n", 9);
+
+    size_t pos;
+    TEST_ASSERT_TRUE(ringbuffer_find_char(&rb, '\r', 20, &pos));
+    TEST_ASSERT_EQUAL(6, pos);
+    TEST_ASSERT_FALSE(ringbuffer_find_char(&rb, '\r', 6, &pos));
+}
+
+void test_find_any_of_basic(void) {
+    ringbuffer_write(&rb, "GGA,123*4F\r\n", 14);
+
+    size_t pos;
+    TEST_ASSERT_TRUE(ringbuffer_find_any_of(&rb, "*\r", 20, &pos));
+    TEST_ASSERT_EQUAL(7, pos);
+    TEST_ASSERT_TRUE(ringbuffer_find_any_of(&rb, "\n\r", 20, &pos));
+    TEST_ASSERT_EQUAL(10, pos);
+    TEST_ASSERT_FALSE(ringbuffer_find_any_of(&rb, "#!", 20, &pos));
+    TEST_ASSERT_FALSE(ringbuffer_find_any_of(&rb, "", 20, &pos));
+}
+
+void test_find_any_of_high_bytes_wrap(void) {
+    const char data[] = {'a', 'b', 'c', 'd', 'e', (char)0xD3, 'f'};
+    write_across_wrap(data, sizeof(data));
+
+    const char set[] = {(char)0xAA, (char)0xD3, '$', 0};
+    size_t pos;
+    TEST_ASSERT_TRUE(ringbuffer_find_any_of(&rb, set, 20, &pos));
+    TEST_ASSERT_EQUAL(5, pos);
+    TEST_ASSERT_FALSE(ringbuffer_find_any_of(&rb, set, 5, &pos));
+}
+
+void test_find_any_of_earliest_hit_wins(void) {
+    ringbuffer_write(&rb, "ab$cd*ef\r\n", 10);
+
+    /* Set order must not matter: the lowest offset is returned */
+    size_t pos;
+    TEST_ASSERT_TRUE(ringbuffer_find_any_of(&rb, "\n\r*$", 20, &pos));
+    TEST_ASSERT_EQUAL(2, pos);
+
+    /* Larger sets take the bitmap path with the same result */
+    TEST_ASSERT_TRUE(ringbuffer_find_any_of(&rb, "\n\r*#!$", 20, &pos));
+    TEST_ASSERT_EQUAL(2, pos);
+    TEST_ASSERT_TRUE(ringbuffer_find_any_of(&rb, "\n\r*#!", 20, &pos));
+    TEST_ASSERT_EQUAL(5, pos);
+}
+
+void test_find_seq_basic(void) {
+    ringbuffer_write(&rb, "xx$com$command,OK", 17);
+
+    size_t pos;
+    TEST_ASSERT_TRUE(ringbuffer_find_seq(&rb, "$command,", 9, 32, &pos));
+    TEST_ASSERT_EQUAL(6, pos);
+    TEST_ASSERT_FALSE(ringbuffer_find_seq(&rb, "$commands", 9, 32, &pos));
+}
+
+void test_find_seq_must_fit_in_max_search(void) {
+    ringbuffer_write(&rb, "abcdEFG", 7);
+
+    size_t pos;
+    TEST_ASSERT_FALSE(ringbuffer_find_seq(&rb, "EFG", 3, 6, &pos));
+    TEST_ASSERT_TRUE(ringbuffer_find_seq(&rb, "EFG", 3, 7, &pos));
+    TEST_ASSERT_EQUAL(4, pos);
+}
+
+void test_find_seq_across_wrap(void) {
+    const char data[] = {'z', 'z', (char)0xAA, 'D', (char)0xB5, 'q'};
+    write_across_wrap(data, sizeof(data));
+
+    const char sync[] = {(char)0xAA, 'D', (char)0xB5};
+    size_t pos;
+    TEST_ASSERT_TRUE(ringbuffer_find_seq(&rb, sync, 3, 20, &pos));
+    TEST_ASSERT_EQUAL(2, pos);
+}
+
 /*===========================================================================
  * Runner
  *===========================================================================*/
@@ -308,12 +761,45 @@ int main(void) {
     RUN_TEST(test_advance_basic);
     RUN_TEST(test_advance_beyond_available_resets);
 
-    /* ringbuffer_find_char */
+    /* Free-running indices */
+    RUN_TEST(test_index_counter_wraps_size_max);
+    RUN_TEST(test_full_after_many_cycles);
+
+    /* Zero-copy spans */
+    RUN_TEST(test_peek_spans_contiguous);
+    RUN_TEST(test_peek_spans_wrap_around);
+    RUN_TEST(test_peek_spans_insufficient);
+    RUN_TEST(test_consume_basic_and_insufficient);
+    RUN_TEST(test_reserve_commit);
+    RUN_TEST(test_reserve_stops_at_wrap);
+    RUN_TEST(test_reserve_full_returns_zero);
+
+    /* SPSC mode */
+    RUN_TEST(test_spsc_write_drops_excess);
+    RUN_TEST(test_spsc_write_when_full_returns_zero);
+    RUN_TEST(test_spsc_advance_beyond_available_keeps_head);
+    RUN_TEST(test_spsc_concurrent_stream_in_order);
+
+    /* DMA mode */
+    RUN_TEST(test_dma_update_publishes_in_place);
+    RUN_TEST(test_dma_update_wrap_around);
+    RUN_TEST(test_dma_update_pos_equals_size);
+    RUN_TEST(test_dma_overrun_resyncs_consumer);
+    RUN_TEST(test_dma_advance_beyond_available_keeps_head);
+
+    /* Search */
     RUN_TEST(test_find_char_basic);
     RUN_TEST(test_find_char_not_found);
     RUN_TEST(test_find_char_max_search);
     RUN_TEST(test_find_char_first_byte);
     RUN_TEST(test_find_char_wrap_around);
+    RUN_TEST(test_find_char_in_second_segment);
+    RUN_TEST(test_find_any_of_basic);
+    RUN_TEST(test_find_any_of_high_bytes_wrap);
+    RUN_TEST(test_find_any_of_earliest_hit_wins);
+    RUN_TEST(test_find_seq_basic);
+    RUN_TEST(test_find_seq_must_fit_in_max_search);
+    RUN_TEST(test_find_seq_across_wrap);
 
     return UNITY_END();
 }
@@ -0,0 +1,425 @@
+/**
+ * @file test_uart_dma_port.c
+ * @brief Unit tests for lib/utils/src/uart_dma_port.c
+ *
+ * Target: lib/utils/src/uart_dma_port.c (PURE module, peripheral faked by
+ *         test/mock/fake_uart_dma.c)
+ *
+ * Every test runs once per transport in the table below. The buffer sizes
+ * match the board descriptor table, so GPS, LTE, LoRa, BLE, RS485 and
+ * RS232 are all checked through the same code path.
+ *
+ * Tests: zero-copy IDLE publish, HT/TC publish without IDLE, multi-lap
+ *        streaming, overflow event, USART error/overrun, RX DMA error
+ *        restart, stop/start, callback detach while running, external
+ *        ring binding, TX ordering,
+ *        blocking send, baudrate change
+ */
+
+#include "unity.h"
+#include "fake_uart_dma.h"
+#include <string.h>
+
+/*===========================================================================
+ * Transport table
+ *===========================================================================*/
+
+typedef struct {
+    const char *name;
+    size_t rx_size;
+    size_t tx_size;
+    uint32_t baudrate;
+} transport_t;
+
+static const transport_t transports[] = {
+    {"gps", 2048, 2048, 115200},
+    {"lte", 2048, 1024, 115200},
+    {"lora", 1024, 512, 115200},
+    {"ble", 1024, 512, 115200},
+    {"rs485", 512, 512, 9600},
+    {"rs232", 512, 512, 115200},
+};
+
+#define TRANSPORT_COUNT (sizeof(transports) / sizeof(transports[0]))
+#define RX_MAX 2048
+#define TX_MAX 2048
+
+static char rx_mem[RX_MAX];
+static uint8_t tx_mem[TX_MAX];
+static uart_dma_desc_t desc;
+static uart_dma_port_t port;
+static fake_uart_t fake;
+static const transport_t *cur;
+
+/* 이벤트 콜백 기록 */
+static uint32_t evt_bits;
+static int evt_calls;
+
+static void on_event(uart_dma_port_t *p, uint32_t events, void *arg) {
+    TEST_ASSERT_EQUAL_PTR(&port, p);
+    TEST_ASSERT_EQUAL_PTR(&fake, arg);
+    evt_bits |= events;
+    evt_calls++;
+}
+
+static void transport_open(const transport_t *t) {
+    cur = t;
+    memset(rx_mem, 0, sizeof(rx_mem));
+    desc = (uart_dma_desc_t){
+        .name = t->name,
+        .uart = &fake,
+        .baudrate = t->baudrate,
+        .rx_buf = rx_mem,
+        .rx_size = t->rx_size,
+        .tx_buf = tx_mem,
+        .tx_size = t->tx_size,
+        .hw = &fake_uart_hw,
+        .os = &fake_uart_os,
+    };
+
+    uart_dma_port_init(&port, &desc);
+    fake_uart_attach(&fake, &port);
+    uart_dma_port_set_event_cb(&port, on_event, &fake);
+    evt_bits = 0;
+    evt_calls = 0;
+    fake_uart_clock_ms = 1000;
+    uart_dma_port_start(&port);
+}
+
+#define FOR_EACH_TRANSPORT(t)                                                          \
+    for (const transport_t *t = transports; t < transports + TRANSPORT_COUNT; t++)      \
+        if (transport_open(t), 1)
+
+static void fill(char *buf, size_t len, uint32_t seed) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (char)((seed + i) * 31u + (i >> 8));
+    }
+}
+
+/* 링에서 모두 꺼냄 (peek_spans + consume, 복사는 검증용) */
+static size_t drain_rx(char *out, size_t cap) {
+    ringbuffer_t *rb = uart_dma_port_rx(&port);
+    ringbuffer_span_t spans[2];
+    size_t n = ringbuffer_size(rb);
+    size_t cnt = ringbuffer_peek_spans(rb, 0, n, spans);
+    size_t off = 0;
+
+    for (size_t i = 0; i < cnt; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(off + spans[i].len <= cap, cur->name);
+        memcpy(&out[off], spans[i].data, spans[i].len);
+        off += spans[i].len;
+    }
+    ringbuffer_consume(rb, off);
+    return off;
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*===========================================================================
+ * RX
+ *===========================================================================*/
+
+void test_idle_publishes_dma_position_without_copy(void) {
+    FOR_EACH_TRANSPORT(t) {
+        /* HT 문턱 아래의 짧은 프레임 */
+        fake_uart_receive(&fake, "$GNGGA,1*00\r\n", 13);
+        TEST_ASSERT_EQUAL_MESSAGE(0, ringbuffer_size(uart_dma_port_rx(&port)), t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, evt_calls, t->name);
+
+        fake_uart_idle(&fake);
+
+        ringbuffer_t *rb = uart_dma_port_rx(&port);
+        ringbuffer_span_t spans[2];
+        TEST_ASSERT_EQUAL_MESSAGE(13, ringbuffer_size(rb), t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(1, ringbuffer_peek_spans(rb, 0, 13, spans), t->name);
+        /* 링 메모리 = DMA 수신 버퍼 */
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(rx_mem, spans[0].data, t->name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(UART_DMA_EVT_RX, evt_bits, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(13, uart_dma_port_rx_pos(&port), t->name);
+
+        /* 새 데이터 없는 IDLE은 알리지 않음 */
+        fake_uart_idle(&fake);
+        TEST_ASSERT_EQUAL_MESSAGE(1, evt_calls, t->name);
+    }
+}
+
+void test_half_and_full_transfer_publish_without_idle(void) {
+    FOR_EACH_TRANSPORT(t) {
+        char data[RX_MAX];
+        fill(data, t->rx_size, 1);
+
+        fake_uart_receive(&fake, data, t->rx_size / 2);
+        TEST_ASSERT_EQUAL_MESSAGE(t->rx_size / 2, ringbuffer_size(uart_dma_port_rx(&port)),
+                                  t->name);
+
+        char out[RX_MAX];
+        TEST_ASSERT_EQUAL_MESSAGE(t->rx_size / 2, drain_rx(out, sizeof(out)), t->name);
+
+        /* TC: 위치가 버퍼 끝(0으로 랩)에 도달 */
+        fake_uart_receive(&fake, &data[t->rx_size / 2], t->rx_size / 2);
+        TEST_ASSERT_EQUAL_MESSAGE(t->rx_size / 2,
+                                  drain_rx(&out[t->rx_size / 2], sizeof(out) - t->rx_size / 2),
+                                  t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, out, t->rx_size, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(2, port.rx_events, t->name);
+    }
+}
+
+void test_streaming_over_many_laps_keeps_content(void) {
+    FOR_EACH_TRANSPORT(t) {
+        static char data[RX_MAX * 6];
+        static char out[RX_MAX * 6];
+        size_t total = t->rx_size * 5 + 77;
+        size_t got = 0;
+        size_t off = 0;
+        size_t chunk = 1;
+
+        fill(data, total, 7);
+
+        /* 프레임 크기를 바꿔가며 수신, 매 프레임 IDLE 후 소비 */
+        while (off < total) {
+            size_t n = chunk;
+            if (n > total - off) {
+                n = total - off;
+            }
+            fake_uart_receive(&fake, &data[off], n);
+            fake_uart_idle(&fake);
+            off += n;
+            got += drain_rx(&out[got], sizeof(out) - got);
+            chunk = (chunk * 7 + 13) % (t->rx_size / 3) + 1;
+        }
+
+        TEST_ASSERT_EQUAL_MESSAGE(total, got, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, out, total, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, uart_dma_port_rx(&port)->overflow_cnt, t->name);
+        TEST_ASSERT_FALSE_MESSAGE(evt_bits & UART_DMA_EVT_OVERFLOW, t->name);
+    }
+}
+
+void test_lagging_consumer_gets_overflow_event(void) {
+    FOR_EACH_TRANSPORT(t) {
+        char data[RX_MAX];
+        fill(data, t->rx_size, 3);
+
+        /* 소비 없이 한 바퀴 반: DMA가 읽지 않은 데이터를 덮어씀 */
+        fake_uart_receive(&fake, data, t->rx_size);
+        fake_uart_receive(&fake, data, t->rx_size / 2);
+
+        TEST_ASSERT_TRUE_MESSAGE(evt_bits & UART_DMA_EVT_OVERFLOW, t->name);
+        TEST_ASSERT_TRUE_MESSAGE(ringbuffer_is_overflow(uart_dma_port_rx(&port)), t->name);
+
+        /* 같은 유실은 한 번만 알림 */
+        evt_bits = 0;
+        fake_uart_idle(&fake);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, evt_bits, t->name);
+    }
+}
+
+void test_usart_errors_are_reported_and_reception_continues(void) {
+    FOR_EACH_TRANSPORT(t) {
+        fake_uart_receive(&fake, "abc", 3);
+        fake_uart_error(&fake, UART_DMA_ERR_OVERRUN);
+
+        /* 오류 전 데이터는 공개됨 */
+        TEST_ASSERT_EQUAL_MESSAGE(3, ringbuffer_size(uart_dma_port_rx(&port)), t->name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(UART_DMA_EVT_RX | UART_DMA_EVT_OVERFLOW, evt_bits,
+                                         t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(1, port.overruns, t->name);
+
+        evt_bits = 0;
+        fake_uart_error(&fake, UART_DMA_ERR_FRAMING | UART_DMA_ERR_NOISE);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(UART_DMA_EVT_ERROR, evt_bits, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(1, port.errors, t->name);
+
+        /* USART 오류는 DMA를 멈추지 않음 */
+        TEST_ASSERT_EQUAL_MESSAGE(1, fake.rx_starts, t->name);
+        fake_uart_receive(&fake, "def", 3);
+        fake_uart_idle(&fake);
+
+        char out[8];
+        TEST_ASSERT_EQUAL_MESSAGE(6, drain_rx(out, sizeof(out)), t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE("abcdef", out, 6, t->name);
+    }
+}
+
+void test_rx_dma_error_restarts_at_ring_position(void) {
+    FOR_EACH_TRANSPORT(t) {
+        char data[RX_MAX];
+        char out[RX_MAX * 2];
+        size_t pre = t->rx_size - 10;
+        size_t got;
+
+        fill(data, t->rx_size, 9);
+
+        fake_uart_receive(&fake, data, pre);
+
+        /* 오류 시점까지 받은 데이터는 공개됨 */
+        fake_uart_error(&fake, UART_DMA_ERR_RX_DMA);
+        TEST_ASSERT_TRUE_MESSAGE(evt_bits & UART_DMA_EVT_ERROR, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(2, fake.rx_starts, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(pre, uart_dma_port_rx_pos(&port), t->name);
+        got = drain_rx(out, sizeof(out));
+        TEST_ASSERT_EQUAL_MESSAGE(pre, got, t->name);
+
+        /* 재시작 후 버퍼 끝을 넘어 랩해도 링 위치가 이어짐 */
+        fake_uart_receive(&fake, data, t->rx_size / 2);
+        fake_uart_idle(&fake);
+        got += drain_rx(&out[got], sizeof(out) - got);
+        fake_uart_receive(&fake, &data[t->rx_size / 2], t->rx_size / 2);
+        fake_uart_idle(&fake);
+        got += drain_rx(&out[got], sizeof(out) - got);
+
+        TEST_ASSERT_EQUAL_MESSAGE(pre + t->rx_size, got, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, out, pre, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, &out[pre], t->rx_size, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, fake.rx_dropped, t->name);
+    }
+}
+
+void test_stop_discards_and_start_receives_from_buffer_start(void) {
+    FOR_EACH_TRANSPORT(t) {
+        fake_uart_receive(&fake, "stale", 5);
+        fake_uart_idle(&fake);
+
+        uart_dma_port_stop(&port);
+        TEST_ASSERT_FALSE_MESSAGE(fake.enabled, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, ringbuffer_size(uart_dma_port_rx(&port)), t->name);
+
+        /* 정지 중 수신은 버려짐 */
+        fake_uart_receive(&fake, "lost", 4);
+        TEST_ASSERT_EQUAL_MESSAGE(4, fake.rx_dropped, t->name);
+
+        uart_dma_port_start(&port);
+        fake_uart_receive(&fake, "fresh", 5);
+        fake_uart_idle(&fake);
+
+        ringbuffer_span_t spans[2];
+        TEST_ASSERT_EQUAL_MESSAGE(1, ringbuffer_peek_spans(uart_dma_port_rx(&port), 0, 5, spans),
+                                  t->name);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(rx_mem, spans[0].data, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE("fresh", spans[0].data, 5, t->name);
+    }
+}
+
+void test_detach_while_running_stops_events(void) {
+    FOR_EACH_TRANSPORT(t) {
+        uart_dma_port_set_event_cb(&port, NULL, NULL);
+
+        fake_uart_receive(&fake, "quiet", 5);
+        fake_uart_idle(&fake);
+
+        TEST_ASSERT_EQUAL_MESSAGE(0, evt_calls, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(5, ringbuffer_size(uart_dma_port_rx(&port)), t->name);
+    }
+}
+
+void test_bind_rx_uses_external_ring(void) {
+    FOR_EACH_TRANSPORT(t) {
+        ringbuffer_t ext;
+
+        uart_dma_port_stop(&port);
+        uart_dma_port_bind_rx(&port, &ext);
+        uart_dma_port_start(&port);
+
+        fake_uart_receive(&fake, "bound", 5);
+        fake_uart_idle(&fake);
+
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&ext, uart_dma_port_rx(&port), t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(5, ringbuffer_size(&ext), t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, ringbuffer_size(&port.rx_ring), t->name);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(rx_mem, ext.buffer, t->name);
+    }
+}
+
+/*===========================================================================
+ * TX
+ *===========================================================================*/
+
+void test_writes_are_queued_and_sent_in_order(void) {
+    FOR_EACH_TRANSPORT(t) {
+        TEST_ASSERT_EQUAL_MESSAGE(4, uart_dma_port_write(&port, "AT\r\n", 4, 0), t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(6, uart_dma_port_write(&port, "ATE0\r\n", 6, 0), t->name);
+
+        /* 첫 전송 진행 중, 두 번째는 큐에서 대기 */
+        TEST_ASSERT_EQUAL_MESSAGE(1, fake.tx_starts, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, fake.wire_len, t->name);
+
+        fake_uart_tx_drain(&fake);
+        TEST_ASSERT_EQUAL_MESSAGE(10, fake.wire_len, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE("AT\r\nATE0\r\n", fake.wire, 10, t->name);
+    }
+}
+
+void test_burst_larger_than_queue_is_sent_completely(void) {
+    FOR_EACH_TRANSPORT(t) {
+        static char data[TX_MAX * 3];
+        size_t len = t->tx_size * 3 - 5;
+
+        fill(data, len, 11);
+        TEST_ASSERT_EQUAL_MESSAGE(len, uart_dma_port_write(&port, data, len, 1000), t->name);
+        fake_uart_tx_drain(&fake);
+
+        TEST_ASSERT_EQUAL_MESSAGE(len, fake.wire_len, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, fake.wire, len, t->name);
+    }
+}
+
+void test_write_sync_returns_after_transmission(void) {
+    FOR_EACH_TRANSPORT(t) {
+        uart_dma_port_write(&port, "first,", 6, 0);
+
+        TEST_ASSERT_TRUE_MESSAGE(uart_dma_port_write_sync(&port, "second", 6, 100), t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(12, fake.wire_len, t->name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE("first,second", fake.wire, 12, t->name);
+        TEST_ASSERT_FALSE_MESSAGE(uart_tx_is_busy(&port.tx), t->name);
+    }
+}
+
+void test_set_baudrate_flushes_queue_first(void) {
+    FOR_EACH_TRANSPORT(t) {
+        uart_dma_port_write(&port, "CONFIG COM1 921600\r\n", 20, 0);
+
+        TEST_ASSERT_TRUE_MESSAGE(uart_dma_port_set_baudrate(&port, 921600, 100), t->name);
+        /* 명령이 이전 보드레이트로 다 나간 뒤 변경 */
+        TEST_ASSERT_EQUAL_MESSAGE(20, fake.wire_len, t->name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(921600, fake.baudrate, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(1, fake.baud_changes, t->name);
+    }
+}
+
+void test_set_baudrate_fails_when_tx_stalls(void) {
+    FOR_EACH_TRANSPORT(t) {
+        fake.tx_stalled = true;
+        uart_dma_port_write(&port, "stuck", 5, 0);
+
+        TEST_ASSERT_FALSE_MESSAGE(uart_dma_port_set_baudrate(&port, 460800, 30), t->name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(t->baudrate, fake.baudrate, t->name);
+        TEST_ASSERT_EQUAL_MESSAGE(0, fake.baud_changes, t->name);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_idle_publishes_dma_position_without_copy);
+    RUN_TEST(test_half_and_full_transfer_publish_without_idle);
+    RUN_TEST(test_streaming_over_many_laps_keeps_content);
+    RUN_TEST(test_lagging_consumer_gets_overflow_event);
+    RUN_TEST(test_usart_errors_are_reported_and_reception_continues);
+    RUN_TEST(test_rx_dma_error_restarts_at_ring_position);
+    RUN_TEST(test_stop_discards_and_start_receives_from_buffer_start);
+    RUN_TEST(test_detach_while_running_stops_events);
+    RUN_TEST(test_bind_rx_uses_external_ring);
+
+    RUN_TEST(test_writes_are_queued_and_sent_in_order);
+    RUN_TEST(test_burst_larger_than_queue_is_sent_completely);
+    RUN_TEST(test_write_sync_returns_after_transmission);
+    RUN_TEST(test_set_baudrate_flushes_queue_first);
+    RUN_TEST(test_set_baudrate_fails_when_tx_stalls);
+
+    return UNITY_END();
+}
@@ -0,0 +1,323 @@
+/**
+ * @file test_uart_tx.c
+ * @brief Unit tests for lib/utils/src/uart_tx.c
+ *
+ * Target: lib/utils/src/uart_tx.c (PURE module, platform hooks faked here)
+ *
+ * The fake DMA/UART holds one transfer in flight. It completes either when a
+ * test calls fake_complete() or when the engine waits: a wait first completes
+ * the pending transfer, as if its TC interrupt fired, and otherwise lets the
+ * fake clock run out. Each byte sent goes to a wire buffer, so tests check
+ * ordering. Each start records whether it happened inside the completion
+ * ISR, which is the back-to-back case.
+ *
+ * Tests: fire-and-forget, ordering, back-to-back chaining, blocking send
+ *        with timeout, queue full, bursts larger than the queue, start
+ *        failure, flush, reset
+ */
+
+#include "unity.h"
+#include "uart_tx.h"
+#include <string.h>
+
+#define Q_SIZE 64
+
+static uart_tx_t tx;
+static uint8_t q_mem[Q_SIZE];
+
+/*===========================================================================
+ * Fake DMA + UART
+ *===========================================================================*/
+
+static uint8_t wire[4096];
+static size_t wire_len;
+
+static const uint8_t *dma_data;
+static size_t dma_len;
+static bool dma_active;
+static bool dma_stalled; /* 전송이 끝나지 않음 (UART 멈춤) */
+static bool start_fail;
+static bool in_isr;
+
+static int starts;
+static int starts_in_isr;
+static int notifies;
+static int lock_depth;
+static uint32_t clock_ms;
+
+static bool fake_start(void *ctx, const uint8_t *data, size_t len) {
+    (void)ctx;
+    TEST_ASSERT_FALSE_MESSAGE(dma_active, "second transfer started while one is in flight");
+
+    if (start_fail) {
+        return false;
+    }
+
+    starts++;
+    if (in_isr) {
+        starts_in_isr++;
+    }
+    dma_data = data;
+    dma_len = len;
+    dma_active = true;
+    return true;
+}
+
+/* 진행 중 전송 완료 (DMA TC ISR) */
+static bool fake_complete(void) {
+    if (!dma_active || dma_stalled) {
+        return false;
+    }
+
+    memcpy(&wire[wire_len], dma_data, dma_len);
+    wire_len += dma_len;
+    dma_active = false;
+
+    in_isr = true;
+    uart_tx_dma_done(&tx);
+    in_isr = false;
+    return true;
+}
+
+static void fake_lock(void *ctx) {
+    (void)ctx;
+    lock_depth++;
+}
+
+static void fake_unlock(void *ctx) {
+    (void)ctx;
+    lock_depth--;
+}
+
+/* 대기 중 ISR 발생: 진행 중 전송이 있으면 완료, 없으면 시간만 흐름 */
+static bool fake_wait(void *ctx, uint32_t timeout_ms) {
+    (void)ctx;
+    clock_ms += 1;
+    if (fake_complete()) {
+        return true;
+    }
+    clock_ms += timeout_ms;
+    return false;
+}
+
+static void fake_notify(void *ctx) {
+    (void)ctx;
+    notifies++;
+}
+
+static uint32_t fake_now(void *ctx) {
+    (void)ctx;
+    return clock_ms;
+}
+
+static const uart_tx_ops_t fake_ops = {
+    .start = fake_start,
+    .lock = fake_lock,
+    .unlock = fake_unlock,
+    .wait = fake_wait,
+    .notify = fake_notify,
+    .now_ms = fake_now,
+};
+
+static void drain(void) {
+    while (fake_complete()) {
+    }
+}
+
+static void fill(uint8_t *buf, size_t len, uint8_t seed) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(seed + i * 7);
+    }
+}
+
+void setUp(void) {
+    wire_len = 0;
+    dma_active = false;
+    dma_stalled = false;
+    start_fail = false;
+    in_isr = false;
+    starts = 0;
+    starts_in_isr = 0;
+    notifies = 0;
+    lock_depth = 0;
+    clock_ms = 1000;
+    uart_tx_init(&tx, q_mem, sizeof(q_mem), &fake_ops, NULL);
+}
+
+void tearDown(void) {
+    TEST_ASSERT_EQUAL_MESSAGE(0, lock_depth, "lock not released");
+}
+
+/*===========================================================================
+ * Fire-and-forget
+ *===========================================================================*/
+
+void test_write_starts_dma_and_returns_before_completion(void) {
+    TEST_ASSERT_EQUAL(5, uart_tx_write(&tx, "hello", 5, 0));
+
+    TEST_ASSERT_EQUAL(1, starts);
+    TEST_ASSERT_TRUE(dma_active);
+    TEST_ASSERT_EQUAL(0, wire_len);
+    TEST_ASSERT_TRUE(uart_tx_is_busy(&tx));
+    TEST_ASSERT_EQUAL(1000, clock_ms);
+
+    drain();
+    TEST_ASSERT_EQUAL_MEMORY("hello", wire, 5);
+    TEST_ASSERT_FALSE(uart_tx_is_busy(&tx));
+    TEST_ASSERT_EQUAL(1, notifies);
+}
+
+void test_queued_writes_go_out_in_order_back_to_back(void) {
+    uart_tx_write(&tx, "AAAA", 4, 0);
+    uart_tx_write(&tx, "BBB", 3, 0);
+    uart_tx_write(&tx, "CC", 2, 0);
+
+    /* 첫 블록 전송 중 나머지는 큐에서 대기 */
+    TEST_ASSERT_EQUAL(1, starts);
+
+    drain();
+
+    TEST_ASSERT_EQUAL(9, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY("AAAABBBCC", wire, 9);
+    /* 두 번째 전송은 첫 완료 ISR 안에서 바로 시작 (공백 없음) */
+    TEST_ASSERT_EQUAL(2, starts);
+    TEST_ASSERT_EQUAL(1, starts_in_isr);
+}
+
+void test_write_into_full_queue_without_timeout_drops_rest(void) {
+    uint8_t data[Q_SIZE * 2];
+    fill(data, sizeof(data), 1);
+    dma_stalled = true;
+
+    size_t n = uart_tx_write(&tx, data, sizeof(data), 0);
+
+    TEST_ASSERT_TRUE(n > 0);
+    TEST_ASSERT_TRUE(n < sizeof(data));
+    TEST_ASSERT_EQUAL(sizeof(data) - n, tx.dropped);
+    TEST_ASSERT_EQUAL(1000, clock_ms);
+
+    dma_stalled = false;
+    drain();
+    TEST_ASSERT_EQUAL(n, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, wire, n);
+}
+
+void test_burst_larger_than_queue_waits_for_space(void) {
+    /* 1 KB RTCM 버스트 (큐 64바이트) */
+    uint8_t data[1024];
+    fill(data, sizeof(data), 3);
+
+    TEST_ASSERT_EQUAL(sizeof(data), uart_tx_write(&tx, data, sizeof(data), 1000));
+    drain();
+
+    TEST_ASSERT_EQUAL(sizeof(data), wire_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, wire, sizeof(data));
+    TEST_ASSERT_EQUAL(0, tx.dropped);
+}
+
+void test_wrapped_queue_keeps_order(void) {
+    uint8_t data[300];
+    fill(data, sizeof(data), 5);
+
+    /* 완료 시점을 어긋나게 해 bip-buffer 랩이 여러 번 생기도록 */
+    size_t off = 0;
+    size_t sizes[] = {20, 13, 31, 7, 29, 17, 23, 11, 30, 19, 25, 9, 27, 39};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        TEST_ASSERT_EQUAL(sizes[i], uart_tx_write(&tx, &data[off], sizes[i], 100));
+        off += sizes[i];
+        if (i % 3 == 0) {
+            fake_complete();
+        }
+    }
+    drain();
+
+    TEST_ASSERT_EQUAL(off, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, wire, off);
+}
+
+/*===========================================================================
+ * Blocking
+ *===========================================================================*/
+
+void test_write_sync_returns_after_transmission(void) {
+    TEST_ASSERT_TRUE(uart_tx_write_sync(&tx, "CONFIG\r\n", 8, 100));
+
+    TEST_ASSERT_EQUAL(8, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY("CONFIG\r\n", wire, 8);
+    TEST_ASSERT_FALSE(uart_tx_is_busy(&tx));
+}
+
+void test_write_sync_waits_for_earlier_data_too(void) {
+    uart_tx_write(&tx, "first,", 6, 0);
+
+    TEST_ASSERT_TRUE(uart_tx_write_sync(&tx, "second", 6, 100));
+    TEST_ASSERT_EQUAL(12, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY("first,second", wire, 12);
+}
+
+void test_write_sync_times_out_when_uart_stalls(void) {
+    dma_stalled = true;
+
+    TEST_ASSERT_FALSE(uart_tx_write_sync(&tx, "stuck", 5, 50));
+    TEST_ASSERT_TRUE(clock_ms - 1000 >= 50);
+    TEST_ASSERT_TRUE(clock_ms - 1000 < 50 + 20);
+}
+
+void test_start_failure_fails_write_sync_without_hanging(void) {
+    start_fail = true;
+
+    TEST_ASSERT_FALSE(uart_tx_write_sync(&tx, "lost", 4, 100));
+    TEST_ASSERT_EQUAL(1, tx.start_errors);
+    TEST_ASSERT_FALSE(uart_tx_is_busy(&tx));
+
+    /* 이후 전송은 정상 */
+    start_fail = false;
+    TEST_ASSERT_TRUE(uart_tx_write_sync(&tx, "ok", 2, 100));
+    TEST_ASSERT_EQUAL_MEMORY("ok", wire, 2);
+}
+
+void test_flush_waits_for_all_queued_data(void) {
+    uart_tx_write(&tx, "abc", 3, 0);
+    uart_tx_write(&tx, "def", 3, 0);
+
+    TEST_ASSERT_TRUE(uart_tx_flush(&tx, 100));
+    TEST_ASSERT_EQUAL(6, wire_len);
+
+    dma_stalled = true;
+    uart_tx_write(&tx, "g", 1, 0);
+    TEST_ASSERT_FALSE(uart_tx_flush(&tx, 30));
+}
+
+void test_reset_discards_queue_and_allows_restart(void) {
+    dma_stalled = true;
+    uart_tx_write(&tx, "discard me", 10, 0);
+
+    /* 포트 정지: DMA 중지 후 리셋 */
+    dma_active = false;
+    uart_tx_reset(&tx);
+    TEST_ASSERT_FALSE(uart_tx_is_busy(&tx));
+
+    dma_stalled = false;
+    TEST_ASSERT_TRUE(uart_tx_write_sync(&tx, "fresh", 5, 100));
+    TEST_ASSERT_EQUAL(5, wire_len);
+    TEST_ASSERT_EQUAL_MEMORY("fresh", wire, 5);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_write_starts_dma_and_returns_before_completion);
+    RUN_TEST(test_queued_writes_go_out_in_order_back_to_back);
+    RUN_TEST(test_write_into_full_queue_without_timeout_drops_rest);
+    RUN_TEST(test_burst_larger_than_queue_waits_for_space);
+    RUN_TEST(test_wrapped_queue_keeps_order);
+
+    RUN_TEST(test_write_sync_returns_after_transmission);
+    RUN_TEST(test_write_sync_waits_for_earlier_data_too);
+    RUN_TEST(test_write_sync_times_out_when_uart_stalls);
+    RUN_TEST(test_start_failure_fails_write_sync_without_hanging);
+    RUN_TEST(test_flush_waits_for_all_queued_data);
+    RUN_TEST(test_reset_discards_queue_and_allows_restart);
+
+    return UNITY_END();
+}